@@ -0,0 +1,552 @@
+#include "bvh.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#define BVH_BINS 12
+#define BVH_LEAF_SIZE 4
+//Leaves may grow to this when splitting would cost more than it saves
+#define BVH_MAX_LEAF_SIZE 8
+//Subtrees whose surface area grew by this factor are rebuilt on refit
+#define BVH_REBUILD_GROWTH 1.5f
+#define BVH_STACK_SIZE 64
+
+static float
+surface_area(const float* min, const float* max) {
+	float dx = max[0] - min[0];
+	float dy = max[1] - min[1];
+	float dz = max[2] - min[2];
+	if (dx < 0 || dy < 0 || dz < 0) return 0.0f;
+	return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+static void
+bounds_reset(float* min, float* max) {
+	for (int axis = 0; axis < 3; axis++) {
+		min[axis] = FLT_MAX;
+		max[axis] = -FLT_MAX;
+	}
+}
+
+static void
+bounds_grow(float* min, float* max, const float* other_min, const float* other_max) {
+	for (int axis = 0; axis < 3; axis++) {
+		if (other_min[axis] < min[axis]) min[axis] = other_min[axis];
+		if (other_max[axis] > max[axis]) max[axis] = other_max[axis];
+	}
+}
+
+static const float*
+object_min(const struct Bvh* bvh, uint32_t object) {
+	return &bvh->boxes[object * 6];
+}
+
+static const float*
+object_max(const struct Bvh* bvh, uint32_t object) {
+	return &bvh->boxes[object * 6 + 3];
+}
+
+static float
+object_centroid(const struct Bvh* bvh, uint32_t object, int axis) {
+	return 0.5f * (object_min(bvh, object)[axis] + object_max(bvh, object)[axis]);
+}
+
+static uint32_t
+allocate_node(struct Bvh* bvh) {
+	if (bvh->free_list != BVH_NULL) {
+		uint32_t node = bvh->free_list;
+		bvh->free_list = bvh->nodes[node].left;
+		return node;
+	}
+
+	if (bvh->node_count == bvh->node_capacity) {
+		uint32_t capacity = bvh->node_capacity ? bvh->node_capacity * 2 : 64;
+		struct BvhNode* nodes = realloc(bvh->nodes, (size_t) capacity * sizeof(*nodes));
+		if (nodes == NULL) return BVH_NULL;
+		bvh->nodes = nodes;
+		bvh->node_capacity = capacity;
+	}
+	return bvh->node_count++;
+}
+
+static void
+release_children(struct Bvh* bvh, uint32_t node) {
+	uint32_t children[2] = {bvh->nodes[node].left, bvh->nodes[node].right};
+	if (children[0] == BVH_NULL) {
+		return;
+	}
+
+	for (int i = 0; i < 2; i++) {
+		release_children(bvh, children[i]);
+		bvh->nodes[children[i]].left = bvh->free_list;
+		bvh->free_list = children[i];
+	}
+	bvh->nodes[node].left = BVH_NULL;
+	bvh->nodes[node].right = BVH_NULL;
+}
+
+struct Bin {
+	float min[3];
+	float max[3];
+	uint32_t count;
+};
+
+//Best binned SAH split of the node's range, returns 0 if it should stay a leaf
+static int
+find_split(const struct Bvh* bvh, const struct BvhNode* node, int* split_axis, float* split_position) {
+	float centroid_min[3], centroid_max[3];
+	bounds_reset(centroid_min, centroid_max);
+	for (uint32_t i = node->first; i < node->first + node->count; i++) {
+		float centroid[3];
+		for (int axis = 0; axis < 3; axis++) {
+			centroid[axis] = object_centroid(bvh, bvh->objects[i], axis);
+		}
+		bounds_grow(centroid_min, centroid_max, centroid, centroid);
+	}
+
+	float best_cost = FLT_MAX;
+	for (int axis = 0; axis < 3; axis++) {
+		float extent = centroid_max[axis] - centroid_min[axis];
+		if (extent <= 0.0f) continue;
+
+		struct Bin bins[BVH_BINS];
+		for (int b = 0; b < BVH_BINS; b++) {
+			bounds_reset(bins[b].min, bins[b].max);
+			bins[b].count = 0;
+		}
+
+		float scale = BVH_BINS / extent;
+		for (uint32_t i = node->first; i < node->first + node->count; i++) {
+			uint32_t object = bvh->objects[i];
+			int b = (int) ((object_centroid(bvh, object, axis) - centroid_min[axis]) * scale);
+			if (b >= BVH_BINS) b = BVH_BINS - 1;
+			bins[b].count++;
+			bounds_grow(bins[b].min, bins[b].max, object_min(bvh, object), object_max(bvh, object));
+		}
+
+		//Sweep from the right to get every suffix, then from the left
+		float right_area[BVH_BINS];
+		uint32_t right_count[BVH_BINS];
+		float min[3], max[3];
+		bounds_reset(min, max);
+		uint32_t count = 0;
+		for (int b = BVH_BINS - 1; b > 0; b--) {
+			bounds_grow(min, max, bins[b].min, bins[b].max);
+			count += bins[b].count;
+			right_area[b] = surface_area(min, max);
+			right_count[b] = count;
+		}
+
+		bounds_reset(min, max);
+		count = 0;
+		for (int b = 0; b < BVH_BINS - 1; b++) {
+			bounds_grow(min, max, bins[b].min, bins[b].max);
+			count += bins[b].count;
+			if (count == 0 || right_count[b + 1] == 0) continue;
+
+			float cost = surface_area(min, max) * count + right_area[b + 1] * right_count[b + 1];
+			if (cost < best_cost) {
+				best_cost = cost;
+				*split_axis = axis;
+				*split_position = centroid_min[axis] + (b + 1) / scale;
+			}
+		}
+	}
+
+	if (best_cost == FLT_MAX) {
+		//All centroids coincide, split by count if the leaf is too big
+		if (node->count <= BVH_MAX_LEAF_SIZE) return 0;
+		*split_axis = -1;
+		return 1;
+	}
+
+	float leaf_cost = surface_area(node->min, node->max) * node->count;
+	return best_cost < leaf_cost || node->count > BVH_MAX_LEAF_SIZE;
+}
+
+static int
+build_node(struct Bvh* bvh, uint32_t node_index, uint32_t first, uint32_t count) {
+	struct BvhNode* node = &bvh->nodes[node_index];
+	node->first = first;
+	node->count = count;
+	node->left = BVH_NULL;
+	node->right = BVH_NULL;
+
+	bounds_reset(node->min, node->max);
+	for (uint32_t i = first; i < first + count; i++) {
+		uint32_t object = bvh->objects[i];
+		bounds_grow(node->min, node->max, object_min(bvh, object), object_max(bvh, object));
+	}
+	node->built_area = surface_area(node->min, node->max);
+
+	int axis = 0;
+	float position = 0.0f;
+	if (count <= BVH_LEAF_SIZE || !find_split(bvh, node, &axis, &position)) {
+		return 1;
+	}
+
+	uint32_t middle = first + count / 2;
+	if (axis >= 0) {
+		uint32_t i = first;
+		uint32_t j = first + count;
+		while (i < j) {
+			if (object_centroid(bvh, bvh->objects[i], axis) < position) {
+				i++;
+			} else {
+				j--;
+				uint32_t swap = bvh->objects[i];
+				bvh->objects[i] = bvh->objects[j];
+				bvh->objects[j] = swap;
+			}
+		}
+		if (i != first && i != first + count) {
+			middle = i;
+		}
+	}
+
+	uint32_t left = allocate_node(bvh);
+	uint32_t right = allocate_node(bvh);
+	if (left == BVH_NULL || right == BVH_NULL) {
+		return 0;
+	}
+
+	//allocate_node may have moved the array
+	bvh->nodes[node_index].left = left;
+	bvh->nodes[node_index].right = right;
+	return build_node(bvh, left, first, middle - first) &&
+		build_node(bvh, right, middle, first + count - middle);
+}
+
+int
+bvh_build(struct Bvh* bvh, const float* mins, const float* maxs, uint32_t count) {
+	bvh_free(bvh);
+
+	bvh->objects = malloc((size_t) (count ? count : 1) * sizeof(uint32_t));
+	bvh->boxes = malloc((size_t) (count ? count : 1) * 6 * sizeof(float));
+	if (bvh->objects == NULL || bvh->boxes == NULL) {
+		bvh_free(bvh);
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		bvh->objects[i] = i;
+		memcpy(&bvh->boxes[i * 6], &mins[i * 3], 3 * sizeof(float));
+		memcpy(&bvh->boxes[i * 6 + 3], &maxs[i * 3], 3 * sizeof(float));
+	}
+	bvh->object_count = count;
+
+	bvh->root = allocate_node(bvh);
+	if (bvh->root == BVH_NULL || !build_node(bvh, bvh->root, 0, count)) {
+		bvh_free(bvh);
+		return 0;
+	}
+	return 1;
+}
+
+void
+bvh_free(struct Bvh* bvh) {
+	free(bvh->nodes);
+	free(bvh->objects);
+	free(bvh->boxes);
+	*bvh = (struct Bvh) {.free_list = BVH_NULL, .root = BVH_NULL};
+}
+
+void
+bvh_update_object(struct Bvh* bvh, uint32_t object, Vector3 min, Vector3 max) {
+	memcpy(&bvh->boxes[object * 6], min.e, 3 * sizeof(float));
+	memcpy(&bvh->boxes[object * 6 + 3], max.e, 3 * sizeof(float));
+}
+
+static void
+refit_node(struct Bvh* bvh, uint32_t node_index) {
+	struct BvhNode* node = &bvh->nodes[node_index];
+	bounds_reset(node->min, node->max);
+
+	if (node->left == BVH_NULL) {
+		for (uint32_t i = node->first; i < node->first + node->count; i++) {
+			uint32_t object = bvh->objects[i];
+			bounds_grow(node->min, node->max, object_min(bvh, object), object_max(bvh, object));
+		}
+		return;
+	}
+
+	refit_node(bvh, node->left);
+	refit_node(bvh, node->right);
+	bounds_grow(node->min, node->max, bvh->nodes[node->left].min, bvh->nodes[node->left].max);
+	bounds_grow(node->min, node->max, bvh->nodes[node->right].min, bvh->nodes[node->right].max);
+}
+
+struct RebuildCandidate {
+	uint32_t node;
+	float growth;
+};
+
+//Topmost degraded internal nodes, their subtrees are rebuilt as a whole
+static void
+collect_degraded(const struct Bvh* bvh, uint32_t node_index, struct RebuildCandidate* candidates,
+		int* count, int capacity) {
+
+	const struct BvhNode* node = &bvh->nodes[node_index];
+	if (node->left == BVH_NULL) {
+		return;
+	}
+
+	float area = surface_area(node->min, node->max);
+	float growth = node->built_area > 0.0f ? area / node->built_area : (area > 0.0f ? FLT_MAX : 1.0f);
+	if (growth > BVH_REBUILD_GROWTH) {
+		if (*count < capacity) {
+			candidates[(*count)++] = (struct RebuildCandidate) {node_index, growth};
+		} else {
+			//Replace the mildest one if this is worse
+			int mildest = 0;
+			for (int i = 1; i < capacity; i++) {
+				if (candidates[i].growth < candidates[mildest].growth) mildest = i;
+			}
+			if (candidates[mildest].growth < growth) {
+				candidates[mildest] = (struct RebuildCandidate) {node_index, growth};
+			}
+		}
+		return;
+	}
+
+	collect_degraded(bvh, node->left, candidates, count, capacity);
+	collect_degraded(bvh, node->right, candidates, count, capacity);
+}
+
+int
+bvh_refit(struct Bvh* bvh, int rebuild_budget) {
+	if (bvh->root == BVH_NULL) {
+		return 0;
+	}
+
+	refit_node(bvh, bvh->root);
+	if (rebuild_budget <= 0) {
+		return 0;
+	}
+
+	struct RebuildCandidate candidates[16];
+	int capacity = rebuild_budget < 16 ? rebuild_budget : 16;
+	int count = 0;
+	collect_degraded(bvh, bvh->root, candidates, &count, capacity);
+
+	//Subtrees keep their object range, so rebuilding one never touches
+	//the rest of the tree except for the ancestors' boxes
+	int rebuilt = 0;
+	for (int i = 0; i < count; i++) {
+		uint32_t node = candidates[i].node;
+		release_children(bvh, node);
+		if (!build_node(bvh, node, bvh->nodes[node].first, bvh->nodes[node].count)) {
+			break;
+		}
+		rebuilt++;
+	}
+
+	if (rebuilt > 0) {
+		refit_node(bvh, bvh->root);
+	}
+	return rebuilt;
+}
+
+//-1 outside, 1 fully inside, 0 intersecting
+static int
+classify_box(const float* plane, const float* min, const float* max) {
+	float p[3], n[3];
+	for (int axis = 0; axis < 3; axis++) {
+		p[axis] = plane[axis] >= 0.0f ? max[axis] : min[axis];
+		n[axis] = plane[axis] >= 0.0f ? min[axis] : max[axis];
+	}
+
+	if (plane[0] * p[0] + plane[1] * p[1] + plane[2] * p[2] + plane[3] < 0.0f) {
+		return -1;
+	}
+	return plane[0] * n[0] + plane[1] * n[1] + plane[2] * n[2] + plane[3] >= 0.0f;
+}
+
+uint32_t
+bvh_cull(const struct Bvh* bvh, const struct Frustum* frustum, uint32_t* visible) {
+	if (bvh->root == BVH_NULL) {
+		return 0;
+	}
+
+	//Planes a node is already fully inside of are dropped for its subtree
+	struct {
+		uint32_t node;
+		int planes;
+	} stack[BVH_STACK_SIZE];
+	int top = 0;
+	stack[top++].node = bvh->root;
+	stack[0].planes = 0x3f;
+
+	uint32_t out = 0;
+	while (top > 0) {
+		top--;
+		const struct BvhNode* node = &bvh->nodes[stack[top].node];
+		int planes = stack[top].planes;
+
+		int outside = 0;
+		for (int p = 0; p < 6 && !outside; p++) {
+			if (!(planes & (1 << p))) continue;
+			int side = classify_box(frustum->planes[p], node->min, node->max);
+			outside = side < 0;
+			if (side > 0) planes &= ~(1 << p);
+		}
+		if (outside) continue;
+
+		if (planes == 0) {
+			memcpy(&visible[out], &bvh->objects[node->first], node->count * sizeof(uint32_t));
+			out += node->count;
+			continue;
+		}
+
+		if (node->left == BVH_NULL) {
+			for (uint32_t i = node->first; i < node->first + node->count; i++) {
+				uint32_t object = bvh->objects[i];
+				int inside = 1;
+				for (int p = 0; p < 6; p++) {
+					if ((planes & (1 << p)) &&
+							classify_box(frustum->planes[p], object_min(bvh, object), object_max(bvh, object)) < 0) {
+						inside = 0;
+					}
+				}
+				visible[out] = object;
+				out += (uint32_t) inside;
+			}
+			continue;
+		}
+
+		if (top + 2 > BVH_STACK_SIZE) {
+			//Pathologically deep tree, accept the rest of the subtree
+			memcpy(&visible[out], &bvh->objects[node->first], node->count * sizeof(uint32_t));
+			out += node->count;
+			continue;
+		}
+		stack[top].node = node->left;
+		stack[top++].planes = planes;
+		stack[top].node = node->right;
+		stack[top++].planes = planes;
+	}
+	return out;
+}
+
+//Slab test, returns the entry distance or a negative value on a miss
+static float
+ray_box(const float* origin, const float* inverse, const float* min, const float* max, float max_distance) {
+	float enter = 0.0f;
+	float exit = max_distance;
+	for (int axis = 0; axis < 3; axis++) {
+		float t0 = (min[axis] - origin[axis]) * inverse[axis];
+		float t1 = (max[axis] - origin[axis]) * inverse[axis];
+		if (t0 > t1) {
+			float swap = t0;
+			t0 = t1;
+			t1 = swap;
+		}
+		if (t0 > enter) enter = t0;
+		if (t1 < exit) exit = t1;
+	}
+	return enter <= exit ? enter : -1.0f;
+}
+
+uint32_t
+bvh_raycast(const struct Bvh* bvh, Vector3 origin, Vector3 direction,
+		float max_distance, float* distance) {
+
+	if (bvh->root == BVH_NULL) {
+		return BVH_NULL;
+	}
+
+	float inverse[3];
+	for (int axis = 0; axis < 3; axis++) {
+		inverse[axis] = direction.e[axis] != 0.0f ? 1.0f / direction.e[axis] : FLT_MAX;
+	}
+
+	uint32_t stack[BVH_STACK_SIZE];
+	int top = 0;
+	stack[top++] = bvh->root;
+
+	uint32_t best = BVH_NULL;
+	float best_distance = max_distance;
+	while (top > 0) {
+		const struct BvhNode* node = &bvh->nodes[stack[--top]];
+		if (ray_box(origin.e, inverse, node->min, node->max, best_distance) < 0.0f) {
+			continue;
+		}
+
+		//A pathologically deep tree tests the rest of the subtree directly,
+		//its range covers every object below it
+		if (node->left == BVH_NULL || top + 2 > BVH_STACK_SIZE) {
+			for (uint32_t i = node->first; i < node->first + node->count; i++) {
+				uint32_t object = bvh->objects[i];
+				float t = ray_box(origin.e, inverse, object_min(bvh, object), object_max(bvh, object), best_distance);
+				if (t >= 0.0f && (best == BVH_NULL || t < best_distance)) {
+					best = object;
+					best_distance = t;
+				}
+			}
+			continue;
+		}
+
+		//Visit the nearer child first so the far one is more often pruned
+		const struct BvhNode* left = &bvh->nodes[node->left];
+		const struct BvhNode* right = &bvh->nodes[node->right];
+		float left_t = ray_box(origin.e, inverse, left->min, left->max, best_distance);
+		float right_t = ray_box(origin.e, inverse, right->min, right->max, best_distance);
+		if (left_t >= 0.0f && right_t >= 0.0f) {
+			int left_first = left_t <= right_t;
+			stack[top++] = left_first ? node->right : node->left;
+			stack[top++] = left_first ? node->left : node->right;
+		} else if (left_t >= 0.0f) {
+			stack[top++] = node->left;
+		} else if (right_t >= 0.0f) {
+			stack[top++] = node->right;
+		}
+	}
+
+	if (best != BVH_NULL && distance != NULL) {
+		*distance = best_distance;
+	}
+	return best;
+}
+
+static int
+boxes_overlap(const float* a_min, const float* a_max, const float* b_min, const float* b_max) {
+	return a_min[0] <= b_max[0] && a_max[0] >= b_min[0] &&
+		a_min[1] <= b_max[1] && a_max[1] >= b_min[1] &&
+		a_min[2] <= b_max[2] && a_max[2] >= b_min[2];
+}
+
+uint32_t
+bvh_overlap(const struct Bvh* bvh, Vector3 min, Vector3 max, uint32_t* objects, uint32_t capacity) {
+	if (bvh->root == BVH_NULL) {
+		return 0;
+	}
+
+	uint32_t stack[BVH_STACK_SIZE];
+	int top = 0;
+	stack[top++] = bvh->root;
+
+	uint32_t count = 0;
+	while (top > 0) {
+		const struct BvhNode* node = &bvh->nodes[stack[--top]];
+		if (!boxes_overlap(min.e, max.e, node->min, node->max)) {
+			continue;
+		}
+
+		if (node->left == BVH_NULL || top + 2 > BVH_STACK_SIZE) {
+			for (uint32_t i = node->first; i < node->first + node->count; i++) {
+				uint32_t object = bvh->objects[i];
+				if (boxes_overlap(min.e, max.e, object_min(bvh, object), object_max(bvh, object))) {
+					if (count < capacity) objects[count] = object;
+					count++;
+				}
+			}
+			continue;
+		}
+
+		stack[top++] = node->left;
+		stack[top++] = node->right;
+	}
+	return count;
+}
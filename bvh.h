@@ -0,0 +1,66 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <stdint.h>
+
+#include "every_math.h"
+#include "frustum.h"
+
+//Bounding volume hierarchy over object AABBs. Objects are identified by
+//their index in the arrays passed to bvh_build. Moving objects update their
+//box with bvh_update_object; bvh_refit then grows the tree to match and
+//rebuilds the subtrees that degraded most since they were built.
+
+#define BVH_NULL 0xffffffffu
+
+struct BvhNode {
+	float min[3];
+	float max[3];
+	//Children for internal nodes, BVH_NULL for leaves
+	uint32_t left;
+	uint32_t right;
+	//Range in Bvh.objects covered by the subtree, internal nodes included
+	uint32_t first;
+	uint32_t count;
+	//Surface area right after the subtree was built
+	float built_area;
+};
+
+struct Bvh {
+	struct BvhNode* nodes;
+	uint32_t node_count;
+	uint32_t node_capacity;
+	//Nodes released by subtree rebuilds, linked through BvhNode.left
+	uint32_t free_list;
+	uint32_t root;
+
+	//Object ids in leaf order
+	uint32_t* objects;
+	uint32_t object_count;
+	//Per object id, min xyz then max xyz
+	float* boxes;
+};
+
+//Binned surface area heuristic build. Returns 0 when out of memory.
+int bvh_build(struct Bvh* bvh, const float* mins, const float* maxs, uint32_t count);
+void bvh_free(struct Bvh* bvh);
+
+void bvh_update_object(struct Bvh* bvh, uint32_t object, Vector3 min, Vector3 max);
+//Refits every node to its children, then rebuilds up to rebuild_budget of
+//the subtrees whose area grew the most. Returns how many were rebuilt.
+int bvh_refit(struct Bvh* bvh, int rebuild_budget);
+
+//Writes the ids of the objects intersecting the frustum, returns the count.
+//visible must hold object_count entries.
+uint32_t bvh_cull(const struct Bvh* bvh, const struct Frustum* frustum, uint32_t* visible);
+
+//Nearest object whose box the ray enters within max_distance, or BVH_NULL.
+//distance receives where the ray enters the box.
+uint32_t bvh_raycast(const struct Bvh* bvh, Vector3 origin, Vector3 direction,
+		float max_distance, float* distance);
+
+//Writes up to capacity ids of objects whose box overlaps [min, max] and
+//returns how many overlap in total
+uint32_t bvh_overlap(const struct Bvh* bvh, Vector3 min, Vector3 max, uint32_t* objects, uint32_t capacity);
+
+#endif
@@ -0,0 +1,85 @@
+#include "camera.h"
+
+#include <math.h>
+#include "glad/glad.h"
+
+struct Camera
+camera_create(double fov, int width, int height, double far_plane) {
+	struct Camera camera = {
+		.fov = fov,
+		.width = width,
+		.height = height,
+		.far_plane = far_plane,
+		.near_plane = 1.0,
+		.projection_dirty = 1,
+		.upload_dirty = 1
+	};
+	return camera;
+}
+
+void
+camera_use_reversed_z(struct Camera* camera, double near_plane, int zero_to_one) {
+	camera->reversed_z = 1;
+	camera->near_plane = near_plane;
+	camera->zero_to_one = zero_to_one;
+	camera->projection_dirty = 1;
+}
+
+void
+camera_set_fov(struct Camera* camera, double fov) {
+	if (camera->fov != fov) {
+		camera->fov = fov;
+		camera->projection_dirty = 1;
+	}
+}
+
+void
+camera_set_viewport(struct Camera* camera, int width, int height) {
+	//A minimized window reports 0x0, keep the last usable aspect ratio
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+
+	if (camera->width != width || camera->height != height) {
+		camera->width = width;
+		camera->height = height;
+		camera->projection_dirty = 1;
+	}
+}
+
+int
+camera_update(struct Camera* camera) {
+	if (!camera->projection_dirty) {
+		return 0;
+	}
+
+	double aspect_ratio = (double) camera->width / (double) camera->height;
+	if (camera->reversed_z) {
+		camera->projection = perspective_reversed_infinite(TO_RAD(camera->fov), aspect_ratio,
+				camera->near_plane, camera->zero_to_one);
+	} else {
+		camera->projection = perspective_matrix(TO_RAD(camera->fov), aspect_ratio, camera->far_plane);
+	}
+	camera->projection_dirty = 0;
+	camera->upload_dirty = 1;
+	return 1;
+}
+
+void
+camera_invalidate_upload(struct Camera* camera) {
+	camera->upload_dirty = 1;
+}
+
+int
+camera_upload(struct Camera* camera, unsigned int program) {
+	if (!camera->upload_dirty && camera->uploaded_program == program) {
+		return 0;
+	}
+
+	int projection_location = glGetUniformLocation(program, "projection");
+	glUniformMatrix4fv(projection_location, 1, GL_TRUE, camera->projection.e);
+
+	camera->uploaded_program = program;
+	camera->upload_dirty = 0;
+	return 1;
+}
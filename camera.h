@@ -0,0 +1,41 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include "every_math.h"
+
+struct Camera {
+	double fov;
+	int width;
+	int height;
+	double far_plane;
+
+	//Reversed-Z infinite projection, far_plane is ignored when set
+	int reversed_z;
+	int zero_to_one;
+	double near_plane;
+
+	Matrix4 projection;
+	int projection_dirty;
+
+	//Program the projection was last uploaded to, 0 forces an upload
+	unsigned int uploaded_program;
+	int upload_dirty;
+};
+
+struct Camera camera_create(double fov, int width, int height, double far_plane);
+
+void camera_use_reversed_z(struct Camera* camera, double near_plane, int zero_to_one);
+void camera_set_fov(struct Camera* camera, double fov);
+void camera_set_viewport(struct Camera* camera, int width, int height);
+
+//Rebuilds the projection if fov or viewport changed, returns 1 if it did
+int camera_update(struct Camera* camera);
+
+//Call after a shader reload, GL may hand out the deleted program's id again
+void camera_invalidate_upload(struct Camera* camera);
+
+//Uploads the projection to the bound program only when it changed or
+//the program was relinked, returns 1 if a glUniform call was issued
+int camera_upload(struct Camera* camera, unsigned int program);
+
+#endif
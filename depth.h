@@ -0,0 +1,43 @@
+#ifndef DEPTH_H
+#define DEPTH_H
+
+#include "glad/glad.h"
+
+#ifndef GL_ZERO_TO_ONE
+#define GL_ZERO_TO_ONE 0x935F
+#endif
+
+#ifndef GL_NEGATIVE_ONE_TO_ONE
+#define GL_NEGATIVE_ONE_TO_ONE 0x935E
+#endif
+
+//Offscreen target with a 32-bit float depth attachment. The default
+//framebuffer rarely offers more than 24-bit fixed point depth, which
+//throws away what reversed-Z gains.
+struct DepthTarget {
+	unsigned int fbo;
+	unsigned int color;
+	unsigned int depth;
+	int width;
+	int height;
+	//glClipControl(GL_LOWER_LEFT, GL_ZERO_TO_ONE) is active
+	int zero_to_one;
+};
+
+//Resolves glClipControl (GL 4.5 or ARB_clip_control), returns 0 when the
+//driver has neither and the [-1, 1] fallback must be used
+int clip_control_load(GLADloadproc load);
+
+struct DepthTarget depth_target_create(int width, int height);
+void depth_target_resize(struct DepthTarget* target, int width, int height);
+void depth_target_destroy(struct DepthTarget* target);
+
+//Binds the target and clears it for reversed-Z (depth 0, GL_GREATER)
+void depth_target_begin(struct DepthTarget* target);
+//Copies color to the default framebuffer
+void depth_target_present(struct DepthTarget* target);
+//Reads color back as width * height RGBA8 pixels, bottom row first. Stalls
+//until rendering finishes, meant for tests and benchmarks.
+void depth_target_read_color(const struct DepthTarget* target, unsigned char* pixels);
+
+#endif
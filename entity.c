@@ -0,0 +1,427 @@
+#include "entity.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "jobs.h"
+
+//Transforms per job when a depth level is split over the pool
+#define TRANSFORM_BATCH_SIZE 4096
+
+static uint32_t
+entity_index(Entity entity) {
+	return entity & ENTITY_INDEX_MASK;
+}
+
+static uint8_t
+entity_generation(Entity entity) {
+	return (uint8_t) (entity >> ENTITY_INDEX_BITS);
+}
+
+struct Scene
+scene_create(void) {
+	return (struct Scene) {.free_head = ENTITY_NULL};
+}
+
+void
+scene_free(struct Scene* scene) {
+	free(scene->generations);
+	free(scene->transform_index);
+	free(scene->next_free);
+
+	struct Transforms* transforms = &scene->transforms;
+	free(transforms->entities);
+	free(transforms->positions);
+	free(transforms->rotations);
+	free(transforms->scales);
+	free(transforms->parents);
+	free(transforms->parent_index);
+	free(transforms->dirty);
+	free(transforms->moved);
+	free(transforms->world);
+	free(transforms->level_offsets);
+
+	*scene = scene_create();
+}
+
+//realloc that leaves the old block alone on failure
+static int
+grow(void** array, size_t size) {
+	void* grown = realloc(*array, size);
+	if (grown == NULL) {
+		return 0;
+	}
+	*array = grown;
+	return 1;
+}
+
+Entity
+entity_create(struct Scene* scene) {
+	uint32_t slot;
+	if (scene->free_head != ENTITY_NULL) {
+		slot = scene->free_head;
+		scene->free_head = scene->next_free[slot];
+	} else {
+		//The last index is left out so no handle equals ENTITY_NULL
+		if (scene->slot_count >= ENTITY_INDEX_MASK) {
+			fprintf(stderr, "Out of entity slots\n");
+			return ENTITY_NULL;
+		}
+
+		if (scene->slot_count == scene->slot_capacity) {
+			uint32_t capacity = scene->slot_capacity ? scene->slot_capacity * 2 : 256;
+			if (!grow((void**) &scene->generations, capacity * sizeof(uint8_t)) ||
+					!grow((void**) &scene->transform_index, capacity * sizeof(uint32_t)) ||
+					!grow((void**) &scene->next_free, capacity * sizeof(uint32_t))) {
+				return ENTITY_NULL;
+			}
+			scene->slot_capacity = capacity;
+		}
+
+		slot = scene->slot_count++;
+		scene->generations[slot] = 0;
+	}
+
+	scene->transform_index[slot] = ENTITY_NULL;
+	return ((uint32_t) scene->generations[slot] << ENTITY_INDEX_BITS) | slot;
+}
+
+int
+entity_alive(const struct Scene* scene, Entity entity) {
+	uint32_t slot = entity_index(entity);
+	return entity != ENTITY_NULL && slot < scene->slot_count &&
+		scene->generations[slot] == entity_generation(entity);
+}
+
+void
+entity_destroy(struct Scene* scene, Entity entity) {
+	if (!entity_alive(scene, entity)) {
+		return;
+	}
+
+	transform_remove(scene, entity);
+
+	uint32_t slot = entity_index(entity);
+	//Stale handles now fail the generation check
+	scene->generations[slot]++;
+	scene->next_free[slot] = scene->free_head;
+	scene->free_head = slot;
+}
+
+static int
+transforms_reserve(struct Transforms* transforms, uint32_t count) {
+	if (count <= transforms->capacity) {
+		return 1;
+	}
+
+	uint32_t capacity = transforms->capacity ? transforms->capacity * 2 : 256;
+	if (capacity < count) capacity = count;
+
+	if (!grow((void**) &transforms->entities, capacity * sizeof(Entity)) ||
+			!grow((void**) &transforms->positions, capacity * sizeof(Vector3)) ||
+			!grow((void**) &transforms->rotations, capacity * sizeof(Quaternion)) ||
+			!grow((void**) &transforms->scales, capacity * sizeof(Vector3)) ||
+			!grow((void**) &transforms->parents, capacity * sizeof(Entity)) ||
+			!grow((void**) &transforms->parent_index, capacity * sizeof(uint32_t)) ||
+			!grow((void**) &transforms->dirty, capacity * sizeof(uint8_t)) ||
+			!grow((void**) &transforms->moved, capacity * sizeof(uint8_t)) ||
+			!grow((void**) &transforms->world, (size_t) capacity * sizeof(Matrix4))) {
+		return 0;
+	}
+	transforms->capacity = capacity;
+	return 1;
+}
+
+uint32_t
+transform_add(struct Scene* scene, Entity entity, Vector3 position, Quaternion rotation, Vector3 scale) {
+	if (!entity_alive(scene, entity)) {
+		return ENTITY_NULL;
+	}
+
+	struct Transforms* transforms = &scene->transforms;
+	uint32_t index = scene->transform_index[entity_index(entity)];
+	if (index == ENTITY_NULL) {
+		if (!transforms_reserve(transforms, transforms->count + 1)) {
+			return ENTITY_NULL;
+		}
+		index = transforms->count++;
+		scene->transform_index[entity_index(entity)] = index;
+		transforms->parents[index] = ENTITY_NULL;
+		transforms->parent_index[index] = ENTITY_NULL;
+		transforms->moved[index] = 0;
+		transforms->world[index] = mat4_identity();
+		transforms->ordered = 0;
+	}
+
+	transforms->entities[index] = entity;
+	transforms->positions[index] = position;
+	transforms->rotations[index] = rotation;
+	transforms->scales[index] = scale;
+	transforms->dirty[index] = 1;
+	return index;
+}
+
+void
+transform_remove(struct Scene* scene, Entity entity) {
+	uint32_t index = transform_find(scene, entity);
+	if (index == ENTITY_NULL) {
+		return;
+	}
+
+	struct Transforms* transforms = &scene->transforms;
+	uint32_t last = --transforms->count;
+	if (index != last) {
+		Entity moved = transforms->entities[last];
+		transforms->entities[index] = moved;
+		transforms->positions[index] = transforms->positions[last];
+		transforms->rotations[index] = transforms->rotations[last];
+		transforms->scales[index] = transforms->scales[last];
+		transforms->parents[index] = transforms->parents[last];
+		transforms->dirty[index] = transforms->dirty[last];
+		transforms->moved[index] = transforms->moved[last];
+		transforms->world[index] = transforms->world[last];
+		scene->transform_index[entity_index(moved)] = index;
+	}
+	scene->transform_index[entity_index(entity)] = ENTITY_NULL;
+	transforms->ordered = 0;
+}
+
+uint32_t
+transform_find(const struct Scene* scene, Entity entity) {
+	if (!entity_alive(scene, entity)) {
+		return ENTITY_NULL;
+	}
+	return scene->transform_index[entity_index(entity)];
+}
+
+int
+transform_set_parent(struct Scene* scene, Entity entity, Entity parent) {
+	uint32_t index = transform_find(scene, entity);
+	if (index == ENTITY_NULL) {
+		return 0;
+	}
+
+	struct Transforms* transforms = &scene->transforms;
+	if (parent != ENTITY_NULL) {
+		//Walk up from the new parent, meeting entity means a cycle
+		uint32_t ancestor = transform_find(scene, parent);
+		if (ancestor == ENTITY_NULL) {
+			return 0;
+		}
+		while (ancestor != ENTITY_NULL) {
+			if (ancestor == index) {
+				return 0;
+			}
+			ancestor = transform_find(scene, transforms->parents[ancestor]);
+		}
+	}
+
+	transforms->parents[index] = parent;
+	transforms->dirty[index] = 1;
+	transforms->ordered = 0;
+	return 1;
+}
+
+void
+transform_set_position(struct Scene* scene, Entity entity, Vector3 position) {
+	uint32_t index = transform_find(scene, entity);
+	if (index != ENTITY_NULL && memcmp(&scene->transforms.positions[index], &position, sizeof(position)) != 0) {
+		scene->transforms.positions[index] = position;
+		scene->transforms.dirty[index] = 1;
+	}
+}
+
+void
+transform_set_rotation(struct Scene* scene, Entity entity, Quaternion rotation) {
+	uint32_t index = transform_find(scene, entity);
+	if (index != ENTITY_NULL && memcmp(&scene->transforms.rotations[index], &rotation, sizeof(rotation)) != 0) {
+		scene->transforms.rotations[index] = rotation;
+		scene->transforms.dirty[index] = 1;
+	}
+}
+
+void
+transform_set_scale(struct Scene* scene, Entity entity, Vector3 scale) {
+	uint32_t index = transform_find(scene, entity);
+	if (index != ENTITY_NULL && memcmp(&scene->transforms.scales[index], &scale, sizeof(scale)) != 0) {
+		scene->transforms.scales[index] = scale;
+		scene->transforms.dirty[index] = 1;
+	}
+}
+
+//Gathers array[order[i]] into a fresh block of the same capacity
+static int
+permute(void** array, size_t size, const uint32_t* order, uint32_t count, uint32_t capacity) {
+	char* sorted = malloc((size_t) capacity * size);
+	if (sorted == NULL) {
+		return 0;
+	}
+
+	const char* source = *array;
+	for (uint32_t i = 0; i < count; i++) {
+		memcpy(sorted + i * size, source + (size_t) order[i] * size, size);
+	}
+	free(*array);
+	*array = sorted;
+	return 1;
+}
+
+//Counting sort by depth. Dangling parents are cleared first so a removed
+//parent turns its children into roots.
+static int
+transforms_sort(struct Scene* scene) {
+	struct Transforms* transforms = &scene->transforms;
+	uint32_t count = transforms->count;
+
+	uint32_t* depth = malloc((count + 1) * sizeof(uint32_t));
+	uint32_t* order = malloc((count + 1) * sizeof(uint32_t));
+	if (depth == NULL || order == NULL) {
+		free(depth);
+		free(order);
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		transforms->parent_index[i] = transform_find(scene, transforms->parents[i]);
+		if (transforms->parent_index[i] == ENTITY_NULL && transforms->parents[i] != ENTITY_NULL) {
+			transforms->parents[i] = ENTITY_NULL;
+			transforms->dirty[i] = 1;
+		}
+		depth[i] = ENTITY_NULL;
+	}
+
+	//Resolve each chain once, order doubles as the walk stack here
+	uint32_t level_count = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t top = 0;
+		uint32_t node = i;
+		while (node != ENTITY_NULL && depth[node] == ENTITY_NULL) {
+			order[top++] = node;
+			node = transforms->parent_index[node];
+		}
+
+		uint32_t d = node == ENTITY_NULL ? 0 : depth[node] + 1;
+		while (top > 0) {
+			depth[order[--top]] = d++;
+		}
+		if (d > level_count) level_count = d;
+	}
+
+	if (!grow((void**) &transforms->level_offsets, (level_count + 1) * sizeof(uint32_t))) {
+		free(depth);
+		free(order);
+		return 0;
+	}
+
+	uint32_t* offsets = transforms->level_offsets;
+	memset(offsets, 0, (level_count + 1) * sizeof(uint32_t));
+	for (uint32_t i = 0; i < count; i++) {
+		offsets[depth[i] + 1]++;
+	}
+	for (uint32_t level = 0; level < level_count; level++) {
+		offsets[level + 1] += offsets[level];
+	}
+	//Stable, so siblings keep their relative order between sorts
+	for (uint32_t i = 0; i < count; i++) {
+		order[offsets[depth[i]]++] = i;
+	}
+	for (uint32_t level = level_count; level > 0; level--) {
+		offsets[level] = offsets[level - 1];
+	}
+	offsets[0] = 0;
+	free(depth);
+
+	uint32_t capacity = transforms->capacity;
+	int sorted = permute((void**) &transforms->entities, sizeof(Entity), order, count, capacity) &&
+		permute((void**) &transforms->positions, sizeof(Vector3), order, count, capacity) &&
+		permute((void**) &transforms->rotations, sizeof(Quaternion), order, count, capacity) &&
+		permute((void**) &transforms->scales, sizeof(Vector3), order, count, capacity) &&
+		permute((void**) &transforms->parents, sizeof(Entity), order, count, capacity) &&
+		permute((void**) &transforms->dirty, sizeof(uint8_t), order, count, capacity) &&
+		permute((void**) &transforms->moved, sizeof(uint8_t), order, count, capacity) &&
+		permute((void**) &transforms->world, sizeof(Matrix4), order, count, capacity);
+	free(order);
+
+	//A failed permute leaves earlier arrays sorted and later ones not, so
+	//the sparse index has to be rebuilt from entities either way
+	for (uint32_t i = 0; i < count; i++) {
+		scene->transform_index[entity_index(transforms->entities[i])] = i;
+	}
+	if (!sorted) {
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		transforms->parent_index[i] = transform_find(scene, transforms->parents[i]);
+	}
+	transforms->level_count = level_count;
+	transforms->ordered = 1;
+	return 1;
+}
+
+struct PropagateJob {
+	struct Transforms* transforms;
+	uint32_t begin;
+	uint32_t end;
+	uint32_t updated;
+};
+
+//Returns how many world matrices were recomputed
+static uint32_t
+propagate_range(struct Transforms* transforms, uint32_t begin, uint32_t end) {
+	uint32_t updated = 0;
+	for (uint32_t i = begin; i < end; i++) {
+		uint32_t parent = transforms->parent_index[i];
+		int moved = transforms->dirty[i] | (parent != ENTITY_NULL && transforms->moved[parent]);
+		transforms->dirty[i] = 0;
+		transforms->moved[i] = (uint8_t) moved;
+		if (!moved) {
+			continue;
+		}
+
+		Matrix4 local = mat4_from_transform(transforms->positions[i],
+			transforms->rotations[i], transforms->scales[i]);
+		transforms->world[i] = parent == ENTITY_NULL ? local : mat4_mult(transforms->world[parent], local);
+		updated++;
+	}
+	return updated;
+}
+
+static void
+propagate_batch(void* user, int batch) {
+	struct PropagateJob* job = user;
+	uint32_t begin = job->begin + (uint32_t) batch * TRANSFORM_BATCH_SIZE;
+	uint32_t end = begin + TRANSFORM_BATCH_SIZE < job->end ? begin + TRANSFORM_BATCH_SIZE : job->end;
+	uint32_t updated = propagate_range(job->transforms, begin, end);
+	__atomic_fetch_add(&job->updated, updated, __ATOMIC_RELAXED);
+}
+
+void
+scene_update_transforms(struct Scene* scene) {
+	struct Transforms* transforms = &scene->transforms;
+	if (!transforms->ordered && !transforms_sort(scene)) {
+		fprintf(stderr, "Failed to sort transforms\n");
+		return;
+	}
+
+	transforms->updated = 0;
+	//Levels only depend on the ones before them
+	for (uint32_t level = 0; level < transforms->level_count; level++) {
+		struct PropagateJob job = {
+			transforms,
+			transforms->level_offsets[level],
+			transforms->level_offsets[level + 1],
+			0
+		};
+
+		int batches = (int) ((job.end - job.begin + TRANSFORM_BATCH_SIZE - 1) / TRANSFORM_BATCH_SIZE);
+		if (batches > 1) {
+			jobs_parallel_for(batches, propagate_batch, &job);
+		} else {
+			job.updated = propagate_range(transforms, job.begin, job.end);
+		}
+		transforms->updated += job.updated;
+	}
+	transforms->skipped = transforms->count - transforms->updated;
+}
@@ -0,0 +1,102 @@
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include <stdint.h>
+
+#include "every_math.h"
+
+//Entities are generational handles, the low bits index a slot and the high
+//bits count how often that slot was reused, so handles to destroyed
+//entities stay invalid. Components live in a sparse set: slot -> dense
+//index, with the component data packed as parallel arrays that are always
+//iterated front to back.
+
+typedef uint32_t Entity;
+
+#define ENTITY_NULL 0xffffffffu
+#define ENTITY_INDEX_BITS 24
+#define ENTITY_INDEX_MASK ((1u << ENTITY_INDEX_BITS) - 1)
+
+//Transform components, structure of arrays indexed by dense index.
+//scene_update_transforms keeps the arrays sorted by hierarchy depth, so
+//parents always come before their children and every depth level is one
+//contiguous range. Adding, removing or reparenting breaks the order and the
+//next update sorts again, which also moves dense indices around.
+struct Transforms {
+	Entity* entities;
+	Vector3* positions;
+	Quaternion* rotations;
+	Vector3* scales;
+	//ENTITY_NULL for roots
+	Entity* parents;
+	//Dense index of the parent, only valid while ordered
+	uint32_t* parent_index;
+	//Local values changed since the last update, set by the setters
+	uint8_t* dirty;
+	//World matrix changed in the last update
+	uint8_t* moved;
+	//Written by scene_update_transforms
+	Matrix4* world;
+	uint32_t count;
+	uint32_t capacity;
+
+	//World matrices recomputed and left alone by the last update
+	uint32_t updated;
+	uint32_t skipped;
+
+	//Start of each depth level, level_count + 1 entries
+	uint32_t* level_offsets;
+	uint32_t level_count;
+	int ordered;
+};
+
+struct Scene {
+	//Per slot
+	uint8_t* generations;
+	//Dense transform index, or ENTITY_NULL
+	uint32_t* transform_index;
+	//Free slots, linked through next_free
+	uint32_t* next_free;
+	uint32_t free_head;
+	uint32_t slot_count;
+	uint32_t slot_capacity;
+
+	struct Transforms transforms;
+};
+
+//A zeroed Scene is empty but free_head must be ENTITY_NULL, use scene_create
+struct Scene scene_create(void);
+void scene_free(struct Scene* scene);
+
+//Returns ENTITY_NULL when out of memory or slots
+Entity entity_create(struct Scene* scene);
+void entity_destroy(struct Scene* scene, Entity entity);
+int entity_alive(const struct Scene* scene, Entity entity);
+
+//Returns the dense index, or ENTITY_NULL when out of memory. Adding to an
+//entity that already has a transform overwrites it.
+uint32_t transform_add(struct Scene* scene, Entity entity,
+		Vector3 position, Quaternion rotation, Vector3 scale);
+//Children of a removed transform become roots
+void transform_remove(struct Scene* scene, Entity entity);
+//Dense index, or ENTITY_NULL. Only valid until the next add, remove,
+//reparent or update.
+uint32_t transform_find(const struct Scene* scene, Entity entity);
+
+//parent ENTITY_NULL detaches. Returns 0 if either has no transform or the
+//link would create a cycle.
+int transform_set_parent(struct Scene* scene, Entity entity, Entity parent);
+
+//Local values are relative to the parent. Writing the arrays directly
+//skips change tracking, so go through these. Setting the current value
+//again does not mark the transform dirty.
+void transform_set_position(struct Scene* scene, Entity entity, Vector3 position);
+void transform_set_rotation(struct Scene* scene, Entity entity, Quaternion rotation);
+void transform_set_scale(struct Scene* scene, Entity entity, Vector3 scale);
+
+//Sorts by depth if needed, then recomputes the world matrix of every
+//transform that changed or whose parent moved, one depth level at a time
+//with large levels split over the job pool
+void scene_update_transforms(struct Scene* scene);
+
+#endif
@@ -118,3 +118,88 @@ quat_normalize(Quaternion q) {
 	double norm = quat_norm(q);
 	return quat_scale(1 / norm, q);
 }
+
+Matrix4
+mat4_identity(void) {
+	Matrix4 r = {0};
+	r.e[0] = 1;
+	r.e[5] = 1;
+	r.e[10] = 1;
+	r.e[15] = 1;
+	return r;
+}
+
+Matrix4
+mat4_mult(Matrix4 a, Matrix4 b) {
+	Matrix4 r;
+	for (int row = 0; row < 4; row++) {
+		for (int col = 0; col < 4; col++) {
+			r.e[row * 4 + col] =
+				a.e[row * 4 + 0] * b.e[0 * 4 + col] +
+				a.e[row * 4 + 1] * b.e[1 * 4 + col] +
+				a.e[row * 4 + 2] * b.e[2 * 4 + col] +
+				a.e[row * 4 + 3] * b.e[3 * 4 + col];
+		}
+	}
+	return r;
+}
+
+Matrix4
+mat4_from_transform(Vector3 position, Quaternion rotation, Vector3 scale) {
+	Matrix4 r = quat_to_matrix(rotation);
+	for (int row = 0; row < 3; row++) {
+		r.e[row * 4 + 0] *= scale.x;
+		r.e[row * 4 + 1] *= scale.y;
+		r.e[row * 4 + 2] *= scale.z;
+		r.e[row * 4 + 3] = position.e[row];
+	}
+	return r;
+}
+
+Vector3
+mat4_transform_point(Matrix4 m, Vector3 v) {
+	Vector3 r;
+	for (int row = 0; row < 3; row++) {
+		r.e[row] = m.e[row * 4 + 0] * v.x + m.e[row * 4 + 1] * v.y +
+			m.e[row * 4 + 2] * v.z + m.e[row * 4 + 3];
+	}
+	return r;
+}
+
+Matrix4
+perspective_matrix(double fov, double aspect_ratio, double far_plane) {
+	Matrix4 r = {0};
+	
+	double near_plane = 1.0;
+	double c = 1.0 / tan(fov * 0.5);
+
+	r.e[0] = c / aspect_ratio;
+	r.e[5] = c;
+	r.e[10] = -(far_plane + near_plane) / (far_plane - near_plane);
+	r.e[11] = - 2.0 * far_plane * near_plane / (far_plane - near_plane);
+	r.e[14] = -1;
+
+	return r;
+}
+
+Matrix4
+perspective_reversed_infinite(double fov, double aspect_ratio, double near_plane, int zero_to_one) {
+	Matrix4 r = {0};
+
+	double c = 1.0 / tan(fov * 0.5);
+
+	r.e[0] = c / aspect_ratio;
+	r.e[5] = c;
+	if (zero_to_one) {
+		//z_ndc = near / -z_eye
+		r.e[10] = 0;
+		r.e[11] = near_plane;
+	} else {
+		//z_ndc = 2 * near / -z_eye - 1, window depth ends up as above
+		r.e[10] = 1;
+		r.e[11] = 2.0 * near_plane;
+	}
+	r.e[14] = -1;
+
+	return r;
+}
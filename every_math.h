@@ -21,6 +21,7 @@ typedef union {
 	};
 	float e[4];
 } Quaternion;
+//Row-major, upload with transpose = GL_TRUE
 typedef struct {
 	float e[4*4];
 } Matrix4;
@@ -42,4 +43,17 @@ Matrix4 quat_to_matrix(Quaternion a);
 Quaternion to_quaternion(double deg, Vector3 axis);
 Quaternion quat_rotate(Quaternion q, double deg);
 
+Matrix4 mat4_identity(void);
+Matrix4 mat4_mult(Matrix4 a, Matrix4 b);
+//Translation * rotation * scale, rotation must be a unit quaternion
+Matrix4 mat4_from_transform(Vector3 position, Quaternion rotation, Vector3 scale);
+//Treats v as a point, w = 1, and drops the resulting w
+Vector3 mat4_transform_point(Matrix4 m, Vector3 v);
+
+Matrix4 perspective_matrix(double fov, double aspect_ratio, double far_plane);
+//Reversed-Z with the far plane at infinity, depth is 1 at near_plane and
+//falls towards 0 with distance. zero_to_one selects the glClipControl
+//[0, 1] depth range, otherwise the matrix targets the default [-1, 1].
+Matrix4 perspective_reversed_infinite(double fov, double aspect_ratio, double near_plane, int zero_to_one);
+
 #endif
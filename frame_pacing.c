@@ -0,0 +1,84 @@
+#include "frame_pacing.h"
+
+#include <GLFW/glfw3.h>
+#include <time.h>
+
+struct FramePacing
+frame_pacing_create(int swap_interval, double max_fps, int max_frames_in_flight, int late_latch) {
+	if (max_frames_in_flight > FRAME_PACING_MAX_IN_FLIGHT) {
+		max_frames_in_flight = FRAME_PACING_MAX_IN_FLIGHT;
+	}
+
+	struct FramePacing pacing = {
+		.swap_interval = swap_interval,
+		.frame_period = max_fps > 0.0 ? 1.0 / max_fps : 0.0,
+		.spin_time = 0.002,
+		.max_frames_in_flight = max_frames_in_flight > 0 ? max_frames_in_flight : 0,
+		.late_latch = late_latch,
+		.deadline = glfwGetTime()
+	};
+	glfwSwapInterval(swap_interval);
+	return pacing;
+}
+
+void
+frame_pacing_destroy(struct FramePacing* pacing) {
+	for (int i = 0; i < FRAME_PACING_MAX_IN_FLIGHT; i++) {
+		if (pacing->fences[i] != NULL) {
+			glDeleteSync(pacing->fences[i]);
+		}
+	}
+	*pacing = (struct FramePacing) {0};
+}
+
+void
+frame_pacing_wait(struct FramePacing* pacing) {
+	pacing->frames++;
+	if (pacing->frame_period <= 0.0) {
+		return;
+	}
+
+	double start = glfwGetTime();
+	pacing->deadline += pacing->frame_period;
+	//After a long frame start over instead of rushing to catch up
+	if (pacing->deadline < start - pacing->frame_period) {
+		pacing->deadline = start;
+	}
+
+	double sleep_time = pacing->deadline - start - pacing->spin_time;
+	if (sleep_time > 0.0) {
+		struct timespec duration = {
+			.tv_sec = (time_t) sleep_time,
+			.tv_nsec = (long) ((sleep_time - (double) (time_t) sleep_time) * 1e9)
+		};
+		nanosleep(&duration, NULL);
+	}
+	double now;
+	while ((now = glfwGetTime()) < pacing->deadline) {
+	}
+	pacing->limiter_wait += now - start;
+}
+
+void
+frame_pacing_after_swap(struct FramePacing* pacing) {
+	int in_flight = pacing->max_frames_in_flight;
+	if (in_flight == 0) {
+		return;
+	}
+
+	double start = glfwGetTime();
+	pacing->fences[pacing->fence_index % in_flight] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	pacing->fence_index++;
+
+	//The oldest fence, in_flight - 1 frames back, or this frame's with 1
+	GLsync* oldest = &pacing->fences[pacing->fence_index % in_flight];
+	if (*oldest != NULL) {
+		GLenum result;
+		do {
+			result = glClientWaitSync(*oldest, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000);
+		} while (result == GL_TIMEOUT_EXPIRED);
+		glDeleteSync(*oldest);
+		*oldest = NULL;
+	}
+	pacing->fence_wait += glfwGetTime() - start;
+}
@@ -0,0 +1,50 @@
+#ifndef FRAME_PACING_H
+#define FRAME_PACING_H
+
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+#define FRAME_PACING_MAX_IN_FLIGHT 4
+
+//Trades throughput for latency. Drivers queue several frames ahead by
+//default, so input sampled at the start of a frame can be shown 50 ms or
+//more later. Limiting the frames the GPU may lag behind and waiting for
+//the next frame's deadline before sampling input, instead of after, keeps
+//that queue short.
+struct FramePacing {
+	//Passed to glfwSwapInterval, 0 disables vsync
+	int swap_interval;
+	//Seconds per frame for the limiter, 0 for no limit
+	double frame_period;
+	//The limiter sleeps until this long before the deadline and spins for
+	//the rest, sleeps overshoot by up to a scheduler tick
+	double spin_time;
+	//Frames the GPU may lag behind the CPU, 1 waits for every frame like
+	//glFinish. 0 leaves it to the driver.
+	int max_frames_in_flight;
+	//Poll input after the limiter's wait rather than before it
+	int late_latch;
+
+	double deadline;
+	GLsync fences[FRAME_PACING_MAX_IN_FLIGHT];
+	uint32_t fence_index;
+
+	//Seconds spent in the limiter and on fences, and frames paced
+	double limiter_wait;
+	double fence_wait;
+	unsigned long frames;
+};
+
+//max_fps 0 disables the limiter, max_frames_in_flight is clamped to
+//FRAME_PACING_MAX_IN_FLIGHT. Applies the swap interval to the current
+//context.
+struct FramePacing frame_pacing_create(int swap_interval, double max_fps, int max_frames_in_flight, int late_latch);
+void frame_pacing_destroy(struct FramePacing* pacing);
+
+//Blocks until the next frame's deadline
+void frame_pacing_wait(struct FramePacing* pacing);
+//Call right after the swap, blocks while too many frames are queued
+void frame_pacing_after_swap(struct FramePacing* pacing);
+
+#endif
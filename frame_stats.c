@@ -0,0 +1,158 @@
+#include "frame_stats.h"
+
+#include <stdlib.h>
+
+static uint32_t
+bucket_index(uint64_t value) {
+	if (value < FRAME_HISTOGRAM_SUB_BUCKETS) {
+		return (uint32_t) value;
+	}
+	//Top FRAME_HISTOGRAM_SUB_BITS + 1 bits, the leading one picks the row
+	uint32_t exponent = 63 - (uint32_t) __builtin_clzll(value);
+	uint32_t shift = exponent - FRAME_HISTOGRAM_SUB_BITS;
+	uint32_t sub = (uint32_t) (value >> shift) - FRAME_HISTOGRAM_SUB_BUCKETS;
+	return (shift + 1) * FRAME_HISTOGRAM_SUB_BUCKETS + sub;
+}
+
+//Middle of the bucket's range
+static uint64_t
+bucket_value(uint32_t index) {
+	if (index < FRAME_HISTOGRAM_SUB_BUCKETS) {
+		return index;
+	}
+	uint32_t shift = index / FRAME_HISTOGRAM_SUB_BUCKETS - 1;
+	uint64_t sub = index % FRAME_HISTOGRAM_SUB_BUCKETS + FRAME_HISTOGRAM_SUB_BUCKETS;
+	uint64_t low = sub << shift;
+	return low + (((uint64_t) 1 << shift) >> 1);
+}
+
+void
+frame_histogram_reset(struct FrameHistogram* histogram) {
+	*histogram = (struct FrameHistogram) {.min = UINT64_MAX};
+}
+
+void
+frame_histogram_record(struct FrameHistogram* histogram, uint64_t value) {
+	histogram->counts[bucket_index(value)]++;
+	histogram->total++;
+	histogram->sum += value;
+	histogram->min = value < histogram->min ? value : histogram->min;
+	histogram->max = value > histogram->max ? value : histogram->max;
+}
+
+uint64_t
+frame_histogram_percentile(const struct FrameHistogram* histogram, double percentile) {
+	if (histogram->total == 0) {
+		return 0;
+	}
+
+	//Smallest value with at least percentile of the samples at or below it
+	double target = percentile / 100.0 * (double) histogram->total;
+	uint64_t rank = (uint64_t) target;
+	rank += (double) rank < target;
+	rank = rank < 1 ? 1 : rank;
+
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < FRAME_HISTOGRAM_BUCKETS; i++) {
+		seen += histogram->counts[i];
+		if (seen >= rank) {
+			//The bucket middle can lie outside what was actually recorded
+			uint64_t value = bucket_value(i);
+			value = value < histogram->min ? histogram->min : value;
+			return value > histogram->max ? histogram->max : value;
+		}
+	}
+	return histogram->max;
+}
+
+static double
+to_ms(uint64_t ns) {
+	return (double) ns / 1e6;
+}
+
+void
+frame_histogram_print(const struct FrameHistogram* histogram, const char* label, FILE* file) {
+	if (histogram->total == 0) {
+		fprintf(file, "%s: no frames\n", label);
+		return;
+	}
+	fprintf(file, "%s: %llu frames, mean %.2f ms, p50 %.2f ms, p99 %.2f ms, p99.9 %.2f ms, max %.2f ms\n",
+		label, (unsigned long long) histogram->total,
+		to_ms(histogram->sum) / (double) histogram->total,
+		to_ms(frame_histogram_percentile(histogram, 50.0)),
+		to_ms(frame_histogram_percentile(histogram, 99.0)),
+		to_ms(frame_histogram_percentile(histogram, 99.9)),
+		to_ms(histogram->max));
+}
+
+struct FrameStats*
+frame_stats_create(uint64_t hitch_threshold, uint64_t summary_interval) {
+	struct FrameStats* stats = malloc(sizeof(*stats));
+	if (stats == NULL) {
+		fprintf(stderr, "Out of memory for frame stats\n");
+		return NULL;
+	}
+
+	frame_histogram_reset(&stats->recent);
+	frame_histogram_reset(&stats->overall);
+	stats->hitch_threshold = hitch_threshold;
+	stats->summary_interval = summary_interval;
+	stats->hitch_count = 0;
+	stats->frame_index = 0;
+	stats->frame_start = 0;
+	stats->summary_start = 0;
+	return stats;
+}
+
+void
+frame_stats_free(struct FrameStats* stats) {
+	free(stats);
+}
+
+//Prints the zones recorded since the frame started as an indented tree
+static void
+report_hitch(struct FrameStats* stats, uint64_t duration) {
+	uint32_t count = profile_thread_zones(stats->frame_start, stats->zones, FRAME_HITCH_ZONES);
+
+	fprintf(stderr, "Hitch: frame %llu took %.2f ms\n",
+		(unsigned long long) stats->frame_index, to_ms(duration));
+	for (uint32_t i = 0; i < count; i++) {
+		const struct ProfileZone* zone = &stats->zones[i];
+		fprintf(stderr, "  %*s%s %.2f ms\n", zone->depth * 2, "", zone->name, to_ms(zone->duration));
+	}
+}
+
+void
+frame_stats_frame_end(struct FrameStats* stats) {
+	uint64_t now = profile_now();
+	if (stats->frame_index++ == 0) {
+		stats->frame_start = now;
+		stats->summary_start = now;
+		return;
+	}
+
+	uint64_t duration = now - stats->frame_start;
+	frame_histogram_record(&stats->recent, duration);
+	frame_histogram_record(&stats->overall, duration);
+
+	if (duration > stats->hitch_threshold) {
+		stats->hitch_count++;
+		report_hitch(stats, duration);
+	}
+
+	if (stats->summary_interval != 0 && now - stats->summary_start >= stats->summary_interval) {
+		frame_histogram_print(&stats->recent, "Frame times", stdout);
+		frame_histogram_reset(&stats->recent);
+		stats->summary_start = now;
+	}
+
+	//Taken after reporting so the printing is not blamed on the next frame
+	stats->frame_start = profile_now();
+}
+
+void
+frame_stats_print(const struct FrameStats* stats, FILE* file) {
+	frame_histogram_print(&stats->overall, "Frame times overall", file);
+	fprintf(file, "Hitches: %llu frames over %.2f ms\n",
+		(unsigned long long) stats->hitch_count, to_ms(stats->hitch_threshold));
+}
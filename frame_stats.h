@@ -0,0 +1,63 @@
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "profile.h"
+
+//Log-linear histogram of nanosecond values, HdrHistogram style. Each power
+//of two is split into FRAME_HISTOGRAM_SUB_BUCKETS buckets, so any value is
+//off by at most 1/64 and a fixed 15 KB covers every uint64_t.
+#define FRAME_HISTOGRAM_SUB_BITS 6
+#define FRAME_HISTOGRAM_SUB_BUCKETS (1 << FRAME_HISTOGRAM_SUB_BITS)
+#define FRAME_HISTOGRAM_BUCKETS ((64 - FRAME_HISTOGRAM_SUB_BITS + 1) * FRAME_HISTOGRAM_SUB_BUCKETS)
+
+struct FrameHistogram {
+	uint32_t counts[FRAME_HISTOGRAM_BUCKETS];
+	uint64_t total;
+	uint64_t min;
+	uint64_t max;
+	uint64_t sum;
+};
+
+void frame_histogram_reset(struct FrameHistogram* histogram);
+void frame_histogram_record(struct FrameHistogram* histogram, uint64_t value);
+//percentile in [0, 100], 0 when empty
+uint64_t frame_histogram_percentile(const struct FrameHistogram* histogram, double percentile);
+//One line with the count, mean, p50, p99, p99.9 and max in ms
+void frame_histogram_print(const struct FrameHistogram* histogram, const char* label, FILE* file);
+
+#define FRAME_HITCH_ZONES 64
+
+//Frame time tracking for the main loop. Averages hide the occasional long
+//frame, so every frame goes into the histograms and any frame longer than
+//hitch_threshold has the main thread's profiling zones printed as it
+//happens.
+struct FrameStats {
+	//Since the last summary, and since creation
+	struct FrameHistogram recent;
+	struct FrameHistogram overall;
+
+	uint64_t hitch_threshold;
+	uint64_t summary_interval;
+	uint64_t hitch_count;
+	uint64_t frame_index;
+
+	uint64_t frame_start;
+	uint64_t summary_start;
+	struct ProfileZone zones[FRAME_HITCH_ZONES];
+};
+
+//Thresholds in ns, summary_interval 0 only summarizes on exit. Returns NULL
+//when out of memory.
+struct FrameStats* frame_stats_create(uint64_t hitch_threshold, uint64_t summary_interval);
+void frame_stats_free(struct FrameStats* stats);
+
+//Call once per frame on the main thread, after the frame's zones ended.
+//The first call only starts timing.
+void frame_stats_frame_end(struct FrameStats* stats);
+//Overall histogram and hitch count
+void frame_stats_print(const struct FrameStats* stats, FILE* file);
+
+#endif
@@ -0,0 +1,288 @@
+#include "frustum.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "jobs.h"
+
+#define CULL_BATCH_SIZE 16384
+
+static void
+set_plane(struct Frustum* frustum, int index, const float* a, const float* b, float sign) {
+	float plane[4];
+	for (int i = 0; i < 4; i++) {
+		plane[i] = a[i] + sign * b[i];
+	}
+
+	float length = sqrtf(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+	if (length > 0.0f) {
+		for (int i = 0; i < 4; i++) {
+			plane[i] /= length;
+		}
+	} else {
+		//Degenerate, the infinite far plane. Keep it but let everything pass.
+		plane[0] = plane[1] = plane[2] = 0.0f;
+		plane[3] = 1.0f;
+	}
+
+	memcpy(frustum->planes[index], plane, sizeof(plane));
+}
+
+struct Frustum
+frustum_from_matrix(Matrix4 m, int zero_to_one) {
+	struct Frustum frustum;
+	const float* row0 = &m.e[0];
+	const float* row1 = &m.e[4];
+	const float* row2 = &m.e[8];
+	const float* row3 = &m.e[12];
+	float zero[4] = {0};
+
+	set_plane(&frustum, 0, row3, row0, 1.0f);
+	set_plane(&frustum, 1, row3, row0, -1.0f);
+	set_plane(&frustum, 2, row3, row1, 1.0f);
+	set_plane(&frustum, 3, row3, row1, -1.0f);
+	if (zero_to_one) {
+		set_plane(&frustum, 4, row2, zero, 1.0f);
+	} else {
+		set_plane(&frustum, 4, row3, row2, 1.0f);
+	}
+	set_plane(&frustum, 5, row3, row2, -1.0f);
+
+	return frustum;
+}
+
+//Kernels work on [begin, end) and write absolute indices. Visible indices
+//are always stored and the output cursor only advances for visible
+//objects, so compaction has no branches.
+
+static uint32_t
+cull_spheres_scalar(const struct Frustum* frustum, const struct CullSpheres* spheres,
+		uint32_t begin, uint32_t end, uint32_t* visible) {
+
+	uint32_t out = 0;
+	for (uint32_t i = begin; i < end; i++) {
+		int inside = 1;
+		for (int p = 0; p < 6; p++) {
+			const float* plane = frustum->planes[p];
+			float distance = plane[0] * spheres->x[i] + plane[1] * spheres->y[i] +
+				plane[2] * spheres->z[i] + plane[3];
+			inside &= distance >= -spheres->radius[i];
+		}
+		visible[out] = i;
+		out += (uint32_t) inside;
+	}
+	return out;
+}
+
+static uint32_t
+cull_boxes_scalar(const struct Frustum* frustum, const struct CullBoxes* boxes,
+		uint32_t begin, uint32_t end, uint32_t* visible) {
+
+	uint32_t out = 0;
+	for (uint32_t i = begin; i < end; i++) {
+		int inside = 1;
+		for (int p = 0; p < 6; p++) {
+			const float* plane = frustum->planes[p];
+			float distance = plane[0] * boxes->x[i] + plane[1] * boxes->y[i] +
+				plane[2] * boxes->z[i] + plane[3];
+			float radius = fabsf(plane[0]) * boxes->extent_x[i] + fabsf(plane[1]) * boxes->extent_y[i] +
+				fabsf(plane[2]) * boxes->extent_z[i];
+			inside &= distance >= -radius;
+		}
+		visible[out] = i;
+		out += (uint32_t) inside;
+	}
+	return out;
+}
+
+#if defined(__SSE2__)
+
+static uint32_t
+compact_mask(int mask, uint32_t base, uint32_t* visible) {
+	uint32_t out = 0;
+	for (uint32_t lane = 0; lane < 4; lane++) {
+		visible[out] = base + lane;
+		out += (uint32_t) (mask >> lane) & 1u;
+	}
+	return out;
+}
+
+static uint32_t
+cull_spheres_range(const struct Frustum* frustum, const struct CullSpheres* spheres,
+		uint32_t begin, uint32_t end, uint32_t* visible) {
+
+	__m128 planes[6][4];
+	for (int p = 0; p < 6; p++) {
+		for (int k = 0; k < 4; k++) {
+			planes[p][k] = _mm_set1_ps(frustum->planes[p][k]);
+		}
+	}
+
+	uint32_t out = 0;
+	uint32_t i = begin;
+	for (; i + 4 <= end; i += 4) {
+		__m128 x = _mm_loadu_ps(&spheres->x[i]);
+		__m128 y = _mm_loadu_ps(&spheres->y[i]);
+		__m128 z = _mm_loadu_ps(&spheres->z[i]);
+		__m128 negative_radius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&spheres->radius[i]));
+
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (int p = 0; p < 6; p++) {
+			__m128 distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(planes[p][0], x), _mm_mul_ps(planes[p][1], y)),
+				_mm_add_ps(_mm_mul_ps(planes[p][2], z), planes[p][3]));
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negative_radius));
+		}
+
+		out += compact_mask(_mm_movemask_ps(inside), i, visible + out);
+	}
+
+	return out + cull_spheres_scalar(frustum, spheres, i, end, visible + out);
+}
+
+static uint32_t
+cull_boxes_range(const struct Frustum* frustum, const struct CullBoxes* boxes,
+		uint32_t begin, uint32_t end, uint32_t* visible) {
+
+	__m128 planes[6][4];
+	__m128 absolute[6][3];
+	for (int p = 0; p < 6; p++) {
+		for (int k = 0; k < 4; k++) {
+			planes[p][k] = _mm_set1_ps(frustum->planes[p][k]);
+		}
+		for (int k = 0; k < 3; k++) {
+			absolute[p][k] = _mm_set1_ps(fabsf(frustum->planes[p][k]));
+		}
+	}
+
+	uint32_t out = 0;
+	uint32_t i = begin;
+	for (; i + 4 <= end; i += 4) {
+		__m128 x = _mm_loadu_ps(&boxes->x[i]);
+		__m128 y = _mm_loadu_ps(&boxes->y[i]);
+		__m128 z = _mm_loadu_ps(&boxes->z[i]);
+		__m128 ex = _mm_loadu_ps(&boxes->extent_x[i]);
+		__m128 ey = _mm_loadu_ps(&boxes->extent_y[i]);
+		__m128 ez = _mm_loadu_ps(&boxes->extent_z[i]);
+
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (int p = 0; p < 6; p++) {
+			__m128 distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(planes[p][0], x), _mm_mul_ps(planes[p][1], y)),
+				_mm_add_ps(_mm_mul_ps(planes[p][2], z), planes[p][3]));
+			__m128 radius = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(absolute[p][0], ex), _mm_mul_ps(absolute[p][1], ey)),
+				_mm_mul_ps(absolute[p][2], ez));
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+		}
+
+		out += compact_mask(_mm_movemask_ps(inside), i, visible + out);
+	}
+
+	return out + cull_boxes_scalar(frustum, boxes, i, end, visible + out);
+}
+
+#else
+
+static uint32_t
+cull_spheres_range(const struct Frustum* frustum, const struct CullSpheres* spheres,
+		uint32_t begin, uint32_t end, uint32_t* visible) {
+	return cull_spheres_scalar(frustum, spheres, begin, end, visible);
+}
+
+static uint32_t
+cull_boxes_range(const struct Frustum* frustum, const struct CullBoxes* boxes,
+		uint32_t begin, uint32_t end, uint32_t* visible) {
+	return cull_boxes_scalar(frustum, boxes, begin, end, visible);
+}
+
+#endif
+
+uint32_t
+frustum_cull_spheres(const struct Frustum* frustum, struct CullSpheres spheres, uint32_t* visible) {
+	return cull_spheres_range(frustum, &spheres, 0, spheres.count, visible);
+}
+
+uint32_t
+frustum_cull_boxes(const struct Frustum* frustum, struct CullBoxes boxes, uint32_t* visible) {
+	return cull_boxes_range(frustum, &boxes, 0, boxes.count, visible);
+}
+
+//Every batch writes into its own slice of visible, the slices are packed
+//together once all batches are done
+struct CullJob {
+	const struct Frustum* frustum;
+	const struct CullSpheres* spheres;
+	const struct CullBoxes* boxes;
+	uint32_t count;
+	uint32_t* visible;
+	uint32_t* batch_counts;
+};
+
+static void
+cull_batch(void* user, int batch) {
+	struct CullJob* job = user;
+	uint32_t begin = (uint32_t) batch * CULL_BATCH_SIZE;
+	uint32_t end = begin + CULL_BATCH_SIZE < job->count ? begin + CULL_BATCH_SIZE : job->count;
+
+	if (job->spheres != NULL) {
+		job->batch_counts[batch] = cull_spheres_range(job->frustum, job->spheres, begin, end, job->visible + begin);
+	} else {
+		job->batch_counts[batch] = cull_boxes_range(job->frustum, job->boxes, begin, end, job->visible + begin);
+	}
+}
+
+static uint32_t
+cull_parallel(struct CullJob* job) {
+	int batches = (int) ((job->count + CULL_BATCH_SIZE - 1) / CULL_BATCH_SIZE);
+	uint32_t counts[64];
+	job->batch_counts = batches <= 64 ? counts : malloc((size_t) batches * sizeof(uint32_t));
+	if (job->batch_counts == NULL) {
+		return job->spheres != NULL ?
+			cull_spheres_range(job->frustum, job->spheres, 0, job->count, job->visible) :
+			cull_boxes_range(job->frustum, job->boxes, 0, job->count, job->visible);
+	}
+
+	jobs_parallel_for(batches, cull_batch, job);
+
+	uint32_t total = 0;
+	for (int batch = 0; batch < batches; batch++) {
+		uint32_t begin = (uint32_t) batch * CULL_BATCH_SIZE;
+		if (total != begin) {
+			memmove(job->visible + total, job->visible + begin, job->batch_counts[batch] * sizeof(uint32_t));
+		}
+		total += job->batch_counts[batch];
+	}
+
+	if (job->batch_counts != counts) {
+		free(job->batch_counts);
+	}
+	return total;
+}
+
+uint32_t
+frustum_cull_spheres_parallel(const struct Frustum* frustum, struct CullSpheres spheres, uint32_t* visible) {
+	struct CullJob job = {
+		.frustum = frustum,
+		.spheres = &spheres,
+		.count = spheres.count,
+		.visible = visible
+	};
+	return cull_parallel(&job);
+}
+
+uint32_t
+frustum_cull_boxes_parallel(const struct Frustum* frustum, struct CullBoxes boxes, uint32_t* visible) {
+	struct CullJob job = {
+		.frustum = frustum,
+		.boxes = &boxes,
+		.count = boxes.count,
+		.visible = visible
+	};
+	return cull_parallel(&job);
+}
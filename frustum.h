@@ -0,0 +1,49 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <stdint.h>
+
+#include "every_math.h"
+
+//Planes as (a, b, c, d) with the normal pointing inwards, a point is
+//inside when a*x + b*y + c*z + d >= 0 for all six
+struct Frustum {
+	float planes[6][4];
+};
+
+//Bounding volumes in structure of arrays layout so the kernels load four
+//objects per plane test. Spheres use x, y, z, radius; boxes use x, y, z as
+//the center and extent_x, extent_y, extent_z as half sizes.
+struct CullSpheres {
+	const float* x;
+	const float* y;
+	const float* z;
+	const float* radius;
+	uint32_t count;
+};
+
+struct CullBoxes {
+	const float* x;
+	const float* y;
+	const float* z;
+	const float* extent_x;
+	const float* extent_y;
+	const float* extent_z;
+	uint32_t count;
+};
+
+//Extracts the planes from a row-major projection * view matrix.
+//zero_to_one selects the glClipControl depth range. An infinite far plane
+//comes out as an always passing plane.
+struct Frustum frustum_from_matrix(Matrix4 m, int zero_to_one);
+
+//Write the indices of the visible objects to visible, in increasing order,
+//and return how many there are. visible must hold count entries.
+uint32_t frustum_cull_spheres(const struct Frustum* frustum, struct CullSpheres spheres, uint32_t* visible);
+uint32_t frustum_cull_boxes(const struct Frustum* frustum, struct CullBoxes boxes, uint32_t* visible);
+
+//Same results, spread over the job pool in batches
+uint32_t frustum_cull_spheres_parallel(const struct Frustum* frustum, struct CullSpheres spheres, uint32_t* visible);
+uint32_t frustum_cull_boxes_parallel(const struct Frustum* frustum, struct CullBoxes boxes, uint32_t* visible);
+
+#endif
@@ -0,0 +1,191 @@
+#include "gl_state.h"
+
+#include <string.h>
+
+enum BufferSlot {
+	BUFFER_SLOT_ARRAY,
+	BUFFER_SLOT_ELEMENT_ARRAY,
+	BUFFER_SLOT_UNIFORM,
+	BUFFER_SLOT_PIXEL_UNPACK,
+	BUFFER_SLOT_PIXEL_PACK,
+	BUFFER_SLOT_COPY_READ,
+	BUFFER_SLOT_COPY_WRITE,
+	BUFFER_SLOT_COUNT
+};
+
+struct TextureBinding {
+	GLenum target;
+	unsigned int texture;
+};
+
+//-1 marks a cached value as unknown so the next call is always issued
+static struct {
+	int valid;
+	unsigned int program;
+	unsigned int vao;
+	unsigned int buffers[BUFFER_SLOT_COUNT];
+	unsigned int active_unit;
+	struct TextureBinding textures[GL_STATE_TEXTURE_UNITS];
+	int blend;
+	GLenum blend_source;
+	GLenum blend_destination;
+	float clear_color[4];
+
+	struct GLStateStats stats;
+} state;
+
+static int
+buffer_slot(GLenum target) {
+	switch (target) {
+	case GL_ARRAY_BUFFER: return BUFFER_SLOT_ARRAY;
+	case GL_ELEMENT_ARRAY_BUFFER: return BUFFER_SLOT_ELEMENT_ARRAY;
+	case GL_UNIFORM_BUFFER: return BUFFER_SLOT_UNIFORM;
+	case GL_PIXEL_UNPACK_BUFFER: return BUFFER_SLOT_PIXEL_UNPACK;
+	case GL_PIXEL_PACK_BUFFER: return BUFFER_SLOT_PIXEL_PACK;
+	case GL_COPY_READ_BUFFER: return BUFFER_SLOT_COPY_READ;
+	case GL_COPY_WRITE_BUFFER: return BUFFER_SLOT_COPY_WRITE;
+	default: return -1;
+	}
+}
+
+static void
+ensure_valid(void) {
+	if (state.valid) {
+		return;
+	}
+
+	struct GLStateStats stats = state.stats;
+	memset(&state, 0xff, sizeof(state));
+	state.stats = stats;
+	state.valid = 1;
+}
+
+//Returns 1 when the call has to be issued, counting either way
+static int
+changed(int differs) {
+	if (differs) {
+		state.stats.issued++;
+	} else {
+		state.stats.elided++;
+	}
+	return differs;
+}
+
+void
+gl_state_reset(void) {
+	state.valid = 0;
+}
+
+struct GLStateStats
+gl_state_stats(void) {
+	return state.stats;
+}
+
+void
+gl_state_use_program(unsigned int program) {
+	ensure_valid();
+	if (changed(state.program != program)) {
+		glUseProgram(program);
+		state.program = program;
+	}
+}
+
+void
+gl_state_delete_program(unsigned int program) {
+	ensure_valid();
+	//A bound program outlives glDeleteProgram, unbind so it really goes
+	if (state.program == program) {
+		glUseProgram(0);
+		state.program = 0;
+	}
+	glDeleteProgram(program);
+}
+
+void
+gl_state_bind_vertex_array(unsigned int vao) {
+	ensure_valid();
+	if (changed(state.vao != vao)) {
+		glBindVertexArray(vao);
+		state.vao = vao;
+		//The element array binding is part of the vertex array object
+		state.buffers[BUFFER_SLOT_ELEMENT_ARRAY] = (unsigned int) -1;
+	}
+}
+
+void
+gl_state_bind_buffer(GLenum target, unsigned int buffer) {
+	ensure_valid();
+	int slot = buffer_slot(target);
+	if (slot < 0) {
+		state.stats.issued++;
+		glBindBuffer(target, buffer);
+		return;
+	}
+
+	if (changed(state.buffers[slot] != buffer)) {
+		glBindBuffer(target, buffer);
+		state.buffers[slot] = buffer;
+	}
+}
+
+void
+gl_state_bind_texture(unsigned int unit, GLenum target, unsigned int texture) {
+	ensure_valid();
+	if (unit >= GL_STATE_TEXTURE_UNITS) {
+		state.stats.issued += 2;
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(target, texture);
+		state.active_unit = unit;
+		return;
+	}
+
+	struct TextureBinding* binding = &state.textures[unit];
+	if (binding->target == target && binding->texture == texture) {
+		state.stats.elided++;
+		return;
+	}
+
+	if (changed(state.active_unit != unit)) {
+		glActiveTexture(GL_TEXTURE0 + unit);
+		state.active_unit = unit;
+	}
+
+	state.stats.issued++;
+	glBindTexture(target, texture);
+	binding->target = target;
+	binding->texture = texture;
+}
+
+void
+gl_state_blend(int enabled) {
+	ensure_valid();
+	enabled = enabled != 0;
+	if (changed(state.blend != enabled)) {
+		if (enabled) {
+			glEnable(GL_BLEND);
+		} else {
+			glDisable(GL_BLEND);
+		}
+		state.blend = enabled;
+	}
+}
+
+void
+gl_state_blend_func(GLenum source, GLenum destination) {
+	ensure_valid();
+	if (changed(state.blend_source != source || state.blend_destination != destination)) {
+		glBlendFunc(source, destination);
+		state.blend_source = source;
+		state.blend_destination = destination;
+	}
+}
+
+void
+gl_state_clear_color(float r, float g, float b, float a) {
+	ensure_valid();
+	float color[4] = {r, g, b, a};
+	if (changed(memcmp(state.clear_color, color, sizeof(color)) != 0)) {
+		glClearColor(r, g, b, a);
+		memcpy(state.clear_color, color, sizeof(color));
+	}
+}
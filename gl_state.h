@@ -0,0 +1,32 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+
+#include "glad/glad.h"
+
+//Shadows the bind state of the current context so redundant GL calls can
+//be skipped. Everything that changes this state must go through here, or
+//call gl_state_reset afterwards.
+
+#define GL_STATE_TEXTURE_UNITS 16
+
+struct GLStateStats {
+	unsigned long issued;
+	unsigned long elided;
+};
+
+void gl_state_reset(void);
+struct GLStateStats gl_state_stats(void);
+
+void gl_state_use_program(unsigned int program);
+void gl_state_delete_program(unsigned int program);
+
+void gl_state_bind_vertex_array(unsigned int vao);
+void gl_state_bind_buffer(GLenum target, unsigned int buffer);
+void gl_state_bind_texture(unsigned int unit, GLenum target, unsigned int texture);
+
+void gl_state_blend(int enabled);
+void gl_state_blend_func(GLenum source, GLenum destination);
+
+void gl_state_clear_color(float r, float g, float b, float a);
+
+#endif
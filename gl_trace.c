@@ -0,0 +1,168 @@
+#include "gl_trace.h"
+
+#include "glad/glad.h"
+
+#ifdef GLAD_DEBUG
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+//Comfortably above the number of GL 3.3 entry points
+#define GL_TRACE_SLOTS 2048
+
+struct TraceEntry {
+	//The wrappers pass string literals, so the pointer is the key
+	const char* name;
+	unsigned long total_calls;
+	unsigned long frame_calls;
+	unsigned long last_frame_calls;
+	uint64_t total_ns;
+};
+
+enum RecordState {
+	RECORD_OFF,
+	RECORD_ARMED,
+	RECORD_ON
+};
+
+static struct {
+	struct TraceEntry entries[GL_TRACE_SLOTS];
+	unsigned long frames;
+	uint64_t call_start;
+
+	FILE* record;
+	enum RecordState record_state;
+} trace;
+
+static uint64_t
+now_ns(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint64_t) time.tv_sec * 1000000000u + (uint64_t) time.tv_nsec;
+}
+
+static struct TraceEntry*
+find_entry(const char* name) {
+	uintptr_t hash = ((uintptr_t) name >> 3) * 0x9e3779b97f4a7c15u;
+	uint32_t slot = (uint32_t) (hash >> 32) & (GL_TRACE_SLOTS - 1);
+	while (trace.entries[slot].name != NULL && trace.entries[slot].name != name) {
+		slot = (slot + 1) & (GL_TRACE_SLOTS - 1);
+	}
+	trace.entries[slot].name = name;
+	return &trace.entries[slot];
+}
+
+static void
+pre_call(const char* name, void* function, int argument_count, ...) {
+	trace.call_start = now_ns();
+}
+
+//GL calls never nest, so one start time is enough
+static void
+post_call(const char* name, void* function, int argument_count, ...) {
+	uint64_t elapsed = now_ns() - trace.call_start;
+
+	struct TraceEntry* entry = find_entry(name);
+	entry->total_calls++;
+	entry->frame_calls++;
+	entry->total_ns += elapsed;
+
+	if (trace.record_state == RECORD_ON) {
+		fprintf(trace.record, "%s %llu\n", name, (unsigned long long) elapsed);
+	}
+}
+
+void
+gl_trace_install(void) {
+	glad_set_pre_callback(pre_call);
+	glad_set_post_callback(post_call);
+}
+
+void
+gl_trace_frame_end(void) {
+	for (int i = 0; i < GL_TRACE_SLOTS; i++) {
+		trace.entries[i].last_frame_calls = trace.entries[i].frame_calls;
+		trace.entries[i].frame_calls = 0;
+	}
+	trace.frames++;
+
+	if (trace.record_state == RECORD_ON) {
+		fclose(trace.record);
+		trace.record = NULL;
+		trace.record_state = RECORD_OFF;
+	} else if (trace.record_state == RECORD_ARMED) {
+		fprintf(trace.record, "frame %lu\n", trace.frames);
+		trace.record_state = RECORD_ON;
+	}
+}
+
+int
+gl_trace_record_next_frame(const char* path) {
+	if (trace.record_state != RECORD_OFF) {
+		return 0;
+	}
+
+	trace.record = fopen(path, "w");
+	if (trace.record == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return 0;
+	}
+	trace.record_state = RECORD_ARMED;
+	return 1;
+}
+
+static int
+compare_time(const void* a, const void* b) {
+	const struct TraceEntry* x = a;
+	const struct TraceEntry* y = b;
+	return (x->total_ns < y->total_ns) - (x->total_ns > y->total_ns);
+}
+
+void
+gl_trace_print(FILE* file) {
+	struct TraceEntry* sorted = malloc(sizeof(trace.entries));
+	if (sorted == NULL) {
+		return;
+	}
+
+	int count = 0;
+	for (int i = 0; i < GL_TRACE_SLOTS; i++) {
+		if (trace.entries[i].name != NULL) {
+			sorted[count++] = trace.entries[i];
+		}
+	}
+	qsort(sorted, count, sizeof(*sorted), compare_time);
+
+	unsigned long frames = trace.frames ? trace.frames : 1;
+	fprintf(file, "%-32s %10s %10s %10s %10s %10s\n",
+		"function", "calls", "per frame", "last", "total ms", "us/call");
+	for (int i = 0; i < count; i++) {
+		fprintf(file, "%-32s %10lu %10.1f %10lu %10.3f %10.3f\n",
+			sorted[i].name, sorted[i].total_calls, (double) sorted[i].total_calls / frames,
+			sorted[i].last_frame_calls, sorted[i].total_ns / 1e6,
+			sorted[i].total_ns / 1e3 / sorted[i].total_calls);
+	}
+	free(sorted);
+}
+
+#else
+
+void
+gl_trace_install(void) {
+}
+
+void
+gl_trace_frame_end(void) {
+}
+
+int
+gl_trace_record_next_frame(const char* path) {
+	return 0;
+}
+
+void
+gl_trace_print(FILE* file) {
+}
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <stdio.h>
+
+//Counts and times every GL call through the glad debug wrappers. Only
+//builds with GLAD_DEBUG defined (make GL_TRACE=1) have those wrappers, in
+//any other build these functions do nothing.
+
+void gl_trace_install(void);
+//Closes the current frame's counters, and a recording if one is running
+void gl_trace_frame_end(void);
+//Writes every call of the next frame, with the time spent in it, to path
+int gl_trace_record_next_frame(const char* path);
+//Per function totals, most expensive first
+void gl_trace_print(FILE* file);
+
+#endif
@@ -85,6 +85,11 @@ GLAPI struct gladGLversionStruct GLVersion;
 GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
+/* Same as gladLoadGLLoader, but entry points resolve on their first call.
+ * load must stay valid, and the context current, for the rest of the run. */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+/* Hash lookup in the extensions found by the last successful load */
+GLAPI int gladHasExtension(const char *ext);
 
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
@@ -3604,6 +3609,2187 @@ GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
 
+#ifdef GLAD_DEBUG
+/* Debug build, see glad_set_pre_callback. funcptr is the real function and
+ * the call's arguments follow len_args, promoted as for any variadic call. */
+typedef void (*GLADcallback)(const char *name, void *funcptr, int len_args, ...);
+GLAPI void glad_set_pre_callback(GLADcallback cb);
+GLAPI void glad_set_post_callback(GLADcallback cb);
+
+GLAPI PFNGLCULLFACEPROC glad_debug_glCullFace;
+#undef glCullFace
+#define glCullFace glad_debug_glCullFace
+GLAPI PFNGLFRONTFACEPROC glad_debug_glFrontFace;
+#undef glFrontFace
+#define glFrontFace glad_debug_glFrontFace
+GLAPI PFNGLHINTPROC glad_debug_glHint;
+#undef glHint
+#define glHint glad_debug_glHint
+GLAPI PFNGLLINEWIDTHPROC glad_debug_glLineWidth;
+#undef glLineWidth
+#define glLineWidth glad_debug_glLineWidth
+GLAPI PFNGLPOINTSIZEPROC glad_debug_glPointSize;
+#undef glPointSize
+#define glPointSize glad_debug_glPointSize
+GLAPI PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode;
+#undef glPolygonMode
+#define glPolygonMode glad_debug_glPolygonMode
+GLAPI PFNGLSCISSORPROC glad_debug_glScissor;
+#undef glScissor
+#define glScissor glad_debug_glScissor
+GLAPI PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf;
+#undef glTexParameterf
+#define glTexParameterf glad_debug_glTexParameterf
+GLAPI PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv;
+#undef glTexParameterfv
+#define glTexParameterfv glad_debug_glTexParameterfv
+GLAPI PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri;
+#undef glTexParameteri
+#define glTexParameteri glad_debug_glTexParameteri
+GLAPI PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv;
+#undef glTexParameteriv
+#define glTexParameteriv glad_debug_glTexParameteriv
+GLAPI PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D;
+#undef glTexImage1D
+#define glTexImage1D glad_debug_glTexImage1D
+GLAPI PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D;
+#undef glTexImage2D
+#define glTexImage2D glad_debug_glTexImage2D
+GLAPI PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer;
+#undef glDrawBuffer
+#define glDrawBuffer glad_debug_glDrawBuffer
+GLAPI PFNGLCLEARPROC glad_debug_glClear;
+#undef glClear
+#define glClear glad_debug_glClear
+GLAPI PFNGLCLEARCOLORPROC glad_debug_glClearColor;
+#undef glClearColor
+#define glClearColor glad_debug_glClearColor
+GLAPI PFNGLCLEARSTENCILPROC glad_debug_glClearStencil;
+#undef glClearStencil
+#define glClearStencil glad_debug_glClearStencil
+GLAPI PFNGLCLEARDEPTHPROC glad_debug_glClearDepth;
+#undef glClearDepth
+#define glClearDepth glad_debug_glClearDepth
+GLAPI PFNGLSTENCILMASKPROC glad_debug_glStencilMask;
+#undef glStencilMask
+#define glStencilMask glad_debug_glStencilMask
+GLAPI PFNGLCOLORMASKPROC glad_debug_glColorMask;
+#undef glColorMask
+#define glColorMask glad_debug_glColorMask
+GLAPI PFNGLDEPTHMASKPROC glad_debug_glDepthMask;
+#undef glDepthMask
+#define glDepthMask glad_debug_glDepthMask
+GLAPI PFNGLDISABLEPROC glad_debug_glDisable;
+#undef glDisable
+#define glDisable glad_debug_glDisable
+GLAPI PFNGLENABLEPROC glad_debug_glEnable;
+#undef glEnable
+#define glEnable glad_debug_glEnable
+GLAPI PFNGLFINISHPROC glad_debug_glFinish;
+#undef glFinish
+#define glFinish glad_debug_glFinish
+GLAPI PFNGLFLUSHPROC glad_debug_glFlush;
+#undef glFlush
+#define glFlush glad_debug_glFlush
+GLAPI PFNGLBLENDFUNCPROC glad_debug_glBlendFunc;
+#undef glBlendFunc
+#define glBlendFunc glad_debug_glBlendFunc
+GLAPI PFNGLLOGICOPPROC glad_debug_glLogicOp;
+#undef glLogicOp
+#define glLogicOp glad_debug_glLogicOp
+GLAPI PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc;
+#undef glStencilFunc
+#define glStencilFunc glad_debug_glStencilFunc
+GLAPI PFNGLSTENCILOPPROC glad_debug_glStencilOp;
+#undef glStencilOp
+#define glStencilOp glad_debug_glStencilOp
+GLAPI PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc;
+#undef glDepthFunc
+#define glDepthFunc glad_debug_glDepthFunc
+GLAPI PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref;
+#undef glPixelStoref
+#define glPixelStoref glad_debug_glPixelStoref
+GLAPI PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei;
+#undef glPixelStorei
+#define glPixelStorei glad_debug_glPixelStorei
+GLAPI PFNGLREADBUFFERPROC glad_debug_glReadBuffer;
+#undef glReadBuffer
+#define glReadBuffer glad_debug_glReadBuffer
+GLAPI PFNGLREADPIXELSPROC glad_debug_glReadPixels;
+#undef glReadPixels
+#define glReadPixels glad_debug_glReadPixels
+GLAPI PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv;
+#undef glGetBooleanv
+#define glGetBooleanv glad_debug_glGetBooleanv
+GLAPI PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev;
+#undef glGetDoublev
+#define glGetDoublev glad_debug_glGetDoublev
+GLAPI PFNGLGETERRORPROC glad_debug_glGetError;
+#undef glGetError
+#define glGetError glad_debug_glGetError
+GLAPI PFNGLGETFLOATVPROC glad_debug_glGetFloatv;
+#undef glGetFloatv
+#define glGetFloatv glad_debug_glGetFloatv
+GLAPI PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv;
+#undef glGetIntegerv
+#define glGetIntegerv glad_debug_glGetIntegerv
+GLAPI PFNGLGETSTRINGPROC glad_debug_glGetString;
+#undef glGetString
+#define glGetString glad_debug_glGetString
+GLAPI PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage;
+#undef glGetTexImage
+#define glGetTexImage glad_debug_glGetTexImage
+GLAPI PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv;
+#undef glGetTexParameterfv
+#define glGetTexParameterfv glad_debug_glGetTexParameterfv
+GLAPI PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv;
+#undef glGetTexParameteriv
+#define glGetTexParameteriv glad_debug_glGetTexParameteriv
+GLAPI PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv;
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv glad_debug_glGetTexLevelParameterfv
+GLAPI PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv;
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv glad_debug_glGetTexLevelParameteriv
+GLAPI PFNGLISENABLEDPROC glad_debug_glIsEnabled;
+#undef glIsEnabled
+#define glIsEnabled glad_debug_glIsEnabled
+GLAPI PFNGLDEPTHRANGEPROC glad_debug_glDepthRange;
+#undef glDepthRange
+#define glDepthRange glad_debug_glDepthRange
+GLAPI PFNGLVIEWPORTPROC glad_debug_glViewport;
+#undef glViewport
+#define glViewport glad_debug_glViewport
+GLAPI PFNGLNEWLISTPROC glad_debug_glNewList;
+#undef glNewList
+#define glNewList glad_debug_glNewList
+GLAPI PFNGLENDLISTPROC glad_debug_glEndList;
+#undef glEndList
+#define glEndList glad_debug_glEndList
+GLAPI PFNGLCALLLISTPROC glad_debug_glCallList;
+#undef glCallList
+#define glCallList glad_debug_glCallList
+GLAPI PFNGLCALLLISTSPROC glad_debug_glCallLists;
+#undef glCallLists
+#define glCallLists glad_debug_glCallLists
+GLAPI PFNGLDELETELISTSPROC glad_debug_glDeleteLists;
+#undef glDeleteLists
+#define glDeleteLists glad_debug_glDeleteLists
+GLAPI PFNGLGENLISTSPROC glad_debug_glGenLists;
+#undef glGenLists
+#define glGenLists glad_debug_glGenLists
+GLAPI PFNGLLISTBASEPROC glad_debug_glListBase;
+#undef glListBase
+#define glListBase glad_debug_glListBase
+GLAPI PFNGLBEGINPROC glad_debug_glBegin;
+#undef glBegin
+#define glBegin glad_debug_glBegin
+GLAPI PFNGLBITMAPPROC glad_debug_glBitmap;
+#undef glBitmap
+#define glBitmap glad_debug_glBitmap
+GLAPI PFNGLCOLOR3BPROC glad_debug_glColor3b;
+#undef glColor3b
+#define glColor3b glad_debug_glColor3b
+GLAPI PFNGLCOLOR3BVPROC glad_debug_glColor3bv;
+#undef glColor3bv
+#define glColor3bv glad_debug_glColor3bv
+GLAPI PFNGLCOLOR3DPROC glad_debug_glColor3d;
+#undef glColor3d
+#define glColor3d glad_debug_glColor3d
+GLAPI PFNGLCOLOR3DVPROC glad_debug_glColor3dv;
+#undef glColor3dv
+#define glColor3dv glad_debug_glColor3dv
+GLAPI PFNGLCOLOR3FPROC glad_debug_glColor3f;
+#undef glColor3f
+#define glColor3f glad_debug_glColor3f
+GLAPI PFNGLCOLOR3FVPROC glad_debug_glColor3fv;
+#undef glColor3fv
+#define glColor3fv glad_debug_glColor3fv
+GLAPI PFNGLCOLOR3IPROC glad_debug_glColor3i;
+#undef glColor3i
+#define glColor3i glad_debug_glColor3i
+GLAPI PFNGLCOLOR3IVPROC glad_debug_glColor3iv;
+#undef glColor3iv
+#define glColor3iv glad_debug_glColor3iv
+GLAPI PFNGLCOLOR3SPROC glad_debug_glColor3s;
+#undef glColor3s
+#define glColor3s glad_debug_glColor3s
+GLAPI PFNGLCOLOR3SVPROC glad_debug_glColor3sv;
+#undef glColor3sv
+#define glColor3sv glad_debug_glColor3sv
+GLAPI PFNGLCOLOR3UBPROC glad_debug_glColor3ub;
+#undef glColor3ub
+#define glColor3ub glad_debug_glColor3ub
+GLAPI PFNGLCOLOR3UBVPROC glad_debug_glColor3ubv;
+#undef glColor3ubv
+#define glColor3ubv glad_debug_glColor3ubv
+GLAPI PFNGLCOLOR3UIPROC glad_debug_glColor3ui;
+#undef glColor3ui
+#define glColor3ui glad_debug_glColor3ui
+GLAPI PFNGLCOLOR3UIVPROC glad_debug_glColor3uiv;
+#undef glColor3uiv
+#define glColor3uiv glad_debug_glColor3uiv
+GLAPI PFNGLCOLOR3USPROC glad_debug_glColor3us;
+#undef glColor3us
+#define glColor3us glad_debug_glColor3us
+GLAPI PFNGLCOLOR3USVPROC glad_debug_glColor3usv;
+#undef glColor3usv
+#define glColor3usv glad_debug_glColor3usv
+GLAPI PFNGLCOLOR4BPROC glad_debug_glColor4b;
+#undef glColor4b
+#define glColor4b glad_debug_glColor4b
+GLAPI PFNGLCOLOR4BVPROC glad_debug_glColor4bv;
+#undef glColor4bv
+#define glColor4bv glad_debug_glColor4bv
+GLAPI PFNGLCOLOR4DPROC glad_debug_glColor4d;
+#undef glColor4d
+#define glColor4d glad_debug_glColor4d
+GLAPI PFNGLCOLOR4DVPROC glad_debug_glColor4dv;
+#undef glColor4dv
+#define glColor4dv glad_debug_glColor4dv
+GLAPI PFNGLCOLOR4FPROC glad_debug_glColor4f;
+#undef glColor4f
+#define glColor4f glad_debug_glColor4f
+GLAPI PFNGLCOLOR4FVPROC glad_debug_glColor4fv;
+#undef glColor4fv
+#define glColor4fv glad_debug_glColor4fv
+GLAPI PFNGLCOLOR4IPROC glad_debug_glColor4i;
+#undef glColor4i
+#define glColor4i glad_debug_glColor4i
+GLAPI PFNGLCOLOR4IVPROC glad_debug_glColor4iv;
+#undef glColor4iv
+#define glColor4iv glad_debug_glColor4iv
+GLAPI PFNGLCOLOR4SPROC glad_debug_glColor4s;
+#undef glColor4s
+#define glColor4s glad_debug_glColor4s
+GLAPI PFNGLCOLOR4SVPROC glad_debug_glColor4sv;
+#undef glColor4sv
+#define glColor4sv glad_debug_glColor4sv
+GLAPI PFNGLCOLOR4UBPROC glad_debug_glColor4ub;
+#undef glColor4ub
+#define glColor4ub glad_debug_glColor4ub
+GLAPI PFNGLCOLOR4UBVPROC glad_debug_glColor4ubv;
+#undef glColor4ubv
+#define glColor4ubv glad_debug_glColor4ubv
+GLAPI PFNGLCOLOR4UIPROC glad_debug_glColor4ui;
+#undef glColor4ui
+#define glColor4ui glad_debug_glColor4ui
+GLAPI PFNGLCOLOR4UIVPROC glad_debug_glColor4uiv;
+#undef glColor4uiv
+#define glColor4uiv glad_debug_glColor4uiv
+GLAPI PFNGLCOLOR4USPROC glad_debug_glColor4us;
+#undef glColor4us
+#define glColor4us glad_debug_glColor4us
+GLAPI PFNGLCOLOR4USVPROC glad_debug_glColor4usv;
+#undef glColor4usv
+#define glColor4usv glad_debug_glColor4usv
+GLAPI PFNGLEDGEFLAGPROC glad_debug_glEdgeFlag;
+#undef glEdgeFlag
+#define glEdgeFlag glad_debug_glEdgeFlag
+GLAPI PFNGLEDGEFLAGVPROC glad_debug_glEdgeFlagv;
+#undef glEdgeFlagv
+#define glEdgeFlagv glad_debug_glEdgeFlagv
+GLAPI PFNGLENDPROC glad_debug_glEnd;
+#undef glEnd
+#define glEnd glad_debug_glEnd
+GLAPI PFNGLINDEXDPROC glad_debug_glIndexd;
+#undef glIndexd
+#define glIndexd glad_debug_glIndexd
+GLAPI PFNGLINDEXDVPROC glad_debug_glIndexdv;
+#undef glIndexdv
+#define glIndexdv glad_debug_glIndexdv
+GLAPI PFNGLINDEXFPROC glad_debug_glIndexf;
+#undef glIndexf
+#define glIndexf glad_debug_glIndexf
+GLAPI PFNGLINDEXFVPROC glad_debug_glIndexfv;
+#undef glIndexfv
+#define glIndexfv glad_debug_glIndexfv
+GLAPI PFNGLINDEXIPROC glad_debug_glIndexi;
+#undef glIndexi
+#define glIndexi glad_debug_glIndexi
+GLAPI PFNGLINDEXIVPROC glad_debug_glIndexiv;
+#undef glIndexiv
+#define glIndexiv glad_debug_glIndexiv
+GLAPI PFNGLINDEXSPROC glad_debug_glIndexs;
+#undef glIndexs
+#define glIndexs glad_debug_glIndexs
+GLAPI PFNGLINDEXSVPROC glad_debug_glIndexsv;
+#undef glIndexsv
+#define glIndexsv glad_debug_glIndexsv
+GLAPI PFNGLNORMAL3BPROC glad_debug_glNormal3b;
+#undef glNormal3b
+#define glNormal3b glad_debug_glNormal3b
+GLAPI PFNGLNORMAL3BVPROC glad_debug_glNormal3bv;
+#undef glNormal3bv
+#define glNormal3bv glad_debug_glNormal3bv
+GLAPI PFNGLNORMAL3DPROC glad_debug_glNormal3d;
+#undef glNormal3d
+#define glNormal3d glad_debug_glNormal3d
+GLAPI PFNGLNORMAL3DVPROC glad_debug_glNormal3dv;
+#undef glNormal3dv
+#define glNormal3dv glad_debug_glNormal3dv
+GLAPI PFNGLNORMAL3FPROC glad_debug_glNormal3f;
+#undef glNormal3f
+#define glNormal3f glad_debug_glNormal3f
+GLAPI PFNGLNORMAL3FVPROC glad_debug_glNormal3fv;
+#undef glNormal3fv
+#define glNormal3fv glad_debug_glNormal3fv
+GLAPI PFNGLNORMAL3IPROC glad_debug_glNormal3i;
+#undef glNormal3i
+#define glNormal3i glad_debug_glNormal3i
+GLAPI PFNGLNORMAL3IVPROC glad_debug_glNormal3iv;
+#undef glNormal3iv
+#define glNormal3iv glad_debug_glNormal3iv
+GLAPI PFNGLNORMAL3SPROC glad_debug_glNormal3s;
+#undef glNormal3s
+#define glNormal3s glad_debug_glNormal3s
+GLAPI PFNGLNORMAL3SVPROC glad_debug_glNormal3sv;
+#undef glNormal3sv
+#define glNormal3sv glad_debug_glNormal3sv
+GLAPI PFNGLRASTERPOS2DPROC glad_debug_glRasterPos2d;
+#undef glRasterPos2d
+#define glRasterPos2d glad_debug_glRasterPos2d
+GLAPI PFNGLRASTERPOS2DVPROC glad_debug_glRasterPos2dv;
+#undef glRasterPos2dv
+#define glRasterPos2dv glad_debug_glRasterPos2dv
+GLAPI PFNGLRASTERPOS2FPROC glad_debug_glRasterPos2f;
+#undef glRasterPos2f
+#define glRasterPos2f glad_debug_glRasterPos2f
+GLAPI PFNGLRASTERPOS2FVPROC glad_debug_glRasterPos2fv;
+#undef glRasterPos2fv
+#define glRasterPos2fv glad_debug_glRasterPos2fv
+GLAPI PFNGLRASTERPOS2IPROC glad_debug_glRasterPos2i;
+#undef glRasterPos2i
+#define glRasterPos2i glad_debug_glRasterPos2i
+GLAPI PFNGLRASTERPOS2IVPROC glad_debug_glRasterPos2iv;
+#undef glRasterPos2iv
+#define glRasterPos2iv glad_debug_glRasterPos2iv
+GLAPI PFNGLRASTERPOS2SPROC glad_debug_glRasterPos2s;
+#undef glRasterPos2s
+#define glRasterPos2s glad_debug_glRasterPos2s
+GLAPI PFNGLRASTERPOS2SVPROC glad_debug_glRasterPos2sv;
+#undef glRasterPos2sv
+#define glRasterPos2sv glad_debug_glRasterPos2sv
+GLAPI PFNGLRASTERPOS3DPROC glad_debug_glRasterPos3d;
+#undef glRasterPos3d
+#define glRasterPos3d glad_debug_glRasterPos3d
+GLAPI PFNGLRASTERPOS3DVPROC glad_debug_glRasterPos3dv;
+#undef glRasterPos3dv
+#define glRasterPos3dv glad_debug_glRasterPos3dv
+GLAPI PFNGLRASTERPOS3FPROC glad_debug_glRasterPos3f;
+#undef glRasterPos3f
+#define glRasterPos3f glad_debug_glRasterPos3f
+GLAPI PFNGLRASTERPOS3FVPROC glad_debug_glRasterPos3fv;
+#undef glRasterPos3fv
+#define glRasterPos3fv glad_debug_glRasterPos3fv
+GLAPI PFNGLRASTERPOS3IPROC glad_debug_glRasterPos3i;
+#undef glRasterPos3i
+#define glRasterPos3i glad_debug_glRasterPos3i
+GLAPI PFNGLRASTERPOS3IVPROC glad_debug_glRasterPos3iv;
+#undef glRasterPos3iv
+#define glRasterPos3iv glad_debug_glRasterPos3iv
+GLAPI PFNGLRASTERPOS3SPROC glad_debug_glRasterPos3s;
+#undef glRasterPos3s
+#define glRasterPos3s glad_debug_glRasterPos3s
+GLAPI PFNGLRASTERPOS3SVPROC glad_debug_glRasterPos3sv;
+#undef glRasterPos3sv
+#define glRasterPos3sv glad_debug_glRasterPos3sv
+GLAPI PFNGLRASTERPOS4DPROC glad_debug_glRasterPos4d;
+#undef glRasterPos4d
+#define glRasterPos4d glad_debug_glRasterPos4d
+GLAPI PFNGLRASTERPOS4DVPROC glad_debug_glRasterPos4dv;
+#undef glRasterPos4dv
+#define glRasterPos4dv glad_debug_glRasterPos4dv
+GLAPI PFNGLRASTERPOS4FPROC glad_debug_glRasterPos4f;
+#undef glRasterPos4f
+#define glRasterPos4f glad_debug_glRasterPos4f
+GLAPI PFNGLRASTERPOS4FVPROC glad_debug_glRasterPos4fv;
+#undef glRasterPos4fv
+#define glRasterPos4fv glad_debug_glRasterPos4fv
+GLAPI PFNGLRASTERPOS4IPROC glad_debug_glRasterPos4i;
+#undef glRasterPos4i
+#define glRasterPos4i glad_debug_glRasterPos4i
+GLAPI PFNGLRASTERPOS4IVPROC glad_debug_glRasterPos4iv;
+#undef glRasterPos4iv
+#define glRasterPos4iv glad_debug_glRasterPos4iv
+GLAPI PFNGLRASTERPOS4SPROC glad_debug_glRasterPos4s;
+#undef glRasterPos4s
+#define glRasterPos4s glad_debug_glRasterPos4s
+GLAPI PFNGLRASTERPOS4SVPROC glad_debug_glRasterPos4sv;
+#undef glRasterPos4sv
+#define glRasterPos4sv glad_debug_glRasterPos4sv
+GLAPI PFNGLRECTDPROC glad_debug_glRectd;
+#undef glRectd
+#define glRectd glad_debug_glRectd
+GLAPI PFNGLRECTDVPROC glad_debug_glRectdv;
+#undef glRectdv
+#define glRectdv glad_debug_glRectdv
+GLAPI PFNGLRECTFPROC glad_debug_glRectf;
+#undef glRectf
+#define glRectf glad_debug_glRectf
+GLAPI PFNGLRECTFVPROC glad_debug_glRectfv;
+#undef glRectfv
+#define glRectfv glad_debug_glRectfv
+GLAPI PFNGLRECTIPROC glad_debug_glRecti;
+#undef glRecti
+#define glRecti glad_debug_glRecti
+GLAPI PFNGLRECTIVPROC glad_debug_glRectiv;
+#undef glRectiv
+#define glRectiv glad_debug_glRectiv
+GLAPI PFNGLRECTSPROC glad_debug_glRects;
+#undef glRects
+#define glRects glad_debug_glRects
+GLAPI PFNGLRECTSVPROC glad_debug_glRectsv;
+#undef glRectsv
+#define glRectsv glad_debug_glRectsv
+GLAPI PFNGLTEXCOORD1DPROC glad_debug_glTexCoord1d;
+#undef glTexCoord1d
+#define glTexCoord1d glad_debug_glTexCoord1d
+GLAPI PFNGLTEXCOORD1DVPROC glad_debug_glTexCoord1dv;
+#undef glTexCoord1dv
+#define glTexCoord1dv glad_debug_glTexCoord1dv
+GLAPI PFNGLTEXCOORD1FPROC glad_debug_glTexCoord1f;
+#undef glTexCoord1f
+#define glTexCoord1f glad_debug_glTexCoord1f
+GLAPI PFNGLTEXCOORD1FVPROC glad_debug_glTexCoord1fv;
+#undef glTexCoord1fv
+#define glTexCoord1fv glad_debug_glTexCoord1fv
+GLAPI PFNGLTEXCOORD1IPROC glad_debug_glTexCoord1i;
+#undef glTexCoord1i
+#define glTexCoord1i glad_debug_glTexCoord1i
+GLAPI PFNGLTEXCOORD1IVPROC glad_debug_glTexCoord1iv;
+#undef glTexCoord1iv
+#define glTexCoord1iv glad_debug_glTexCoord1iv
+GLAPI PFNGLTEXCOORD1SPROC glad_debug_glTexCoord1s;
+#undef glTexCoord1s
+#define glTexCoord1s glad_debug_glTexCoord1s
+GLAPI PFNGLTEXCOORD1SVPROC glad_debug_glTexCoord1sv;
+#undef glTexCoord1sv
+#define glTexCoord1sv glad_debug_glTexCoord1sv
+GLAPI PFNGLTEXCOORD2DPROC glad_debug_glTexCoord2d;
+#undef glTexCoord2d
+#define glTexCoord2d glad_debug_glTexCoord2d
+GLAPI PFNGLTEXCOORD2DVPROC glad_debug_glTexCoord2dv;
+#undef glTexCoord2dv
+#define glTexCoord2dv glad_debug_glTexCoord2dv
+GLAPI PFNGLTEXCOORD2FPROC glad_debug_glTexCoord2f;
+#undef glTexCoord2f
+#define glTexCoord2f glad_debug_glTexCoord2f
+GLAPI PFNGLTEXCOORD2FVPROC glad_debug_glTexCoord2fv;
+#undef glTexCoord2fv
+#define glTexCoord2fv glad_debug_glTexCoord2fv
+GLAPI PFNGLTEXCOORD2IPROC glad_debug_glTexCoord2i;
+#undef glTexCoord2i
+#define glTexCoord2i glad_debug_glTexCoord2i
+GLAPI PFNGLTEXCOORD2IVPROC glad_debug_glTexCoord2iv;
+#undef glTexCoord2iv
+#define glTexCoord2iv glad_debug_glTexCoord2iv
+GLAPI PFNGLTEXCOORD2SPROC glad_debug_glTexCoord2s;
+#undef glTexCoord2s
+#define glTexCoord2s glad_debug_glTexCoord2s
+GLAPI PFNGLTEXCOORD2SVPROC glad_debug_glTexCoord2sv;
+#undef glTexCoord2sv
+#define glTexCoord2sv glad_debug_glTexCoord2sv
+GLAPI PFNGLTEXCOORD3DPROC glad_debug_glTexCoord3d;
+#undef glTexCoord3d
+#define glTexCoord3d glad_debug_glTexCoord3d
+GLAPI PFNGLTEXCOORD3DVPROC glad_debug_glTexCoord3dv;
+#undef glTexCoord3dv
+#define glTexCoord3dv glad_debug_glTexCoord3dv
+GLAPI PFNGLTEXCOORD3FPROC glad_debug_glTexCoord3f;
+#undef glTexCoord3f
+#define glTexCoord3f glad_debug_glTexCoord3f
+GLAPI PFNGLTEXCOORD3FVPROC glad_debug_glTexCoord3fv;
+#undef glTexCoord3fv
+#define glTexCoord3fv glad_debug_glTexCoord3fv
+GLAPI PFNGLTEXCOORD3IPROC glad_debug_glTexCoord3i;
+#undef glTexCoord3i
+#define glTexCoord3i glad_debug_glTexCoord3i
+GLAPI PFNGLTEXCOORD3IVPROC glad_debug_glTexCoord3iv;
+#undef glTexCoord3iv
+#define glTexCoord3iv glad_debug_glTexCoord3iv
+GLAPI PFNGLTEXCOORD3SPROC glad_debug_glTexCoord3s;
+#undef glTexCoord3s
+#define glTexCoord3s glad_debug_glTexCoord3s
+GLAPI PFNGLTEXCOORD3SVPROC glad_debug_glTexCoord3sv;
+#undef glTexCoord3sv
+#define glTexCoord3sv glad_debug_glTexCoord3sv
+GLAPI PFNGLTEXCOORD4DPROC glad_debug_glTexCoord4d;
+#undef glTexCoord4d
+#define glTexCoord4d glad_debug_glTexCoord4d
+GLAPI PFNGLTEXCOORD4DVPROC glad_debug_glTexCoord4dv;
+#undef glTexCoord4dv
+#define glTexCoord4dv glad_debug_glTexCoord4dv
+GLAPI PFNGLTEXCOORD4FPROC glad_debug_glTexCoord4f;
+#undef glTexCoord4f
+#define glTexCoord4f glad_debug_glTexCoord4f
+GLAPI PFNGLTEXCOORD4FVPROC glad_debug_glTexCoord4fv;
+#undef glTexCoord4fv
+#define glTexCoord4fv glad_debug_glTexCoord4fv
+GLAPI PFNGLTEXCOORD4IPROC glad_debug_glTexCoord4i;
+#undef glTexCoord4i
+#define glTexCoord4i glad_debug_glTexCoord4i
+GLAPI PFNGLTEXCOORD4IVPROC glad_debug_glTexCoord4iv;
+#undef glTexCoord4iv
+#define glTexCoord4iv glad_debug_glTexCoord4iv
+GLAPI PFNGLTEXCOORD4SPROC glad_debug_glTexCoord4s;
+#undef glTexCoord4s
+#define glTexCoord4s glad_debug_glTexCoord4s
+GLAPI PFNGLTEXCOORD4SVPROC glad_debug_glTexCoord4sv;
+#undef glTexCoord4sv
+#define glTexCoord4sv glad_debug_glTexCoord4sv
+GLAPI PFNGLVERTEX2DPROC glad_debug_glVertex2d;
+#undef glVertex2d
+#define glVertex2d glad_debug_glVertex2d
+GLAPI PFNGLVERTEX2DVPROC glad_debug_glVertex2dv;
+#undef glVertex2dv
+#define glVertex2dv glad_debug_glVertex2dv
+GLAPI PFNGLVERTEX2FPROC glad_debug_glVertex2f;
+#undef glVertex2f
+#define glVertex2f glad_debug_glVertex2f
+GLAPI PFNGLVERTEX2FVPROC glad_debug_glVertex2fv;
+#undef glVertex2fv
+#define glVertex2fv glad_debug_glVertex2fv
+GLAPI PFNGLVERTEX2IPROC glad_debug_glVertex2i;
+#undef glVertex2i
+#define glVertex2i glad_debug_glVertex2i
+GLAPI PFNGLVERTEX2IVPROC glad_debug_glVertex2iv;
+#undef glVertex2iv
+#define glVertex2iv glad_debug_glVertex2iv
+GLAPI PFNGLVERTEX2SPROC glad_debug_glVertex2s;
+#undef glVertex2s
+#define glVertex2s glad_debug_glVertex2s
+GLAPI PFNGLVERTEX2SVPROC glad_debug_glVertex2sv;
+#undef glVertex2sv
+#define glVertex2sv glad_debug_glVertex2sv
+GLAPI PFNGLVERTEX3DPROC glad_debug_glVertex3d;
+#undef glVertex3d
+#define glVertex3d glad_debug_glVertex3d
+GLAPI PFNGLVERTEX3DVPROC glad_debug_glVertex3dv;
+#undef glVertex3dv
+#define glVertex3dv glad_debug_glVertex3dv
+GLAPI PFNGLVERTEX3FPROC glad_debug_glVertex3f;
+#undef glVertex3f
+#define glVertex3f glad_debug_glVertex3f
+GLAPI PFNGLVERTEX3FVPROC glad_debug_glVertex3fv;
+#undef glVertex3fv
+#define glVertex3fv glad_debug_glVertex3fv
+GLAPI PFNGLVERTEX3IPROC glad_debug_glVertex3i;
+#undef glVertex3i
+#define glVertex3i glad_debug_glVertex3i
+GLAPI PFNGLVERTEX3IVPROC glad_debug_glVertex3iv;
+#undef glVertex3iv
+#define glVertex3iv glad_debug_glVertex3iv
+GLAPI PFNGLVERTEX3SPROC glad_debug_glVertex3s;
+#undef glVertex3s
+#define glVertex3s glad_debug_glVertex3s
+GLAPI PFNGLVERTEX3SVPROC glad_debug_glVertex3sv;
+#undef glVertex3sv
+#define glVertex3sv glad_debug_glVertex3sv
+GLAPI PFNGLVERTEX4DPROC glad_debug_glVertex4d;
+#undef glVertex4d
+#define glVertex4d glad_debug_glVertex4d
+GLAPI PFNGLVERTEX4DVPROC glad_debug_glVertex4dv;
+#undef glVertex4dv
+#define glVertex4dv glad_debug_glVertex4dv
+GLAPI PFNGLVERTEX4FPROC glad_debug_glVertex4f;
+#undef glVertex4f
+#define glVertex4f glad_debug_glVertex4f
+GLAPI PFNGLVERTEX4FVPROC glad_debug_glVertex4fv;
+#undef glVertex4fv
+#define glVertex4fv glad_debug_glVertex4fv
+GLAPI PFNGLVERTEX4IPROC glad_debug_glVertex4i;
+#undef glVertex4i
+#define glVertex4i glad_debug_glVertex4i
+GLAPI PFNGLVERTEX4IVPROC glad_debug_glVertex4iv;
+#undef glVertex4iv
+#define glVertex4iv glad_debug_glVertex4iv
+GLAPI PFNGLVERTEX4SPROC glad_debug_glVertex4s;
+#undef glVertex4s
+#define glVertex4s glad_debug_glVertex4s
+GLAPI PFNGLVERTEX4SVPROC glad_debug_glVertex4sv;
+#undef glVertex4sv
+#define glVertex4sv glad_debug_glVertex4sv
+GLAPI PFNGLCLIPPLANEPROC glad_debug_glClipPlane;
+#undef glClipPlane
+#define glClipPlane glad_debug_glClipPlane
+GLAPI PFNGLCOLORMATERIALPROC glad_debug_glColorMaterial;
+#undef glColorMaterial
+#define glColorMaterial glad_debug_glColorMaterial
+GLAPI PFNGLFOGFPROC glad_debug_glFogf;
+#undef glFogf
+#define glFogf glad_debug_glFogf
+GLAPI PFNGLFOGFVPROC glad_debug_glFogfv;
+#undef glFogfv
+#define glFogfv glad_debug_glFogfv
+GLAPI PFNGLFOGIPROC glad_debug_glFogi;
+#undef glFogi
+#define glFogi glad_debug_glFogi
+GLAPI PFNGLFOGIVPROC glad_debug_glFogiv;
+#undef glFogiv
+#define glFogiv glad_debug_glFogiv
+GLAPI PFNGLLIGHTFPROC glad_debug_glLightf;
+#undef glLightf
+#define glLightf glad_debug_glLightf
+GLAPI PFNGLLIGHTFVPROC glad_debug_glLightfv;
+#undef glLightfv
+#define glLightfv glad_debug_glLightfv
+GLAPI PFNGLLIGHTIPROC glad_debug_glLighti;
+#undef glLighti
+#define glLighti glad_debug_glLighti
+GLAPI PFNGLLIGHTIVPROC glad_debug_glLightiv;
+#undef glLightiv
+#define glLightiv glad_debug_glLightiv
+GLAPI PFNGLLIGHTMODELFPROC glad_debug_glLightModelf;
+#undef glLightModelf
+#define glLightModelf glad_debug_glLightModelf
+GLAPI PFNGLLIGHTMODELFVPROC glad_debug_glLightModelfv;
+#undef glLightModelfv
+#define glLightModelfv glad_debug_glLightModelfv
+GLAPI PFNGLLIGHTMODELIPROC glad_debug_glLightModeli;
+#undef glLightModeli
+#define glLightModeli glad_debug_glLightModeli
+GLAPI PFNGLLIGHTMODELIVPROC glad_debug_glLightModeliv;
+#undef glLightModeliv
+#define glLightModeliv glad_debug_glLightModeliv
+GLAPI PFNGLLINESTIPPLEPROC glad_debug_glLineStipple;
+#undef glLineStipple
+#define glLineStipple glad_debug_glLineStipple
+GLAPI PFNGLMATERIALFPROC glad_debug_glMaterialf;
+#undef glMaterialf
+#define glMaterialf glad_debug_glMaterialf
+GLAPI PFNGLMATERIALFVPROC glad_debug_glMaterialfv;
+#undef glMaterialfv
+#define glMaterialfv glad_debug_glMaterialfv
+GLAPI PFNGLMATERIALIPROC glad_debug_glMateriali;
+#undef glMateriali
+#define glMateriali glad_debug_glMateriali
+GLAPI PFNGLMATERIALIVPROC glad_debug_glMaterialiv;
+#undef glMaterialiv
+#define glMaterialiv glad_debug_glMaterialiv
+GLAPI PFNGLPOLYGONSTIPPLEPROC glad_debug_glPolygonStipple;
+#undef glPolygonStipple
+#define glPolygonStipple glad_debug_glPolygonStipple
+GLAPI PFNGLSHADEMODELPROC glad_debug_glShadeModel;
+#undef glShadeModel
+#define glShadeModel glad_debug_glShadeModel
+GLAPI PFNGLTEXENVFPROC glad_debug_glTexEnvf;
+#undef glTexEnvf
+#define glTexEnvf glad_debug_glTexEnvf
+GLAPI PFNGLTEXENVFVPROC glad_debug_glTexEnvfv;
+#undef glTexEnvfv
+#define glTexEnvfv glad_debug_glTexEnvfv
+GLAPI PFNGLTEXENVIPROC glad_debug_glTexEnvi;
+#undef glTexEnvi
+#define glTexEnvi glad_debug_glTexEnvi
+GLAPI PFNGLTEXENVIVPROC glad_debug_glTexEnviv;
+#undef glTexEnviv
+#define glTexEnviv glad_debug_glTexEnviv
+GLAPI PFNGLTEXGENDPROC glad_debug_glTexGend;
+#undef glTexGend
+#define glTexGend glad_debug_glTexGend
+GLAPI PFNGLTEXGENDVPROC glad_debug_glTexGendv;
+#undef glTexGendv
+#define glTexGendv glad_debug_glTexGendv
+GLAPI PFNGLTEXGENFPROC glad_debug_glTexGenf;
+#undef glTexGenf
+#define glTexGenf glad_debug_glTexGenf
+GLAPI PFNGLTEXGENFVPROC glad_debug_glTexGenfv;
+#undef glTexGenfv
+#define glTexGenfv glad_debug_glTexGenfv
+GLAPI PFNGLTEXGENIPROC glad_debug_glTexGeni;
+#undef glTexGeni
+#define glTexGeni glad_debug_glTexGeni
+GLAPI PFNGLTEXGENIVPROC glad_debug_glTexGeniv;
+#undef glTexGeniv
+#define glTexGeniv glad_debug_glTexGeniv
+GLAPI PFNGLFEEDBACKBUFFERPROC glad_debug_glFeedbackBuffer;
+#undef glFeedbackBuffer
+#define glFeedbackBuffer glad_debug_glFeedbackBuffer
+GLAPI PFNGLSELECTBUFFERPROC glad_debug_glSelectBuffer;
+#undef glSelectBuffer
+#define glSelectBuffer glad_debug_glSelectBuffer
+GLAPI PFNGLRENDERMODEPROC glad_debug_glRenderMode;
+#undef glRenderMode
+#define glRenderMode glad_debug_glRenderMode
+GLAPI PFNGLINITNAMESPROC glad_debug_glInitNames;
+#undef glInitNames
+#define glInitNames glad_debug_glInitNames
+GLAPI PFNGLLOADNAMEPROC glad_debug_glLoadName;
+#undef glLoadName
+#define glLoadName glad_debug_glLoadName
+GLAPI PFNGLPASSTHROUGHPROC glad_debug_glPassThrough;
+#undef glPassThrough
+#define glPassThrough glad_debug_glPassThrough
+GLAPI PFNGLPOPNAMEPROC glad_debug_glPopName;
+#undef glPopName
+#define glPopName glad_debug_glPopName
+GLAPI PFNGLPUSHNAMEPROC glad_debug_glPushName;
+#undef glPushName
+#define glPushName glad_debug_glPushName
+GLAPI PFNGLCLEARACCUMPROC glad_debug_glClearAccum;
+#undef glClearAccum
+#define glClearAccum glad_debug_glClearAccum
+GLAPI PFNGLCLEARINDEXPROC glad_debug_glClearIndex;
+#undef glClearIndex
+#define glClearIndex glad_debug_glClearIndex
+GLAPI PFNGLINDEXMASKPROC glad_debug_glIndexMask;
+#undef glIndexMask
+#define glIndexMask glad_debug_glIndexMask
+GLAPI PFNGLACCUMPROC glad_debug_glAccum;
+#undef glAccum
+#define glAccum glad_debug_glAccum
+GLAPI PFNGLPOPATTRIBPROC glad_debug_glPopAttrib;
+#undef glPopAttrib
+#define glPopAttrib glad_debug_glPopAttrib
+GLAPI PFNGLPUSHATTRIBPROC glad_debug_glPushAttrib;
+#undef glPushAttrib
+#define glPushAttrib glad_debug_glPushAttrib
+GLAPI PFNGLMAP1DPROC glad_debug_glMap1d;
+#undef glMap1d
+#define glMap1d glad_debug_glMap1d
+GLAPI PFNGLMAP1FPROC glad_debug_glMap1f;
+#undef glMap1f
+#define glMap1f glad_debug_glMap1f
+GLAPI PFNGLMAP2DPROC glad_debug_glMap2d;
+#undef glMap2d
+#define glMap2d glad_debug_glMap2d
+GLAPI PFNGLMAP2FPROC glad_debug_glMap2f;
+#undef glMap2f
+#define glMap2f glad_debug_glMap2f
+GLAPI PFNGLMAPGRID1DPROC glad_debug_glMapGrid1d;
+#undef glMapGrid1d
+#define glMapGrid1d glad_debug_glMapGrid1d
+GLAPI PFNGLMAPGRID1FPROC glad_debug_glMapGrid1f;
+#undef glMapGrid1f
+#define glMapGrid1f glad_debug_glMapGrid1f
+GLAPI PFNGLMAPGRID2DPROC glad_debug_glMapGrid2d;
+#undef glMapGrid2d
+#define glMapGrid2d glad_debug_glMapGrid2d
+GLAPI PFNGLMAPGRID2FPROC glad_debug_glMapGrid2f;
+#undef glMapGrid2f
+#define glMapGrid2f glad_debug_glMapGrid2f
+GLAPI PFNGLEVALCOORD1DPROC glad_debug_glEvalCoord1d;
+#undef glEvalCoord1d
+#define glEvalCoord1d glad_debug_glEvalCoord1d
+GLAPI PFNGLEVALCOORD1DVPROC glad_debug_glEvalCoord1dv;
+#undef glEvalCoord1dv
+#define glEvalCoord1dv glad_debug_glEvalCoord1dv
+GLAPI PFNGLEVALCOORD1FPROC glad_debug_glEvalCoord1f;
+#undef glEvalCoord1f
+#define glEvalCoord1f glad_debug_glEvalCoord1f
+GLAPI PFNGLEVALCOORD1FVPROC glad_debug_glEvalCoord1fv;
+#undef glEvalCoord1fv
+#define glEvalCoord1fv glad_debug_glEvalCoord1fv
+GLAPI PFNGLEVALCOORD2DPROC glad_debug_glEvalCoord2d;
+#undef glEvalCoord2d
+#define glEvalCoord2d glad_debug_glEvalCoord2d
+GLAPI PFNGLEVALCOORD2DVPROC glad_debug_glEvalCoord2dv;
+#undef glEvalCoord2dv
+#define glEvalCoord2dv glad_debug_glEvalCoord2dv
+GLAPI PFNGLEVALCOORD2FPROC glad_debug_glEvalCoord2f;
+#undef glEvalCoord2f
+#define glEvalCoord2f glad_debug_glEvalCoord2f
+GLAPI PFNGLEVALCOORD2FVPROC glad_debug_glEvalCoord2fv;
+#undef glEvalCoord2fv
+#define glEvalCoord2fv glad_debug_glEvalCoord2fv
+GLAPI PFNGLEVALMESH1PROC glad_debug_glEvalMesh1;
+#undef glEvalMesh1
+#define glEvalMesh1 glad_debug_glEvalMesh1
+GLAPI PFNGLEVALPOINT1PROC glad_debug_glEvalPoint1;
+#undef glEvalPoint1
+#define glEvalPoint1 glad_debug_glEvalPoint1
+GLAPI PFNGLEVALMESH2PROC glad_debug_glEvalMesh2;
+#undef glEvalMesh2
+#define glEvalMesh2 glad_debug_glEvalMesh2
+GLAPI PFNGLEVALPOINT2PROC glad_debug_glEvalPoint2;
+#undef glEvalPoint2
+#define glEvalPoint2 glad_debug_glEvalPoint2
+GLAPI PFNGLALPHAFUNCPROC glad_debug_glAlphaFunc;
+#undef glAlphaFunc
+#define glAlphaFunc glad_debug_glAlphaFunc
+GLAPI PFNGLPIXELZOOMPROC glad_debug_glPixelZoom;
+#undef glPixelZoom
+#define glPixelZoom glad_debug_glPixelZoom
+GLAPI PFNGLPIXELTRANSFERFPROC glad_debug_glPixelTransferf;
+#undef glPixelTransferf
+#define glPixelTransferf glad_debug_glPixelTransferf
+GLAPI PFNGLPIXELTRANSFERIPROC glad_debug_glPixelTransferi;
+#undef glPixelTransferi
+#define glPixelTransferi glad_debug_glPixelTransferi
+GLAPI PFNGLPIXELMAPFVPROC glad_debug_glPixelMapfv;
+#undef glPixelMapfv
+#define glPixelMapfv glad_debug_glPixelMapfv
+GLAPI PFNGLPIXELMAPUIVPROC glad_debug_glPixelMapuiv;
+#undef glPixelMapuiv
+#define glPixelMapuiv glad_debug_glPixelMapuiv
+GLAPI PFNGLPIXELMAPUSVPROC glad_debug_glPixelMapusv;
+#undef glPixelMapusv
+#define glPixelMapusv glad_debug_glPixelMapusv
+GLAPI PFNGLCOPYPIXELSPROC glad_debug_glCopyPixels;
+#undef glCopyPixels
+#define glCopyPixels glad_debug_glCopyPixels
+GLAPI PFNGLDRAWPIXELSPROC glad_debug_glDrawPixels;
+#undef glDrawPixels
+#define glDrawPixels glad_debug_glDrawPixels
+GLAPI PFNGLGETCLIPPLANEPROC glad_debug_glGetClipPlane;
+#undef glGetClipPlane
+#define glGetClipPlane glad_debug_glGetClipPlane
+GLAPI PFNGLGETLIGHTFVPROC glad_debug_glGetLightfv;
+#undef glGetLightfv
+#define glGetLightfv glad_debug_glGetLightfv
+GLAPI PFNGLGETLIGHTIVPROC glad_debug_glGetLightiv;
+#undef glGetLightiv
+#define glGetLightiv glad_debug_glGetLightiv
+GLAPI PFNGLGETMAPDVPROC glad_debug_glGetMapdv;
+#undef glGetMapdv
+#define glGetMapdv glad_debug_glGetMapdv
+GLAPI PFNGLGETMAPFVPROC glad_debug_glGetMapfv;
+#undef glGetMapfv
+#define glGetMapfv glad_debug_glGetMapfv
+GLAPI PFNGLGETMAPIVPROC glad_debug_glGetMapiv;
+#undef glGetMapiv
+#define glGetMapiv glad_debug_glGetMapiv
+GLAPI PFNGLGETMATERIALFVPROC glad_debug_glGetMaterialfv;
+#undef glGetMaterialfv
+#define glGetMaterialfv glad_debug_glGetMaterialfv
+GLAPI PFNGLGETMATERIALIVPROC glad_debug_glGetMaterialiv;
+#undef glGetMaterialiv
+#define glGetMaterialiv glad_debug_glGetMaterialiv
+GLAPI PFNGLGETPIXELMAPFVPROC glad_debug_glGetPixelMapfv;
+#undef glGetPixelMapfv
+#define glGetPixelMapfv glad_debug_glGetPixelMapfv
+GLAPI PFNGLGETPIXELMAPUIVPROC glad_debug_glGetPixelMapuiv;
+#undef glGetPixelMapuiv
+#define glGetPixelMapuiv glad_debug_glGetPixelMapuiv
+GLAPI PFNGLGETPIXELMAPUSVPROC glad_debug_glGetPixelMapusv;
+#undef glGetPixelMapusv
+#define glGetPixelMapusv glad_debug_glGetPixelMapusv
+GLAPI PFNGLGETPOLYGONSTIPPLEPROC glad_debug_glGetPolygonStipple;
+#undef glGetPolygonStipple
+#define glGetPolygonStipple glad_debug_glGetPolygonStipple
+GLAPI PFNGLGETTEXENVFVPROC glad_debug_glGetTexEnvfv;
+#undef glGetTexEnvfv
+#define glGetTexEnvfv glad_debug_glGetTexEnvfv
+GLAPI PFNGLGETTEXENVIVPROC glad_debug_glGetTexEnviv;
+#undef glGetTexEnviv
+#define glGetTexEnviv glad_debug_glGetTexEnviv
+GLAPI PFNGLGETTEXGENDVPROC glad_debug_glGetTexGendv;
+#undef glGetTexGendv
+#define glGetTexGendv glad_debug_glGetTexGendv
+GLAPI PFNGLGETTEXGENFVPROC glad_debug_glGetTexGenfv;
+#undef glGetTexGenfv
+#define glGetTexGenfv glad_debug_glGetTexGenfv
+GLAPI PFNGLGETTEXGENIVPROC glad_debug_glGetTexGeniv;
+#undef glGetTexGeniv
+#define glGetTexGeniv glad_debug_glGetTexGeniv
+GLAPI PFNGLISLISTPROC glad_debug_glIsList;
+#undef glIsList
+#define glIsList glad_debug_glIsList
+GLAPI PFNGLFRUSTUMPROC glad_debug_glFrustum;
+#undef glFrustum
+#define glFrustum glad_debug_glFrustum
+GLAPI PFNGLLOADIDENTITYPROC glad_debug_glLoadIdentity;
+#undef glLoadIdentity
+#define glLoadIdentity glad_debug_glLoadIdentity
+GLAPI PFNGLLOADMATRIXFPROC glad_debug_glLoadMatrixf;
+#undef glLoadMatrixf
+#define glLoadMatrixf glad_debug_glLoadMatrixf
+GLAPI PFNGLLOADMATRIXDPROC glad_debug_glLoadMatrixd;
+#undef glLoadMatrixd
+#define glLoadMatrixd glad_debug_glLoadMatrixd
+GLAPI PFNGLMATRIXMODEPROC glad_debug_glMatrixMode;
+#undef glMatrixMode
+#define glMatrixMode glad_debug_glMatrixMode
+GLAPI PFNGLMULTMATRIXFPROC glad_debug_glMultMatrixf;
+#undef glMultMatrixf
+#define glMultMatrixf glad_debug_glMultMatrixf
+GLAPI PFNGLMULTMATRIXDPROC glad_debug_glMultMatrixd;
+#undef glMultMatrixd
+#define glMultMatrixd glad_debug_glMultMatrixd
+GLAPI PFNGLORTHOPROC glad_debug_glOrtho;
+#undef glOrtho
+#define glOrtho glad_debug_glOrtho
+GLAPI PFNGLPOPMATRIXPROC glad_debug_glPopMatrix;
+#undef glPopMatrix
+#define glPopMatrix glad_debug_glPopMatrix
+GLAPI PFNGLPUSHMATRIXPROC glad_debug_glPushMatrix;
+#undef glPushMatrix
+#define glPushMatrix glad_debug_glPushMatrix
+GLAPI PFNGLROTATEDPROC glad_debug_glRotated;
+#undef glRotated
+#define glRotated glad_debug_glRotated
+GLAPI PFNGLROTATEFPROC glad_debug_glRotatef;
+#undef glRotatef
+#define glRotatef glad_debug_glRotatef
+GLAPI PFNGLSCALEDPROC glad_debug_glScaled;
+#undef glScaled
+#define glScaled glad_debug_glScaled
+GLAPI PFNGLSCALEFPROC glad_debug_glScalef;
+#undef glScalef
+#define glScalef glad_debug_glScalef
+GLAPI PFNGLTRANSLATEDPROC glad_debug_glTranslated;
+#undef glTranslated
+#define glTranslated glad_debug_glTranslated
+GLAPI PFNGLTRANSLATEFPROC glad_debug_glTranslatef;
+#undef glTranslatef
+#define glTranslatef glad_debug_glTranslatef
+GLAPI PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays;
+#undef glDrawArrays
+#define glDrawArrays glad_debug_glDrawArrays
+GLAPI PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements;
+#undef glDrawElements
+#define glDrawElements glad_debug_glDrawElements
+GLAPI PFNGLGETPOINTERVPROC glad_debug_glGetPointerv;
+#undef glGetPointerv
+#define glGetPointerv glad_debug_glGetPointerv
+GLAPI PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset;
+#undef glPolygonOffset
+#define glPolygonOffset glad_debug_glPolygonOffset
+GLAPI PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D;
+#undef glCopyTexImage1D
+#define glCopyTexImage1D glad_debug_glCopyTexImage1D
+GLAPI PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D;
+#undef glCopyTexImage2D
+#define glCopyTexImage2D glad_debug_glCopyTexImage2D
+GLAPI PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D;
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D glad_debug_glCopyTexSubImage1D
+GLAPI PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D;
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D glad_debug_glCopyTexSubImage2D
+GLAPI PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D;
+#undef glTexSubImage1D
+#define glTexSubImage1D glad_debug_glTexSubImage1D
+GLAPI PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D;
+#undef glTexSubImage2D
+#define glTexSubImage2D glad_debug_glTexSubImage2D
+GLAPI PFNGLBINDTEXTUREPROC glad_debug_glBindTexture;
+#undef glBindTexture
+#define glBindTexture glad_debug_glBindTexture
+GLAPI PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures;
+#undef glDeleteTextures
+#define glDeleteTextures glad_debug_glDeleteTextures
+GLAPI PFNGLGENTEXTURESPROC glad_debug_glGenTextures;
+#undef glGenTextures
+#define glGenTextures glad_debug_glGenTextures
+GLAPI PFNGLISTEXTUREPROC glad_debug_glIsTexture;
+#undef glIsTexture
+#define glIsTexture glad_debug_glIsTexture
+GLAPI PFNGLARRAYELEMENTPROC glad_debug_glArrayElement;
+#undef glArrayElement
+#define glArrayElement glad_debug_glArrayElement
+GLAPI PFNGLCOLORPOINTERPROC glad_debug_glColorPointer;
+#undef glColorPointer
+#define glColorPointer glad_debug_glColorPointer
+GLAPI PFNGLDISABLECLIENTSTATEPROC glad_debug_glDisableClientState;
+#undef glDisableClientState
+#define glDisableClientState glad_debug_glDisableClientState
+GLAPI PFNGLEDGEFLAGPOINTERPROC glad_debug_glEdgeFlagPointer;
+#undef glEdgeFlagPointer
+#define glEdgeFlagPointer glad_debug_glEdgeFlagPointer
+GLAPI PFNGLENABLECLIENTSTATEPROC glad_debug_glEnableClientState;
+#undef glEnableClientState
+#define glEnableClientState glad_debug_glEnableClientState
+GLAPI PFNGLINDEXPOINTERPROC glad_debug_glIndexPointer;
+#undef glIndexPointer
+#define glIndexPointer glad_debug_glIndexPointer
+GLAPI PFNGLINTERLEAVEDARRAYSPROC glad_debug_glInterleavedArrays;
+#undef glInterleavedArrays
+#define glInterleavedArrays glad_debug_glInterleavedArrays
+GLAPI PFNGLNORMALPOINTERPROC glad_debug_glNormalPointer;
+#undef glNormalPointer
+#define glNormalPointer glad_debug_glNormalPointer
+GLAPI PFNGLTEXCOORDPOINTERPROC glad_debug_glTexCoordPointer;
+#undef glTexCoordPointer
+#define glTexCoordPointer glad_debug_glTexCoordPointer
+GLAPI PFNGLVERTEXPOINTERPROC glad_debug_glVertexPointer;
+#undef glVertexPointer
+#define glVertexPointer glad_debug_glVertexPointer
+GLAPI PFNGLARETEXTURESRESIDENTPROC glad_debug_glAreTexturesResident;
+#undef glAreTexturesResident
+#define glAreTexturesResident glad_debug_glAreTexturesResident
+GLAPI PFNGLPRIORITIZETEXTURESPROC glad_debug_glPrioritizeTextures;
+#undef glPrioritizeTextures
+#define glPrioritizeTextures glad_debug_glPrioritizeTextures
+GLAPI PFNGLINDEXUBPROC glad_debug_glIndexub;
+#undef glIndexub
+#define glIndexub glad_debug_glIndexub
+GLAPI PFNGLINDEXUBVPROC glad_debug_glIndexubv;
+#undef glIndexubv
+#define glIndexubv glad_debug_glIndexubv
+GLAPI PFNGLPOPCLIENTATTRIBPROC glad_debug_glPopClientAttrib;
+#undef glPopClientAttrib
+#define glPopClientAttrib glad_debug_glPopClientAttrib
+GLAPI PFNGLPUSHCLIENTATTRIBPROC glad_debug_glPushClientAttrib;
+#undef glPushClientAttrib
+#define glPushClientAttrib glad_debug_glPushClientAttrib
+GLAPI PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements;
+#undef glDrawRangeElements
+#define glDrawRangeElements glad_debug_glDrawRangeElements
+GLAPI PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D;
+#undef glTexImage3D
+#define glTexImage3D glad_debug_glTexImage3D
+GLAPI PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D;
+#undef glTexSubImage3D
+#define glTexSubImage3D glad_debug_glTexSubImage3D
+GLAPI PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D;
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D glad_debug_glCopyTexSubImage3D
+GLAPI PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture;
+#undef glActiveTexture
+#define glActiveTexture glad_debug_glActiveTexture
+GLAPI PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage;
+#undef glSampleCoverage
+#define glSampleCoverage glad_debug_glSampleCoverage
+GLAPI PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D;
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D glad_debug_glCompressedTexImage3D
+GLAPI PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D;
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D glad_debug_glCompressedTexImage2D
+GLAPI PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D;
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D glad_debug_glCompressedTexImage1D
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D;
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D glad_debug_glCompressedTexSubImage3D
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D;
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D glad_debug_glCompressedTexSubImage2D
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D;
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D glad_debug_glCompressedTexSubImage1D
+GLAPI PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage;
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage glad_debug_glGetCompressedTexImage
+GLAPI PFNGLCLIENTACTIVETEXTUREPROC glad_debug_glClientActiveTexture;
+#undef glClientActiveTexture
+#define glClientActiveTexture glad_debug_glClientActiveTexture
+GLAPI PFNGLMULTITEXCOORD1DPROC glad_debug_glMultiTexCoord1d;
+#undef glMultiTexCoord1d
+#define glMultiTexCoord1d glad_debug_glMultiTexCoord1d
+GLAPI PFNGLMULTITEXCOORD1DVPROC glad_debug_glMultiTexCoord1dv;
+#undef glMultiTexCoord1dv
+#define glMultiTexCoord1dv glad_debug_glMultiTexCoord1dv
+GLAPI PFNGLMULTITEXCOORD1FPROC glad_debug_glMultiTexCoord1f;
+#undef glMultiTexCoord1f
+#define glMultiTexCoord1f glad_debug_glMultiTexCoord1f
+GLAPI PFNGLMULTITEXCOORD1FVPROC glad_debug_glMultiTexCoord1fv;
+#undef glMultiTexCoord1fv
+#define glMultiTexCoord1fv glad_debug_glMultiTexCoord1fv
+GLAPI PFNGLMULTITEXCOORD1IPROC glad_debug_glMultiTexCoord1i;
+#undef glMultiTexCoord1i
+#define glMultiTexCoord1i glad_debug_glMultiTexCoord1i
+GLAPI PFNGLMULTITEXCOORD1IVPROC glad_debug_glMultiTexCoord1iv;
+#undef glMultiTexCoord1iv
+#define glMultiTexCoord1iv glad_debug_glMultiTexCoord1iv
+GLAPI PFNGLMULTITEXCOORD1SPROC glad_debug_glMultiTexCoord1s;
+#undef glMultiTexCoord1s
+#define glMultiTexCoord1s glad_debug_glMultiTexCoord1s
+GLAPI PFNGLMULTITEXCOORD1SVPROC glad_debug_glMultiTexCoord1sv;
+#undef glMultiTexCoord1sv
+#define glMultiTexCoord1sv glad_debug_glMultiTexCoord1sv
+GLAPI PFNGLMULTITEXCOORD2DPROC glad_debug_glMultiTexCoord2d;
+#undef glMultiTexCoord2d
+#define glMultiTexCoord2d glad_debug_glMultiTexCoord2d
+GLAPI PFNGLMULTITEXCOORD2DVPROC glad_debug_glMultiTexCoord2dv;
+#undef glMultiTexCoord2dv
+#define glMultiTexCoord2dv glad_debug_glMultiTexCoord2dv
+GLAPI PFNGLMULTITEXCOORD2FPROC glad_debug_glMultiTexCoord2f;
+#undef glMultiTexCoord2f
+#define glMultiTexCoord2f glad_debug_glMultiTexCoord2f
+GLAPI PFNGLMULTITEXCOORD2FVPROC glad_debug_glMultiTexCoord2fv;
+#undef glMultiTexCoord2fv
+#define glMultiTexCoord2fv glad_debug_glMultiTexCoord2fv
+GLAPI PFNGLMULTITEXCOORD2IPROC glad_debug_glMultiTexCoord2i;
+#undef glMultiTexCoord2i
+#define glMultiTexCoord2i glad_debug_glMultiTexCoord2i
+GLAPI PFNGLMULTITEXCOORD2IVPROC glad_debug_glMultiTexCoord2iv;
+#undef glMultiTexCoord2iv
+#define glMultiTexCoord2iv glad_debug_glMultiTexCoord2iv
+GLAPI PFNGLMULTITEXCOORD2SPROC glad_debug_glMultiTexCoord2s;
+#undef glMultiTexCoord2s
+#define glMultiTexCoord2s glad_debug_glMultiTexCoord2s
+GLAPI PFNGLMULTITEXCOORD2SVPROC glad_debug_glMultiTexCoord2sv;
+#undef glMultiTexCoord2sv
+#define glMultiTexCoord2sv glad_debug_glMultiTexCoord2sv
+GLAPI PFNGLMULTITEXCOORD3DPROC glad_debug_glMultiTexCoord3d;
+#undef glMultiTexCoord3d
+#define glMultiTexCoord3d glad_debug_glMultiTexCoord3d
+GLAPI PFNGLMULTITEXCOORD3DVPROC glad_debug_glMultiTexCoord3dv;
+#undef glMultiTexCoord3dv
+#define glMultiTexCoord3dv glad_debug_glMultiTexCoord3dv
+GLAPI PFNGLMULTITEXCOORD3FPROC glad_debug_glMultiTexCoord3f;
+#undef glMultiTexCoord3f
+#define glMultiTexCoord3f glad_debug_glMultiTexCoord3f
+GLAPI PFNGLMULTITEXCOORD3FVPROC glad_debug_glMultiTexCoord3fv;
+#undef glMultiTexCoord3fv
+#define glMultiTexCoord3fv glad_debug_glMultiTexCoord3fv
+GLAPI PFNGLMULTITEXCOORD3IPROC glad_debug_glMultiTexCoord3i;
+#undef glMultiTexCoord3i
+#define glMultiTexCoord3i glad_debug_glMultiTexCoord3i
+GLAPI PFNGLMULTITEXCOORD3IVPROC glad_debug_glMultiTexCoord3iv;
+#undef glMultiTexCoord3iv
+#define glMultiTexCoord3iv glad_debug_glMultiTexCoord3iv
+GLAPI PFNGLMULTITEXCOORD3SPROC glad_debug_glMultiTexCoord3s;
+#undef glMultiTexCoord3s
+#define glMultiTexCoord3s glad_debug_glMultiTexCoord3s
+GLAPI PFNGLMULTITEXCOORD3SVPROC glad_debug_glMultiTexCoord3sv;
+#undef glMultiTexCoord3sv
+#define glMultiTexCoord3sv glad_debug_glMultiTexCoord3sv
+GLAPI PFNGLMULTITEXCOORD4DPROC glad_debug_glMultiTexCoord4d;
+#undef glMultiTexCoord4d
+#define glMultiTexCoord4d glad_debug_glMultiTexCoord4d
+GLAPI PFNGLMULTITEXCOORD4DVPROC glad_debug_glMultiTexCoord4dv;
+#undef glMultiTexCoord4dv
+#define glMultiTexCoord4dv glad_debug_glMultiTexCoord4dv
+GLAPI PFNGLMULTITEXCOORD4FPROC glad_debug_glMultiTexCoord4f;
+#undef glMultiTexCoord4f
+#define glMultiTexCoord4f glad_debug_glMultiTexCoord4f
+GLAPI PFNGLMULTITEXCOORD4FVPROC glad_debug_glMultiTexCoord4fv;
+#undef glMultiTexCoord4fv
+#define glMultiTexCoord4fv glad_debug_glMultiTexCoord4fv
+GLAPI PFNGLMULTITEXCOORD4IPROC glad_debug_glMultiTexCoord4i;
+#undef glMultiTexCoord4i
+#define glMultiTexCoord4i glad_debug_glMultiTexCoord4i
+GLAPI PFNGLMULTITEXCOORD4IVPROC glad_debug_glMultiTexCoord4iv;
+#undef glMultiTexCoord4iv
+#define glMultiTexCoord4iv glad_debug_glMultiTexCoord4iv
+GLAPI PFNGLMULTITEXCOORD4SPROC glad_debug_glMultiTexCoord4s;
+#undef glMultiTexCoord4s
+#define glMultiTexCoord4s glad_debug_glMultiTexCoord4s
+GLAPI PFNGLMULTITEXCOORD4SVPROC glad_debug_glMultiTexCoord4sv;
+#undef glMultiTexCoord4sv
+#define glMultiTexCoord4sv glad_debug_glMultiTexCoord4sv
+GLAPI PFNGLLOADTRANSPOSEMATRIXFPROC glad_debug_glLoadTransposeMatrixf;
+#undef glLoadTransposeMatrixf
+#define glLoadTransposeMatrixf glad_debug_glLoadTransposeMatrixf
+GLAPI PFNGLLOADTRANSPOSEMATRIXDPROC glad_debug_glLoadTransposeMatrixd;
+#undef glLoadTransposeMatrixd
+#define glLoadTransposeMatrixd glad_debug_glLoadTransposeMatrixd
+GLAPI PFNGLMULTTRANSPOSEMATRIXFPROC glad_debug_glMultTransposeMatrixf;
+#undef glMultTransposeMatrixf
+#define glMultTransposeMatrixf glad_debug_glMultTransposeMatrixf
+GLAPI PFNGLMULTTRANSPOSEMATRIXDPROC glad_debug_glMultTransposeMatrixd;
+#undef glMultTransposeMatrixd
+#define glMultTransposeMatrixd glad_debug_glMultTransposeMatrixd
+GLAPI PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate;
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate glad_debug_glBlendFuncSeparate
+GLAPI PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays;
+#undef glMultiDrawArrays
+#define glMultiDrawArrays glad_debug_glMultiDrawArrays
+GLAPI PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements;
+#undef glMultiDrawElements
+#define glMultiDrawElements glad_debug_glMultiDrawElements
+GLAPI PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf;
+#undef glPointParameterf
+#define glPointParameterf glad_debug_glPointParameterf
+GLAPI PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv;
+#undef glPointParameterfv
+#define glPointParameterfv glad_debug_glPointParameterfv
+GLAPI PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri;
+#undef glPointParameteri
+#define glPointParameteri glad_debug_glPointParameteri
+GLAPI PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv;
+#undef glPointParameteriv
+#define glPointParameteriv glad_debug_glPointParameteriv
+GLAPI PFNGLFOGCOORDFPROC glad_debug_glFogCoordf;
+#undef glFogCoordf
+#define glFogCoordf glad_debug_glFogCoordf
+GLAPI PFNGLFOGCOORDFVPROC glad_debug_glFogCoordfv;
+#undef glFogCoordfv
+#define glFogCoordfv glad_debug_glFogCoordfv
+GLAPI PFNGLFOGCOORDDPROC glad_debug_glFogCoordd;
+#undef glFogCoordd
+#define glFogCoordd glad_debug_glFogCoordd
+GLAPI PFNGLFOGCOORDDVPROC glad_debug_glFogCoorddv;
+#undef glFogCoorddv
+#define glFogCoorddv glad_debug_glFogCoorddv
+GLAPI PFNGLFOGCOORDPOINTERPROC glad_debug_glFogCoordPointer;
+#undef glFogCoordPointer
+#define glFogCoordPointer glad_debug_glFogCoordPointer
+GLAPI PFNGLSECONDARYCOLOR3BPROC glad_debug_glSecondaryColor3b;
+#undef glSecondaryColor3b
+#define glSecondaryColor3b glad_debug_glSecondaryColor3b
+GLAPI PFNGLSECONDARYCOLOR3BVPROC glad_debug_glSecondaryColor3bv;
+#undef glSecondaryColor3bv
+#define glSecondaryColor3bv glad_debug_glSecondaryColor3bv
+GLAPI PFNGLSECONDARYCOLOR3DPROC glad_debug_glSecondaryColor3d;
+#undef glSecondaryColor3d
+#define glSecondaryColor3d glad_debug_glSecondaryColor3d
+GLAPI PFNGLSECONDARYCOLOR3DVPROC glad_debug_glSecondaryColor3dv;
+#undef glSecondaryColor3dv
+#define glSecondaryColor3dv glad_debug_glSecondaryColor3dv
+GLAPI PFNGLSECONDARYCOLOR3FPROC glad_debug_glSecondaryColor3f;
+#undef glSecondaryColor3f
+#define glSecondaryColor3f glad_debug_glSecondaryColor3f
+GLAPI PFNGLSECONDARYCOLOR3FVPROC glad_debug_glSecondaryColor3fv;
+#undef glSecondaryColor3fv
+#define glSecondaryColor3fv glad_debug_glSecondaryColor3fv
+GLAPI PFNGLSECONDARYCOLOR3IPROC glad_debug_glSecondaryColor3i;
+#undef glSecondaryColor3i
+#define glSecondaryColor3i glad_debug_glSecondaryColor3i
+GLAPI PFNGLSECONDARYCOLOR3IVPROC glad_debug_glSecondaryColor3iv;
+#undef glSecondaryColor3iv
+#define glSecondaryColor3iv glad_debug_glSecondaryColor3iv
+GLAPI PFNGLSECONDARYCOLOR3SPROC glad_debug_glSecondaryColor3s;
+#undef glSecondaryColor3s
+#define glSecondaryColor3s glad_debug_glSecondaryColor3s
+GLAPI PFNGLSECONDARYCOLOR3SVPROC glad_debug_glSecondaryColor3sv;
+#undef glSecondaryColor3sv
+#define glSecondaryColor3sv glad_debug_glSecondaryColor3sv
+GLAPI PFNGLSECONDARYCOLOR3UBPROC glad_debug_glSecondaryColor3ub;
+#undef glSecondaryColor3ub
+#define glSecondaryColor3ub glad_debug_glSecondaryColor3ub
+GLAPI PFNGLSECONDARYCOLOR3UBVPROC glad_debug_glSecondaryColor3ubv;
+#undef glSecondaryColor3ubv
+#define glSecondaryColor3ubv glad_debug_glSecondaryColor3ubv
+GLAPI PFNGLSECONDARYCOLOR3UIPROC glad_debug_glSecondaryColor3ui;
+#undef glSecondaryColor3ui
+#define glSecondaryColor3ui glad_debug_glSecondaryColor3ui
+GLAPI PFNGLSECONDARYCOLOR3UIVPROC glad_debug_glSecondaryColor3uiv;
+#undef glSecondaryColor3uiv
+#define glSecondaryColor3uiv glad_debug_glSecondaryColor3uiv
+GLAPI PFNGLSECONDARYCOLOR3USPROC glad_debug_glSecondaryColor3us;
+#undef glSecondaryColor3us
+#define glSecondaryColor3us glad_debug_glSecondaryColor3us
+GLAPI PFNGLSECONDARYCOLOR3USVPROC glad_debug_glSecondaryColor3usv;
+#undef glSecondaryColor3usv
+#define glSecondaryColor3usv glad_debug_glSecondaryColor3usv
+GLAPI PFNGLSECONDARYCOLORPOINTERPROC glad_debug_glSecondaryColorPointer;
+#undef glSecondaryColorPointer
+#define glSecondaryColorPointer glad_debug_glSecondaryColorPointer
+GLAPI PFNGLWINDOWPOS2DPROC glad_debug_glWindowPos2d;
+#undef glWindowPos2d
+#define glWindowPos2d glad_debug_glWindowPos2d
+GLAPI PFNGLWINDOWPOS2DVPROC glad_debug_glWindowPos2dv;
+#undef glWindowPos2dv
+#define glWindowPos2dv glad_debug_glWindowPos2dv
+GLAPI PFNGLWINDOWPOS2FPROC glad_debug_glWindowPos2f;
+#undef glWindowPos2f
+#define glWindowPos2f glad_debug_glWindowPos2f
+GLAPI PFNGLWINDOWPOS2FVPROC glad_debug_glWindowPos2fv;
+#undef glWindowPos2fv
+#define glWindowPos2fv glad_debug_glWindowPos2fv
+GLAPI PFNGLWINDOWPOS2IPROC glad_debug_glWindowPos2i;
+#undef glWindowPos2i
+#define glWindowPos2i glad_debug_glWindowPos2i
+GLAPI PFNGLWINDOWPOS2IVPROC glad_debug_glWindowPos2iv;
+#undef glWindowPos2iv
+#define glWindowPos2iv glad_debug_glWindowPos2iv
+GLAPI PFNGLWINDOWPOS2SPROC glad_debug_glWindowPos2s;
+#undef glWindowPos2s
+#define glWindowPos2s glad_debug_glWindowPos2s
+GLAPI PFNGLWINDOWPOS2SVPROC glad_debug_glWindowPos2sv;
+#undef glWindowPos2sv
+#define glWindowPos2sv glad_debug_glWindowPos2sv
+GLAPI PFNGLWINDOWPOS3DPROC glad_debug_glWindowPos3d;
+#undef glWindowPos3d
+#define glWindowPos3d glad_debug_glWindowPos3d
+GLAPI PFNGLWINDOWPOS3DVPROC glad_debug_glWindowPos3dv;
+#undef glWindowPos3dv
+#define glWindowPos3dv glad_debug_glWindowPos3dv
+GLAPI PFNGLWINDOWPOS3FPROC glad_debug_glWindowPos3f;
+#undef glWindowPos3f
+#define glWindowPos3f glad_debug_glWindowPos3f
+GLAPI PFNGLWINDOWPOS3FVPROC glad_debug_glWindowPos3fv;
+#undef glWindowPos3fv
+#define glWindowPos3fv glad_debug_glWindowPos3fv
+GLAPI PFNGLWINDOWPOS3IPROC glad_debug_glWindowPos3i;
+#undef glWindowPos3i
+#define glWindowPos3i glad_debug_glWindowPos3i
+GLAPI PFNGLWINDOWPOS3IVPROC glad_debug_glWindowPos3iv;
+#undef glWindowPos3iv
+#define glWindowPos3iv glad_debug_glWindowPos3iv
+GLAPI PFNGLWINDOWPOS3SPROC glad_debug_glWindowPos3s;
+#undef glWindowPos3s
+#define glWindowPos3s glad_debug_glWindowPos3s
+GLAPI PFNGLWINDOWPOS3SVPROC glad_debug_glWindowPos3sv;
+#undef glWindowPos3sv
+#define glWindowPos3sv glad_debug_glWindowPos3sv
+GLAPI PFNGLBLENDCOLORPROC glad_debug_glBlendColor;
+#undef glBlendColor
+#define glBlendColor glad_debug_glBlendColor
+GLAPI PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation;
+#undef glBlendEquation
+#define glBlendEquation glad_debug_glBlendEquation
+GLAPI PFNGLGENQUERIESPROC glad_debug_glGenQueries;
+#undef glGenQueries
+#define glGenQueries glad_debug_glGenQueries
+GLAPI PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries;
+#undef glDeleteQueries
+#define glDeleteQueries glad_debug_glDeleteQueries
+GLAPI PFNGLISQUERYPROC glad_debug_glIsQuery;
+#undef glIsQuery
+#define glIsQuery glad_debug_glIsQuery
+GLAPI PFNGLBEGINQUERYPROC glad_debug_glBeginQuery;
+#undef glBeginQuery
+#define glBeginQuery glad_debug_glBeginQuery
+GLAPI PFNGLENDQUERYPROC glad_debug_glEndQuery;
+#undef glEndQuery
+#define glEndQuery glad_debug_glEndQuery
+GLAPI PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv;
+#undef glGetQueryiv
+#define glGetQueryiv glad_debug_glGetQueryiv
+GLAPI PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv;
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv glad_debug_glGetQueryObjectiv
+GLAPI PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv;
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv glad_debug_glGetQueryObjectuiv
+GLAPI PFNGLBINDBUFFERPROC glad_debug_glBindBuffer;
+#undef glBindBuffer
+#define glBindBuffer glad_debug_glBindBuffer
+GLAPI PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers;
+#undef glDeleteBuffers
+#define glDeleteBuffers glad_debug_glDeleteBuffers
+GLAPI PFNGLGENBUFFERSPROC glad_debug_glGenBuffers;
+#undef glGenBuffers
+#define glGenBuffers glad_debug_glGenBuffers
+GLAPI PFNGLISBUFFERPROC glad_debug_glIsBuffer;
+#undef glIsBuffer
+#define glIsBuffer glad_debug_glIsBuffer
+GLAPI PFNGLBUFFERDATAPROC glad_debug_glBufferData;
+#undef glBufferData
+#define glBufferData glad_debug_glBufferData
+GLAPI PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData;
+#undef glBufferSubData
+#define glBufferSubData glad_debug_glBufferSubData
+GLAPI PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData;
+#undef glGetBufferSubData
+#define glGetBufferSubData glad_debug_glGetBufferSubData
+GLAPI PFNGLMAPBUFFERPROC glad_debug_glMapBuffer;
+#undef glMapBuffer
+#define glMapBuffer glad_debug_glMapBuffer
+GLAPI PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer;
+#undef glUnmapBuffer
+#define glUnmapBuffer glad_debug_glUnmapBuffer
+GLAPI PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv;
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv glad_debug_glGetBufferParameteriv
+GLAPI PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv;
+#undef glGetBufferPointerv
+#define glGetBufferPointerv glad_debug_glGetBufferPointerv
+GLAPI PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate;
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate glad_debug_glBlendEquationSeparate
+GLAPI PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers;
+#undef glDrawBuffers
+#define glDrawBuffers glad_debug_glDrawBuffers
+GLAPI PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate;
+#undef glStencilOpSeparate
+#define glStencilOpSeparate glad_debug_glStencilOpSeparate
+GLAPI PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate;
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate glad_debug_glStencilFuncSeparate
+GLAPI PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate;
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate glad_debug_glStencilMaskSeparate
+GLAPI PFNGLATTACHSHADERPROC glad_debug_glAttachShader;
+#undef glAttachShader
+#define glAttachShader glad_debug_glAttachShader
+GLAPI PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation;
+#undef glBindAttribLocation
+#define glBindAttribLocation glad_debug_glBindAttribLocation
+GLAPI PFNGLCOMPILESHADERPROC glad_debug_glCompileShader;
+#undef glCompileShader
+#define glCompileShader glad_debug_glCompileShader
+GLAPI PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram;
+#undef glCreateProgram
+#define glCreateProgram glad_debug_glCreateProgram
+GLAPI PFNGLCREATESHADERPROC glad_debug_glCreateShader;
+#undef glCreateShader
+#define glCreateShader glad_debug_glCreateShader
+GLAPI PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram;
+#undef glDeleteProgram
+#define glDeleteProgram glad_debug_glDeleteProgram
+GLAPI PFNGLDELETESHADERPROC glad_debug_glDeleteShader;
+#undef glDeleteShader
+#define glDeleteShader glad_debug_glDeleteShader
+GLAPI PFNGLDETACHSHADERPROC glad_debug_glDetachShader;
+#undef glDetachShader
+#define glDetachShader glad_debug_glDetachShader
+GLAPI PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray;
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray glad_debug_glDisableVertexAttribArray
+GLAPI PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray;
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray glad_debug_glEnableVertexAttribArray
+GLAPI PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib;
+#undef glGetActiveAttrib
+#define glGetActiveAttrib glad_debug_glGetActiveAttrib
+GLAPI PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform;
+#undef glGetActiveUniform
+#define glGetActiveUniform glad_debug_glGetActiveUniform
+GLAPI PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders;
+#undef glGetAttachedShaders
+#define glGetAttachedShaders glad_debug_glGetAttachedShaders
+GLAPI PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation;
+#undef glGetAttribLocation
+#define glGetAttribLocation glad_debug_glGetAttribLocation
+GLAPI PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv;
+#undef glGetProgramiv
+#define glGetProgramiv glad_debug_glGetProgramiv
+GLAPI PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog;
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog glad_debug_glGetProgramInfoLog
+GLAPI PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv;
+#undef glGetShaderiv
+#define glGetShaderiv glad_debug_glGetShaderiv
+GLAPI PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog;
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog glad_debug_glGetShaderInfoLog
+GLAPI PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource;
+#undef glGetShaderSource
+#define glGetShaderSource glad_debug_glGetShaderSource
+GLAPI PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation;
+#undef glGetUniformLocation
+#define glGetUniformLocation glad_debug_glGetUniformLocation
+GLAPI PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv;
+#undef glGetUniformfv
+#define glGetUniformfv glad_debug_glGetUniformfv
+GLAPI PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv;
+#undef glGetUniformiv
+#define glGetUniformiv glad_debug_glGetUniformiv
+GLAPI PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv;
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv glad_debug_glGetVertexAttribdv
+GLAPI PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv;
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv glad_debug_glGetVertexAttribfv
+GLAPI PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv;
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv glad_debug_glGetVertexAttribiv
+GLAPI PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv;
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv glad_debug_glGetVertexAttribPointerv
+GLAPI PFNGLISPROGRAMPROC glad_debug_glIsProgram;
+#undef glIsProgram
+#define glIsProgram glad_debug_glIsProgram
+GLAPI PFNGLISSHADERPROC glad_debug_glIsShader;
+#undef glIsShader
+#define glIsShader glad_debug_glIsShader
+GLAPI PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram;
+#undef glLinkProgram
+#define glLinkProgram glad_debug_glLinkProgram
+GLAPI PFNGLSHADERSOURCEPROC glad_debug_glShaderSource;
+#undef glShaderSource
+#define glShaderSource glad_debug_glShaderSource
+GLAPI PFNGLUSEPROGRAMPROC glad_debug_glUseProgram;
+#undef glUseProgram
+#define glUseProgram glad_debug_glUseProgram
+GLAPI PFNGLUNIFORM1FPROC glad_debug_glUniform1f;
+#undef glUniform1f
+#define glUniform1f glad_debug_glUniform1f
+GLAPI PFNGLUNIFORM2FPROC glad_debug_glUniform2f;
+#undef glUniform2f
+#define glUniform2f glad_debug_glUniform2f
+GLAPI PFNGLUNIFORM3FPROC glad_debug_glUniform3f;
+#undef glUniform3f
+#define glUniform3f glad_debug_glUniform3f
+GLAPI PFNGLUNIFORM4FPROC glad_debug_glUniform4f;
+#undef glUniform4f
+#define glUniform4f glad_debug_glUniform4f
+GLAPI PFNGLUNIFORM1IPROC glad_debug_glUniform1i;
+#undef glUniform1i
+#define glUniform1i glad_debug_glUniform1i
+GLAPI PFNGLUNIFORM2IPROC glad_debug_glUniform2i;
+#undef glUniform2i
+#define glUniform2i glad_debug_glUniform2i
+GLAPI PFNGLUNIFORM3IPROC glad_debug_glUniform3i;
+#undef glUniform3i
+#define glUniform3i glad_debug_glUniform3i
+GLAPI PFNGLUNIFORM4IPROC glad_debug_glUniform4i;
+#undef glUniform4i
+#define glUniform4i glad_debug_glUniform4i
+GLAPI PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv;
+#undef glUniform1fv
+#define glUniform1fv glad_debug_glUniform1fv
+GLAPI PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv;
+#undef glUniform2fv
+#define glUniform2fv glad_debug_glUniform2fv
+GLAPI PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv;
+#undef glUniform3fv
+#define glUniform3fv glad_debug_glUniform3fv
+GLAPI PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv;
+#undef glUniform4fv
+#define glUniform4fv glad_debug_glUniform4fv
+GLAPI PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv;
+#undef glUniform1iv
+#define glUniform1iv glad_debug_glUniform1iv
+GLAPI PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv;
+#undef glUniform2iv
+#define glUniform2iv glad_debug_glUniform2iv
+GLAPI PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv;
+#undef glUniform3iv
+#define glUniform3iv glad_debug_glUniform3iv
+GLAPI PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv;
+#undef glUniform4iv
+#define glUniform4iv glad_debug_glUniform4iv
+GLAPI PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv;
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv glad_debug_glUniformMatrix2fv
+GLAPI PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv;
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv glad_debug_glUniformMatrix3fv
+GLAPI PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv;
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv glad_debug_glUniformMatrix4fv
+GLAPI PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram;
+#undef glValidateProgram
+#define glValidateProgram glad_debug_glValidateProgram
+GLAPI PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d;
+#undef glVertexAttrib1d
+#define glVertexAttrib1d glad_debug_glVertexAttrib1d
+GLAPI PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv;
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv glad_debug_glVertexAttrib1dv
+GLAPI PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f;
+#undef glVertexAttrib1f
+#define glVertexAttrib1f glad_debug_glVertexAttrib1f
+GLAPI PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv;
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv glad_debug_glVertexAttrib1fv
+GLAPI PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s;
+#undef glVertexAttrib1s
+#define glVertexAttrib1s glad_debug_glVertexAttrib1s
+GLAPI PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv;
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv glad_debug_glVertexAttrib1sv
+GLAPI PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d;
+#undef glVertexAttrib2d
+#define glVertexAttrib2d glad_debug_glVertexAttrib2d
+GLAPI PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv;
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv glad_debug_glVertexAttrib2dv
+GLAPI PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f;
+#undef glVertexAttrib2f
+#define glVertexAttrib2f glad_debug_glVertexAttrib2f
+GLAPI PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv;
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv glad_debug_glVertexAttrib2fv
+GLAPI PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s;
+#undef glVertexAttrib2s
+#define glVertexAttrib2s glad_debug_glVertexAttrib2s
+GLAPI PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv;
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv glad_debug_glVertexAttrib2sv
+GLAPI PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d;
+#undef glVertexAttrib3d
+#define glVertexAttrib3d glad_debug_glVertexAttrib3d
+GLAPI PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv;
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv glad_debug_glVertexAttrib3dv
+GLAPI PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f;
+#undef glVertexAttrib3f
+#define glVertexAttrib3f glad_debug_glVertexAttrib3f
+GLAPI PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv;
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv glad_debug_glVertexAttrib3fv
+GLAPI PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s;
+#undef glVertexAttrib3s
+#define glVertexAttrib3s glad_debug_glVertexAttrib3s
+GLAPI PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv;
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv glad_debug_glVertexAttrib3sv
+GLAPI PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv;
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv glad_debug_glVertexAttrib4Nbv
+GLAPI PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv;
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv glad_debug_glVertexAttrib4Niv
+GLAPI PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv;
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv glad_debug_glVertexAttrib4Nsv
+GLAPI PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub;
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub glad_debug_glVertexAttrib4Nub
+GLAPI PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv;
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv glad_debug_glVertexAttrib4Nubv
+GLAPI PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv;
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv glad_debug_glVertexAttrib4Nuiv
+GLAPI PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv;
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv glad_debug_glVertexAttrib4Nusv
+GLAPI PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv;
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv glad_debug_glVertexAttrib4bv
+GLAPI PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d;
+#undef glVertexAttrib4d
+#define glVertexAttrib4d glad_debug_glVertexAttrib4d
+GLAPI PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv;
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv glad_debug_glVertexAttrib4dv
+GLAPI PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f;
+#undef glVertexAttrib4f
+#define glVertexAttrib4f glad_debug_glVertexAttrib4f
+GLAPI PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv;
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv glad_debug_glVertexAttrib4fv
+GLAPI PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv;
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv glad_debug_glVertexAttrib4iv
+GLAPI PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s;
+#undef glVertexAttrib4s
+#define glVertexAttrib4s glad_debug_glVertexAttrib4s
+GLAPI PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv;
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv glad_debug_glVertexAttrib4sv
+GLAPI PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv;
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv glad_debug_glVertexAttrib4ubv
+GLAPI PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv;
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv glad_debug_glVertexAttrib4uiv
+GLAPI PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv;
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv glad_debug_glVertexAttrib4usv
+GLAPI PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer;
+#undef glVertexAttribPointer
+#define glVertexAttribPointer glad_debug_glVertexAttribPointer
+GLAPI PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv;
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv glad_debug_glUniformMatrix2x3fv
+GLAPI PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv;
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv glad_debug_glUniformMatrix3x2fv
+GLAPI PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv;
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv glad_debug_glUniformMatrix2x4fv
+GLAPI PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv;
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv glad_debug_glUniformMatrix4x2fv
+GLAPI PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv;
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv glad_debug_glUniformMatrix3x4fv
+GLAPI PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv;
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv glad_debug_glUniformMatrix4x3fv
+GLAPI PFNGLCOLORMASKIPROC glad_debug_glColorMaski;
+#undef glColorMaski
+#define glColorMaski glad_debug_glColorMaski
+GLAPI PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v;
+#undef glGetBooleani_v
+#define glGetBooleani_v glad_debug_glGetBooleani_v
+GLAPI PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v;
+#undef glGetIntegeri_v
+#define glGetIntegeri_v glad_debug_glGetIntegeri_v
+GLAPI PFNGLENABLEIPROC glad_debug_glEnablei;
+#undef glEnablei
+#define glEnablei glad_debug_glEnablei
+GLAPI PFNGLDISABLEIPROC glad_debug_glDisablei;
+#undef glDisablei
+#define glDisablei glad_debug_glDisablei
+GLAPI PFNGLISENABLEDIPROC glad_debug_glIsEnabledi;
+#undef glIsEnabledi
+#define glIsEnabledi glad_debug_glIsEnabledi
+GLAPI PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback;
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback glad_debug_glBeginTransformFeedback
+GLAPI PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback;
+#undef glEndTransformFeedback
+#define glEndTransformFeedback glad_debug_glEndTransformFeedback
+GLAPI PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange;
+#undef glBindBufferRange
+#define glBindBufferRange glad_debug_glBindBufferRange
+GLAPI PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase;
+#undef glBindBufferBase
+#define glBindBufferBase glad_debug_glBindBufferBase
+GLAPI PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings;
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings glad_debug_glTransformFeedbackVaryings
+GLAPI PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying;
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying glad_debug_glGetTransformFeedbackVarying
+GLAPI PFNGLCLAMPCOLORPROC glad_debug_glClampColor;
+#undef glClampColor
+#define glClampColor glad_debug_glClampColor
+GLAPI PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender;
+#undef glBeginConditionalRender
+#define glBeginConditionalRender glad_debug_glBeginConditionalRender
+GLAPI PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender;
+#undef glEndConditionalRender
+#define glEndConditionalRender glad_debug_glEndConditionalRender
+GLAPI PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer;
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer glad_debug_glVertexAttribIPointer
+GLAPI PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv;
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv glad_debug_glGetVertexAttribIiv
+GLAPI PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv;
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv glad_debug_glGetVertexAttribIuiv
+GLAPI PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i;
+#undef glVertexAttribI1i
+#define glVertexAttribI1i glad_debug_glVertexAttribI1i
+GLAPI PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i;
+#undef glVertexAttribI2i
+#define glVertexAttribI2i glad_debug_glVertexAttribI2i
+GLAPI PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i;
+#undef glVertexAttribI3i
+#define glVertexAttribI3i glad_debug_glVertexAttribI3i
+GLAPI PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i;
+#undef glVertexAttribI4i
+#define glVertexAttribI4i glad_debug_glVertexAttribI4i
+GLAPI PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui;
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui glad_debug_glVertexAttribI1ui
+GLAPI PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui;
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui glad_debug_glVertexAttribI2ui
+GLAPI PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui;
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui glad_debug_glVertexAttribI3ui
+GLAPI PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui;
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui glad_debug_glVertexAttribI4ui
+GLAPI PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv;
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv glad_debug_glVertexAttribI1iv
+GLAPI PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv;
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv glad_debug_glVertexAttribI2iv
+GLAPI PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv;
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv glad_debug_glVertexAttribI3iv
+GLAPI PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv;
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv glad_debug_glVertexAttribI4iv
+GLAPI PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv;
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv glad_debug_glVertexAttribI1uiv
+GLAPI PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv;
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv glad_debug_glVertexAttribI2uiv
+GLAPI PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv;
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv glad_debug_glVertexAttribI3uiv
+GLAPI PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv;
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv glad_debug_glVertexAttribI4uiv
+GLAPI PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv;
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv glad_debug_glVertexAttribI4bv
+GLAPI PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv;
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv glad_debug_glVertexAttribI4sv
+GLAPI PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv;
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv glad_debug_glVertexAttribI4ubv
+GLAPI PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv;
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv glad_debug_glVertexAttribI4usv
+GLAPI PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv;
+#undef glGetUniformuiv
+#define glGetUniformuiv glad_debug_glGetUniformuiv
+GLAPI PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation;
+#undef glBindFragDataLocation
+#define glBindFragDataLocation glad_debug_glBindFragDataLocation
+GLAPI PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation;
+#undef glGetFragDataLocation
+#define glGetFragDataLocation glad_debug_glGetFragDataLocation
+GLAPI PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui;
+#undef glUniform1ui
+#define glUniform1ui glad_debug_glUniform1ui
+GLAPI PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui;
+#undef glUniform2ui
+#define glUniform2ui glad_debug_glUniform2ui
+GLAPI PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui;
+#undef glUniform3ui
+#define glUniform3ui glad_debug_glUniform3ui
+GLAPI PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui;
+#undef glUniform4ui
+#define glUniform4ui glad_debug_glUniform4ui
+GLAPI PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv;
+#undef glUniform1uiv
+#define glUniform1uiv glad_debug_glUniform1uiv
+GLAPI PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv;
+#undef glUniform2uiv
+#define glUniform2uiv glad_debug_glUniform2uiv
+GLAPI PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv;
+#undef glUniform3uiv
+#define glUniform3uiv glad_debug_glUniform3uiv
+GLAPI PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv;
+#undef glUniform4uiv
+#define glUniform4uiv glad_debug_glUniform4uiv
+GLAPI PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv;
+#undef glTexParameterIiv
+#define glTexParameterIiv glad_debug_glTexParameterIiv
+GLAPI PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv;
+#undef glTexParameterIuiv
+#define glTexParameterIuiv glad_debug_glTexParameterIuiv
+GLAPI PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv;
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv glad_debug_glGetTexParameterIiv
+GLAPI PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv;
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv glad_debug_glGetTexParameterIuiv
+GLAPI PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv;
+#undef glClearBufferiv
+#define glClearBufferiv glad_debug_glClearBufferiv
+GLAPI PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv;
+#undef glClearBufferuiv
+#define glClearBufferuiv glad_debug_glClearBufferuiv
+GLAPI PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv;
+#undef glClearBufferfv
+#define glClearBufferfv glad_debug_glClearBufferfv
+GLAPI PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi;
+#undef glClearBufferfi
+#define glClearBufferfi glad_debug_glClearBufferfi
+GLAPI PFNGLGETSTRINGIPROC glad_debug_glGetStringi;
+#undef glGetStringi
+#define glGetStringi glad_debug_glGetStringi
+GLAPI PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer;
+#undef glIsRenderbuffer
+#define glIsRenderbuffer glad_debug_glIsRenderbuffer
+GLAPI PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer;
+#undef glBindRenderbuffer
+#define glBindRenderbuffer glad_debug_glBindRenderbuffer
+GLAPI PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers;
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers glad_debug_glDeleteRenderbuffers
+GLAPI PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers;
+#undef glGenRenderbuffers
+#define glGenRenderbuffers glad_debug_glGenRenderbuffers
+GLAPI PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage;
+#undef glRenderbufferStorage
+#define glRenderbufferStorage glad_debug_glRenderbufferStorage
+GLAPI PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv;
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv glad_debug_glGetRenderbufferParameteriv
+GLAPI PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer;
+#undef glIsFramebuffer
+#define glIsFramebuffer glad_debug_glIsFramebuffer
+GLAPI PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer;
+#undef glBindFramebuffer
+#define glBindFramebuffer glad_debug_glBindFramebuffer
+GLAPI PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers;
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers glad_debug_glDeleteFramebuffers
+GLAPI PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers;
+#undef glGenFramebuffers
+#define glGenFramebuffers glad_debug_glGenFramebuffers
+GLAPI PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus;
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus glad_debug_glCheckFramebufferStatus
+GLAPI PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D;
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D glad_debug_glFramebufferTexture1D
+GLAPI PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D;
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D glad_debug_glFramebufferTexture2D
+GLAPI PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D;
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D glad_debug_glFramebufferTexture3D
+GLAPI PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer;
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer glad_debug_glFramebufferRenderbuffer
+GLAPI PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv;
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv glad_debug_glGetFramebufferAttachmentParameteriv
+GLAPI PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap;
+#undef glGenerateMipmap
+#define glGenerateMipmap glad_debug_glGenerateMipmap
+GLAPI PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer;
+#undef glBlitFramebuffer
+#define glBlitFramebuffer glad_debug_glBlitFramebuffer
+GLAPI PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample;
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample glad_debug_glRenderbufferStorageMultisample
+GLAPI PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer;
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer glad_debug_glFramebufferTextureLayer
+GLAPI PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange;
+#undef glMapBufferRange
+#define glMapBufferRange glad_debug_glMapBufferRange
+GLAPI PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange;
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange glad_debug_glFlushMappedBufferRange
+GLAPI PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray;
+#undef glBindVertexArray
+#define glBindVertexArray glad_debug_glBindVertexArray
+GLAPI PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays;
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays glad_debug_glDeleteVertexArrays
+GLAPI PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays;
+#undef glGenVertexArrays
+#define glGenVertexArrays glad_debug_glGenVertexArrays
+GLAPI PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray;
+#undef glIsVertexArray
+#define glIsVertexArray glad_debug_glIsVertexArray
+GLAPI PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced;
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced glad_debug_glDrawArraysInstanced
+GLAPI PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced;
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced glad_debug_glDrawElementsInstanced
+GLAPI PFNGLTEXBUFFERPROC glad_debug_glTexBuffer;
+#undef glTexBuffer
+#define glTexBuffer glad_debug_glTexBuffer
+GLAPI PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex;
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex glad_debug_glPrimitiveRestartIndex
+GLAPI PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData;
+#undef glCopyBufferSubData
+#define glCopyBufferSubData glad_debug_glCopyBufferSubData
+GLAPI PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices;
+#undef glGetUniformIndices
+#define glGetUniformIndices glad_debug_glGetUniformIndices
+GLAPI PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv;
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv glad_debug_glGetActiveUniformsiv
+GLAPI PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName;
+#undef glGetActiveUniformName
+#define glGetActiveUniformName glad_debug_glGetActiveUniformName
+GLAPI PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex;
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex glad_debug_glGetUniformBlockIndex
+GLAPI PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv;
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv glad_debug_glGetActiveUniformBlockiv
+GLAPI PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName;
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName glad_debug_glGetActiveUniformBlockName
+GLAPI PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding;
+#undef glUniformBlockBinding
+#define glUniformBlockBinding glad_debug_glUniformBlockBinding
+GLAPI PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex;
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex glad_debug_glDrawElementsBaseVertex
+GLAPI PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex;
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex glad_debug_glDrawRangeElementsBaseVertex
+GLAPI PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex;
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex glad_debug_glDrawElementsInstancedBaseVertex
+GLAPI PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex;
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex glad_debug_glMultiDrawElementsBaseVertex
+GLAPI PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex;
+#undef glProvokingVertex
+#define glProvokingVertex glad_debug_glProvokingVertex
+GLAPI PFNGLFENCESYNCPROC glad_debug_glFenceSync;
+#undef glFenceSync
+#define glFenceSync glad_debug_glFenceSync
+GLAPI PFNGLISSYNCPROC glad_debug_glIsSync;
+#undef glIsSync
+#define glIsSync glad_debug_glIsSync
+GLAPI PFNGLDELETESYNCPROC glad_debug_glDeleteSync;
+#undef glDeleteSync
+#define glDeleteSync glad_debug_glDeleteSync
+GLAPI PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync;
+#undef glClientWaitSync
+#define glClientWaitSync glad_debug_glClientWaitSync
+GLAPI PFNGLWAITSYNCPROC glad_debug_glWaitSync;
+#undef glWaitSync
+#define glWaitSync glad_debug_glWaitSync
+GLAPI PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v;
+#undef glGetInteger64v
+#define glGetInteger64v glad_debug_glGetInteger64v
+GLAPI PFNGLGETSYNCIVPROC glad_debug_glGetSynciv;
+#undef glGetSynciv
+#define glGetSynciv glad_debug_glGetSynciv
+GLAPI PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v;
+#undef glGetInteger64i_v
+#define glGetInteger64i_v glad_debug_glGetInteger64i_v
+GLAPI PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v;
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v glad_debug_glGetBufferParameteri64v
+GLAPI PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture;
+#undef glFramebufferTexture
+#define glFramebufferTexture glad_debug_glFramebufferTexture
+GLAPI PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample;
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample glad_debug_glTexImage2DMultisample
+GLAPI PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample;
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample glad_debug_glTexImage3DMultisample
+GLAPI PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv;
+#undef glGetMultisamplefv
+#define glGetMultisamplefv glad_debug_glGetMultisamplefv
+GLAPI PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski;
+#undef glSampleMaski
+#define glSampleMaski glad_debug_glSampleMaski
+GLAPI PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed;
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed glad_debug_glBindFragDataLocationIndexed
+GLAPI PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex;
+#undef glGetFragDataIndex
+#define glGetFragDataIndex glad_debug_glGetFragDataIndex
+GLAPI PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers;
+#undef glGenSamplers
+#define glGenSamplers glad_debug_glGenSamplers
+GLAPI PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers;
+#undef glDeleteSamplers
+#define glDeleteSamplers glad_debug_glDeleteSamplers
+GLAPI PFNGLISSAMPLERPROC glad_debug_glIsSampler;
+#undef glIsSampler
+#define glIsSampler glad_debug_glIsSampler
+GLAPI PFNGLBINDSAMPLERPROC glad_debug_glBindSampler;
+#undef glBindSampler
+#define glBindSampler glad_debug_glBindSampler
+GLAPI PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri;
+#undef glSamplerParameteri
+#define glSamplerParameteri glad_debug_glSamplerParameteri
+GLAPI PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv;
+#undef glSamplerParameteriv
+#define glSamplerParameteriv glad_debug_glSamplerParameteriv
+GLAPI PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf;
+#undef glSamplerParameterf
+#define glSamplerParameterf glad_debug_glSamplerParameterf
+GLAPI PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv;
+#undef glSamplerParameterfv
+#define glSamplerParameterfv glad_debug_glSamplerParameterfv
+GLAPI PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv;
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv glad_debug_glSamplerParameterIiv
+GLAPI PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv;
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv glad_debug_glSamplerParameterIuiv
+GLAPI PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv;
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv glad_debug_glGetSamplerParameteriv
+GLAPI PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv;
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv glad_debug_glGetSamplerParameterIiv
+GLAPI PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv;
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv glad_debug_glGetSamplerParameterfv
+GLAPI PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv;
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv glad_debug_glGetSamplerParameterIuiv
+GLAPI PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter;
+#undef glQueryCounter
+#define glQueryCounter glad_debug_glQueryCounter
+GLAPI PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v;
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v glad_debug_glGetQueryObjecti64v
+GLAPI PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v;
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v glad_debug_glGetQueryObjectui64v
+GLAPI PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor;
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor glad_debug_glVertexAttribDivisor
+GLAPI PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui;
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui glad_debug_glVertexAttribP1ui
+GLAPI PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv;
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv glad_debug_glVertexAttribP1uiv
+GLAPI PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui;
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui glad_debug_glVertexAttribP2ui
+GLAPI PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv;
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv glad_debug_glVertexAttribP2uiv
+GLAPI PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui;
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui glad_debug_glVertexAttribP3ui
+GLAPI PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv;
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv glad_debug_glVertexAttribP3uiv
+GLAPI PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui;
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui glad_debug_glVertexAttribP4ui
+GLAPI PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv;
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv glad_debug_glVertexAttribP4uiv
+GLAPI PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui;
+#undef glVertexP2ui
+#define glVertexP2ui glad_debug_glVertexP2ui
+GLAPI PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv;
+#undef glVertexP2uiv
+#define glVertexP2uiv glad_debug_glVertexP2uiv
+GLAPI PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui;
+#undef glVertexP3ui
+#define glVertexP3ui glad_debug_glVertexP3ui
+GLAPI PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv;
+#undef glVertexP3uiv
+#define glVertexP3uiv glad_debug_glVertexP3uiv
+GLAPI PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui;
+#undef glVertexP4ui
+#define glVertexP4ui glad_debug_glVertexP4ui
+GLAPI PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv;
+#undef glVertexP4uiv
+#define glVertexP4uiv glad_debug_glVertexP4uiv
+GLAPI PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui;
+#undef glTexCoordP1ui
+#define glTexCoordP1ui glad_debug_glTexCoordP1ui
+GLAPI PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv;
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv glad_debug_glTexCoordP1uiv
+GLAPI PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui;
+#undef glTexCoordP2ui
+#define glTexCoordP2ui glad_debug_glTexCoordP2ui
+GLAPI PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv;
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv glad_debug_glTexCoordP2uiv
+GLAPI PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui;
+#undef glTexCoordP3ui
+#define glTexCoordP3ui glad_debug_glTexCoordP3ui
+GLAPI PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv;
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv glad_debug_glTexCoordP3uiv
+GLAPI PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui;
+#undef glTexCoordP4ui
+#define glTexCoordP4ui glad_debug_glTexCoordP4ui
+GLAPI PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv;
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv glad_debug_glTexCoordP4uiv
+GLAPI PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui;
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui glad_debug_glMultiTexCoordP1ui
+GLAPI PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv;
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv glad_debug_glMultiTexCoordP1uiv
+GLAPI PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui;
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui glad_debug_glMultiTexCoordP2ui
+GLAPI PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv;
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv glad_debug_glMultiTexCoordP2uiv
+GLAPI PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui;
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui glad_debug_glMultiTexCoordP3ui
+GLAPI PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv;
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv glad_debug_glMultiTexCoordP3uiv
+GLAPI PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui;
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui glad_debug_glMultiTexCoordP4ui
+GLAPI PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv;
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv glad_debug_glMultiTexCoordP4uiv
+GLAPI PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui;
+#undef glNormalP3ui
+#define glNormalP3ui glad_debug_glNormalP3ui
+GLAPI PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv;
+#undef glNormalP3uiv
+#define glNormalP3uiv glad_debug_glNormalP3uiv
+GLAPI PFNGLCOLORP3UIPROC glad_debug_glColorP3ui;
+#undef glColorP3ui
+#define glColorP3ui glad_debug_glColorP3ui
+GLAPI PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv;
+#undef glColorP3uiv
+#define glColorP3uiv glad_debug_glColorP3uiv
+GLAPI PFNGLCOLORP4UIPROC glad_debug_glColorP4ui;
+#undef glColorP4ui
+#define glColorP4ui glad_debug_glColorP4ui
+GLAPI PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv;
+#undef glColorP4uiv
+#define glColorP4uiv glad_debug_glColorP4uiv
+GLAPI PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui;
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui glad_debug_glSecondaryColorP3ui
+GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv;
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv glad_debug_glSecondaryColorP3uiv
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,304 @@
+#include "input.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//GLFW callbacks carry no user data besides the window user pointer, which
+//the camera already uses
+static struct Input* installed;
+
+struct Input*
+input_create(void) {
+	struct Input* input = calloc(1, sizeof(*input));
+	if (input == NULL) {
+		fprintf(stderr, "Out of memory for input\n");
+		return NULL;
+	}
+	input->start_time = glfwGetTime();
+	frame_histogram_reset(&input->latency);
+	return input;
+}
+
+void
+input_free(struct Input* input) {
+	if (input == NULL) {
+		return;
+	}
+	if (installed == input) {
+		installed = NULL;
+	}
+	if (input->record != NULL && fclose(input->record) != 0) {
+		fprintf(stderr, "Failed to write the input recording\n");
+	}
+	free(input->replay);
+	free(input);
+}
+
+static void
+write_event(struct Input* input, struct InputEvent event) {
+	if (input->record != NULL && fwrite(&event, sizeof(event), 1, input->record) != 1) {
+		fprintf(stderr, "Failed to write the input recording, stopping it\n");
+		fclose(input->record);
+		input->record = NULL;
+	}
+}
+
+//Only changes count, key repeats keep the state as it is
+static void
+update_button(struct Input* input, uint8_t* state, const struct InputEvent* event) {
+	uint8_t down = event->action != GLFW_RELEASE;
+	if (*state == down) {
+		return;
+	}
+	*state = down;
+
+	for (int i = 0; i < input->binding_count; i++) {
+		const struct InputBinding* binding = &input->bindings[i];
+		if (binding->type != event->type || binding->code != event->code) {
+			continue;
+		}
+		if (down) {
+			input->action_held[binding->action]++;
+			input->actions_pressed |= 1u << binding->action;
+		} else {
+			input->action_held[binding->action]--;
+			input->actions_released |= 1u << binding->action;
+		}
+	}
+}
+
+//Updates the state, shared by live and replayed events
+static void
+apply_event(struct Input* input, const struct InputEvent* event) {
+	switch (event->type) {
+	case INPUT_KEY:
+		if (event->code >= 0 && event->code <= GLFW_KEY_LAST) {
+			update_button(input, &input->keys[event->code], event);
+		}
+		break;
+	case INPUT_MOUSE_BUTTON:
+		if (event->code >= 0 && event->code <= GLFW_MOUSE_BUTTON_LAST) {
+			update_button(input, &input->buttons[event->code], event);
+		}
+		break;
+	case INPUT_CURSOR:
+		input->cursor_x = event->x;
+		input->cursor_y = event->y;
+		break;
+	case INPUT_SCROLL:
+		input->scroll_x += event->x;
+		input->scroll_y += event->y;
+		break;
+	}
+}
+
+static uint32_t
+input_time(const struct Input* input) {
+	return (uint32_t) ((glfwGetTime() - input->start_time) * 1e6);
+}
+
+//Producer side, the frame is filled in when the event is drained
+static void
+live_event(struct InputEvent event) {
+	struct Input* input = installed;
+	if (input == NULL || input->replay != NULL) {
+		return;
+	}
+
+	uint32_t head = input->queue_head;
+	uint32_t tail = __atomic_load_n(&input->queue_tail, __ATOMIC_ACQUIRE);
+	if (head - tail == INPUT_QUEUE_SIZE) {
+		input->dropped++;
+		return;
+	}
+	event.time = input_time(input);
+	input->queue[head & (INPUT_QUEUE_SIZE - 1)] = event;
+	//Publishes the event to the consumer
+	__atomic_store_n(&input->queue_head, head + 1, __ATOMIC_RELEASE);
+}
+
+static void
+key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+	live_event((struct InputEvent) {.type = INPUT_KEY, .action = (uint8_t) action,
+		.mods = (uint16_t) mods, .code = key});
+}
+
+static void
+mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
+	live_event((struct InputEvent) {.type = INPUT_MOUSE_BUTTON, .action = (uint8_t) action,
+		.mods = (uint16_t) mods, .code = button});
+}
+
+static void
+cursor_callback(GLFWwindow* window, double x, double y) {
+	live_event((struct InputEvent) {.type = INPUT_CURSOR, .x = (float) x, .y = (float) y});
+}
+
+static void
+scroll_callback(GLFWwindow* window, double x, double y) {
+	live_event((struct InputEvent) {.type = INPUT_SCROLL, .x = (float) x, .y = (float) y});
+}
+
+void
+input_install(struct Input* input, GLFWwindow* window) {
+	installed = input;
+	glfwSetKeyCallback(window, key_callback);
+	glfwSetMouseButtonCallback(window, mouse_button_callback);
+	glfwSetCursorPosCallback(window, cursor_callback);
+	glfwSetScrollCallback(window, scroll_callback);
+}
+
+int
+input_bind(struct Input* input, int action, enum InputEventType type, int code) {
+	if (action < 0 || action >= INPUT_MAX_ACTIONS || input->binding_count == INPUT_MAX_BINDINGS) {
+		fprintf(stderr, "Can not bind action %d\n", action);
+		return 0;
+	}
+	input->bindings[input->binding_count++] = (struct InputBinding) {action, (uint8_t) type, code};
+	return 1;
+}
+
+int
+input_record(struct Input* input, const char* path) {
+	FILE* file = fopen(path, "wb");
+	if (file == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return 0;
+	}
+
+	struct InputLogHeader header = {INPUT_LOG_MAGIC, INPUT_LOG_VERSION};
+	if (fwrite(&header, sizeof(header), 1, file) != 1) {
+		fprintf(stderr, "Failed to write %s\n", path);
+		fclose(file);
+		return 0;
+	}
+	input->record = file;
+	return 1;
+}
+
+int
+input_replay(struct Input* input, const char* path) {
+	FILE* file = fopen(path, "rb");
+	if (file == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return 0;
+	}
+
+	struct InputLogHeader header;
+	long size = -1;
+	if (fread(&header, sizeof(header), 1, file) == 1 && fseek(file, 0, SEEK_END) == 0) {
+		size = ftell(file);
+	}
+	if (size < 0 || header.magic != INPUT_LOG_MAGIC || header.version != INPUT_LOG_VERSION) {
+		fprintf(stderr, "%s is not an input log\n", path);
+		fclose(file);
+		return 0;
+	}
+
+	//A recording cut short by a crash just loses its partial last event
+	uint32_t count = (uint32_t) (((size_t) size - sizeof(header)) / sizeof(struct InputEvent));
+	struct InputEvent* events = malloc((count ? count : 1) * sizeof(*events));
+	int ok = events != NULL && fseek(file, sizeof(header), SEEK_SET) == 0
+		&& fread(events, sizeof(*events), count, file) == count;
+	fclose(file);
+	if (!ok) {
+		fprintf(stderr, "Failed to read %s\n", path);
+		free(events);
+		return 0;
+	}
+
+	free(input->replay);
+	input->replay = events;
+	input->replay_count = count;
+	input->replay_next = 0;
+	return 1;
+}
+
+int
+input_replay_finished(const struct Input* input) {
+	return input->replay != NULL && input->replay_next >= input->replay_count;
+}
+
+float
+input_begin_frame(struct Input* input, float dt) {
+	uint32_t now = input_time(input);
+	input->actions_pressed = 0;
+	input->actions_released = 0;
+	input->scroll_x = 0.0;
+	input->scroll_y = 0.0;
+	input->frame_has_events = 0;
+
+	if (input->replay != NULL) {
+		//Replayed events arrive all at once, as the frame starts
+		while (input->replay_next < input->replay_count
+				&& input->replay[input->replay_next].frame <= input->frame) {
+			const struct InputEvent* event = &input->replay[input->replay_next++];
+			if (event->type == INPUT_FRAME) {
+				dt = event->x;
+			} else {
+				apply_event(input, event);
+				input->frame_has_events = 1;
+				input->frame_time = now;
+			}
+		}
+		return dt;
+	}
+
+	uint32_t tail = input->queue_tail;
+	uint32_t head = __atomic_load_n(&input->queue_head, __ATOMIC_ACQUIRE);
+	for (; tail != head; tail++) {
+		struct InputEvent event = input->queue[tail & (INPUT_QUEUE_SIZE - 1)];
+		event.frame = input->frame;
+		write_event(input, event);
+		apply_event(input, &event);
+		if (!input->frame_has_events) {
+			input->frame_has_events = 1;
+			input->frame_time = event.time;
+		}
+	}
+	//Hands the slots back to the producer
+	__atomic_store_n(&input->queue_tail, tail, __ATOMIC_RELEASE);
+
+	write_event(input, (struct InputEvent) {
+		.time = now,
+		.frame = input->frame,
+		.type = INPUT_FRAME,
+		.x = dt
+	});
+	return dt;
+}
+
+void
+input_end_frame(struct Input* input) {
+	if (input->frame_has_events) {
+		//Unsigned difference stays right across the time wrapping
+		uint32_t latency = input_time(input) - input->frame_time;
+		frame_histogram_record(&input->latency, (uint64_t) latency * 1000);
+	}
+	input->frame++;
+}
+
+int
+input_key_down(const struct Input* input, int key) {
+	return key >= 0 && key <= GLFW_KEY_LAST && input->keys[key];
+}
+
+int
+input_button_down(const struct Input* input, int button) {
+	return button >= 0 && button <= GLFW_MOUSE_BUTTON_LAST && input->buttons[button];
+}
+
+int
+input_action_down(const struct Input* input, int action) {
+	return action >= 0 && action < INPUT_MAX_ACTIONS && input->action_held[action] > 0;
+}
+
+int
+input_action_pressed(const struct Input* input, int action) {
+	return action >= 0 && action < INPUT_MAX_ACTIONS && (input->actions_pressed >> action) & 1u;
+}
+
+int
+input_action_released(const struct Input* input, int action) {
+	return action >= 0 && action < INPUT_MAX_ACTIONS && (input->actions_released >> action) & 1u;
+}
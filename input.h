@@ -0,0 +1,149 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <GLFW/glfw3.h>
+
+#include "frame_stats.h"
+
+//Input arrives as events from GLFW callbacks instead of glfwGetKey polling.
+//The callbacks only timestamp events and push them into a lock-free single
+//producer, single consumer queue. The consumer drains it once per frame,
+//which updates the key, button and action state the game reads, so the
+//simulation can run on a different thread than the one polling GLFW.
+//Drained events can be written to a log that a later run plays back frame
+//by frame in place of the callbacks.
+//
+//Log file, little endian: InputLogHeader, then InputEvent records until the
+//end of the file. Every frame starts with an INPUT_FRAME record holding
+//that frame's timestep, so a replay runs the same simulation.
+
+#define INPUT_LOG_MAGIC 0x4e495645u /* "EVIN" */
+#define INPUT_LOG_VERSION 1
+
+enum InputEventType {
+	//x is the frame's dt in seconds
+	INPUT_FRAME = 1,
+	//code is the GLFW key, action GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+	INPUT_KEY = 2,
+	//code is the GLFW button
+	INPUT_MOUSE_BUTTON = 3,
+	//x, y in screen coordinates
+	INPUT_CURSOR = 4,
+	//x, y are the scroll offsets
+	INPUT_SCROLL = 5
+};
+
+struct InputLogHeader {
+	uint32_t magic;
+	uint32_t version;
+};
+
+//24 bytes on disk
+struct InputEvent {
+	//Microseconds since the input was created, wraps after 71 minutes
+	uint32_t time;
+	uint32_t frame;
+	uint8_t type;
+	uint8_t action;
+	uint16_t mods;
+	int32_t code;
+	float x;
+	float y;
+};
+
+//Power of two, events past it are dropped until the consumer catches up
+#define INPUT_QUEUE_SIZE 1024
+#define INPUT_MAX_ACTIONS 32
+#define INPUT_MAX_BINDINGS 64
+
+struct InputBinding {
+	int action;
+	//INPUT_KEY or INPUT_MOUSE_BUTTON
+	uint8_t type;
+	int32_t code;
+};
+
+struct Input {
+	//Written by the callbacks, read by input_begin_frame
+	struct InputEvent queue[INPUT_QUEUE_SIZE];
+	uint32_t queue_head;
+	uint32_t queue_tail;
+	unsigned long dropped;
+
+	struct InputBinding bindings[INPUT_MAX_BINDINGS];
+	int binding_count;
+	//Bound keys and buttons held per action
+	uint8_t action_held[INPUT_MAX_ACTIONS];
+	//Bit per action, went down or up during the current frame's events
+	uint32_t actions_pressed;
+	uint32_t actions_released;
+
+	uint8_t keys[GLFW_KEY_LAST + 1];
+	uint8_t buttons[GLFW_MOUSE_BUTTON_LAST + 1];
+	double cursor_x;
+	double cursor_y;
+	//Summed over the frame
+	double scroll_x;
+	double scroll_y;
+
+	uint32_t frame;
+	double start_time;
+
+	FILE* record;
+	//The whole log while replaying
+	struct InputEvent* replay;
+	uint32_t replay_count;
+	uint32_t replay_next;
+
+	//Earliest event consumed by the current frame, in InputEvent time
+	uint32_t frame_time;
+	int frame_has_events;
+	//From an event being received to the end of the swap that showed its
+	//effect, in ns. Replayed events count from their frame's start.
+	struct FrameHistogram latency;
+};
+
+//Returns NULL when out of memory
+struct Input* input_create(void);
+//Closes a recording and frees a replay
+void input_free(struct Input* input);
+
+//Routes the window's key, button, cursor and scroll callbacks to input.
+//Only one input can be installed at a time. The thread calling
+//glfwPollEvents is the queue's producer.
+void input_install(struct Input* input, GLFWwindow* window);
+
+//Maps a key or mouse button to action, several inputs can share an
+//action. Returns 0 when the action is out of range or the table is full.
+int input_bind(struct Input* input, int action, enum InputEventType type, int code);
+
+//Writes every event from now on to path, returns 0 if it can not be opened
+int input_record(struct Input* input, const char* path);
+//Loads a log to play back, live events are ignored from then on. Returns 0
+//if the file can not be read.
+int input_replay(struct Input* input, const char* path);
+//The last recorded frame has been played back
+int input_replay_finished(const struct Input* input);
+
+//Everything below is for the consumer thread only.
+
+//Call at the start of every frame. Drains the queue, or applies the
+//frame's replayed events, records the frame and returns the dt to simulate
+//with, the recorded one while replaying and dt otherwise.
+float input_begin_frame(struct Input* input, float dt);
+//Call once the frame is on screen, right after the swap
+void input_end_frame(struct Input* input);
+
+int input_key_down(const struct Input* input, int key);
+int input_button_down(const struct Input* input, int button);
+//Any bound input is held
+int input_action_down(const struct Input* input, int action);
+//Went down or up during this frame's events, both can be true for a tap
+//shorter than a frame
+int input_action_pressed(const struct Input* input, int action);
+int input_action_released(const struct Input* input, int action);
+
+#endif
@@ -0,0 +1,144 @@
+#include "jobs.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "profile.h"
+
+#define JOBS_MAX_THREADS 64
+
+static struct {
+	pthread_t threads[JOBS_MAX_THREADS];
+	int thread_count;
+
+	pthread_mutex_t mutex;
+	pthread_cond_t work_ready;
+	pthread_cond_t work_done;
+
+	//Bumped for every parallel_for so sleeping workers notice new work
+	unsigned long generation;
+	int shutting_down;
+
+	JobFunction function;
+	void* user;
+	int count;
+	int next;
+	int finished;
+} pool = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.work_ready = PTHREAD_COND_INITIALIZER,
+	.work_done = PTHREAD_COND_INITIALIZER
+};
+
+//Claims and runs indices until none are left, called with the mutex held
+static void
+drain(void) {
+	while (pool.next < pool.count) {
+		int index = pool.next++;
+		JobFunction function = pool.function;
+		void* user = pool.user;
+
+		pthread_mutex_unlock(&pool.mutex);
+		profile_begin("job");
+		function(user, index);
+		profile_end();
+		pthread_mutex_lock(&pool.mutex);
+
+		pool.finished++;
+		if (pool.finished == pool.count) {
+			pthread_cond_broadcast(&pool.work_done);
+		}
+	}
+}
+
+static void*
+worker(void* argument) {
+	unsigned long seen = 0;
+	profile_set_thread_name("worker");
+
+	pthread_mutex_lock(&pool.mutex);
+	while (1) {
+		while (!pool.shutting_down && pool.generation == seen) {
+			pthread_cond_wait(&pool.work_ready, &pool.mutex);
+		}
+		if (pool.shutting_down) {
+			break;
+		}
+
+		seen = pool.generation;
+		drain();
+	}
+	pthread_mutex_unlock(&pool.mutex);
+
+	return NULL;
+}
+
+int
+jobs_init(int thread_count) {
+	if (thread_count <= 0) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		thread_count = cpus > 1 ? (int) cpus - 1 : 0;
+	}
+	if (thread_count > JOBS_MAX_THREADS) {
+		thread_count = JOBS_MAX_THREADS;
+	}
+
+	pool.shutting_down = 0;
+	pool.thread_count = 0;
+	for (int i = 0; i < thread_count; i++) {
+		if (pthread_create(&pool.threads[i], NULL, worker, NULL) != 0) {
+			break;
+		}
+		pool.thread_count++;
+	}
+
+	return pool.thread_count == thread_count;
+}
+
+void
+jobs_shutdown(void) {
+	pthread_mutex_lock(&pool.mutex);
+	pool.shutting_down = 1;
+	pthread_cond_broadcast(&pool.work_ready);
+	pthread_mutex_unlock(&pool.mutex);
+
+	for (int i = 0; i < pool.thread_count; i++) {
+		pthread_join(pool.threads[i], NULL);
+	}
+	pool.thread_count = 0;
+}
+
+int
+jobs_concurrency(void) {
+	return pool.thread_count + 1;
+}
+
+void
+jobs_parallel_for(int count, JobFunction function, void* user) {
+	if (count <= 0) {
+		return;
+	}
+
+	if (pool.thread_count == 0 || count == 1) {
+		for (int i = 0; i < count; i++) {
+			function(user, i);
+		}
+		return;
+	}
+
+	pthread_mutex_lock(&pool.mutex);
+	pool.function = function;
+	pool.user = user;
+	pool.count = count;
+	pool.next = 0;
+	pool.finished = 0;
+	pool.generation++;
+	pthread_cond_broadcast(&pool.work_ready);
+
+	drain();
+	while (pool.finished < pool.count) {
+		pthread_cond_wait(&pool.work_done, &pool.mutex);
+	}
+	pthread_mutex_unlock(&pool.mutex);
+}
@@ -0,0 +1,20 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+//Persistent worker pool for data parallel loops. The calling thread
+//takes part in the work, so a pool of 0 workers runs everything inline.
+
+typedef void (*JobFunction)(void* user, int index);
+
+//thread_count <= 0 uses one worker per online CPU minus the caller
+int jobs_init(int thread_count);
+void jobs_shutdown(void);
+
+//Workers plus the calling thread
+int jobs_concurrency(void);
+
+//Calls function(user, i) for every i in [0, count) and returns once all
+//calls finished. Not reentrant, do not call from inside a job.
+void jobs_parallel_for(int count, JobFunction function, void* user);
+
+#endif
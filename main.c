@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/stat.h>
 
 #include "glad/glad.h"
@@ -8,49 +9,88 @@
 
 #include <math.h>
 #include "every_math.h"
+#include "camera.h"
+#include "depth.h"
+#include "gl_state.h"
+#include "render_queue.h"
+#include "mesh.h"
+#include "jobs.h"
+#include "frustum.h"
+#include "bvh.h"
+#include "entity.h"
+#include "frame_pacing.h"
+#include "frame_stats.h"
+#include "particles.h"
+#include "particle_buffer.h"
+#include "gl_trace.h"
+#include "input.h"
+#include "profile.h"
+#include "script.h"
+#include "texture.h"
 
-Matrix4 perspective_matrix(double fov, double aspect_ratio, double far_plane) {
-	Matrix4 r = {0};
-	
-	double near_plane = 1.0;
-	double c = 1.0 / tan(fov * 0.5);
-
-	r.e[0] = c / aspect_ratio;
-	r.e[5] = c;
-	r.e[10] = -(far_plane + near_plane) / (far_plane - near_plane);
-	r.e[11] = - 2.0 * far_plane * near_plane / (far_plane - near_plane);
-	r.e[14] = -1;
+void
+framebuffer_size_callback(GLFWwindow* window, int width, int height) {
+	glViewport(0, 0, width, height);
 
-	return r;
+	struct Camera* camera = glfwGetWindowUserPointer(window);
+	if (camera != NULL) {
+		camera_set_viewport(camera, width, height);
+	}
 }
 
+enum Action {
+	ACTION_QUIT,
+	ACTION_TURN_LEFT,
+	ACTION_TURN_RIGHT,
+	ACTION_WIDEN_FOV,
+	ACTION_NARROW_FOV,
+	ACTION_TRACE_FRAME,
+	ACTION_PICK
+};
+
+//Ids of the scene's objects in the BVH. The mesh comes last so it can be
+//left out when none was loaded.
+enum SceneObject {
+	OBJECT_TRIANGLE,
+	OBJECT_MESH,
+	OBJECT_COUNT
+};
+
+static const char* object_names[OBJECT_COUNT] = {"triangle", "mesh"};
+
 void
-framebuffer_size_callback(GLFWwindow* window, int width, int height) {
-	glViewport(0, 0, width, height);
+bind_actions(struct Input* input) {
+	input_bind(input, ACTION_QUIT, INPUT_KEY, GLFW_KEY_ESCAPE);
+	input_bind(input, ACTION_TURN_LEFT, INPUT_KEY, GLFW_KEY_LEFT);
+	input_bind(input, ACTION_TURN_RIGHT, INPUT_KEY, GLFW_KEY_RIGHT);
+	input_bind(input, ACTION_WIDEN_FOV, INPUT_KEY, GLFW_KEY_N);
+	input_bind(input, ACTION_NARROW_FOV, INPUT_KEY, GLFW_KEY_M);
+	input_bind(input, ACTION_TRACE_FRAME, INPUT_KEY, GLFW_KEY_T);
+	input_bind(input, ACTION_PICK, INPUT_MOUSE_BUTTON, GLFW_MOUSE_BUTTON_LEFT);
 }
 
 void
-process_input(GLFWwindow* window, Quaternion* r, double *fov) {
+process_input(GLFWwindow* window, const struct Input* input, Quaternion* r, double *fov) {
 	
-	if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+	if(input_action_pressed(input, ACTION_QUIT)) {
 		glfwSetWindowShouldClose(window, true);
 	}
 
-	if(glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS) {
+	if(input_action_down(input, ACTION_TURN_LEFT)) {
 		*r = quat_rotate(*r, -2);
 		*r = quat_normalize(*r);
 	}
 
-	if(glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS) {
+	if(input_action_down(input, ACTION_TURN_RIGHT)) {
 		*r = quat_rotate(*r, 2);
 		*r = quat_normalize(*r);
 	}
 
-	if(glfwGetKey(window, GLFW_KEY_N) == GLFW_PRESS) {
+	if(input_action_down(input, ACTION_WIDEN_FOV)) {
 		*fov += 2.0;
 	}
 
-	if(glfwGetKey(window, GLFW_KEY_M) == GLFW_PRESS) {
+	if(input_action_down(input, ACTION_NARROW_FOV)) {
 		* fov -= 2.0;
 	}
 }
@@ -150,6 +190,75 @@ read_and_compile_shaders(struct ShaderSources sources) {
 	return (struct ShaderProgram) {sources, shader_program};
 }
 
+float
+random_signed(void) {
+	return (float) rand() / RAND_MAX * 2.0f - 1.0f;
+}
+
+void
+emit_particles(struct Particles* particles, int count) {
+	Vector3 emitter = {{0, -0.5f, -3}};
+	for (int i = 0; i < count; i++) {
+		Vector3 velocity = {{random_signed(), 4.0f + random_signed(), random_signed()}};
+		particles_emit(particles, emitter, velocity, 1.0f + random_signed() * 0.5f);
+	}
+}
+
+//Entities keep their model buffer slot for as long as they live, a
+//recycled slot is invalidated when its new transform first moves
+uint32_t
+render_model_slot(Entity entity) {
+	return (entity & ENTITY_INDEX_MASK) + 1;
+}
+
+//World space box around a transformed object space box
+void
+transform_box(Matrix4 model, Vector3 min, Vector3 max, Vector3* world_min, Vector3* world_max) {
+	for (int corner = 0; corner < 8; corner++) {
+		Vector3 point = {{
+			corner & 1 ? max.x : min.x,
+			corner & 2 ? max.y : min.y,
+			corner & 4 ? max.z : min.z
+		}};
+		point = mat4_transform_point(model, point);
+		for (int axis = 0; axis < 3; axis++) {
+			if (corner == 0 || point.e[axis] < world_min->e[axis]) world_min->e[axis] = point.e[axis];
+			if (corner == 0 || point.e[axis] > world_max->e[axis]) world_max->e[axis] = point.e[axis];
+		}
+	}
+}
+
+//Ray through the cursor, the camera sits at the origin looking down -z
+Vector3
+cursor_ray(GLFWwindow* window, const struct Input* input, const struct Camera* camera) {
+	int width, height;
+	glfwGetWindowSize(window, &width, &height);
+	double x = width > 0 ? 2.0 * input->cursor_x / width - 1.0 : 0.0;
+	double y = height > 0 ? 1.0 - 2.0 * input->cursor_y / height : 0.0;
+	double half_height = tan(TO_RAD(camera->fov) * 0.5);
+	double aspect_ratio = camera->height > 0 ? (double) camera->width / camera->height : 1.0;
+	return (Vector3) {{(float) (x * half_height * aspect_ratio), (float) (y * half_height), -1.0f}};
+}
+
+//FNV-1a over the final frame, equal hashes mean identical output
+uint64_t
+hash_frame(const struct DepthTarget* target) {
+	size_t size = (size_t) target->width * (size_t) target->height * 4;
+	unsigned char* pixels = malloc(size);
+	if (pixels == NULL) {
+		fprintf(stderr, "Out of memory for frame readback\n");
+		return 0;
+	}
+	depth_target_read_color(target, pixels);
+
+	uint64_t hash = 14695981039346656037ull;
+	for (size_t i = 0; i < size; i++) {
+		hash = (hash ^ pixels[i]) * 1099511628211ull;
+	}
+	free(pixels);
+	return hash;
+}
+
 int
 file_changed(const char* path, time_t* old_time) {
 	struct stat file_stat;
@@ -169,9 +278,52 @@ file_changed(const char* path, time_t* old_time) {
 };
 
 int
-main() {
+main(int argc, char** argv) {
+	//game [mesh] [--texture image] [--script timeline] [--record log | --replay log]
+	//     [--swap-interval n] [--max-fps fps] [--frames-in-flight n] [--late-latch]
+	//A script runs headless with a fixed timestep and seed for benchmarking,
+	//a replay plays a recorded session back with its original timesteps. The
+	//rest set up frame pacing, see frame_pacing.h.
+	const char* mesh_path = NULL;
+	const char* record_path = NULL;
+	const char* replay_path = NULL;
+	const char* texture_path = NULL;
+	struct Script script = {0};
+	int swap_interval = -1;
+	double max_fps = 0.0;
+	int frames_in_flight = 0;
+	int late_latch = 0;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--script") == 0 && i + 1 < argc) {
+			script = script_load(argv[++i]);
+			if (script.events == NULL) {
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+			record_path = argv[++i];
+		} else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+			replay_path = argv[++i];
+		} else if (strcmp(argv[i], "--texture") == 0 && i + 1 < argc) {
+			texture_path = argv[++i];
+		} else if (strcmp(argv[i], "--swap-interval") == 0 && i + 1 < argc) {
+			swap_interval = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--max-fps") == 0 && i + 1 < argc) {
+			max_fps = atof(argv[++i]);
+		} else if (strcmp(argv[i], "--frames-in-flight") == 0 && i + 1 < argc) {
+			frames_in_flight = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--late-latch") == 0) {
+			late_latch = 1;
+		} else {
+			mesh_path = argv[i];
+		}
+	}
+	int scripted = script.events != NULL;
 
 	glfwInit();
+	jobs_init(0);
+	if (scripted) {
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	}
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
@@ -179,19 +331,60 @@ main() {
 	int width = 800;
 	int height = 600;
 	const char* title = "Game";
+	double context_start = glfwGetTime();
 	GLFWwindow* window = glfwCreateWindow(width, height, title, NULL, NULL);
 	if (window == NULL) {
 		goto TERMINATE;
 	}
 	glfwMakeContextCurrent(window);
 
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+	//Entry points resolve on first use instead of all of GL 1.0 to 3.3 here
+	double loader_start = glfwGetTime();
+	if (!gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress)) {
 		goto TERMINATE;
 	}
+	double loader_end = glfwGetTime();
+	if (scripted) {
+		srand(script.seed);
+	}
+	//Scripts time the work, not the display
+	if (swap_interval < 0) {
+		swap_interval = scripted ? 0 : 1;
+	}
+	struct FramePacing pacing = frame_pacing_create(swap_interval, max_fps, frames_in_flight, late_latch);
+	gl_trace_install();
+	printf("Startup: context %.2f ms, loader %.2f ms\n",
+		(loader_start - context_start) * 1000.0, (loader_end - loader_start) * 1000.0);
+
+	Quaternion orientation = {.x = 0, .y = 0, .z = 0, .w = 1};
+	double fov = 45;
+
+	//The framebuffer can differ from the requested window size (HiDPI)
+	glfwGetFramebufferSize(window, &width, &height);
+	struct Camera camera = camera_create(fov, width, height, 10);
+
+	if (!clip_control_load((GLADloadproc)glfwGetProcAddress)) {
+		fprintf(stderr, "glClipControl unavailable, reversed-Z falls back to [-1, 1] depth\n");
+	}
+	struct DepthTarget depth_target = depth_target_create(width, height);
+	camera_use_reversed_z(&camera, 0.1, depth_target.zero_to_one);
 
 	glViewport(0, 0, width, height);
+	glfwSetWindowUserPointer(window, &camera);
 	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
+	struct Input* input = input_create();
+	if (input == NULL) {
+		goto TERMINATE;
+	}
+	bind_actions(input);
+	input_install(input, window);
+	if ((record_path != NULL && !input_record(input, record_path))
+			|| (replay_path != NULL && !input_replay(input, replay_path))) {
+		input_free(input);
+		goto TERMINATE;
+	}
+
 	float vertices[] = {
 		-0.5f, -0.5f, -1.0f,
 		0.5f, -0.5f, -1.0f,
@@ -199,13 +392,19 @@ main() {
 	};
 	unsigned int VAO;
 	glGenVertexArrays(1, &VAO);
-	glBindVertexArray(VAO);
+	gl_state_bind_vertex_array(VAO);
 
 	unsigned int VBO;
 	glGenBuffers(1, &VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, VBO);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
+	unsigned short indices[] = {0, 1, 2};
+	unsigned int IBO;
+	glGenBuffers(1, &IBO);
+	gl_state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, IBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
 	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*) 0);
 	glEnableVertexAttribArray(0);
 	
@@ -219,38 +418,337 @@ main() {
 	time_t old_time_vertex = {0};
 	time_t old_time_fragment = {0};
 
-	Quaternion orientation = {.x = 0, .y = 0, .z = 0, .w = 1};
-	double fov = 45;
+	struct ShaderSources particle_sources = {
+		"shaders/particle.vert",
+		"shaders/particle.frag",
+		0
+	};
+	struct ShaderProgram particle_program = {0};
+	time_t old_time_particle_vertex = {0};
+	time_t old_time_particle_fragment = {0};
+
+	struct Particles particles = particles_create(65536);
+	struct ParticleBuffer particle_buffer = particle_buffer_create(particles.capacity);
+	Vector3 gravity = {{0, -9.81f, 0}};
+	double last_time = glfwGetTime();
+
+	struct RenderQueue render_queue = {0};
+
+	struct Mesh mesh = {0};
+	if (mesh_path != NULL) {
+		mesh = mesh_load(mesh_path);
+	}
+	Matrix4 mesh_dequantize = mesh_dequantize_matrix(&mesh);
+
+	//Runs without textures if the loader can not start
+	struct TextureLoader* textures = texture_loader_create();
+	int mesh_texture = -1;
+	if (textures != NULL && texture_path != NULL) {
+		mesh_texture = texture_load(textures, texture_path);
+		//Streaming would make the final frame depend on decode timing
+		if (scripted) {
+			texture_loader_finish(textures);
+		}
+	}
+
+	struct Scene scene = scene_create();
+	Vector3 origin = {{0, 0, 0}};
+	Vector3 unit_scale = {{1, 1, 1}};
+	Entity triangle_entity = entity_create(&scene);
+	transform_add(&scene, triangle_entity, origin, orientation, unit_scale);
+	Entity mesh_entity = entity_create(&scene);
+	transform_add(&scene, mesh_entity, origin, orientation, unit_scale);
+
+	//Object space boxes, the BVH holds them in world space
+	Vector3 object_min[OBJECT_COUNT] = {{{-0.5f, -0.5f, -1.0f}}, mesh.bounds_min};
+	Vector3 object_max[OBJECT_COUNT] = {{{0.5f, 0.5f, -1.0f}}, mesh.bounds_max};
+	Entity object_entities[OBJECT_COUNT] = {triangle_entity, mesh_entity};
+	//Without a mesh its zeroed bounds would sit at the camera and catch every ray
+	uint32_t object_count = mesh.vao != 0 ? OBJECT_COUNT : OBJECT_MESH;
+	struct Bvh bvh = {0};
+	if (!bvh_build(&bvh, &object_min[0].x, &object_max[0].x, object_count)) {
+		fprintf(stderr, "Failed to build the scene BVH\n");
+	}
+
+	unsigned long transforms_updated = 0;
+	unsigned long transforms_skipped = 0;
+	unsigned long model_uploads = 0;
+	unsigned long model_uploads_skipped = 0;
+
+	profile_set_thread_name("main");
+	//Anything over two 60 Hz frames counts as a hitch
+	struct FrameStats* frame_stats = frame_stats_create(33333333, 10000000000ull);
+	uint32_t frame = 0;
+	double rotate_rate = 0.0;
+	double fov_rate = 0.0;
+	double script_start = glfwGetTime();
+	while(!glfwWindowShouldClose(window) && (!scripted || frame < script.frame_count)
+			&& !input_replay_finished(input)) {
+		profile_begin("frame");
+
+		//Input polled just before it is used, after waiting for the deadline
+		if (pacing.late_latch) {
+			profile_begin("pacing");
+			frame_pacing_wait(&pacing);
+			profile_end();
+			profile_begin("poll events");
+			glfwPollEvents();
+			profile_end();
+		}
+
+		double now = glfwGetTime();
+		float dt = input_begin_frame(input, scripted ? 1.0f / 60.0f : (float) (now - last_time));
+		last_time = now;
+
+		profile_begin("input");
+		if (scripted) {
+			const struct ScriptEvent* event;
+			while ((event = script_next(&script, frame)) != NULL) {
+				switch (event->action) {
+				case SCRIPT_ROTATE:
+					rotate_rate = event->value;
+					break;
+				case SCRIPT_FOV:
+					fov_rate = event->value;
+					break;
+				case SCRIPT_SPAWN:
+					emit_particles(&particles, (int) event->value);
+					break;
+				case SCRIPT_END:
+					break;
+				}
+			}
+			if (rotate_rate != 0.0) {
+				orientation = quat_normalize(quat_rotate(orientation, rotate_rate));
+			}
+			fov += fov_rate;
+		} else {
+			process_input(window, input, &orientation, &fov);
+		}
+		profile_end();
+
+		profile_begin("transforms");
+		transform_set_rotation(&scene, triangle_entity, orientation);
+		transform_set_rotation(&scene, mesh_entity, orientation);
+		scene_update_transforms(&scene);
+		transforms_skipped += scene.transforms.skipped;
+		transforms_updated += scene.transforms.updated;
+		uint32_t triangle_index = transform_find(&scene, triangle_entity);
+		uint32_t mesh_index = transform_find(&scene, mesh_entity);
+		Matrix4 triangle_model = scene.transforms.world[triangle_index];
+		Matrix4 mesh_model = scene.transforms.world[mesh_index];
+
+		//Culled objects keep moving, their slots must not survive until
+		//they are drawn again
+		for (uint32_t i = 0; i < scene.transforms.count; i++) {
+			if (scene.transforms.moved[i]) {
+				render_queue_invalidate_model(&render_queue, render_model_slot(scene.transforms.entities[i]));
+			}
+		}
+
+		int objects_moved = 0;
+		for (uint32_t object = 0; object < object_count && bvh.root != BVH_NULL; object++) {
+			uint32_t index = transform_find(&scene, object_entities[object]);
+			if (scene.transforms.moved[index]) {
+				Vector3 world_min, world_max;
+				transform_box(scene.transforms.world[index], object_min[object], object_max[object],
+					&world_min, &world_max);
+				bvh_update_object(&bvh, object, world_min, world_max);
+				objects_moved = 1;
+			}
+		}
+		if (objects_moved) {
+			bvh_refit(&bvh, 1);
+		}
 
-	while(!glfwWindowShouldClose(window)) {
-		process_input(window, &orientation, &fov);
+		if (!scripted && input_action_pressed(input, ACTION_PICK)) {
+			float distance;
+			uint32_t picked = bvh_raycast(&bvh, (Vector3) {{0, 0, 0}},
+				cursor_ray(window, input, &camera), INFINITY, &distance);
+			if (picked != BVH_NULL) {
+				printf("Picked %s at %.2f\n", object_names[picked], distance);
+			}
+		}
+		profile_end();
 
-		Matrix4 rotation_matrix = quat_to_matrix(orientation);
-		Matrix4 projection_matrix = perspective_matrix(TO_RAD(fov), (float) width / (float) height, 10);
+		camera_set_fov(&camera, fov);
+		camera_update(&camera);
 
+		profile_begin("shader poll");
 		if (file_changed(shader_sources.vertex, &old_time_vertex) || 
 				file_changed(shader_sources.fragment, &old_time_fragment)) {
-			glDeleteProgram(shader_program.id);
+			profile_begin("shader reload");
+			gl_state_delete_program(shader_program.id);
 			shader_program = read_and_compile_shaders(shader_sources);
+			camera_invalidate_upload(&camera);
+			profile_end();
 		}
 
-		int modelLoc = glGetUniformLocation(shader_program.id, "model");
-		glUniformMatrix4fv(modelLoc, 1, GL_FALSE, rotation_matrix.e);
-
-		int projection_location = glGetUniformLocation(shader_program.id, "projection");
-		glUniformMatrix4fv(projection_location, 1, GL_FALSE, projection_matrix.e);
+		if (file_changed(particle_sources.vertex, &old_time_particle_vertex) ||
+				file_changed(particle_sources.fragment, &old_time_particle_fragment)) {
+			profile_begin("shader reload");
+			gl_state_delete_program(particle_program.id);
+			particle_program = read_and_compile_shaders(particle_sources);
+			camera_invalidate_upload(&camera);
+			profile_end();
+		}
+		profile_end();
+
+		profile_begin("particles");
+		emit_particles(&particles, 1000);
+		float* particle_instances = particle_buffer_map(&particle_buffer);
+		particles_update(&particles, dt, gravity, particle_instances);
+		if (particle_instances != NULL) {
+			particle_buffer_unmap(&particle_buffer);
+		}
+		profile_end();
+
+		unsigned int mesh_texture_id = 0;
+		if (textures != NULL) {
+			profile_begin("texture uploads");
+			//4 MB a frame keeps uploads from becoming the hitch
+			texture_loader_update(textures, 4u << 20);
+			profile_end();
+			mesh_texture_id = texture_get(textures, mesh_texture);
+		}
 
-		printf("%f,%f,%f,%f\n", orientation.x, orientation.y, orientation.z, orientation.w);
-		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-		glClear(GL_COLOR_BUFFER_BIT);
+		profile_begin("build queue");
+		render_queue_reset(&render_queue);
+		//The camera sits at the origin, so the view matrix is the identity
+		struct Frustum frustum = frustum_from_matrix(camera.projection, camera.zero_to_one);
+		uint32_t visible[OBJECT_COUNT];
+		uint32_t visible_count = bvh.root != BVH_NULL ? bvh_cull(&bvh, &frustum, visible) : 0;
+		for (uint32_t i = 0; i < visible_count; i++) {
+			if (visible[i] == OBJECT_TRIANGLE) {
+				render_queue_push(&render_queue, (struct RenderCommand) {
+					.key = render_key(RENDER_PASS_OPAQUE, shader_program.id, VAO, 0, 0.0f),
+					.program = shader_program.id,
+					.vao = VAO,
+					.mode = GL_TRIANGLES,
+					.count = 3,
+					.index_type = GL_UNSIGNED_SHORT,
+					.model_slot = render_model_slot(triangle_entity),
+					.model = triangle_model
+				});
+			} else if (visible[i] == OBJECT_MESH && mesh.vao != 0) {
+				Vector3 center = vec3_scale(0.5f, vec3_add(mesh.bounds_min, mesh.bounds_max));
+				center = mat4_transform_point(mesh_model, center);
+				float distance = sqrtf(vec3_dot(center, center));
+				int lod = mesh_select_lod(&mesh, distance, 1.0f, &camera, 1.0f);
+
+				render_queue_push(&render_queue, (struct RenderCommand) {
+					.key = render_key(RENDER_PASS_OPAQUE, shader_program.id, mesh.vao, mesh_texture_id, 0.0f),
+					.program = shader_program.id,
+					.vao = mesh.vao,
+					.texture = mesh_texture_id,
+					.mode = GL_TRIANGLES,
+					.count = (int) mesh.lods[lod].index_count,
+					.index_type = mesh.index_type,
+					.first = mesh_lod_offset(&mesh, lod),
+					.flags = mesh.octahedral_normals ? RENDER_OCTAHEDRAL_NORMALS : 0,
+					.model_slot = render_model_slot(mesh_entity),
+					.model = mat4_mult(mesh_model, mesh_dequantize)
+				});
+			}
+		}
+		if (particle_instances != NULL && particles.count > 0) {
+			render_queue_push(&render_queue, (struct RenderCommand) {
+				.key = render_key(RENDER_PASS_OPAQUE, particle_program.id, particle_buffer.vao, 0, 0.0f),
+				.program = particle_program.id,
+				.vao = particle_buffer.vao,
+				.mode = GL_TRIANGLE_STRIP,
+				.count = 4,
+				.instance_count = (int) particles.count,
+				.model = mat4_identity()
+			});
+		}
+		render_queue_sort(&render_queue);
+		profile_end();
 
-		glUseProgram(shader_program.id);
-		glBindVertexArray(VAO);
-		glDrawArrays(GL_TRIANGLES, 0, 3);
+		//Console output would show up in the benchmark's frame times
+		if (!scripted) {
+			printf("%f,%f,%f,%f\n", orientation.x, orientation.y, orientation.z, orientation.w);
+		}
+		profile_begin("submit");
+		depth_target_resize(&depth_target, camera.width, camera.height);
+		gl_state_clear_color(0.2f, 0.3f, 0.3f, 1.0f);
+		depth_target_begin(&depth_target);
+
+		render_queue_submit(&render_queue, &camera);
+		model_uploads_skipped += render_queue.model_uploads_skipped;
+		model_uploads += render_queue.model_uploads;
+
+		depth_target_present(&depth_target);
+		profile_end();
+
+		if (scripted && frame + 1 == script.frame_count) {
+			double elapsed = glfwGetTime() - script_start;
+			printf("Benchmark: %u frames in %.2f ms, image hash %016llx\n", script.frame_count,
+				elapsed * 1000.0, (unsigned long long) hash_frame(&depth_target));
+		}
 
+		profile_begin("swap");
 		glfwSwapBuffers(window);
-		glfwPollEvents();
+		profile_end();
+		profile_begin("frames in flight");
+		frame_pacing_after_swap(&pacing);
+		profile_end();
+		input_end_frame(input);
+		gl_trace_frame_end();
+
+		if (!pacing.late_latch) {
+			profile_begin("poll events");
+			glfwPollEvents();
+			profile_end();
+			profile_begin("pacing");
+			frame_pacing_wait(&pacing);
+			profile_end();
+		}
+		if (input_action_pressed(input, ACTION_TRACE_FRAME)) {
+			gl_trace_record_next_frame("gl_trace.txt");
+		}
+		profile_end();
+		if (frame_stats != NULL) {
+			frame_stats_frame_end(frame_stats);
+		}
+		frame++;
+	}
+
+	//PROFILE_TRACE=trace.json writes the last frames' zones for chrome://tracing
+	const char* profile_path = getenv("PROFILE_TRACE");
+	if (profile_path != NULL) {
+		profile_write_chrome_trace(profile_path);
+	}
+
+	bvh_free(&bvh);
+	scene_free(&scene);
+	particle_buffer_destroy(&particle_buffer);
+	particles_free(&particles);
+	mesh_destroy(&mesh);
+	texture_loader_destroy(textures);
+	render_queue_free(&render_queue);
+	depth_target_destroy(&depth_target);
+
+	struct GLStateStats gl_stats = gl_state_stats();
+	printf("GL state: %lu calls issued, %lu elided\n", gl_stats.issued, gl_stats.elided);
+	printf("Transforms: %lu updated, %lu skipped\n", transforms_updated, transforms_skipped);
+	printf("Model uploads: %lu issued, %lu skipped\n", model_uploads, model_uploads_skipped);
+	gl_trace_print(stdout);
+	if (frame_stats != NULL) {
+		frame_stats_print(frame_stats, stdout);
+		frame_stats_free(frame_stats);
+	}
+	frame_histogram_print(&input->latency, "Input to swap latency", stdout);
+	if (pacing.frames > 0) {
+		printf("Pacing: %.2f ms limiter, %.2f ms fence wait per frame\n",
+			pacing.limiter_wait * 1000.0 / (double) pacing.frames,
+			pacing.fence_wait * 1000.0 / (double) pacing.frames);
+	}
+	frame_pacing_destroy(&pacing);
+	if (input->dropped > 0) {
+		printf("Input: %lu events dropped on a full queue\n", input->dropped);
 	}
+	input_free(input);
 
 TERMINATE:;
 	
@@ -263,6 +761,8 @@ TERMINATE:;
 	}
 
 	glfwTerminate();
+	jobs_shutdown();
+	script_free(&script);
 
 	return exit_code;
 }
@@ -0,0 +1,217 @@
+#include "mesh.h"
+
+#include <stdio.h>
+#include <stddef.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "gl_state.h"
+#include "mesh_format.h"
+
+//[offset, offset + size) lies in the file past data_start
+static int
+section_in_file(uint64_t offset, uint64_t size, uint64_t data_start, size_t file_size) {
+	return offset >= data_start && offset <= file_size && size <= file_size - offset;
+}
+
+static int
+validate_header(const struct MeshFileHeader* header, size_t file_size) {
+	if (file_size < sizeof(*header) || header->magic != MESH_FILE_MAGIC) {
+		return 0;
+	}
+
+	uint32_t stride = mesh_vertex_stride((enum MeshVertexFormat) header->vertex_format);
+	if (header->version < 1 || header->version > MESH_FILE_VERSION ||
+			stride == 0 || header->vertex_stride != stride) {
+		return 0;
+	}
+
+	if (header->version >= 2) {
+		if (header->lod_count == 0 || header->lod_count > MESH_MAX_LODS ||
+				sizeof(*header) + header->lod_count * sizeof(struct MeshLod) > file_size) {
+			return 0;
+		}
+
+		const struct MeshLod* lods = (const struct MeshLod*) (header + 1);
+		for (uint32_t i = 0; i < header->lod_count; i++) {
+			if ((uint64_t) lods[i].index_offset + lods[i].index_count > header->index_count) {
+				return 0;
+			}
+		}
+	}
+
+	if (header->index_size != 2 && header->index_size != 4) {
+		return 0;
+	}
+
+	//Sections start after the header and LOD table and end inside the
+	//file. Sizes are compared against what is left so huge offsets cannot
+	//wrap around.
+	uint64_t data_start = sizeof(*header);
+	if (header->version >= 2) {
+		data_start += (uint64_t) header->lod_count * sizeof(struct MeshLod);
+	}
+	uint64_t vertex_size = (uint64_t) header->vertex_stride * header->vertex_count;
+	uint64_t index_size = (uint64_t) header->index_size * header->index_count;
+	return section_in_file(header->vertex_offset, vertex_size, data_start, file_size) &&
+		section_in_file(header->index_offset, index_size, data_start, file_size);
+}
+
+//Location 0 position, 1 normal, 2 uv, see shaders/default.vert
+static void
+setup_attributes(enum MeshVertexFormat format) {
+	GLsizei stride = (GLsizei) mesh_vertex_stride(format);
+
+	switch (format) {
+	case MESH_VERTEX_QUANTIZED:
+		glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, stride,
+				(void*) offsetof(struct MeshVertexQuantized, position));
+		glVertexAttribPointer(1, 3, GL_BYTE, GL_TRUE, stride,
+				(void*) offsetof(struct MeshVertexQuantized, normal));
+		glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride,
+				(void*) offsetof(struct MeshVertexQuantized, uv));
+		break;
+	case MESH_VERTEX_OCTAHEDRAL:
+		glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, stride,
+				(void*) offsetof(struct MeshVertexOctahedral, position));
+		glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride,
+				(void*) offsetof(struct MeshVertexOctahedral, normal));
+		glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride,
+				(void*) offsetof(struct MeshVertexOctahedral, uv));
+		break;
+	case MESH_VERTEX_PACKED:
+		glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, stride,
+				(void*) offsetof(struct MeshVertexPacked, position));
+		glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride,
+				(void*) offsetof(struct MeshVertexPacked, normal));
+		glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride,
+				(void*) offsetof(struct MeshVertexPacked, uv));
+		break;
+	}
+
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+}
+
+struct Mesh
+mesh_load(const char* path) {
+	struct Mesh mesh = {0};
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return mesh;
+	}
+
+	struct stat file_stat;
+	if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+		close(fd);
+		fprintf(stderr, "Failed to stat %s\n", path);
+		return mesh;
+	}
+	size_t file_size = (size_t) file_stat.st_size;
+
+	const unsigned char* data = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		fprintf(stderr, "Failed to map %s\n", path);
+		return mesh;
+	}
+
+	const struct MeshFileHeader* header = (const struct MeshFileHeader*) data;
+	if (!validate_header(header, file_size)) {
+		fprintf(stderr, "%s: not a valid mesh file\n", path);
+		munmap((void*) data, file_size);
+		return mesh;
+	}
+
+	//The whole file is about to be read front to back by the driver
+	madvise((void*) data, file_size, MADV_SEQUENTIAL);
+
+	glGenVertexArrays(1, &mesh.vao);
+	gl_state_bind_vertex_array(mesh.vao);
+
+	glGenBuffers(1, &mesh.vbo);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, mesh.vbo);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) header->vertex_stride * header->vertex_count,
+			data + header->vertex_offset, GL_STATIC_DRAW);
+
+	glGenBuffers(1, &mesh.ibo);
+	gl_state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ibo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr) header->index_size * header->index_count,
+			data + header->index_offset, GL_STATIC_DRAW);
+
+	enum MeshVertexFormat format = (enum MeshVertexFormat) header->vertex_format;
+	setup_attributes(format);
+
+	mesh.index_count = (int) header->index_count;
+	mesh.index_type = header->index_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	mesh.octahedral_normals = format == MESH_VERTEX_OCTAHEDRAL;
+
+	if (header->version >= 2) {
+		mesh.lod_count = (int) header->lod_count;
+		const struct MeshLod* lods = (const struct MeshLod*) (header + 1);
+		for (int i = 0; i < mesh.lod_count; i++) {
+			mesh.lods[i] = lods[i];
+		}
+	} else {
+		mesh.lod_count = 1;
+		mesh.lods[0] = (struct MeshLod) {0, header->index_count, 0.0f, 0};
+	}
+	mesh.bounds_min = (Vector3) {{header->bounds_min[0], header->bounds_min[1], header->bounds_min[2]}};
+	mesh.bounds_max = (Vector3) {{header->bounds_max[0], header->bounds_max[1], header->bounds_max[2]}};
+
+	munmap((void*) data, file_size);
+	return mesh;
+}
+
+void
+mesh_destroy(struct Mesh* mesh) {
+	glDeleteVertexArrays(1, &mesh->vao);
+	glDeleteBuffers(1, &mesh->vbo);
+	glDeleteBuffers(1, &mesh->ibo);
+	//Deleted names get handed out again, drop the cached binds
+	gl_state_reset();
+	*mesh = (struct Mesh) {0};
+}
+
+int
+mesh_select_lod(const struct Mesh* mesh, float distance, float scale,
+		const struct Camera* camera, float pixel_error) {
+
+	if (distance <= 0.0f) {
+		return 0;
+	}
+
+	//Pixels per world unit at this distance, along the vertical axis
+	double pixels_per_unit = camera->height / (2.0 * tan(TO_RAD(camera->fov) * 0.5) * distance);
+
+	int lod = 0;
+	for (int i = 1; i < mesh->lod_count; i++) {
+		if (mesh->lods[i].error * scale * pixels_per_unit > pixel_error) {
+			break;
+		}
+		lod = i;
+	}
+	return lod;
+}
+
+uintptr_t
+mesh_lod_offset(const struct Mesh* mesh, int lod) {
+	uintptr_t index_size = mesh->index_type == GL_UNSIGNED_SHORT ? 2 : 4;
+	return mesh->lods[lod].index_offset * index_size;
+}
+
+Matrix4
+mesh_dequantize_matrix(const struct Mesh* mesh) {
+	Matrix4 r = mat4_identity();
+	for (int axis = 0; axis < 3; axis++) {
+		r.e[axis * 4 + axis] = mesh->bounds_max.e[axis] - mesh->bounds_min.e[axis];
+		r.e[axis * 4 + 3] = mesh->bounds_min.e[axis];
+	}
+	return r;
+}
@@ -0,0 +1,44 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <stdint.h>
+
+#include "glad/glad.h"
+#include "every_math.h"
+#include "camera.h"
+#include "mesh_format.h"
+
+struct Mesh {
+	unsigned int vao;
+	unsigned int vbo;
+	unsigned int ibo;
+	int index_count;
+	//GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+	GLenum index_type;
+	//Normals need unfolding in the shader, pass RENDER_OCTAHEDRAL_NORMALS
+	int octahedral_normals;
+	Vector3 bounds_min;
+	Vector3 bounds_max;
+	struct MeshLod lods[MESH_MAX_LODS];
+	int lod_count;
+};
+
+//Maps a file written by mesh_write and uploads the vertex and index
+//streams straight from the mapping. Returns a zeroed mesh on failure.
+struct Mesh mesh_load(const char* path);
+void mesh_destroy(struct Mesh* mesh);
+
+//Coarsest LOD whose simplification error projects to at most pixel_error
+//pixels at distance from the camera. scale is the largest axis scale of
+//the model matrix, excluding the dequantize matrix.
+int mesh_select_lod(const struct Mesh* mesh, float distance, float scale,
+		const struct Camera* camera, float pixel_error);
+//Byte offset of a LOD's indices, for RenderCommand.first
+uintptr_t mesh_lod_offset(const struct Mesh* mesh, int lod);
+
+//Scales the [0, 1] quantized positions back into the bounding box,
+//multiply it into the model matrix so dequantization costs no extra
+//shader work
+Matrix4 mesh_dequantize_matrix(const struct Mesh* mesh);
+
+#endif
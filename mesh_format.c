@@ -0,0 +1,264 @@
+#include "mesh_format.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+void
+mesh_data_free(struct MeshData* mesh) {
+	free(mesh->positions);
+	free(mesh->normals);
+	free(mesh->uvs);
+	free(mesh->indices);
+	*mesh = (struct MeshData) {0};
+}
+
+void
+mesh_data_bounds(const struct MeshData* mesh, float min[3], float max[3]) {
+	for (int axis = 0; axis < 3; axis++) {
+		min[axis] = mesh->vertex_count ? FLT_MAX : 0;
+		max[axis] = mesh->vertex_count ? -FLT_MAX : 0;
+	}
+
+	for (uint32_t i = 0; i < mesh->vertex_count; i++) {
+		for (int axis = 0; axis < 3; axis++) {
+			float value = mesh->positions[i * 3 + axis];
+			if (value < min[axis]) min[axis] = value;
+			if (value > max[axis]) max[axis] = value;
+		}
+	}
+}
+
+static uint16_t
+quantize_unorm16(float value) {
+	if (value < 0.0f) value = 0.0f;
+	if (value > 1.0f) value = 1.0f;
+	return (uint16_t) lrintf(value * 65535.0f);
+}
+
+static int8_t
+quantize_snorm8(float value) {
+	if (value < -1.0f) value = -1.0f;
+	if (value > 1.0f) value = 1.0f;
+	return (int8_t) lrintf(value * 127.0f);
+}
+
+static int16_t
+quantize_snorm16(float value) {
+	if (value < -1.0f) value = -1.0f;
+	if (value > 1.0f) value = 1.0f;
+	return (int16_t) lrintf(value * 32767.0f);
+}
+
+static uint32_t
+quantize_snorm10(float value) {
+	if (value < -1.0f) value = -1.0f;
+	if (value > 1.0f) value = 1.0f;
+	return (uint32_t) lrintf(value * 511.0f) & 0x3ffu;
+}
+
+//IEEE binary16 with round to nearest even, enough for uvs
+static uint16_t
+float_to_half(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	uint32_t sign = (bits >> 16) & 0x8000u;
+	int32_t exponent = (int32_t) ((bits >> 23) & 0xff) - 127 + 15;
+	uint32_t mantissa = bits & 0x7fffffu;
+
+	if (((bits >> 23) & 0xff) == 0xff) {
+		return (uint16_t) (sign | 0x7c00u | (mantissa ? 0x200u : 0));
+	}
+	if (exponent >= 31) {
+		return (uint16_t) (sign | 0x7c00u);
+	}
+	if (exponent <= 0) {
+		if (exponent < -10) {
+			return (uint16_t) sign;
+		}
+		mantissa |= 0x800000u;
+		uint32_t shift = (uint32_t) (14 - exponent);
+		uint32_t half = mantissa >> shift;
+		uint32_t rest = mantissa & ((1u << shift) - 1);
+		uint32_t halfway = 1u << (shift - 1);
+		if (rest > halfway || (rest == halfway && (half & 1))) half++;
+		return (uint16_t) (sign | half);
+	}
+
+	uint32_t half = sign | ((uint32_t) exponent << 10) | (mantissa >> 13);
+	uint32_t rest = mantissa & 0x1fffu;
+	if (rest > 0x1000u || (rest == 0x1000u && (half & 1))) half++;
+	return (uint16_t) half;
+}
+
+//Folds the unit sphere onto the [-1, 1] square, the shader unfolds it
+static void
+octahedral_encode(const float* normal, float* out) {
+	float x = normal[0], y = normal[1], z = normal[2];
+	float length = fabsf(x) + fabsf(y) + fabsf(z);
+	if (length == 0.0f) {
+		out[0] = 0.0f;
+		out[1] = 0.0f;
+		return;
+	}
+
+	x /= length;
+	y /= length;
+	if (z < 0.0f) {
+		float folded_x = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+		float folded_y = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+		x = folded_x;
+		y = folded_y;
+	}
+	out[0] = x;
+	out[1] = y;
+}
+
+static void
+quantize_position(const struct MeshData* mesh, uint32_t i, const float min[3],
+		const float extent[3], uint16_t* position) {
+
+	for (int axis = 0; axis < 3; axis++) {
+		float relative = extent[axis] > 0 ? (mesh->positions[i * 3 + axis] - min[axis]) / extent[axis] : 0;
+		position[axis] = quantize_unorm16(relative);
+	}
+	position[3] = 0;
+}
+
+static void
+quantize_half_uv(const struct MeshData* mesh, uint32_t i, uint16_t* uv) {
+	uv[0] = mesh->uvs != NULL ? float_to_half(mesh->uvs[i * 2 + 0]) : 0;
+	uv[1] = mesh->uvs != NULL ? float_to_half(mesh->uvs[i * 2 + 1]) : 0;
+}
+
+//Writes vertex i in the given format into out, which holds one stride
+static void
+quantize_vertex(const struct MeshData* mesh, uint32_t i, enum MeshVertexFormat format,
+		const float min[3], const float extent[3], void* out) {
+
+	float zero[3] = {0};
+	const float* normal = mesh->normals != NULL ? &mesh->normals[i * 3] : zero;
+
+	switch (format) {
+	case MESH_VERTEX_QUANTIZED: {
+		struct MeshVertexQuantized* vertex = out;
+		memset(vertex, 0, sizeof(*vertex));
+		quantize_position(mesh, i, min, extent, vertex->position);
+		for (int axis = 0; axis < 3; axis++) {
+			vertex->normal[axis] = quantize_snorm8(normal[axis]);
+		}
+		//Wrapped uvs are clamped, the format only covers [0, 1]
+		if (mesh->uvs != NULL) {
+			vertex->uv[0] = quantize_unorm16(mesh->uvs[i * 2 + 0]);
+			vertex->uv[1] = quantize_unorm16(mesh->uvs[i * 2 + 1]);
+		}
+		break;
+	}
+	case MESH_VERTEX_OCTAHEDRAL: {
+		struct MeshVertexOctahedral* vertex = out;
+		quantize_position(mesh, i, min, extent, vertex->position);
+		float encoded[2];
+		octahedral_encode(normal, encoded);
+		vertex->normal[0] = quantize_snorm16(encoded[0]);
+		vertex->normal[1] = quantize_snorm16(encoded[1]);
+		quantize_half_uv(mesh, i, vertex->uv);
+		break;
+	}
+	case MESH_VERTEX_PACKED: {
+		struct MeshVertexPacked* vertex = out;
+		quantize_position(mesh, i, min, extent, vertex->position);
+		vertex->normal = quantize_snorm10(normal[0]) |
+			quantize_snorm10(normal[1]) << 10 |
+			quantize_snorm10(normal[2]) << 20;
+		quantize_half_uv(mesh, i, vertex->uv);
+		break;
+	}
+	}
+}
+
+uint32_t
+mesh_vertex_stride(enum MeshVertexFormat format) {
+	switch (format) {
+	case MESH_VERTEX_QUANTIZED: return sizeof(struct MeshVertexQuantized);
+	case MESH_VERTEX_OCTAHEDRAL: return sizeof(struct MeshVertexOctahedral);
+	case MESH_VERTEX_PACKED: return sizeof(struct MeshVertexPacked);
+	}
+	return 0;
+}
+
+int
+mesh_write(const char* path, const struct MeshData* mesh, enum MeshVertexFormat format) {
+	uint32_t stride = mesh_vertex_stride(format);
+	if (stride == 0) {
+		fprintf(stderr, "Unknown vertex format %d\n", format);
+		return 0;
+	}
+
+	FILE* file = fopen(path, "wb");
+	if (file == NULL) {
+		fprintf(stderr, "Failed to open %s for writing\n", path);
+		return 0;
+	}
+
+	struct MeshFileHeader header = {
+		.magic = MESH_FILE_MAGIC,
+		.version = MESH_FILE_VERSION,
+		.vertex_format = format,
+		.vertex_stride = stride,
+		.vertex_count = mesh->vertex_count,
+		.index_size = mesh->vertex_count <= 0xffff ? 2 : 4,
+		.index_count = mesh->index_count
+	};
+	mesh_data_bounds(mesh, header.bounds_min, header.bounds_max);
+
+	struct MeshLod single = {0, mesh->index_count, 0.0f, 0};
+	const struct MeshLod* lods = mesh->lod_count ? mesh->lods : &single;
+	header.lod_count = mesh->lod_count ? mesh->lod_count : 1;
+
+	//Keep the vertex stream 8 byte aligned behind the LOD table
+	header.vertex_offset = sizeof(header) + ((header.lod_count * sizeof(struct MeshLod) + 7) & ~(uint64_t) 7);
+	header.index_offset = header.vertex_offset + (uint64_t) header.vertex_stride * header.vertex_count;
+
+	float extent[3];
+	for (int axis = 0; axis < 3; axis++) {
+		extent[axis] = header.bounds_max[axis] - header.bounds_min[axis];
+	}
+
+	int ok = fwrite(&header, sizeof(header), 1, file) == 1;
+	ok = ok && fwrite(lods, sizeof(struct MeshLod), header.lod_count, file) == header.lod_count;
+
+	uint64_t padding = 0;
+	size_t padding_size = header.vertex_offset - sizeof(header) - header.lod_count * sizeof(struct MeshLod);
+	ok = ok && (padding_size == 0 || fwrite(&padding, padding_size, 1, file) == 1);
+
+	union {
+		struct MeshVertexQuantized quantized;
+		struct MeshVertexOctahedral octahedral;
+		struct MeshVertexPacked packed;
+	} vertex;
+	for (uint32_t i = 0; ok && i < mesh->vertex_count; i++) {
+		quantize_vertex(mesh, i, format, header.bounds_min, extent, &vertex);
+		ok = fwrite(&vertex, stride, 1, file) == 1;
+	}
+
+	for (uint32_t i = 0; ok && i < mesh->index_count; i++) {
+		if (header.index_size == 2) {
+			uint16_t index = (uint16_t) mesh->indices[i];
+			ok = fwrite(&index, sizeof(index), 1, file) == 1;
+		} else {
+			ok = fwrite(&mesh->indices[i], sizeof(uint32_t), 1, file) == 1;
+		}
+	}
+
+	if (fclose(file) != 0) {
+		ok = 0;
+	}
+
+	if (!ok) {
+		fprintf(stderr, "Failed to write %s\n", path);
+	}
+	return ok;
+}
@@ -0,0 +1,100 @@
+#ifndef MESH_FORMAT_H
+#define MESH_FORMAT_H
+
+#include <stdint.h>
+
+//Binary mesh file, little endian, laid out so it can be mapped and handed
+//to glBufferData as is:
+//
+//  MeshFileHeader
+//  MeshLod         lod_count entries, version 2 and up
+//  vertex stream   vertex_count * vertex_stride bytes, at vertex_offset
+//  index buffer    index_count * index_size bytes, at index_offset
+//
+//Every LOD is a range of the one index buffer over the shared vertex
+//stream, finest first. Version 1 files have no table and a single LOD.
+//
+//Positions are stored as unsigned normalized 16-bit values relative to the
+//bounding box, so the shader sees them in [0, 1] and the model matrix has to
+//be multiplied with mesh_dequantize_matrix.
+
+#define MESH_FILE_MAGIC 0x534d5645u /* "EVMS" */
+#define MESH_FILE_VERSION 2
+#define MESH_MAX_LODS 8
+
+//Every format is 16 bytes per vertex, half of the 32 an unquantized
+//position, normal and uv take
+enum MeshVertexFormat {
+	//position unorm16 x4 (w unused), normal snorm8 x4 (w unused), uv unorm16 x2
+	MESH_VERTEX_QUANTIZED = 1,
+	//position unorm16 x4, octahedral normal snorm16 x2, uv half x2
+	MESH_VERTEX_OCTAHEDRAL = 2,
+	//position unorm16 x4, normal snorm 10:10:10:2, uv half x2
+	MESH_VERTEX_PACKED = 3
+};
+
+struct MeshVertexQuantized {
+	uint16_t position[4];
+	int8_t normal[4];
+	uint16_t uv[2];
+};
+
+struct MeshVertexOctahedral {
+	uint16_t position[4];
+	int16_t normal[2];
+	uint16_t uv[2];
+};
+
+struct MeshVertexPacked {
+	uint16_t position[4];
+	uint32_t normal;
+	uint16_t uv[2];
+};
+
+struct MeshFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t vertex_format;
+	uint32_t vertex_stride;
+	uint32_t vertex_count;
+	uint32_t index_size;
+	uint32_t index_count;
+	uint32_t lod_count;
+	uint64_t vertex_offset;
+	uint64_t index_offset;
+	float bounds_min[3];
+	float bounds_max[3];
+};
+
+struct MeshLod {
+	uint32_t index_offset;
+	uint32_t index_count;
+	//Largest object space distance the simplifier moved the surface
+	float error;
+	uint32_t reserved;
+};
+
+//Unquantized mesh as produced by importers, one attribute array per
+//stream. normals and uvs may be NULL. With lod_count 0 the whole index
+//array is a single LOD.
+struct MeshData {
+	float* positions;
+	float* normals;
+	float* uvs;
+	uint32_t* indices;
+	uint32_t vertex_count;
+	uint32_t index_count;
+	struct MeshLod lods[MESH_MAX_LODS];
+	uint32_t lod_count;
+};
+
+void mesh_data_free(struct MeshData* mesh);
+void mesh_data_bounds(const struct MeshData* mesh, float min[3], float max[3]);
+
+uint32_t mesh_vertex_stride(enum MeshVertexFormat format);
+
+//Quantizes and writes the mesh, using 16-bit indices when they fit.
+//Returns 0 and prints the reason on failure.
+int mesh_write(const char* path, const struct MeshData* mesh, enum MeshVertexFormat format);
+
+#endif
@@ -0,0 +1,454 @@
+#include "mesh_optimize.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define CACHE_SIZE 32
+#define CACHE_DECAY_POWER 1.5f
+#define LAST_TRIANGLE_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.0f
+#define VALENCE_BOOST_POWER 0.5f
+
+//Valences past this share the same boost, keeps the score table small
+#define MAX_VALENCE_SCORE 32
+
+static float cache_scores[CACHE_SIZE];
+static float valence_scores[MAX_VALENCE_SCORE];
+
+static void
+build_score_tables(void) {
+	for (int position = 0; position < CACHE_SIZE; position++) {
+		if (position < 3) {
+			//The last triangle's vertices get a fixed score so a strip is
+			//not immediately doubled back on
+			cache_scores[position] = LAST_TRIANGLE_SCORE;
+		} else {
+			float scale = 1.0f / (CACHE_SIZE - 3);
+			cache_scores[position] = powf(1.0f - (position - 3) * scale, CACHE_DECAY_POWER);
+		}
+	}
+
+	valence_scores[0] = 0.0f;
+	for (int valence = 1; valence < MAX_VALENCE_SCORE; valence++) {
+		valence_scores[valence] = VALENCE_BOOST_SCALE * powf((float) valence, -VALENCE_BOOST_POWER);
+	}
+}
+
+static float
+vertex_score(int cache_position, uint32_t remaining) {
+	if (remaining == 0) {
+		return -1.0f;
+	}
+
+	float score = cache_position >= 0 ? cache_scores[cache_position] : 0.0f;
+	return score + valence_scores[remaining < MAX_VALENCE_SCORE ? remaining : MAX_VALENCE_SCORE - 1];
+}
+
+int
+mesh_optimize_vertex_cache(uint32_t* indices, uint32_t index_count, uint32_t vertex_count) {
+	uint32_t triangle_count = index_count / 3;
+	if (triangle_count == 0) {
+		return 1;
+	}
+
+	if (cache_scores[0] == 0.0f) {
+		build_score_tables();
+	}
+
+	uint32_t* offsets = calloc((size_t) vertex_count + 1, sizeof(uint32_t));
+	uint32_t* remaining = calloc(vertex_count, sizeof(uint32_t));
+	uint32_t* adjacency = malloc((size_t) index_count * sizeof(uint32_t));
+	int* cache_position = malloc((size_t) vertex_count * sizeof(int));
+	float* scores = malloc((size_t) vertex_count * sizeof(float));
+	float* triangle_scores = malloc((size_t) triangle_count * sizeof(float));
+	unsigned char* emitted = calloc(triangle_count, 1);
+	uint32_t* output = malloc((size_t) index_count * sizeof(uint32_t));
+
+	int ok = offsets && remaining && adjacency && cache_position && scores &&
+		triangle_scores && emitted && output;
+	if (!ok) {
+		goto CLEANUP;
+	}
+
+	//Triangles per vertex, as a compact list of lists
+	for (uint32_t i = 0; i < index_count; i++) {
+		remaining[indices[i]]++;
+	}
+	for (uint32_t v = 0; v < vertex_count; v++) {
+		offsets[v + 1] = offsets[v] + remaining[v];
+		remaining[v] = 0;
+	}
+	for (uint32_t t = 0; t < triangle_count; t++) {
+		for (int k = 0; k < 3; k++) {
+			uint32_t v = indices[t * 3 + k];
+			adjacency[offsets[v] + remaining[v]++] = t;
+		}
+	}
+
+	for (uint32_t v = 0; v < vertex_count; v++) {
+		cache_position[v] = -1;
+		scores[v] = vertex_score(-1, remaining[v]);
+	}
+	for (uint32_t t = 0; t < triangle_count; t++) {
+		triangle_scores[t] = scores[indices[t * 3]] + scores[indices[t * 3 + 1]] + scores[indices[t * 3 + 2]];
+	}
+
+	uint32_t cache[CACHE_SIZE + 3];
+	int cache_count = 0;
+	uint32_t scan = 0;
+	uint32_t best = 0;
+	float best_score = triangle_scores[0];
+	for (uint32_t t = 1; t < triangle_count; t++) {
+		if (triangle_scores[t] > best_score) {
+			best = t;
+			best_score = triangle_scores[t];
+		}
+	}
+
+	for (uint32_t out = 0; out < triangle_count; out++) {
+		if (best_score < 0.0f) {
+			//Nothing in the cache has work left, take the next unemitted one
+			while (emitted[scan]) scan++;
+			best = scan;
+		}
+
+		emitted[best] = 1;
+		const uint32_t* triangle = &indices[best * 3];
+		memcpy(&output[out * 3], triangle, 3 * sizeof(uint32_t));
+
+		//Drop the triangle from its vertices' pending lists
+		for (int k = 0; k < 3; k++) {
+			uint32_t v = triangle[k];
+			uint32_t* list = &adjacency[offsets[v]];
+			for (uint32_t i = 0; i < remaining[v]; i++) {
+				if (list[i] == best) {
+					list[i] = list[remaining[v] - 1];
+					break;
+				}
+			}
+			remaining[v]--;
+		}
+
+		//Emitted vertices move to the front of the LRU
+		uint32_t new_cache[CACHE_SIZE + 3];
+		int new_count = 0;
+		for (int k = 0; k < 3; k++) {
+			new_cache[new_count++] = triangle[k];
+		}
+		for (int i = 0; i < cache_count; i++) {
+			uint32_t v = cache[i];
+			if (v != triangle[0] && v != triangle[1] && v != triangle[2]) {
+				new_cache[new_count++] = v;
+			}
+		}
+
+		for (int i = 0; i < new_count; i++) {
+			uint32_t v = new_cache[i];
+			cache_position[v] = i < CACHE_SIZE ? i : -1;
+			scores[v] = vertex_score(cache_position[v], remaining[v]);
+		}
+
+		//Only triangles touching the cache changed score
+		best_score = -1.0f;
+		for (int i = 0; i < new_count; i++) {
+			uint32_t v = new_cache[i];
+			for (uint32_t j = 0; j < remaining[v]; j++) {
+				uint32_t t = adjacency[offsets[v] + j];
+				float score = scores[indices[t * 3]] + scores[indices[t * 3 + 1]] + scores[indices[t * 3 + 2]];
+				triangle_scores[t] = score;
+				if (score > best_score) {
+					best = t;
+					best_score = score;
+				}
+			}
+		}
+
+		cache_count = new_count < CACHE_SIZE ? new_count : CACHE_SIZE;
+		memcpy(cache, new_cache, (size_t) cache_count * sizeof(uint32_t));
+	}
+
+	memcpy(indices, output, (size_t) triangle_count * 3 * sizeof(uint32_t));
+
+CLEANUP:
+	free(offsets);
+	free(remaining);
+	free(adjacency);
+	free(cache_position);
+	free(scores);
+	free(triangle_scores);
+	free(emitted);
+	free(output);
+	return ok;
+}
+
+//FIFO cache simulation shared by the metric and the overdraw clustering.
+//timestamps[v] holds the miss count at which v entered the cache.
+struct FifoCache {
+	uint32_t* timestamps;
+	uint32_t misses;
+	uint32_t size;
+};
+
+static int
+fifo_triangle_misses(struct FifoCache* cache, const uint32_t* triangle) {
+	int misses = 0;
+	for (int k = 0; k < 3; k++) {
+		uint32_t v = triangle[k];
+		if (cache->misses - cache->timestamps[v] >= cache->size) {
+			cache->timestamps[v] = cache->misses + 1;
+			cache->misses++;
+			misses++;
+		}
+	}
+	return misses;
+}
+
+static void
+fifo_reset(struct FifoCache* cache) {
+	//Pushing the clock past every timestamp evicts everything
+	cache->misses += cache->size + 1;
+}
+
+static int
+fifo_init(struct FifoCache* cache, uint32_t vertex_count, uint32_t size) {
+	cache->timestamps = calloc(vertex_count ? vertex_count : 1, sizeof(uint32_t));
+	cache->size = size;
+	cache->misses = size + 1;
+	return cache->timestamps != NULL;
+}
+
+float
+mesh_acmr(const uint32_t* indices, uint32_t index_count, uint32_t vertex_count, int cache_size) {
+	uint32_t triangle_count = index_count / 3;
+	struct FifoCache cache;
+	if (triangle_count == 0 || !fifo_init(&cache, vertex_count, (uint32_t) cache_size)) {
+		return 0.0f;
+	}
+
+	uint32_t misses = 0;
+	for (uint32_t t = 0; t < triangle_count; t++) {
+		misses += fifo_triangle_misses(&cache, &indices[t * 3]);
+	}
+
+	free(cache.timestamps);
+	return (float) misses / (float) triangle_count;
+}
+
+struct Cluster {
+	uint32_t start;
+	uint32_t end;
+	float sort_key;
+};
+
+static int
+compare_clusters(const void* a, const void* b) {
+	const struct Cluster* x = a;
+	const struct Cluster* y = b;
+	if (x->sort_key != y->sort_key) {
+		return x->sort_key > y->sort_key ? -1 : 1;
+	}
+	return x->start < y->start ? -1 : 1;
+}
+
+int
+mesh_optimize_overdraw(uint32_t* indices, uint32_t index_count, const float* positions,
+		uint32_t vertex_count, float threshold) {
+
+	uint32_t triangle_count = index_count / 3;
+	if (triangle_count == 0) {
+		return 1;
+	}
+
+	struct Cluster* clusters = malloc((size_t) triangle_count * sizeof(*clusters));
+	uint32_t* output = malloc((size_t) index_count * sizeof(uint32_t));
+	struct FifoCache cache = {0};
+	int ok = clusters && output && fifo_init(&cache, vertex_count, 16);
+	if (!ok) {
+		free(clusters);
+		free(output);
+		free(cache.timestamps);
+		return 0;
+	}
+
+	//Hard boundaries, where a triangle misses on all three vertices
+	uint32_t cluster_count = 0;
+	for (uint32_t t = 0; t < triangle_count; t++) {
+		if (fifo_triangle_misses(&cache, &indices[t * 3]) == 3 || t == 0) {
+			if (cluster_count > 0) clusters[cluster_count - 1].end = t;
+			clusters[cluster_count++].start = t;
+		}
+	}
+	clusters[cluster_count - 1].end = triangle_count;
+
+	//Soft boundaries inside a hard cluster, wherever the prefix so far is
+	//already within threshold of the whole cluster's miss ratio
+	uint32_t hard_count = cluster_count;
+	struct Cluster* hard = malloc((size_t) hard_count * sizeof(*hard));
+	if (hard == NULL) {
+		free(clusters);
+		free(output);
+		free(cache.timestamps);
+		return 0;
+	}
+	memcpy(hard, clusters, (size_t) hard_count * sizeof(*hard));
+
+	cluster_count = 0;
+	for (uint32_t c = 0; c < hard_count; c++) {
+		uint32_t start = hard[c].start;
+		uint32_t end = hard[c].end;
+
+		fifo_reset(&cache);
+		uint32_t total = 0;
+		for (uint32_t t = start; t < end; t++) {
+			total += fifo_triangle_misses(&cache, &indices[t * 3]);
+		}
+		float cluster_acmr = (float) total / (float) (end - start);
+
+		fifo_reset(&cache);
+		uint32_t misses = 0;
+		uint32_t soft_start = start;
+		for (uint32_t t = start; t < end; t++) {
+			misses += fifo_triangle_misses(&cache, &indices[t * 3]);
+			uint32_t triangles = t + 1 - soft_start;
+			if (t + 1 < end && (float) misses / (float) triangles <= cluster_acmr * threshold) {
+				clusters[cluster_count++] = (struct Cluster) {soft_start, t + 1, 0};
+				soft_start = t + 1;
+				misses = 0;
+				fifo_reset(&cache);
+			}
+		}
+		clusters[cluster_count++] = (struct Cluster) {soft_start, end, 0};
+	}
+	free(hard);
+
+	float mesh_center[3] = {0};
+	for (uint32_t v = 0; v < vertex_count; v++) {
+		for (int axis = 0; axis < 3; axis++) {
+			mesh_center[axis] += positions[v * 3 + axis];
+		}
+	}
+	for (int axis = 0; axis < 3; axis++) {
+		mesh_center[axis] /= vertex_count ? (float) vertex_count : 1.0f;
+	}
+
+	//Clusters facing away from the mesh center are likely in front of
+	//whatever they overlap, so they go first
+	for (uint32_t c = 0; c < cluster_count; c++) {
+		float centroid[3] = {0};
+		float normal[3] = {0};
+		float area_sum = 0.0f;
+
+		for (uint32_t t = clusters[c].start; t < clusters[c].end; t++) {
+			const float* a = &positions[indices[t * 3] * 3];
+			const float* b = &positions[indices[t * 3 + 1] * 3];
+			const float* d = &positions[indices[t * 3 + 2] * 3];
+
+			float e0[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+			float e1[3] = {d[0] - a[0], d[1] - a[1], d[2] - a[2]};
+			float n[3] = {
+				e0[1] * e1[2] - e0[2] * e1[1],
+				e0[2] * e1[0] - e0[0] * e1[2],
+				e0[0] * e1[1] - e0[1] * e1[0]
+			};
+			float area = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+			for (int axis = 0; axis < 3; axis++) {
+				centroid[axis] += (a[axis] + b[axis] + d[axis]) * (area / 3.0f);
+				normal[axis] += n[axis];
+			}
+			area_sum += area;
+		}
+
+		float key = 0.0f;
+		float length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		if (area_sum > 0.0f && length > 0.0f) {
+			for (int axis = 0; axis < 3; axis++) {
+				key += (centroid[axis] / area_sum - mesh_center[axis]) * (normal[axis] / length);
+			}
+		}
+		clusters[c].sort_key = key;
+	}
+
+	qsort(clusters, cluster_count, sizeof(*clusters), compare_clusters);
+
+	uint32_t out = 0;
+	for (uint32_t c = 0; c < cluster_count; c++) {
+		size_t count = (size_t) (clusters[c].end - clusters[c].start) * 3;
+		memcpy(&output[out], &indices[clusters[c].start * 3], count * sizeof(uint32_t));
+		out += (uint32_t) count;
+	}
+	memcpy(indices, output, (size_t) index_count * sizeof(uint32_t));
+
+	free(clusters);
+	free(output);
+	free(cache.timestamps);
+	return 1;
+}
+
+static float*
+remap_stream(const float* stream, const uint32_t* order, uint32_t count, int components) {
+	if (stream == NULL) {
+		return NULL;
+	}
+
+	float* remapped = malloc((size_t) (count ? count : 1) * components * sizeof(float));
+	if (remapped == NULL) {
+		return NULL;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		memcpy(&remapped[i * components], &stream[order[i] * components], components * sizeof(float));
+	}
+	return remapped;
+}
+
+int
+mesh_optimize_vertex_fetch(struct MeshData* mesh) {
+	uint32_t* remap = malloc((size_t) (mesh->vertex_count ? mesh->vertex_count : 1) * sizeof(uint32_t));
+	uint32_t* order = malloc((size_t) (mesh->vertex_count ? mesh->vertex_count : 1) * sizeof(uint32_t));
+	if (remap == NULL || order == NULL) {
+		free(remap);
+		free(order);
+		return 0;
+	}
+	memset(remap, 0xff, (size_t) mesh->vertex_count * sizeof(uint32_t));
+
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < mesh->index_count; i++) {
+		uint32_t v = mesh->indices[i];
+		if (remap[v] == 0xffffffffu) {
+			remap[v] = used;
+			order[used] = v;
+			used++;
+		}
+	}
+
+	float* positions = remap_stream(mesh->positions, order, used, 3);
+	float* normals = remap_stream(mesh->normals, order, used, 3);
+	float* uvs = remap_stream(mesh->uvs, order, used, 2);
+	if (positions == NULL || (mesh->normals && normals == NULL) || (mesh->uvs && uvs == NULL)) {
+		free(positions);
+		free(normals);
+		free(uvs);
+		free(remap);
+		free(order);
+		return 0;
+	}
+
+	for (uint32_t i = 0; i < mesh->index_count; i++) {
+		mesh->indices[i] = remap[mesh->indices[i]];
+	}
+
+	free(mesh->positions);
+	free(mesh->normals);
+	free(mesh->uvs);
+	mesh->positions = positions;
+	mesh->normals = normals;
+	mesh->uvs = uvs;
+	mesh->vertex_count = used;
+
+	free(remap);
+	free(order);
+	return 1;
+}
@@ -0,0 +1,30 @@
+#ifndef MESH_OPTIMIZE_H
+#define MESH_OPTIMIZE_H
+
+#include <stdint.h>
+
+#include "mesh_format.h"
+
+//Offline passes over an indexed triangle list, meant to run in this order:
+//vertex cache, overdraw, vertex fetch. Return 0 when out of memory, in
+//which case the mesh is left untouched.
+
+//Reorders triangles for the post-transform vertex cache (Forsyth's linear
+//speed algorithm, tuned for a 32 entry LRU)
+int mesh_optimize_vertex_cache(uint32_t* indices, uint32_t index_count, uint32_t vertex_count);
+
+//Groups the cache optimized triangles into clusters at cache flush points
+//and sorts the clusters so the outward facing ones come first. threshold
+//is how much the ACMR may grow, 1.05 allows 5%.
+int mesh_optimize_overdraw(uint32_t* indices, uint32_t index_count, const float* positions,
+		uint32_t vertex_count, float threshold);
+
+//Renumbers vertices in order of first use so vertex fetch walks memory
+//linearly, dropping unreferenced vertices
+int mesh_optimize_vertex_fetch(struct MeshData* mesh);
+
+//Average cache miss ratio, transformed vertices per triangle for a FIFO
+//cache of cache_size entries. 0.5 is the practical optimum, 3 the worst.
+float mesh_acmr(const uint32_t* indices, uint32_t index_count, uint32_t vertex_count, int cache_size);
+
+#endif
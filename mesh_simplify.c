@@ -0,0 +1,374 @@
+#include "mesh_simplify.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define LOCKED_BORDER_WEIGHT 10.0
+
+//Symmetric 4x4 plane quadric, a2 ab ac ad b2 bc bd c2 cd d2, plus the
+//total plane weight so errors come out as mean squared distance
+struct Quadric {
+	double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+	double weight;
+};
+
+struct Collapse {
+	uint32_t from;
+	uint32_t to;
+	double cost;
+};
+
+static void
+quadric_from_plane(struct Quadric* q, double a, double b, double c, double d, double weight) {
+	q->a2 = a * a * weight;
+	q->ab = a * b * weight;
+	q->ac = a * c * weight;
+	q->ad = a * d * weight;
+	q->b2 = b * b * weight;
+	q->bc = b * c * weight;
+	q->bd = b * d * weight;
+	q->c2 = c * c * weight;
+	q->cd = c * d * weight;
+	q->d2 = d * d * weight;
+	q->weight = weight;
+}
+
+static void
+quadric_add(struct Quadric* q, const struct Quadric* r) {
+	q->a2 += r->a2;
+	q->ab += r->ab;
+	q->ac += r->ac;
+	q->ad += r->ad;
+	q->b2 += r->b2;
+	q->bc += r->bc;
+	q->bd += r->bd;
+	q->c2 += r->c2;
+	q->cd += r->cd;
+	q->d2 += r->d2;
+	q->weight += r->weight;
+}
+
+//Weighted mean of the squared distances to the accumulated planes
+static double
+quadric_error(const struct Quadric* q, const float* p) {
+	if (q->weight <= 0) {
+		return 0;
+	}
+
+	double x = p[0], y = p[1], z = p[2];
+	double error = q->a2 * x * x + 2 * q->ab * x * y + 2 * q->ac * x * z + 2 * q->ad * x +
+		q->b2 * y * y + 2 * q->bc * y * z + 2 * q->bd * y +
+		q->c2 * z * z + 2 * q->cd * z +
+		q->d2;
+	return error > 0 ? error / q->weight : 0;
+}
+
+static void
+triangle_normal(const float* a, const float* b, const float* c, double* n) {
+	double e0[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+	double e1[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+	n[0] = e0[1] * e1[2] - e0[2] * e1[1];
+	n[1] = e0[2] * e1[0] - e0[0] * e1[2];
+	n[2] = e0[0] * e1[1] - e0[1] * e1[0];
+}
+
+static uint32_t
+hash_position(const float* p) {
+	uint32_t h = 2166136261u;
+	const unsigned char* bytes = (const unsigned char*) p;
+	for (int i = 0; i < 12; i++) {
+		h = (h ^ bytes[i]) * 16777619u;
+	}
+	return h;
+}
+
+//Marks vertices that share their position with another vertex, those are
+//seams in normals or uvs and moving one side would tear the mesh
+static int
+lock_seams(const float* positions, uint32_t vertex_count, unsigned char* locked) {
+	uint32_t capacity = 1;
+	while (capacity < vertex_count * 2) capacity *= 2;
+
+	uint32_t* table = malloc((size_t) capacity * sizeof(uint32_t));
+	if (table == NULL) {
+		return 0;
+	}
+	memset(table, 0xff, (size_t) capacity * sizeof(uint32_t));
+
+	for (uint32_t v = 0; v < vertex_count; v++) {
+		const float* p = &positions[v * 3];
+		uint32_t slot = hash_position(p) & (capacity - 1);
+		while (table[slot] != 0xffffffffu) {
+			uint32_t other = table[slot];
+			if (memcmp(&positions[other * 3], p, 3 * sizeof(float)) == 0) {
+				locked[v] = 1;
+				locked[other] = 1;
+				break;
+			}
+			slot = (slot + 1) & (capacity - 1);
+		}
+		if (table[slot] == 0xffffffffu) {
+			table[slot] = v;
+		}
+	}
+
+	free(table);
+	return 1;
+}
+
+struct Edge {
+	uint32_t a;
+	uint32_t b;
+};
+
+static int
+compare_edges(const void* x, const void* y) {
+	const struct Edge* a = x;
+	const struct Edge* b = y;
+	if (a->a != b->a) return a->a < b->a ? -1 : 1;
+	if (a->b != b->b) return a->b < b->b ? -1 : 1;
+	return 0;
+}
+
+static int
+compare_collapses(const void* x, const void* y) {
+	const struct Collapse* a = x;
+	const struct Collapse* b = y;
+	if (a->cost != b->cost) return a->cost < b->cost ? -1 : 1;
+	return a->from < b->from ? -1 : a->from > b->from;
+}
+
+//Edges used by exactly one triangle lie on an open border. Their
+//vertices are locked and get a perpendicular plane so the neighbouring
+//collapses do not pull the border inwards either.
+static void
+mark_borders(struct Edge* edges, uint32_t edge_count, const float* positions,
+		struct Quadric* quadrics, unsigned char* locked) {
+
+	for (uint32_t i = 0; i < edge_count;) {
+		uint32_t j = i + 1;
+		while (j < edge_count && edges[j].a == edges[i].a && edges[j].b == edges[i].b) j++;
+
+		if (j - i == 1) {
+			uint32_t a = edges[i].a;
+			uint32_t b = edges[i].b;
+			locked[a] = 1;
+			locked[b] = 1;
+
+			const float* pa = &positions[a * 3];
+			const float* pb = &positions[b * 3];
+			double direction[3] = {pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2]};
+			double length = sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+			if (length > 0) {
+				//Any plane containing the edge will do, pick the one whose
+				//normal is the edge's least dominant axis crossed with it
+				double axis[3] = {0, 0, 0};
+				double ax = fabs(direction[0]), ay = fabs(direction[1]), az = fabs(direction[2]);
+				axis[ax <= ay && ax <= az ? 0 : (ay <= az ? 1 : 2)] = 1;
+				double n[3] = {
+					direction[1] * axis[2] - direction[2] * axis[1],
+					direction[2] * axis[0] - direction[0] * axis[2],
+					direction[0] * axis[1] - direction[1] * axis[0]
+				};
+				double nl = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+				n[0] /= nl;
+				n[1] /= nl;
+				n[2] /= nl;
+				double d = -(n[0] * pa[0] + n[1] * pa[1] + n[2] * pa[2]);
+
+				struct Quadric q;
+				quadric_from_plane(&q, n[0], n[1], n[2], d, length * LOCKED_BORDER_WEIGHT);
+				quadric_add(&quadrics[a], &q);
+				quadric_add(&quadrics[b], &q);
+			}
+		}
+		i = j;
+	}
+}
+
+//Would moving from onto to turn any triangle around from upside down?
+static int
+collapse_flips(uint32_t from, uint32_t to, const float* positions, const uint32_t* indices,
+		const uint32_t* offsets, const uint32_t* adjacency) {
+
+	for (uint32_t i = offsets[from]; i < offsets[from + 1]; i++) {
+		const uint32_t* triangle = &indices[adjacency[i] * 3];
+		if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+			//Collapses away entirely
+			continue;
+		}
+
+		const float* before[3];
+		const float* after[3];
+		for (int k = 0; k < 3; k++) {
+			before[k] = &positions[triangle[k] * 3];
+			after[k] = triangle[k] == from ? &positions[to * 3] : before[k];
+		}
+
+		double n0[3], n1[3];
+		triangle_normal(before[0], before[1], before[2], n0);
+		triangle_normal(after[0], after[1], after[2], n1);
+		if (n0[0] * n0[0] + n0[1] * n0[1] + n0[2] * n0[2] == 0) {
+			continue;
+		}
+		if (n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2] <= 0) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+uint32_t
+mesh_simplify(uint32_t* destination, const uint32_t* indices, uint32_t index_count,
+		const float* positions, uint32_t vertex_count,
+		uint32_t target_index_count, float target_error, float* result_error) {
+
+	struct Quadric* quadrics = calloc(vertex_count ? vertex_count : 1, sizeof(*quadrics));
+	unsigned char* locked = calloc(vertex_count ? vertex_count : 1, 1);
+	unsigned char* touched = calloc(vertex_count ? vertex_count : 1, 1);
+	uint32_t* remap = malloc((size_t) (vertex_count ? vertex_count : 1) * sizeof(uint32_t));
+	uint32_t* offsets = malloc(((size_t) vertex_count + 1) * sizeof(uint32_t));
+	uint32_t* adjacency = malloc((size_t) (index_count ? index_count : 1) * sizeof(uint32_t));
+	struct Edge* edges = malloc((size_t) (index_count ? index_count : 1) * sizeof(*edges));
+	struct Collapse* collapses = malloc((size_t) (index_count ? index_count : 1) * sizeof(*collapses));
+
+	uint32_t count = 0;
+	double max_error = 0;
+	if (!quadrics || !locked || !touched || !remap || !offsets || !adjacency || !edges || !collapses ||
+			!lock_seams(positions, vertex_count, locked)) {
+		goto CLEANUP;
+	}
+
+	memcpy(destination, indices, (size_t) index_count * sizeof(uint32_t));
+	count = index_count;
+
+	//Area weighted face planes
+	for (uint32_t t = 0; t < count / 3; t++) {
+		const uint32_t* triangle = &destination[t * 3];
+		const float* a = &positions[triangle[0] * 3];
+		double n[3];
+		triangle_normal(a, &positions[triangle[1] * 3], &positions[triangle[2] * 3], n);
+		double length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		if (length == 0) continue;
+
+		n[0] /= length;
+		n[1] /= length;
+		n[2] /= length;
+		double d = -(n[0] * a[0] + n[1] * a[1] + n[2] * a[2]);
+
+		struct Quadric q;
+		quadric_from_plane(&q, n[0], n[1], n[2], d, length * 0.5);
+		for (int k = 0; k < 3; k++) {
+			quadric_add(&quadrics[triangle[k]], &q);
+		}
+	}
+
+	//Directed edges, a < b, borders show up once
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t a = destination[i];
+		uint32_t b = destination[i % 3 == 2 ? i - 2 : i + 1];
+		edges[i] = (struct Edge) {a < b ? a : b, a < b ? b : a};
+	}
+	qsort(edges, count, sizeof(*edges), compare_edges);
+	mark_borders(edges, count, positions, quadrics, locked);
+
+	double error_limit = (double) target_error * target_error;
+
+	while (count > target_index_count) {
+		//Adjacency for the current triangles
+		memset(offsets, 0, ((size_t) vertex_count + 1) * sizeof(uint32_t));
+		for (uint32_t i = 0; i < count; i++) {
+			offsets[destination[i] + 1]++;
+		}
+		for (uint32_t v = 0; v < vertex_count; v++) {
+			offsets[v + 1] += offsets[v];
+		}
+		for (uint32_t i = 0; i < count; i++) {
+			adjacency[offsets[destination[i]]++] = i / 3;
+		}
+		for (uint32_t v = vertex_count; v > 0; v--) {
+			offsets[v] = offsets[v - 1];
+		}
+		offsets[0] = 0;
+
+		//Cheapest direction for every edge
+		uint32_t collapse_count = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			uint32_t a = destination[i];
+			uint32_t b = destination[i % 3 == 2 ? i - 2 : i + 1];
+			//Interior edges are seen from both triangles, keep one. Border
+			//edges may get skipped, but their vertices are locked anyway.
+			if (a > b) {
+				continue;
+			}
+
+			struct Quadric q = quadrics[a];
+			quadric_add(&q, &quadrics[b]);
+			double cost_ab = locked[a] ? INFINITY : quadric_error(&q, &positions[b * 3]);
+			double cost_ba = locked[b] ? INFINITY : quadric_error(&q, &positions[a * 3]);
+			if (isinf(cost_ab) && isinf(cost_ba)) continue;
+
+			collapses[collapse_count++] = cost_ab <= cost_ba ?
+				(struct Collapse) {a, b, cost_ab} : (struct Collapse) {b, a, cost_ba};
+		}
+		if (collapse_count == 0) break;
+
+		qsort(collapses, collapse_count, sizeof(*collapses), compare_collapses);
+
+		for (uint32_t v = 0; v < vertex_count; v++) {
+			remap[v] = v;
+		}
+		memset(touched, 0, vertex_count);
+
+		//Every collapse removes about two triangles
+		uint32_t triangles_to_remove = (count - target_index_count) / 3;
+		uint32_t removed = 0;
+		uint32_t applied = 0;
+		for (uint32_t i = 0; i < collapse_count && removed < triangles_to_remove; i++) {
+			struct Collapse c = collapses[i];
+			if (c.cost > error_limit) break;
+			if (touched[c.from] || touched[c.to]) continue;
+			if (collapse_flips(c.from, c.to, positions, destination, offsets, adjacency)) continue;
+
+			remap[c.from] = c.to;
+			quadric_add(&quadrics[c.to], &quadrics[c.from]);
+			touched[c.from] = 1;
+			touched[c.to] = 1;
+			if (c.cost > max_error) max_error = c.cost;
+
+			removed += 2;
+			applied++;
+		}
+		if (applied == 0) break;
+
+		//Apply the remap, dropping triangles that became degenerate
+		uint32_t out = 0;
+		for (uint32_t t = 0; t < count / 3; t++) {
+			uint32_t a = remap[destination[t * 3]];
+			uint32_t b = remap[destination[t * 3 + 1]];
+			uint32_t c = remap[destination[t * 3 + 2]];
+			if (a != b && b != c && a != c) {
+				destination[out++] = a;
+				destination[out++] = b;
+				destination[out++] = c;
+			}
+		}
+		count = out;
+	}
+
+CLEANUP:
+	free(quadrics);
+	free(locked);
+	free(touched);
+	free(remap);
+	free(offsets);
+	free(adjacency);
+	free(edges);
+	free(collapses);
+
+	if (result_error != NULL) {
+		*result_error = (float) sqrt(max_error);
+	}
+	return count;
+}
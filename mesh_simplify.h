@@ -0,0 +1,20 @@
+#ifndef MESH_SIMPLIFY_H
+#define MESH_SIMPLIFY_H
+
+#include <stdint.h>
+
+//Quadric error metric edge collapse. Vertices only ever collapse onto one
+//of their neighbours, so the result indexes the same vertex buffer and a
+//whole LOD chain can share one VBO. Vertices on open borders and on
+//attribute seams (same position, different vertex) are never moved.
+//
+//Writes at most index_count indices to destination and returns how many,
+//stopping at target_index_count or once the next collapse would move the
+//surface by more than target_error, in the units of positions.
+//result_error, if not NULL, receives the largest error actually introduced.
+//Returns 0 when out of memory.
+uint32_t mesh_simplify(uint32_t* destination, const uint32_t* indices, uint32_t index_count,
+		const float* positions, uint32_t vertex_count,
+		uint32_t target_index_count, float target_error, float* result_error);
+
+#endif
@@ -0,0 +1,696 @@
+#include "obj.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "jobs.h"
+
+//The file is mapped, cut into newline aligned chunks and every chunk is
+//parsed on its own worker. Faces may reference attributes from earlier
+//chunks, so indices stay chunk relative until the chunks are stitched
+//together, after which corners are deduplicated through a hash table.
+
+#define CHUNK_MIN_SIZE (1 << 20)
+
+#define INDEX_MISSING 0xffffffffu
+//Negative OBJ indices count back from the end of the chunk's own list
+#define INDEX_LOCAL 0x80000000u
+
+struct FloatArray {
+	float* data;
+	uint32_t count;
+	uint32_t capacity;
+};
+
+struct Corner {
+	uint32_t position;
+	uint32_t uv;
+	uint32_t normal;
+};
+
+struct CornerArray {
+	struct Corner* data;
+	uint32_t count;
+	uint32_t capacity;
+};
+
+struct ObjChunk {
+	const char* begin;
+	const char* end;
+
+	struct FloatArray positions;
+	struct FloatArray normals;
+	struct FloatArray uvs;
+	//Three per triangle
+	struct CornerArray corners;
+
+	uint32_t position_base;
+	uint32_t normal_base;
+	uint32_t uv_base;
+
+	const char* error;
+};
+
+static int
+float_array_reserve(struct FloatArray* array, uint32_t count) {
+	if (array->count + count <= array->capacity) {
+		return 1;
+	}
+
+	uint32_t capacity = array->capacity ? array->capacity * 2 : 4096;
+	while (capacity < array->count + count) capacity *= 2;
+
+	float* data = realloc(array->data, (size_t) capacity * sizeof(float));
+	if (data == NULL) return 0;
+	array->data = data;
+	array->capacity = capacity;
+	return 1;
+}
+
+static int
+corner_array_push(struct CornerArray* array, struct Corner corner) {
+	if (array->count == array->capacity) {
+		uint32_t capacity = array->capacity ? array->capacity * 2 : 4096;
+		struct Corner* data = realloc(array->data, (size_t) capacity * sizeof(*data));
+		if (data == NULL) return 0;
+		array->data = data;
+		array->capacity = capacity;
+	}
+
+	array->data[array->count++] = corner;
+	return 1;
+}
+
+static double
+seconds_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+//Float parsing. Mantissas up to 19 digits with small exponents are exact in
+//a double multiply or divide, so only unusual numbers go through strtod.
+//Runs of 8 digits are converted together with SWAR arithmetic.
+
+static const double powers_of_ten[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static int
+is_digit(char c) {
+	return (unsigned char) (c - '0') < 10;
+}
+
+static int
+is_eight_digits(uint64_t value) {
+	return ((value & 0xf0f0f0f0f0f0f0f0ull) |
+		(((value + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) ==
+		0x3333333333333333ull;
+}
+
+//Assumes little endian byte order
+static uint32_t
+parse_eight_digits(uint64_t value) {
+	value = (value & 0x0f0f0f0f0f0f0f0full) * 2561 >> 8;
+	value = (value & 0x00ff00ff00ff00ffull) * 6553601 >> 16;
+	return (uint32_t) ((value & 0x0000ffff0000ffffull) * 42949672960001ull >> 32);
+}
+
+//Accumulates digits into mantissa, returns the number of digits consumed
+static const char*
+parse_digits(const char* p, const char* end, uint64_t* mantissa, int* digits) {
+	while (end - p >= 8 && *digits + 8 <= 19) {
+		uint64_t chunk;
+		memcpy(&chunk, p, sizeof(chunk));
+		if (!is_eight_digits(chunk)) break;
+		*mantissa = *mantissa * 100000000ull + parse_eight_digits(chunk);
+		*digits += 8;
+		p += 8;
+	}
+
+	while (p < end && is_digit(*p)) {
+		if (*digits < 19) {
+			*mantissa = *mantissa * 10 + (uint64_t) (*p - '0');
+		}
+		//Digits past 19 do not fit, flag the slow path with > 19
+		(*digits)++;
+		p++;
+	}
+	return p;
+}
+
+static const char*
+skip_blanks(const char* p, const char* end) {
+	while (p < end && (*p == ' ' || *p == '\t')) p++;
+	return p;
+}
+
+static const char*
+parse_float(const char* p, const char* end, float* out) {
+	p = skip_blanks(p, end);
+	const char* start = p;
+
+	int negative = 0;
+	if (p < end && (*p == '-' || *p == '+')) {
+		negative = *p == '-';
+		p++;
+	}
+
+	uint64_t mantissa = 0;
+	int digits = 0;
+	const char* integer_start = p;
+	p = parse_digits(p, end, &mantissa, &digits);
+	int integer_digits = (int) (p - integer_start);
+
+	int exponent = 0;
+	if (integer_digits > 19) {
+		exponent = integer_digits - 19;
+	}
+
+	int fraction_digits = 0;
+	if (p < end && *p == '.') {
+		p++;
+		const char* fraction_start = p;
+		int before = digits;
+		p = parse_digits(p, end, &mantissa, &digits);
+		fraction_digits = (int) (p - fraction_start);
+		if (before < 19) {
+			exponent -= (digits < 19 ? digits : 19) - before;
+		}
+	}
+
+	if (integer_digits + fraction_digits == 0) {
+		return NULL;
+	}
+
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		const char* q = p + 1;
+		int exponent_negative = 0;
+		if (q < end && (*q == '-' || *q == '+')) {
+			exponent_negative = *q == '-';
+			q++;
+		}
+		if (q < end && is_digit(*q)) {
+			int value = 0;
+			while (q < end && is_digit(*q)) {
+				if (value < 10000) value = value * 10 + (*q - '0');
+				q++;
+			}
+			exponent += exponent_negative ? -value : value;
+			p = q;
+		}
+	}
+
+	if (digits <= 19 && mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22) {
+		double value = (double) mantissa;
+		value = exponent < 0 ? value / powers_of_ten[-exponent] : value * powers_of_ten[exponent];
+		*out = (float) (negative ? -value : value);
+		return p;
+	}
+
+	char buffer[128];
+	size_t length = (size_t) (p - start);
+	if (length >= sizeof(buffer)) {
+		return NULL;
+	}
+	memcpy(buffer, start, length);
+	buffer[length] = '\0';
+	*out = strtof(buffer, NULL);
+	return p;
+}
+
+static const char*
+parse_index(const char* p, const char* end, long* out) {
+	int negative = 0;
+	if (p < end && *p == '-') {
+		negative = 1;
+		p++;
+	}
+	if (p >= end || !is_digit(*p)) {
+		return NULL;
+	}
+
+	long value = 0;
+	while (p < end && is_digit(*p)) {
+		if (value < 0x7fffffffL) value = value * 10 + (*p - '0');
+		p++;
+	}
+	*out = negative ? -value : value;
+	return p;
+}
+
+static uint32_t
+encode_index(long index, uint32_t local_count) {
+	if (index > 0) {
+		return (uint32_t) (index - 1);
+	}
+	if (index < 0 && -index <= (long) local_count) {
+		return INDEX_LOCAL | (uint32_t) ((long) local_count + index);
+	}
+	//Negative indices reaching into an earlier chunk are resolved later,
+	//encoded as a count back from this chunk's start
+	if (index < 0) {
+		return INDEX_LOCAL | INDEX_LOCAL >> 1 | (uint32_t) (-index - (long) local_count);
+	}
+	return INDEX_MISSING;
+}
+
+static const char*
+parse_corner(const char* p, const char* end, struct ObjChunk* chunk, struct Corner* corner) {
+	p = skip_blanks(p, end);
+
+	long index = 0;
+	p = parse_index(p, end, &index);
+	if (p == NULL) return NULL;
+	corner->position = encode_index(index, chunk->positions.count / 3);
+	corner->uv = INDEX_MISSING;
+	corner->normal = INDEX_MISSING;
+
+	if (p < end && *p == '/') {
+		p++;
+		const char* uv_end = parse_index(p, end, &index);
+		if (uv_end != NULL) {
+			corner->uv = encode_index(index, chunk->uvs.count / 2);
+			p = uv_end;
+		}
+		if (p < end && *p == '/') {
+			p++;
+			const char* normal_end = parse_index(p, end, &index);
+			if (normal_end != NULL) {
+				corner->normal = encode_index(index, chunk->normals.count / 3);
+				p = normal_end;
+			}
+		}
+	}
+	return p;
+}
+
+static int
+parse_face(struct ObjChunk* chunk, const char* p, const char* end) {
+	struct Corner first, previous, current;
+
+	if ((p = parse_corner(p, end, chunk, &first)) == NULL) return 0;
+	if ((p = parse_corner(p, end, chunk, &previous)) == NULL) return 0;
+
+	int triangles = 0;
+	while ((p = parse_corner(p, end, chunk, &current)) != NULL) {
+		if (!corner_array_push(&chunk->corners, first) ||
+				!corner_array_push(&chunk->corners, previous) ||
+				!corner_array_push(&chunk->corners, current)) {
+			return 0;
+		}
+		previous = current;
+		triangles++;
+	}
+	return triangles > 0;
+}
+
+static int
+parse_vector(struct FloatArray* array, const char* p, const char* end, int count) {
+	if (!float_array_reserve(array, (uint32_t) count)) {
+		return 0;
+	}
+
+	//Trailing components may be left out ("vt u"), they default to 0
+	float* values = array->data + array->count;
+	for (int i = 0; i < count; i++) {
+		const char* next = parse_float(p, end, &values[i]);
+		if (next == NULL) {
+			if (i == 0) return 0;
+			values[i] = 0.0f;
+			continue;
+		}
+		p = next;
+	}
+	array->count += (uint32_t) count;
+	return 1;
+}
+
+static void
+parse_chunk(void* user, int index) {
+	struct ObjChunk* chunk = &((struct ObjChunk*) user)[index];
+	const char* p = chunk->begin;
+
+	while (p < chunk->end) {
+		const char* line_end = memchr(p, '\n', (size_t) (chunk->end - p));
+		if (line_end == NULL) line_end = chunk->end;
+
+		int ok = 1;
+		if (line_end - p >= 2 && p[0] == 'v') {
+			if (p[1] == ' ' || p[1] == '\t') {
+				ok = parse_vector(&chunk->positions, p + 2, line_end, 3);
+			} else if (p[1] == 'n') {
+				ok = parse_vector(&chunk->normals, p + 2, line_end, 3);
+			} else if (p[1] == 't') {
+				ok = parse_vector(&chunk->uvs, p + 2, line_end, 2);
+			}
+		} else if (line_end - p >= 2 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+			ok = parse_face(chunk, p + 2, line_end);
+		}
+
+		if (!ok) {
+			chunk->error = p;
+			return;
+		}
+		p = line_end + 1;
+	}
+}
+
+//Turns chunk relative corner indices into indices of the merged arrays
+static int
+resolve_index(uint32_t* index, uint32_t base, uint32_t total) {
+	if (*index == INDEX_MISSING) {
+		return 1;
+	}
+
+	if (*index & INDEX_LOCAL) {
+		uint32_t value = *index & ~INDEX_LOCAL;
+		if (value & INDEX_LOCAL >> 1) {
+			uint32_t back = value & ~(INDEX_LOCAL >> 1);
+			if (back > base) return 0;
+			*index = base - back;
+		} else {
+			*index = base + value;
+		}
+	}
+	return *index < total;
+}
+
+struct MergeContext {
+	struct ObjChunk* chunks;
+	uint32_t position_count;
+	uint32_t normal_count;
+	uint32_t uv_count;
+	float* positions;
+	float* normals;
+	float* uvs;
+};
+
+static void
+merge_chunk(void* user, int index) {
+	struct MergeContext* context = user;
+	struct ObjChunk* chunk = &context->chunks[index];
+
+	memcpy(context->positions + (size_t) chunk->position_base * 3, chunk->positions.data,
+			chunk->positions.count * sizeof(float));
+	if (context->normals != NULL && chunk->normals.count) {
+		memcpy(context->normals + (size_t) chunk->normal_base * 3, chunk->normals.data,
+				chunk->normals.count * sizeof(float));
+	}
+	if (context->uvs != NULL && chunk->uvs.count) {
+		memcpy(context->uvs + (size_t) chunk->uv_base * 2, chunk->uvs.data,
+				chunk->uvs.count * sizeof(float));
+	}
+
+	for (uint32_t i = 0; i < chunk->corners.count; i++) {
+		struct Corner* corner = &chunk->corners.data[i];
+		if (!resolve_index(&corner->position, chunk->position_base, context->position_count) ||
+				!resolve_index(&corner->normal, chunk->normal_base, context->normal_count) ||
+				!resolve_index(&corner->uv, chunk->uv_base, context->uv_count) ||
+				corner->position == INDEX_MISSING) {
+			chunk->error = chunk->begin;
+			return;
+		}
+	}
+}
+
+static uint32_t
+hash_corner(struct Corner corner) {
+	uint64_t h = corner.position * 0x9e3779b97f4a7c15ull;
+	h ^= (corner.uv + 0x632be59bd9b4e019ull) * 0xc2b2ae3d27d4eb4full;
+	h ^= (corner.normal + 0x165667b19e3779f9ull) * 0x85ebca77c2b2ae63ull;
+	h ^= h >> 29;
+	return (uint32_t) h;
+}
+
+struct VertexTable {
+	uint32_t* slots;
+	uint32_t mask;
+	struct Corner* keys;
+	uint32_t count;
+};
+
+static int
+vertex_table_grow(struct VertexTable* table) {
+	uint32_t capacity = table->slots ? (table->mask + 1) * 2 : 1024;
+	uint32_t* slots = malloc((size_t) capacity * sizeof(uint32_t));
+	if (slots == NULL) return 0;
+	memset(slots, 0xff, (size_t) capacity * sizeof(uint32_t));
+
+	uint32_t mask = capacity - 1;
+	for (uint32_t i = 0; i < table->count; i++) {
+		uint32_t slot = hash_corner(table->keys[i]) & mask;
+		while (slots[slot] != INDEX_MISSING) slot = (slot + 1) & mask;
+		slots[slot] = i;
+	}
+
+	free(table->slots);
+	table->slots = slots;
+	table->mask = mask;
+	return 1;
+}
+
+//keys must have room for every corner, the table never holds more
+static uint32_t
+vertex_table_insert(struct VertexTable* table, struct Corner corner) {
+	if (table->count * 2 >= table->mask + 1 && !vertex_table_grow(table)) {
+		return INDEX_MISSING;
+	}
+
+	uint32_t slot = hash_corner(corner) & table->mask;
+	while (table->slots[slot] != INDEX_MISSING) {
+		struct Corner* key = &table->keys[table->slots[slot]];
+		if (key->position == corner.position && key->uv == corner.uv && key->normal == corner.normal) {
+			return table->slots[slot];
+		}
+		slot = (slot + 1) & table->mask;
+	}
+
+	table->keys[table->count] = corner;
+	table->slots[slot] = table->count;
+	return table->count++;
+}
+
+static int
+build_mesh(struct ObjChunk* chunks, int chunk_count, struct MergeContext* merged, struct MeshData* mesh) {
+	uint64_t corner_count = 0;
+	for (int i = 0; i < chunk_count; i++) {
+		corner_count += chunks[i].corners.count;
+	}
+	if (corner_count >= INDEX_MISSING) {
+		return 0;
+	}
+
+	uint32_t* indices = malloc((corner_count ? corner_count : 1) * sizeof(uint32_t));
+	struct VertexTable table = {
+		.keys = malloc((corner_count ? corner_count : 1) * sizeof(struct Corner))
+	};
+	if (indices == NULL || table.keys == NULL || !vertex_table_grow(&table)) {
+		free(indices);
+		free(table.keys);
+		free(table.slots);
+		return 0;
+	}
+
+	uint32_t out = 0;
+	for (int i = 0; i < chunk_count; i++) {
+		for (uint32_t c = 0; c < chunks[i].corners.count; c++) {
+			uint32_t vertex = vertex_table_insert(&table, chunks[i].corners.data[c]);
+			if (vertex == INDEX_MISSING) {
+				free(indices);
+				free(table.keys);
+				free(table.slots);
+				return 0;
+			}
+			indices[out++] = vertex;
+		}
+	}
+	free(table.slots);
+
+	uint32_t vertex_count = table.count;
+	float* positions = malloc((vertex_count ? vertex_count : 1) * 3 * sizeof(float));
+	float* normals = merged->normals ? malloc((vertex_count ? vertex_count : 1) * 3 * sizeof(float)) : NULL;
+	float* uvs = merged->uvs ? malloc((vertex_count ? vertex_count : 1) * 2 * sizeof(float)) : NULL;
+	if (positions == NULL || (merged->normals && normals == NULL) || (merged->uvs && uvs == NULL)) {
+		free(positions);
+		free(normals);
+		free(uvs);
+		free(indices);
+		free(table.keys);
+		return 0;
+	}
+
+	for (uint32_t v = 0; v < vertex_count; v++) {
+		struct Corner corner = table.keys[v];
+		memcpy(positions + v * 3, merged->positions + (size_t) corner.position * 3, 3 * sizeof(float));
+		if (normals != NULL) {
+			if (corner.normal != INDEX_MISSING) {
+				memcpy(normals + v * 3, merged->normals + (size_t) corner.normal * 3, 3 * sizeof(float));
+			} else {
+				memset(normals + v * 3, 0, 3 * sizeof(float));
+			}
+		}
+		if (uvs != NULL) {
+			if (corner.uv != INDEX_MISSING) {
+				memcpy(uvs + v * 2, merged->uvs + (size_t) corner.uv * 2, 2 * sizeof(float));
+			} else {
+				memset(uvs + v * 2, 0, 2 * sizeof(float));
+			}
+		}
+	}
+	free(table.keys);
+
+	*mesh = (struct MeshData) {
+		.positions = positions,
+		.normals = normals,
+		.uvs = uvs,
+		.indices = indices,
+		.vertex_count = vertex_count,
+		.index_count = (uint32_t) corner_count
+	};
+	return 1;
+}
+
+static void
+free_chunks(struct ObjChunk* chunks, int chunk_count) {
+	for (int i = 0; i < chunk_count; i++) {
+		free(chunks[i].positions.data);
+		free(chunks[i].normals.data);
+		free(chunks[i].uvs.data);
+		free(chunks[i].corners.data);
+	}
+	free(chunks);
+}
+
+static int
+split_chunks(const char* data, size_t size, struct ObjChunk** out) {
+	size_t target = size / ((size_t) jobs_concurrency() * 4);
+	if (target < CHUNK_MIN_SIZE) target = CHUNK_MIN_SIZE;
+
+	int capacity = (int) (size / target) + 1;
+	struct ObjChunk* chunks = calloc((size_t) capacity, sizeof(*chunks));
+	if (chunks == NULL) return -1;
+
+	int count = 0;
+	const char* p = data;
+	const char* end = data + size;
+	while (p < end && count < capacity) {
+		const char* chunk_end = (size_t) (end - p) > target && count < capacity - 1 ? p + target : end;
+		if (chunk_end < end) {
+			const char* newline = memchr(chunk_end, '\n', (size_t) (end - chunk_end));
+			chunk_end = newline ? newline + 1 : end;
+		}
+		chunks[count].begin = p;
+		chunks[count].end = chunk_end;
+		count++;
+		p = chunk_end;
+	}
+
+	*out = chunks;
+	return count;
+}
+
+static void
+report_error(const char* path, const char* data, const char* location) {
+	long line = 1;
+	for (const char* p = data; p < location; p++) {
+		if (*p == '\n') line++;
+	}
+	fprintf(stderr, "%s:%ld: malformed line\n", path, line);
+}
+
+int
+obj_load(const char* path, struct MeshData* mesh, struct ObjStats* stats) {
+	double start = seconds_now();
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return 0;
+	}
+
+	struct stat file_stat;
+	if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+		close(fd);
+		fprintf(stderr, "%s is empty\n", path);
+		return 0;
+	}
+	size_t size = (size_t) file_stat.st_size;
+
+	const char* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		fprintf(stderr, "Failed to map %s\n", path);
+		return 0;
+	}
+	madvise((void*) data, size, MADV_SEQUENTIAL);
+
+	struct ObjChunk* chunks = NULL;
+	int chunk_count = split_chunks(data, size, &chunks);
+	if (chunk_count < 0) {
+		munmap((void*) data, size);
+		return 0;
+	}
+
+	jobs_parallel_for(chunk_count, parse_chunk, chunks);
+
+	int ok = 1;
+	struct MergeContext merged = {.chunks = chunks};
+	for (int i = 0; i < chunk_count && ok; i++) {
+		if (chunks[i].error != NULL) {
+			report_error(path, data, chunks[i].error);
+			ok = 0;
+		}
+		chunks[i].position_base = merged.position_count;
+		chunks[i].normal_base = merged.normal_count;
+		chunks[i].uv_base = merged.uv_count;
+		merged.position_count += chunks[i].positions.count / 3;
+		merged.normal_count += chunks[i].normals.count / 3;
+		merged.uv_count += chunks[i].uvs.count / 2;
+	}
+
+	if (ok) {
+		merged.positions = malloc(((size_t) merged.position_count * 3 + 1) * sizeof(float));
+		merged.normals = merged.normal_count ? malloc((size_t) merged.normal_count * 3 * sizeof(float)) : NULL;
+		merged.uvs = merged.uv_count ? malloc((size_t) merged.uv_count * 2 * sizeof(float)) : NULL;
+		ok = merged.positions != NULL && (merged.normal_count == 0 || merged.normals != NULL) &&
+			(merged.uv_count == 0 || merged.uvs != NULL);
+	}
+
+	if (ok) {
+		jobs_parallel_for(chunk_count, merge_chunk, &merged);
+		for (int i = 0; i < chunk_count && ok; i++) {
+			if (chunks[i].error != NULL) {
+				fprintf(stderr, "%s: face index out of range\n", path);
+				ok = 0;
+			}
+		}
+	}
+
+	if (ok) {
+		ok = build_mesh(chunks, chunk_count, &merged, mesh);
+	}
+
+	free(merged.positions);
+	free(merged.normals);
+	free(merged.uvs);
+	free_chunks(chunks, chunk_count);
+	munmap((void*) data, size);
+
+	if (ok && stats != NULL) {
+		*stats = (struct ObjStats) {
+			.bytes = size,
+			.seconds = seconds_now() - start,
+			.triangles = mesh->index_count / 3,
+			.vertices = mesh->vertex_count
+		};
+	}
+	return ok;
+}
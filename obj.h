@@ -0,0 +1,22 @@
+#ifndef OBJ_H
+#define OBJ_H
+
+#include <stddef.h>
+
+#include "mesh_format.h"
+
+struct ObjStats {
+	size_t bytes;
+	double seconds;
+	uint32_t triangles;
+	uint32_t vertices;
+};
+
+//Reads positions, normals, uvs and faces from a Wavefront OBJ file into an
+//indexed mesh, with corners sharing position, uv and normal merged into one
+//vertex. Polygons are triangulated as fans. Parsing is spread over the job
+//pool, call jobs_init first to use more than the calling thread.
+//stats may be NULL. Returns 0 on failure.
+int obj_load(const char* path, struct MeshData* mesh, struct ObjStats* stats);
+
+#endif
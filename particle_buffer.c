@@ -0,0 +1,76 @@
+#include "particle_buffer.h"
+
+#include <stdio.h>
+
+#include "gl_state.h"
+#include "particles.h"
+
+#define INSTANCE_SIZE (PARTICLE_INSTANCE_FLOATS * sizeof(float))
+
+struct ParticleBuffer
+particle_buffer_create(uint32_t capacity) {
+	struct ParticleBuffer buffer = {.capacity = capacity};
+	if (capacity == 0) {
+		return (struct ParticleBuffer) {0};
+	}
+
+	float corners[] = {
+		-1.0f, -1.0f,
+		1.0f, -1.0f,
+		-1.0f, 1.0f,
+		1.0f, 1.0f
+	};
+
+	glGenVertexArrays(1, &buffer.vao);
+	gl_state_bind_vertex_array(buffer.vao);
+
+	glGenBuffers(1, &buffer.quad_vbo);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, buffer.quad_vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*) 0);
+	glEnableVertexAttribArray(0);
+
+	glGenBuffers(1, &buffer.instance_vbo);
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, buffer.instance_vbo);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) capacity * INSTANCE_SIZE, NULL, GL_STREAM_DRAW);
+	glVertexAttribPointer(1, PARTICLE_INSTANCE_FLOATS, GL_FLOAT, GL_FALSE, INSTANCE_SIZE, (void*) 0);
+	glEnableVertexAttribArray(1);
+	glVertexAttribDivisor(1, 1);
+
+	if (glGetError() != GL_NO_ERROR) {
+		fprintf(stderr, "Failed to create particle buffer for %u instances\n", capacity);
+		particle_buffer_destroy(&buffer);
+	}
+	return buffer;
+}
+
+void
+particle_buffer_destroy(struct ParticleBuffer* buffer) {
+	glDeleteVertexArrays(1, &buffer->vao);
+	glDeleteBuffers(1, &buffer->quad_vbo);
+	glDeleteBuffers(1, &buffer->instance_vbo);
+	//Deleted names get handed out again, drop the cached binds
+	gl_state_reset();
+	*buffer = (struct ParticleBuffer) {0};
+}
+
+float*
+particle_buffer_map(struct ParticleBuffer* buffer) {
+	if (buffer->instance_vbo == 0) {
+		return NULL;
+	}
+
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, buffer->instance_vbo);
+	return glMapBufferRange(GL_ARRAY_BUFFER, 0, (GLsizeiptr) buffer->capacity * INSTANCE_SIZE,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+}
+
+void
+particle_buffer_unmap(struct ParticleBuffer* buffer) {
+	gl_state_bind_buffer(GL_ARRAY_BUFFER, buffer->instance_vbo);
+	if (!glUnmapBuffer(GL_ARRAY_BUFFER)) {
+		//Contents got lost, e.g. on a mode switch. Drawing garbage for one
+		//frame is harmless, the next update rewrites everything.
+		fprintf(stderr, "Particle instance buffer corrupted\n");
+	}
+}
@@ -0,0 +1,28 @@
+#ifndef PARTICLE_BUFFER_H
+#define PARTICLE_BUFFER_H
+
+#include <stdint.h>
+
+#include "glad/glad.h"
+
+//Instanced quad for particles. Location 0 is the quad corner in [-1, 1],
+//location 1 the per instance PARTICLE_INSTANCE_FLOATS written by
+//particles_update. Draw with GL_TRIANGLE_STRIP, 4 vertices.
+struct ParticleBuffer {
+	unsigned int vao;
+	unsigned int quad_vbo;
+	unsigned int instance_vbo;
+	uint32_t capacity;
+};
+
+//Returns a zeroed struct on failure
+struct ParticleBuffer particle_buffer_create(uint32_t capacity);
+void particle_buffer_destroy(struct ParticleBuffer* buffer);
+
+//Orphans the instance storage and maps all of it for writing, so the
+//driver never waits on the frame still drawing from the old contents.
+//Returns NULL on failure. Unmap before drawing.
+float* particle_buffer_map(struct ParticleBuffer* buffer);
+void particle_buffer_unmap(struct ParticleBuffer* buffer);
+
+#endif
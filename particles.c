@@ -0,0 +1,246 @@
+#include "particles.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "jobs.h"
+
+//Multiple of 4 so every batch but the last runs whole SIMD groups
+#define PARTICLE_BATCH_SIZE 16384
+
+static float**
+arrays_begin(struct ParticleArrays* arrays) {
+	return &arrays->x;
+}
+
+#define PARTICLE_ARRAY_COUNT (sizeof(struct ParticleArrays) / sizeof(float*))
+
+static uint32_t
+batch_count(uint32_t count) {
+	return (count + PARTICLE_BATCH_SIZE - 1) / PARTICLE_BATCH_SIZE;
+}
+
+struct Particles
+particles_create(uint32_t capacity) {
+	struct Particles particles = {.capacity = capacity};
+
+	int allocated = 1;
+	float** front = arrays_begin(&particles.front);
+	float** back = arrays_begin(&particles.back);
+	for (size_t i = 0; i < PARTICLE_ARRAY_COUNT; i++) {
+		front[i] = malloc((size_t) (capacity ? capacity : 1) * sizeof(float));
+		back[i] = malloc((size_t) (capacity ? capacity : 1) * sizeof(float));
+		allocated &= front[i] != NULL && back[i] != NULL;
+	}
+	particles.batch_counts = malloc((batch_count(capacity) + 1) * sizeof(uint32_t));
+	particles.batch_ends = malloc((batch_count(capacity) + 1) * sizeof(uint32_t));
+	allocated &= particles.batch_counts != NULL && particles.batch_ends != NULL;
+
+	if (!allocated) {
+		fprintf(stderr, "Out of memory for %u particles\n", capacity);
+		particles_free(&particles);
+	}
+	return particles;
+}
+
+void
+particles_free(struct Particles* particles) {
+	float** front = arrays_begin(&particles->front);
+	float** back = arrays_begin(&particles->back);
+	for (size_t i = 0; i < PARTICLE_ARRAY_COUNT; i++) {
+		free(front[i]);
+		free(back[i]);
+	}
+	free(particles->batch_counts);
+	free(particles->batch_ends);
+	*particles = (struct Particles) {0};
+}
+
+int
+particles_emit(struct Particles* particles, Vector3 position, Vector3 velocity, float life) {
+	if (particles->count >= particles->capacity) {
+		return 0;
+	}
+
+	struct ParticleArrays* a = &particles->front;
+	uint32_t i = particles->count++;
+	a->x[i] = position.x;
+	a->y[i] = position.y;
+	a->z[i] = position.z;
+	a->velocity_x[i] = velocity.x;
+	a->velocity_y[i] = velocity.y;
+	a->velocity_z[i] = velocity.z;
+	a->life[i] = life;
+	return 1;
+}
+
+struct UpdateJob {
+	struct Particles* particles;
+	float dt;
+	Vector3 gravity;
+	float* instances;
+};
+
+static uint32_t
+batch_end(const struct Particles* particles, uint32_t begin) {
+	return begin + PARTICLE_BATCH_SIZE < particles->count ? begin + PARTICLE_BATCH_SIZE : particles->count;
+}
+
+//First pass, only reads life so the survivors' destinations are known
+//before anything is written
+static void
+count_batch(void* user, int batch) {
+	struct UpdateJob* job = user;
+	const float* life = job->particles->front.life;
+	uint32_t begin = (uint32_t) batch * PARTICLE_BATCH_SIZE;
+	uint32_t end = batch_end(job->particles, begin);
+
+	uint32_t alive = 0;
+	for (uint32_t i = begin; i < end; i++) {
+		alive += life[i] - job->dt > 0.0f;
+	}
+	job->particles->batch_counts[batch] = alive;
+
+	//Dead particles after the last survivor would be written past the
+	//batch's output range, into the next batch's, so they are skipped
+	while (end > begin && !(life[end - 1] - job->dt > 0.0f)) {
+		end--;
+	}
+	job->particles->batch_ends[batch] = end;
+}
+
+//Every particle is written at out and out only advances for survivors, a
+//dead particle's slot is overwritten by the next survivor. Must use the
+//same life test as count_batch.
+static uint32_t
+integrate_scalar(const struct UpdateJob* job, uint32_t begin, uint32_t end, uint32_t out) {
+	const struct ParticleArrays* src = &job->particles->front;
+	const struct ParticleArrays* dst = &job->particles->back;
+	float dt = job->dt;
+
+	for (uint32_t i = begin; i < end; i++) {
+		float vx = src->velocity_x[i] + job->gravity.x * dt;
+		float vy = src->velocity_y[i] + job->gravity.y * dt;
+		float vz = src->velocity_z[i] + job->gravity.z * dt;
+		float x = src->x[i] + vx * dt;
+		float y = src->y[i] + vy * dt;
+		float z = src->z[i] + vz * dt;
+		float life = src->life[i] - dt;
+
+		dst->x[out] = x;
+		dst->y[out] = y;
+		dst->z[out] = z;
+		dst->velocity_x[out] = vx;
+		dst->velocity_y[out] = vy;
+		dst->velocity_z[out] = vz;
+		dst->life[out] = life;
+		if (job->instances != NULL) {
+			float* instance = &job->instances[(size_t) out * PARTICLE_INSTANCE_FLOATS];
+			instance[0] = x;
+			instance[1] = y;
+			instance[2] = z;
+			instance[3] = life;
+		}
+		out += life > 0.0f;
+	}
+	return out;
+}
+
+#if defined(__SSE2__)
+
+static uint32_t
+integrate_range(const struct UpdateJob* job, uint32_t begin, uint32_t end, uint32_t out) {
+	const struct ParticleArrays* src = &job->particles->front;
+	const struct ParticleArrays* dst = &job->particles->back;
+
+	__m128 dt = _mm_set1_ps(job->dt);
+	__m128 gx = _mm_set1_ps(job->gravity.x * job->dt);
+	__m128 gy = _mm_set1_ps(job->gravity.y * job->dt);
+	__m128 gz = _mm_set1_ps(job->gravity.z * job->dt);
+
+	uint32_t i = begin;
+	for (; i + 4 <= end; i += 4) {
+		__m128 vx = _mm_add_ps(_mm_loadu_ps(&src->velocity_x[i]), gx);
+		__m128 vy = _mm_add_ps(_mm_loadu_ps(&src->velocity_y[i]), gy);
+		__m128 vz = _mm_add_ps(_mm_loadu_ps(&src->velocity_z[i]), gz);
+		__m128 x = _mm_add_ps(_mm_loadu_ps(&src->x[i]), _mm_mul_ps(vx, dt));
+		__m128 y = _mm_add_ps(_mm_loadu_ps(&src->y[i]), _mm_mul_ps(vy, dt));
+		__m128 z = _mm_add_ps(_mm_loadu_ps(&src->z[i]), _mm_mul_ps(vz, dt));
+		__m128 life = _mm_sub_ps(_mm_loadu_ps(&src->life[i]), dt);
+		int mask = _mm_movemask_ps(_mm_cmpgt_ps(life, _mm_setzero_ps()));
+
+		float lanes[7][4];
+		_mm_storeu_ps(lanes[0], x);
+		_mm_storeu_ps(lanes[1], y);
+		_mm_storeu_ps(lanes[2], z);
+		_mm_storeu_ps(lanes[3], vx);
+		_mm_storeu_ps(lanes[4], vy);
+		_mm_storeu_ps(lanes[5], vz);
+		_mm_storeu_ps(lanes[6], life);
+
+		//Branchless compaction, same as the frustum culling kernels
+		for (int lane = 0; lane < 4; lane++) {
+			dst->x[out] = lanes[0][lane];
+			dst->y[out] = lanes[1][lane];
+			dst->z[out] = lanes[2][lane];
+			dst->velocity_x[out] = lanes[3][lane];
+			dst->velocity_y[out] = lanes[4][lane];
+			dst->velocity_z[out] = lanes[5][lane];
+			dst->life[out] = lanes[6][lane];
+			if (job->instances != NULL) {
+				float* instance = &job->instances[(size_t) out * PARTICLE_INSTANCE_FLOATS];
+				_mm_storeu_ps(instance, _mm_setr_ps(lanes[0][lane], lanes[1][lane],
+					lanes[2][lane], lanes[6][lane]));
+			}
+			out += (uint32_t) (mask >> lane) & 1u;
+		}
+	}
+
+	return integrate_scalar(job, i, end, out);
+}
+
+#else
+
+static uint32_t
+integrate_range(const struct UpdateJob* job, uint32_t begin, uint32_t end, uint32_t out) {
+	return integrate_scalar(job, begin, end, out);
+}
+
+#endif
+
+static void
+integrate_batch(void* user, int batch) {
+	struct UpdateJob* job = user;
+	uint32_t begin = (uint32_t) batch * PARTICLE_BATCH_SIZE;
+	integrate_range(job, begin, job->particles->batch_ends[batch], job->particles->batch_counts[batch]);
+}
+
+void
+particles_update(struct Particles* particles, float dt, Vector3 gravity, float* instances) {
+	if (particles->count == 0) {
+		return;
+	}
+
+	struct UpdateJob job = {particles, dt, gravity, instances};
+	int batches = (int) batch_count(particles->count);
+	jobs_parallel_for(batches, count_batch, &job);
+
+	//Counts become each batch's first output slot
+	uint32_t total = 0;
+	for (int batch = 0; batch < batches; batch++) {
+		uint32_t alive = particles->batch_counts[batch];
+		particles->batch_counts[batch] = total;
+		total += alive;
+	}
+
+	jobs_parallel_for(batches, integrate_batch, &job);
+
+	struct ParticleArrays swap = particles->front;
+	particles->front = particles->back;
+	particles->back = swap;
+	particles->count = total;
+}
@@ -0,0 +1,51 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <stdint.h>
+
+#include "every_math.h"
+
+//Particles live in two structure of arrays sets. An update reads the
+//front set and writes the survivors, already packed, into the back set
+//before swapping them, so dead particles are removed without a separate
+//compaction pass.
+
+struct ParticleArrays {
+	float* x;
+	float* y;
+	float* z;
+	float* velocity_x;
+	float* velocity_y;
+	float* velocity_z;
+	//Seconds left, a particle dies once this reaches 0
+	float* life;
+};
+
+struct Particles {
+	struct ParticleArrays front;
+	struct ParticleArrays back;
+	uint32_t count;
+	uint32_t capacity;
+	//Per update batch, sized for capacity. Survivor counts turned into
+	//output offsets, and where the last survivor ends.
+	uint32_t* batch_counts;
+	uint32_t* batch_ends;
+};
+
+//Instance layout written by particles_update, x y z then life
+#define PARTICLE_INSTANCE_FLOATS 4
+
+//Returns a zeroed struct when out of memory
+struct Particles particles_create(uint32_t capacity);
+void particles_free(struct Particles* particles);
+
+//Returns 0 when full
+int particles_emit(struct Particles* particles, Vector3 position, Vector3 velocity, float life);
+
+//Applies gravity and moves every particle by dt, dropping the ones whose
+//life runs out. If instances is not NULL it receives
+//PARTICLE_INSTANCE_FLOATS per surviving particle, in the same order.
+//Runs over the job pool.
+void particles_update(struct Particles* particles, float dt, Vector3 gravity, float* instances);
+
+#endif
@@ -0,0 +1,245 @@
+#include "profile.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define PROFILE_MAX_THREADS 72
+#define PROFILE_EVENT_MASK (PROFILE_EVENTS_PER_THREAD - 1)
+
+struct ProfileEvent {
+	uint64_t time;
+	//NULL for the end of the innermost open zone
+	const char* name;
+};
+
+struct ProfileBuffer {
+	struct ProfileEvent events[PROFILE_EVENTS_PER_THREAD];
+	//Events ever written, only the owning thread stores to it
+	uint32_t head;
+	int thread_id;
+	const char* thread_name;
+};
+
+static struct {
+	pthread_mutex_t mutex;
+	struct ProfileBuffer* buffers[PROFILE_MAX_THREADS];
+	int buffer_count;
+	uint64_t epoch;
+} profile = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static _Thread_local struct ProfileBuffer* local_buffer;
+
+static uint64_t
+monotonic_ns(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint64_t) time.tv_sec * 1000000000u + (uint64_t) time.tv_nsec;
+}
+
+uint64_t
+profile_now(void) {
+	uint64_t epoch = __atomic_load_n(&profile.epoch, __ATOMIC_RELAXED);
+	if (epoch == 0) {
+		//Whoever gets here first sets it, the others take theirs
+		uint64_t expected = 0;
+		uint64_t now = monotonic_ns();
+		if (!__atomic_compare_exchange_n(&profile.epoch, &expected, now, 0,
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+			now = expected;
+		}
+		epoch = now;
+	}
+	return monotonic_ns() - epoch;
+}
+
+//Only the first event of each thread takes the lock
+static struct ProfileBuffer*
+thread_buffer(void) {
+	if (local_buffer != NULL) {
+		return local_buffer;
+	}
+
+	pthread_mutex_lock(&profile.mutex);
+	if (profile.buffer_count < PROFILE_MAX_THREADS) {
+		struct ProfileBuffer* buffer = calloc(1, sizeof(*buffer));
+		if (buffer != NULL) {
+			buffer->thread_id = profile.buffer_count + 1;
+			profile.buffers[profile.buffer_count++] = buffer;
+			local_buffer = buffer;
+		}
+	}
+	pthread_mutex_unlock(&profile.mutex);
+
+	if (local_buffer == NULL) {
+		fprintf(stderr, "Profiling disabled on this thread\n");
+	}
+	return local_buffer;
+}
+
+static void
+record(const char* name) {
+	struct ProfileBuffer* buffer = thread_buffer();
+	if (buffer == NULL) {
+		return;
+	}
+
+	uint32_t head = buffer->head;
+	buffer->events[head & PROFILE_EVENT_MASK] = (struct ProfileEvent) {profile_now(), name};
+	//Publishes the event to profile_write_chrome_trace
+	__atomic_store_n(&buffer->head, head + 1, __ATOMIC_RELEASE);
+}
+
+void
+profile_begin(const char* name) {
+	record(name);
+}
+
+void
+profile_end(void) {
+	record(NULL);
+}
+
+void
+profile_set_thread_name(const char* name) {
+	struct ProfileBuffer* buffer = thread_buffer();
+	if (buffer != NULL) {
+		buffer->thread_name = name;
+	}
+}
+
+#define PROFILE_MAX_DEPTH 32
+
+uint32_t
+profile_thread_zones(uint64_t since, struct ProfileZone* zones, uint32_t max) {
+	struct ProfileBuffer* buffer = thread_buffer();
+	if (buffer == NULL) {
+		return 0;
+	}
+
+	//Events are in time order, so walk back to the first one after since
+	uint32_t head = buffer->head;
+	uint32_t first = head > PROFILE_EVENTS_PER_THREAD ? head - PROFILE_EVENTS_PER_THREAD : 0;
+	uint32_t start = head;
+	while (start != first && buffer->events[(start - 1) & PROFILE_EVENT_MASK].time >= since) {
+		start--;
+	}
+
+	//Open zones as indices into zones, or max when that zone did not fit
+	uint32_t open[PROFILE_MAX_DEPTH];
+	int depth = 0;
+	//Zones nested deeper than PROFILE_MAX_DEPTH, only counted
+	int hidden = 0;
+	uint32_t count = 0;
+	for (uint32_t i = start; i != head; i++) {
+		const struct ProfileEvent* event = &buffer->events[i & PROFILE_EVENT_MASK];
+		if (event->name == NULL) {
+			//Ends of zones begun before since
+			if (hidden > 0) {
+				hidden--;
+				continue;
+			}
+			if (depth == 0) {
+				continue;
+			}
+			uint32_t zone = open[--depth];
+			if (zone < max) {
+				zones[zone].duration = event->time - zones[zone].start;
+			}
+			continue;
+		}
+
+		if (depth == PROFILE_MAX_DEPTH) {
+			hidden++;
+			continue;
+		}
+		uint32_t zone = max;
+		if (count < max) {
+			zone = count++;
+			zones[zone] = (struct ProfileZone) {event->name, event->time, 0, depth};
+		}
+		open[depth++] = zone;
+	}
+
+	uint64_t now = profile_now();
+	while (depth > 0) {
+		uint32_t zone = open[--depth];
+		if (zone < max) {
+			zones[zone].duration = now - zones[zone].start;
+		}
+	}
+	return count;
+}
+
+static void
+write_string(FILE* file, const char* string) {
+	fputc('"', file);
+	for (; *string != '\0'; string++) {
+		if (*string == '"' || *string == '\\') {
+			fputc('\\', file);
+		}
+		fputc(*string, file);
+	}
+	fputc('"', file);
+}
+
+int
+profile_write_chrome_trace(const char* path) {
+	FILE* file = fopen(path, "w");
+	if (file == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return 0;
+	}
+
+	pthread_mutex_lock(&profile.mutex);
+	int buffer_count = profile.buffer_count;
+	pthread_mutex_unlock(&profile.mutex);
+
+	fprintf(file, "{\"traceEvents\":[\n");
+	const char* separator = "";
+	for (int b = 0; b < buffer_count; b++) {
+		const struct ProfileBuffer* buffer = profile.buffers[b];
+
+		if (buffer->thread_name != NULL) {
+			fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":",
+				separator, buffer->thread_id);
+			write_string(file, buffer->thread_name);
+			fprintf(file, "}}");
+			separator = ",\n";
+		}
+
+		uint32_t head = __atomic_load_n(&buffer->head, __ATOMIC_ACQUIRE);
+		uint32_t first = head > PROFILE_EVENTS_PER_THREAD ? head - PROFILE_EVENTS_PER_THREAD : 0;
+
+		//After the ring wrapped the oldest ends can lack their begins
+		int depth = 0;
+		for (uint32_t i = first; i != head; i++) {
+			const struct ProfileEvent* event = &buffer->events[i & PROFILE_EVENT_MASK];
+			if (event->name == NULL && depth == 0) {
+				continue;
+			}
+			depth += event->name != NULL ? 1 : -1;
+
+			fprintf(file, "%s{\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%llu.%03u",
+				separator, event->name != NULL ? 'B' : 'E', buffer->thread_id,
+				(unsigned long long) (event->time / 1000), (unsigned) (event->time % 1000));
+			if (event->name != NULL) {
+				fprintf(file, ",\"name\":");
+				write_string(file, event->name);
+			}
+			fprintf(file, "}");
+			separator = ",\n";
+		}
+	}
+	fprintf(file, "\n],\"displayTimeUnit\":\"ns\"}\n");
+
+	int ok = !ferror(file);
+	ok &= fclose(file) == 0;
+	if (!ok) {
+		fprintf(stderr, "Failed to write %s\n", path);
+	}
+	return ok;
+}
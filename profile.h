@@ -0,0 +1,39 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+//Nested timing zones for timeline captures. Every thread records into its
+//own ring buffer without locking, keeping the most recent
+//PROFILE_EVENTS_PER_THREAD begin and end events. name must outlive the
+//capture, string literals are the intended use.
+
+#define PROFILE_EVENTS_PER_THREAD (1 << 16)
+
+void profile_begin(const char* name);
+void profile_end(void);
+//Shown as the thread's track name in the trace viewer
+void profile_set_thread_name(const char* name);
+
+//Nanoseconds since the first profiling call
+uint64_t profile_now(void);
+
+struct ProfileZone {
+	const char* name;
+	uint64_t start;
+	uint64_t duration;
+	//0 for outermost zones
+	int depth;
+};
+
+//Zones the calling thread began at or after since that are still in its
+//buffer, in begin order. Zones still open run until now. Returns how many
+//were written, at most max.
+uint32_t profile_thread_zones(uint64_t since, struct ProfileZone* zones, uint32_t max);
+
+//Writes every buffered event as Chrome trace event JSON, which both
+//chrome://tracing and Perfetto open. Zones still being recorded on other
+//threads can come out torn, so call it while they are idle.
+int profile_write_chrome_trace(const char* path);
+
+#endif
@@ -0,0 +1,258 @@
+#include "render_queue.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "gl_state.h"
+
+#define KEY_PASS_SHIFT 60
+#define KEY_PROGRAM_SHIFT 48
+#define KEY_VAO_SHIFT 36
+#define KEY_TEXTURE_SHIFT 24
+
+#define KEY_12_BITS 0xfffu
+#define KEY_DEPTH_MAX 0xffffffu
+
+uint64_t
+render_key(enum RenderPass pass, unsigned int program, unsigned int vao,
+		unsigned int texture, float depth) {
+
+	if (depth < 0.0f) depth = 0.0f;
+	if (depth > 1.0f) depth = 1.0f;
+	uint32_t depth_bits = (uint32_t) (depth * KEY_DEPTH_MAX);
+	if (pass == RENDER_PASS_TRANSPARENT) {
+		depth_bits = KEY_DEPTH_MAX - depth_bits;
+	}
+
+	return ((uint64_t) (pass & 0xf) << KEY_PASS_SHIFT) |
+		((uint64_t) (program & KEY_12_BITS) << KEY_PROGRAM_SHIFT) |
+		((uint64_t) (vao & KEY_12_BITS) << KEY_VAO_SHIFT) |
+		((uint64_t) (texture & KEY_12_BITS) << KEY_TEXTURE_SHIFT) |
+		(uint64_t) depth_bits;
+}
+
+void
+render_queue_free(struct RenderQueue* queue) {
+	free(queue->commands);
+	free(queue->keys);
+	free(queue->keys_scratch);
+	free(queue->order);
+	free(queue->order_scratch);
+	if (queue->model_buffer != 0) {
+		glDeleteBuffers(1, &queue->model_buffer);
+		gl_state_reset();
+	}
+	*queue = (struct RenderQueue) {0};
+}
+
+void
+render_queue_reset(struct RenderQueue* queue) {
+	queue->count = 0;
+}
+
+static int
+grow(struct RenderQueue* queue) {
+	uint32_t capacity = queue->capacity ? queue->capacity * 2 : 256;
+
+	struct RenderCommand* commands = realloc(queue->commands, capacity * sizeof(*commands));
+	if (commands == NULL) return 0;
+	queue->commands = commands;
+
+	uint64_t* keys = realloc(queue->keys, capacity * sizeof(*keys));
+	if (keys == NULL) return 0;
+	queue->keys = keys;
+
+	keys = realloc(queue->keys_scratch, capacity * sizeof(*keys));
+	if (keys == NULL) return 0;
+	queue->keys_scratch = keys;
+
+	uint32_t* order = realloc(queue->order, capacity * sizeof(*order));
+	if (order == NULL) return 0;
+	queue->order = order;
+
+	order = realloc(queue->order_scratch, capacity * sizeof(*order));
+	if (order == NULL) return 0;
+	queue->order_scratch = order;
+
+	queue->capacity = capacity;
+	return 1;
+}
+
+int
+render_queue_push(struct RenderQueue* queue, struct RenderCommand command) {
+	if (queue->count == queue->capacity && !grow(queue)) {
+		return 0;
+	}
+
+	queue->commands[queue->count] = command;
+	queue->count++;
+	return 1;
+}
+
+//LSD radix sort on the keys, 8 bits per pass, permuting an index array so
+//the commands themselves are never moved
+void
+render_queue_sort(struct RenderQueue* queue) {
+	uint32_t n = queue->count;
+	uint64_t* keys = queue->keys;
+	uint64_t* keys_out = queue->keys_scratch;
+	uint32_t* order = queue->order;
+	uint32_t* order_out = queue->order_scratch;
+
+	uint32_t histogram[8][256];
+	memset(histogram, 0, sizeof(histogram));
+	for (uint32_t i = 0; i < n; i++) {
+		uint64_t key = queue->commands[i].key;
+		keys[i] = key;
+		order[i] = i;
+		for (int pass = 0; pass < 8; pass++) {
+			histogram[pass][(key >> (pass * 8)) & 0xff]++;
+		}
+	}
+
+	for (int pass = 0; pass < 8; pass++) {
+		uint32_t* counts = histogram[pass];
+		int shift = pass * 8;
+
+		//All keys share this byte, the pass would be the identity
+		if (n == 0 || counts[(keys[0] >> shift) & 0xff] == n) {
+			continue;
+		}
+
+		uint32_t offset = 0;
+		for (int bucket = 0; bucket < 256; bucket++) {
+			uint32_t count = counts[bucket];
+			counts[bucket] = offset;
+			offset += count;
+		}
+
+		for (uint32_t i = 0; i < n; i++) {
+			uint32_t destination = counts[(keys[i] >> shift) & 0xff]++;
+			keys_out[destination] = keys[i];
+			order_out[destination] = order[i];
+		}
+
+		uint64_t* keys_swap = keys;
+		keys = keys_out;
+		keys_out = keys_swap;
+
+		uint32_t* order_swap = order;
+		order = order_out;
+		order_out = order_swap;
+	}
+
+	queue->keys = keys;
+	queue->keys_scratch = keys_out;
+	queue->order = order;
+	queue->order_scratch = order_out;
+}
+
+void
+render_queue_invalidate_uploads(struct RenderQueue* queue) {
+	memset(queue->model_valid, 0, sizeof(queue->model_valid));
+}
+
+void
+render_queue_invalidate_model(struct RenderQueue* queue, uint32_t slot) {
+	if (slot < RENDER_MODEL_SLOTS) {
+		queue->model_valid[slot] = 0;
+	}
+}
+
+static void
+create_model_buffer(struct RenderQueue* queue) {
+	GLint alignment = 256;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	if (alignment < 1) {
+		alignment = 256;
+	}
+	queue->model_stride = (uint32_t) ((sizeof(Matrix4) + alignment - 1) / alignment * alignment);
+
+	glGenBuffers(1, &queue->model_buffer);
+	gl_state_bind_buffer(GL_UNIFORM_BUFFER, queue->model_buffer);
+	glBufferData(GL_UNIFORM_BUFFER, (GLsizeiptr) queue->model_stride * RENDER_MODEL_SLOTS,
+			NULL, GL_DYNAMIC_DRAW);
+	render_queue_invalidate_uploads(queue);
+}
+
+void
+render_queue_submit(struct RenderQueue* queue, struct Camera* camera) {
+	unsigned int program = 0;
+	int octahedral_location = -1;
+	int octahedral = -1;
+	int textured_location = -1;
+	int textured = -1;
+	uint32_t bound_slot = RENDER_MODEL_SLOTS;
+
+	if (queue->model_buffer == 0) {
+		create_model_buffer(queue);
+	}
+	queue->model_uploads = 0;
+	queue->model_uploads_skipped = 0;
+
+	for (uint32_t i = 0; i < queue->count; i++) {
+		struct RenderCommand* command = &queue->commands[queue->order[i]];
+
+		gl_state_use_program(command->program);
+		if (command->program != program || i == 0) {
+			program = command->program;
+			GLuint block = glGetUniformBlockIndex(program, "Model");
+			if (block != GL_INVALID_INDEX) {
+				glUniformBlockBinding(program, block, RENDER_MODEL_BINDING);
+			}
+			octahedral_location = glGetUniformLocation(program, "octahedral_normals");
+			octahedral = -1;
+			textured_location = glGetUniformLocation(program, "textured");
+			textured = -1;
+			camera_upload(camera, program);
+		}
+
+		int command_octahedral = (command->flags & RENDER_OCTAHEDRAL_NORMALS) != 0;
+		if (command_octahedral != octahedral) {
+			glUniform1i(octahedral_location, command_octahedral);
+			octahedral = command_octahedral;
+		}
+
+		gl_state_bind_vertex_array(command->vao);
+		if (command->texture != 0) {
+			gl_state_bind_texture(0, GL_TEXTURE_2D, command->texture);
+		}
+		int command_textured = command->texture != 0;
+		if (command_textured != textured) {
+			glUniform1i(textured_location, command_textured);
+			textured = command_textured;
+		}
+
+		//Slot 0 is scratch for commands without one of their own
+		uint32_t slot = command->model_slot < RENDER_MODEL_SLOTS ? command->model_slot : 0;
+		gl_state_bind_buffer(GL_UNIFORM_BUFFER, queue->model_buffer);
+		if (slot == 0 || !queue->model_valid[slot] || (command->flags & RENDER_MODEL_CHANGED)) {
+			glBufferSubData(GL_UNIFORM_BUFFER, (GLintptr) slot * queue->model_stride,
+					sizeof(Matrix4), command->model.e);
+			queue->model_valid[slot] = slot != 0;
+			queue->model_uploads++;
+		} else {
+			queue->model_uploads_skipped++;
+		}
+		if (slot != bound_slot) {
+			glBindBufferRange(GL_UNIFORM_BUFFER, RENDER_MODEL_BINDING, queue->model_buffer,
+					(GLintptr) slot * queue->model_stride, sizeof(Matrix4));
+			bound_slot = slot;
+		}
+
+		if (command->instance_count > 0) {
+			if (command->index_type == 0) {
+				glDrawArraysInstanced(command->mode, (GLint) command->first, command->count,
+						command->instance_count);
+			} else {
+				glDrawElementsInstanced(command->mode, command->count, command->index_type,
+						(const void*) command->first, command->instance_count);
+			}
+		} else if (command->index_type == 0) {
+			glDrawArrays(command->mode, (GLint) command->first, command->count);
+		} else {
+			glDrawElements(command->mode, command->count, command->index_type,
+					(const void*) command->first);
+		}
+	}
+}
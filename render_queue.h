@@ -0,0 +1,92 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <stdint.h>
+
+#include "glad/glad.h"
+#include "every_math.h"
+#include "camera.h"
+
+//Sort key, most significant first:
+//  pass 4 | program 12 | vao 12 | texture 12 | depth 24
+//Names wider than their field only lose grouping, never correctness.
+enum RenderPass {
+	RENDER_PASS_OPAQUE = 0,
+	RENDER_PASS_TRANSPARENT = 1,
+	RENDER_PASS_OVERLAY = 2
+};
+
+//RenderCommand flags
+#define RENDER_OCTAHEDRAL_NORMALS (1u << 0)
+//The model matrix changed since the command's slot was last drawn
+#define RENDER_MODEL_CHANGED (1u << 1)
+
+//Model matrices live in a uniform buffer, block "Model" at this binding,
+//one slot per object so a static object's matrix is uploaded only once
+#define RENDER_MODEL_SLOTS 4096
+#define RENDER_MODEL_BINDING 0
+
+struct RenderCommand {
+	uint64_t key;
+	unsigned int program;
+	unsigned int vao;
+	//Bound to unit 0, the program's textured uniform says whether there is one
+	unsigned int texture;
+	GLenum mode;
+	int count;
+	//0 for glDrawArrays, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT otherwise
+	GLenum index_type;
+	//First vertex, or byte offset into the index buffer
+	uintptr_t first;
+	//Instanced draw when above 0
+	int instance_count;
+	uint32_t flags;
+	//Object's slot in the model buffer, from 1. Commands with 0 upload
+	//their model every time.
+	uint32_t model_slot;
+	Matrix4 model;
+};
+
+struct RenderQueue {
+	struct RenderCommand* commands;
+	uint32_t count;
+	uint32_t capacity;
+
+	//Radix sort scratch, kept between frames
+	uint64_t* keys;
+	uint64_t* keys_scratch;
+	uint32_t* order;
+	uint32_t* order_scratch;
+
+	//Created by the first submit, slots are model_stride bytes apart to
+	//meet the uniform buffer offset alignment
+	unsigned int model_buffer;
+	uint32_t model_stride;
+	//Slot holds the current matrix, uploads are skipped for these unless
+	//the command is flagged RENDER_MODEL_CHANGED
+	uint8_t model_valid[RENDER_MODEL_SLOTS];
+
+	//Model uploads issued and skipped as unchanged by the last submit
+	uint32_t model_uploads;
+	uint32_t model_uploads_skipped;
+};
+
+//depth is the normalized view distance in [0, 1]. Opaque draws sort front
+//to back for early-z, transparent ones back to front for blending.
+uint64_t render_key(enum RenderPass pass, unsigned int program, unsigned int vao,
+		unsigned int texture, float depth);
+
+//Deletes the model buffer too, so needs the GL context once submitted
+void render_queue_free(struct RenderQueue* queue);
+void render_queue_reset(struct RenderQueue* queue);
+int render_queue_push(struct RenderQueue* queue, struct RenderCommand command);
+void render_queue_sort(struct RenderQueue* queue);
+//Issues the sorted commands, uploading the camera whenever the program changes
+void render_queue_submit(struct RenderQueue* queue, struct Camera* camera);
+//Uploads every slot again on its next draw
+void render_queue_invalidate_uploads(struct RenderQueue* queue);
+//Uploads the slot again on its next draw, for objects that moved while
+//nothing drew them
+void render_queue_invalidate_model(struct RenderQueue* queue, uint32_t slot);
+
+#endif
@@ -0,0 +1,132 @@
+#include "script.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int
+parse_action(const char* name, enum ScriptAction* action) {
+	static const struct {
+		const char* name;
+		enum ScriptAction action;
+	} actions[] = {
+		{"rotate", SCRIPT_ROTATE},
+		{"fov", SCRIPT_FOV},
+		{"spawn", SCRIPT_SPAWN},
+		{"end", SCRIPT_END}
+	};
+
+	for (size_t i = 0; i < sizeof(actions) / sizeof(actions[0]); i++) {
+		if (strcmp(name, actions[i].name) == 0) {
+			*action = actions[i].action;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int
+push_event(struct Script* script, uint32_t* capacity, struct ScriptEvent event) {
+	if (script->count == *capacity) {
+		uint32_t new_capacity = *capacity ? *capacity * 2 : 64;
+		struct ScriptEvent* events = realloc(script->events, new_capacity * sizeof(*events));
+		if (events == NULL) {
+			return 0;
+		}
+		script->events = events;
+		*capacity = new_capacity;
+	}
+	script->events[script->count++] = event;
+	return 1;
+}
+
+//Insertion sort keeps same frame events in file order, scripts are
+//written mostly in order so this is close to linear
+static void
+sort_events(struct Script* script) {
+	for (uint32_t i = 1; i < script->count; i++) {
+		struct ScriptEvent event = script->events[i];
+		uint32_t j = i;
+		while (j > 0 && script->events[j - 1].frame > event.frame) {
+			script->events[j] = script->events[j - 1];
+			j--;
+		}
+		script->events[j] = event;
+	}
+}
+
+struct Script
+script_load(const char* path) {
+	struct Script script = {0};
+
+	FILE* file = fopen(path, "r");
+	if (file == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return script;
+	}
+
+	uint32_t capacity = 0;
+	int has_end = 0;
+	int ok = 1;
+	char line[256];
+	for (int line_number = 1; ok && fgets(line, sizeof(line), file) != NULL; line_number++) {
+		char* comment = strchr(line, '#');
+		if (comment != NULL) {
+			*comment = '\0';
+		}
+
+		char name[32];
+		unsigned int frame;
+		double value = 0.0;
+		int fields;
+		if (sscanf(line, " seed %u", &script.seed) == 1) {
+			continue;
+		} else if ((fields = sscanf(line, "%u %31s %lf", &frame, name, &value)) >= 2) {
+			struct ScriptEvent event = {.frame = frame, .value = value};
+			if (!parse_action(name, &event.action) || (fields == 2) != (event.action == SCRIPT_END)) {
+				fprintf(stderr, "%s:%d: bad command\n", path, line_number);
+				ok = 0;
+			} else if (!push_event(&script, &capacity, event)) {
+				fprintf(stderr, "Out of memory for %s\n", path);
+				ok = 0;
+			} else if (event.action == SCRIPT_END && (!has_end || frame < script.frame_count)) {
+				script.frame_count = frame;
+				has_end = 1;
+			}
+		} else if (strspn(line, " \t\r\n") != strlen(line)) {
+			fprintf(stderr, "%s:%d: bad command\n", path, line_number);
+			ok = 0;
+		}
+	}
+	fclose(file);
+
+	if (ok && !has_end) {
+		fprintf(stderr, "%s: no end command\n", path);
+		ok = 0;
+	}
+	if (!ok) {
+		script_free(&script);
+		return script;
+	}
+
+	sort_events(&script);
+	return script;
+}
+
+void
+script_free(struct Script* script) {
+	free(script->events);
+	*script = (struct Script) {0};
+}
+
+const struct ScriptEvent*
+script_next(struct Script* script, uint32_t frame) {
+	//Skips anything left over from earlier frames
+	while (script->next < script->count && script->events[script->next].frame < frame) {
+		script->next++;
+	}
+	if (script->next < script->count && script->events[script->next].frame == frame) {
+		return &script->events[script->next++];
+	}
+	return NULL;
+}
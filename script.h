@@ -0,0 +1,52 @@
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include <stdint.h>
+
+//Benchmark timelines, replayed in place of live input so runs are
+//comparable across commits. A script is a text file, one command per line,
+//'#' starts a comment:
+//
+//  seed <n>              seeds rand() before the first frame
+//  <frame> rotate <deg>  turns the scene by deg every frame from here on,
+//                        like holding the arrow keys, 0 stops
+//  <frame> fov <deg>     same for the field of view
+//  <frame> spawn <n>     emits a burst of n particles
+//  <frame> end           the run stops before this frame
+//
+//Commands on the same frame apply in file order.
+
+enum ScriptAction {
+	SCRIPT_ROTATE,
+	SCRIPT_FOV,
+	SCRIPT_SPAWN,
+	SCRIPT_END
+};
+
+struct ScriptEvent {
+	uint32_t frame;
+	enum ScriptAction action;
+	double value;
+};
+
+struct Script {
+	//Sorted by frame
+	struct ScriptEvent* events;
+	uint32_t count;
+	//Next event to hand out
+	uint32_t next;
+	//Frames to run, from the end command
+	uint32_t frame_count;
+	unsigned int seed;
+};
+
+//Returns a zeroed struct if the file can not be read or has errors, a
+//script without an end command is an error
+struct Script script_load(const char* path);
+void script_free(struct Script* script);
+
+//Hands out the events of frame one by one, NULL once there are no more.
+//Frames must be asked for in increasing order.
+const struct ScriptEvent* script_next(struct Script* script, uint32_t frame);
+
+#endif
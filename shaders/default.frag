@@ -1,10 +1,15 @@
 #version 330 core
 
+in vec2 uv;
+
+uniform sampler2D albedo;
+uniform bool textured;
+
 out vec4 FragColor;
 
 void
 main() {
 
-	FragColor = vec4(1.0f, 2.0f, 0.2f, 1.0f);
+	FragColor = textured ? texture(albedo, uv) : vec4(1.0f, 2.0f, 0.2f, 1.0f);
 
 }
@@ -1,12 +1,30 @@
 #version 330 core
 
 layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec4 aNormal;
+layout (location = 2) in vec2 aUV;
 
-uniform mat4 model;
+//One slot of the render queue's model buffer, rows as stored on the CPU
+layout (std140, row_major) uniform Model {
+	mat4 model;
+};
 uniform mat4 projection;
+uniform bool octahedral_normals;
+
+out vec3 normal;
+out vec2 uv;
+
+vec3
+octahedral_decode(vec2 e) {
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+	return normalize(n);
+}
 
 void
 main() {
+	normal = octahedral_normals ? octahedral_decode(aNormal.xy) : aNormal.xyz;
+	uv = aUV;
 	gl_Position = projection * model * vec4(aPos, 1.0);
 }
-
@@ -0,0 +1,12 @@
+#version 330 core
+
+in float life;
+
+out vec4 FragColor;
+
+void
+main() {
+
+	FragColor = vec4(1.0f, 0.5f * clamp(life, 0.0f, 1.0f), 0.1f, 1.0f);
+
+}
@@ -0,0 +1,21 @@
+#version 330 core
+
+layout (location = 0) in vec2 aCorner;
+layout (location = 1) in vec4 aInstance;
+
+//One slot of the render queue's model buffer, rows as stored on the CPU
+layout (std140, row_major) uniform Model {
+	mat4 model;
+};
+uniform mat4 projection;
+
+out float life;
+
+void
+main() {
+	life = aInstance.w;
+	//Camera facing quad, shrinking as the particle runs out of life
+	vec4 center = model * vec4(aInstance.xyz, 1.0);
+	float size = 0.01 * clamp(life, 0.25, 1.0);
+	gl_Position = projection * (center + vec4(aCorner * size, 0.0, 0.0));
+}
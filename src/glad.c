@@ -165,96 +165,149 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* Extension names live in one allocation: an open addressing table of
+ * offsets into a string pool that follows it. Slots hold offset + 1, 0 is
+ * empty, and the table is kept at most half full. */
+struct ext_table {
+    unsigned int mask;
+    unsigned int *slots;
+    char *names;
+};
+
+static struct ext_table exts_table = { 0, NULL, NULL };
+
+static unsigned int ext_hash(const char *name, size_t len) {
+    /* FNV-1a */
+    unsigned int hash = 2166136261u;
+    size_t index;
+    for(index = 0; index < len; index++) {
+        hash = (hash ^ (unsigned char)name[index]) * 16777619u;
+    }
+    return hash;
+}
+
+static void free_exts(void) {
+    free(exts_table.slots);
+    exts_table.slots = NULL;
+    exts_table.names = NULL;
+    exts_table.mask = 0;
+}
+
+static void insert_ext(size_t offset, size_t len) {
+    unsigned int slot = ext_hash(exts_table.names + offset, len) & exts_table.mask;
+    while(exts_table.slots[slot] != 0) {
+        slot = (slot + 1) & exts_table.mask;
+    }
+    exts_table.slots[slot] = (unsigned int)offset + 1;
+}
+
+/* count names with total_len bytes, not counting terminators */
+static int alloc_exts(size_t count, size_t total_len) {
+    size_t slot_count = 16;
+    while(slot_count < count * 2) {
+        slot_count *= 2;
+    }
+
+    exts_table.slots = (unsigned int *)calloc(1, slot_count * sizeof(unsigned int) + total_len + count);
+    if(exts_table.slots == NULL) {
+        return 0;
+    }
+    exts_table.mask = (unsigned int)(slot_count - 1);
+    exts_table.names = (char *)(exts_table.slots + slot_count);
+    return 1;
+}
 
 static int get_exts(void) {
+    size_t count = 0;
+    size_t total_len = 0;
+    size_t offset = 0;
+
+    free_exts();
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *cursor;
+        if(exts == NULL) {
+            return 0;
+        }
+
+        for(cursor = exts; *cursor != '\0'; cursor++) {
+            if(*cursor != ' ' && (cursor == exts || cursor[-1] == ' ')) {
+                count++;
+            }
+        }
+        if(!alloc_exts(count, strlen(exts))) {
+            return 0;
+        }
+
+        cursor = exts;
+        while(*cursor != '\0') {
+            size_t len;
+            while(*cursor == ' ') cursor++;
+            len = strcspn(cursor, " ");
+            if(len == 0) break;
+
+            memcpy(exts_table.names + offset, cursor, len);
+            insert_ext(offset, len);
+            offset += len + 1;
+            cursor += len;
+        }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
+        int num_exts_i = 0;
         unsigned int index;
 
-        num_exts_i = 0;
         glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
+        if(num_exts_i < 0) {
+            num_exts_i = 0;
         }
 
-        if (exts_i == NULL) {
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            if(gl_str_tmp != NULL) {
+                total_len += strlen(gl_str_tmp);
+            }
+        }
+        if(!alloc_exts((size_t)num_exts_i, total_len)) {
             return 0;
         }
 
         for(index = 0; index < (unsigned)num_exts_i; index++) {
             const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+            size_t len;
+            if(gl_str_tmp == NULL) continue;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+            len = strlen(gl_str_tmp);
+            memcpy(exts_table.names + offset, gl_str_tmp, len);
+            insert_ext(offset, len);
+            offset += len + 1;
         }
     }
 #endif
     return 1;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
-    }
-}
-
 static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+    unsigned int slot;
+    if(exts_table.slots == NULL || ext == NULL) {
+        return 0;
+    }
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
+    slot = ext_hash(ext, strlen(ext)) & exts_table.mask;
+    while(exts_table.slots[slot] != 0) {
+        if(strcmp(exts_table.names + exts_table.slots[slot] - 1, ext) == 0) {
+            return 1;
         }
+        slot = (slot + 1) & exts_table.mask;
     }
-#endif
-
     return 0;
 }
+
+int gladHasExtension(const char *ext) {
+    return has_ext(ext);
+}
+
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -1755,9 +1808,9 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
 static int find_extensionsGL(void) {
+	/* The table is kept for gladHasExtension, and replaced on the next load */
 	if (!get_exts()) return 0;
 	(void)&has_ext;
-	free_exts();
 	return 1;
 }
 
@@ -1815,26 +1868,8112 @@ static void find_coreGL(void) {
 	}
 }
 
-int gladLoadGLLoader(GLADloadproc load) {
-	GLVersion.major = 0; GLVersion.minor = 0;
-	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	if(glGetString == NULL) return 0;
-	if(glGetString(GL_VERSION) == NULL) return 0;
-	find_coreGL();
-	load_GL_VERSION_1_0(load);
-	load_GL_VERSION_1_1(load);
-	load_GL_VERSION_1_2(load);
-	load_GL_VERSION_1_3(load);
-	load_GL_VERSION_1_4(load);
-	load_GL_VERSION_1_5(load);
-	load_GL_VERSION_2_0(load);
-	load_GL_VERSION_2_1(load);
-	load_GL_VERSION_3_0(load);
-	load_GL_VERSION_3_1(load);
-	load_GL_VERSION_3_2(load);
-	load_GL_VERSION_3_3(load);
+/* Lazy loading: every entry point starts out as a trampoline that resolves
+ * the real function on its first call and patches the pointer, so startup
+ * only pays for the functions the program actually uses. */
+static GLADloadproc lazy_load = NULL;
 
-	if (!find_extensionsGL()) return 0;
-	return GLVersion.major != 0 || GLVersion.minor != 0;
+static void* lazy_resolve(const char *name) {
+    void* proc = lazy_load != NULL ? lazy_load(name) : NULL;
+    if(proc == NULL) {
+        fprintf(stderr, "glad: %s is unavailable\n", name);
+        abort();
+    }
+    return proc;
 }
 
+static void APIENTRY lazy_glCullFace(GLenum mode) {
+	glad_glCullFace = (PFNGLCULLFACEPROC)lazy_resolve("glCullFace");
+	glad_glCullFace(mode);
+}
+static void APIENTRY lazy_glFrontFace(GLenum mode) {
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)lazy_resolve("glFrontFace");
+	glad_glFrontFace(mode);
+}
+static void APIENTRY lazy_glHint(GLenum target, GLenum mode) {
+	glad_glHint = (PFNGLHINTPROC)lazy_resolve("glHint");
+	glad_glHint(target, mode);
+}
+static void APIENTRY lazy_glLineWidth(GLfloat width) {
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)lazy_resolve("glLineWidth");
+	glad_glLineWidth(width);
+}
+static void APIENTRY lazy_glPointSize(GLfloat size) {
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)lazy_resolve("glPointSize");
+	glad_glPointSize(size);
+}
+static void APIENTRY lazy_glPolygonMode(GLenum face, GLenum mode) {
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)lazy_resolve("glPolygonMode");
+	glad_glPolygonMode(face, mode);
+}
+static void APIENTRY lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissor = (PFNGLSCISSORPROC)lazy_resolve("glScissor");
+	glad_glScissor(x, y, width, height);
+}
+static void APIENTRY lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)lazy_resolve("glTexParameterf");
+	glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)lazy_resolve("glTexParameterfv");
+	glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)lazy_resolve("glTexParameteri");
+	glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)lazy_resolve("glTexParameteriv");
+	glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)lazy_resolve("glTexImage1D");
+	glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)lazy_resolve("glTexImage2D");
+	glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY lazy_glDrawBuffer(GLenum buf) {
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)lazy_resolve("glDrawBuffer");
+	glad_glDrawBuffer(buf);
+}
+static void APIENTRY lazy_glClear(GLbitfield mask) {
+	glad_glClear = (PFNGLCLEARPROC)lazy_resolve("glClear");
+	glad_glClear(mask);
+}
+static void APIENTRY lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)lazy_resolve("glClearColor");
+	glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearStencil(GLint s) {
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)lazy_resolve("glClearStencil");
+	glad_glClearStencil(s);
+}
+static void APIENTRY lazy_glClearDepth(GLdouble depth) {
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)lazy_resolve("glClearDepth");
+	glad_glClearDepth(depth);
+}
+static void APIENTRY lazy_glStencilMask(GLuint mask) {
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)lazy_resolve("glStencilMask");
+	glad_glStencilMask(mask);
+}
+static void APIENTRY lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glColorMask = (PFNGLCOLORMASKPROC)lazy_resolve("glColorMask");
+	glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glDepthMask(GLboolean flag) {
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)lazy_resolve("glDepthMask");
+	glad_glDepthMask(flag);
+}
+static void APIENTRY lazy_glDisable(GLenum cap) {
+	glad_glDisable = (PFNGLDISABLEPROC)lazy_resolve("glDisable");
+	glad_glDisable(cap);
+}
+static void APIENTRY lazy_glEnable(GLenum cap) {
+	glad_glEnable = (PFNGLENABLEPROC)lazy_resolve("glEnable");
+	glad_glEnable(cap);
+}
+static void APIENTRY lazy_glFinish(void) {
+	glad_glFinish = (PFNGLFINISHPROC)lazy_resolve("glFinish");
+	glad_glFinish();
+}
+static void APIENTRY lazy_glFlush(void) {
+	glad_glFlush = (PFNGLFLUSHPROC)lazy_resolve("glFlush");
+	glad_glFlush();
+}
+static void APIENTRY lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)lazy_resolve("glBlendFunc");
+	glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY lazy_glLogicOp(GLenum opcode) {
+	glad_glLogicOp = (PFNGLLOGICOPPROC)lazy_resolve("glLogicOp");
+	glad_glLogicOp(opcode);
+}
+static void APIENTRY lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)lazy_resolve("glStencilFunc");
+	glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)lazy_resolve("glStencilOp");
+	glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY lazy_glDepthFunc(GLenum func) {
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)lazy_resolve("glDepthFunc");
+	glad_glDepthFunc(func);
+}
+static void APIENTRY lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)lazy_resolve("glPixelStoref");
+	glad_glPixelStoref(pname, param);
+}
+static void APIENTRY lazy_glPixelStorei(GLenum pname, GLint param) {
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)lazy_resolve("glPixelStorei");
+	glad_glPixelStorei(pname, param);
+}
+static void APIENTRY lazy_glReadBuffer(GLenum src) {
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)lazy_resolve("glReadBuffer");
+	glad_glReadBuffer(src);
+}
+static void APIENTRY lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)lazy_resolve("glReadPixels");
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)lazy_resolve("glGetBooleanv");
+	glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)lazy_resolve("glGetDoublev");
+	glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY lazy_glGetError(void) {
+	glad_glGetError = (PFNGLGETERRORPROC)lazy_resolve("glGetError");
+	return glad_glGetError();
+}
+static void APIENTRY lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)lazy_resolve("glGetFloatv");
+	glad_glGetFloatv(pname, data);
+}
+static void APIENTRY lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)lazy_resolve("glGetIntegerv");
+	glad_glGetIntegerv(pname, data);
+}
+static void APIENTRY lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)lazy_resolve("glGetTexImage");
+	glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)lazy_resolve("glGetTexParameterfv");
+	glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)lazy_resolve("glGetTexParameteriv");
+	glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)lazy_resolve("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)lazy_resolve("glGetTexLevelParameteriv");
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsEnabled(GLenum cap) {
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)lazy_resolve("glIsEnabled");
+	return glad_glIsEnabled(cap);
+}
+static void APIENTRY lazy_glDepthRange(GLdouble n, GLdouble f) {
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)lazy_resolve("glDepthRange");
+	glad_glDepthRange(n, f);
+}
+static void APIENTRY lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glViewport = (PFNGLVIEWPORTPROC)lazy_resolve("glViewport");
+	glad_glViewport(x, y, width, height);
+}
+static void APIENTRY lazy_glNewList(GLuint list, GLenum mode) {
+	glad_glNewList = (PFNGLNEWLISTPROC)lazy_resolve("glNewList");
+	glad_glNewList(list, mode);
+}
+static void APIENTRY lazy_glEndList(void) {
+	glad_glEndList = (PFNGLENDLISTPROC)lazy_resolve("glEndList");
+	glad_glEndList();
+}
+static void APIENTRY lazy_glCallList(GLuint list) {
+	glad_glCallList = (PFNGLCALLLISTPROC)lazy_resolve("glCallList");
+	glad_glCallList(list);
+}
+static void APIENTRY lazy_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	glad_glCallLists = (PFNGLCALLLISTSPROC)lazy_resolve("glCallLists");
+	glad_glCallLists(n, type, lists);
+}
+static void APIENTRY lazy_glDeleteLists(GLuint list, GLsizei range) {
+	glad_glDeleteLists = (PFNGLDELETELISTSPROC)lazy_resolve("glDeleteLists");
+	glad_glDeleteLists(list, range);
+}
+static GLuint APIENTRY lazy_glGenLists(GLsizei range) {
+	glad_glGenLists = (PFNGLGENLISTSPROC)lazy_resolve("glGenLists");
+	return glad_glGenLists(range);
+}
+static void APIENTRY lazy_glListBase(GLuint base) {
+	glad_glListBase = (PFNGLLISTBASEPROC)lazy_resolve("glListBase");
+	glad_glListBase(base);
+}
+static void APIENTRY lazy_glBegin(GLenum mode) {
+	glad_glBegin = (PFNGLBEGINPROC)lazy_resolve("glBegin");
+	glad_glBegin(mode);
+}
+static void APIENTRY lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	glad_glBitmap = (PFNGLBITMAPPROC)lazy_resolve("glBitmap");
+	glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glColor3b = (PFNGLCOLOR3BPROC)lazy_resolve("glColor3b");
+	glad_glColor3b(red, green, blue);
+}
+static void APIENTRY lazy_glColor3bv(const GLbyte *v) {
+	glad_glColor3bv = (PFNGLCOLOR3BVPROC)lazy_resolve("glColor3bv");
+	glad_glColor3bv(v);
+}
+static void APIENTRY lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glColor3d = (PFNGLCOLOR3DPROC)lazy_resolve("glColor3d");
+	glad_glColor3d(red, green, blue);
+}
+static void APIENTRY lazy_glColor3dv(const GLdouble *v) {
+	glad_glColor3dv = (PFNGLCOLOR3DVPROC)lazy_resolve("glColor3dv");
+	glad_glColor3dv(v);
+}
+static void APIENTRY lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glColor3f = (PFNGLCOLOR3FPROC)lazy_resolve("glColor3f");
+	glad_glColor3f(red, green, blue);
+}
+static void APIENTRY lazy_glColor3fv(const GLfloat *v) {
+	glad_glColor3fv = (PFNGLCOLOR3FVPROC)lazy_resolve("glColor3fv");
+	glad_glColor3fv(v);
+}
+static void APIENTRY lazy_glColor3i(GLint red, GLint green, GLint blue) {
+	glad_glColor3i = (PFNGLCOLOR3IPROC)lazy_resolve("glColor3i");
+	glad_glColor3i(red, green, blue);
+}
+static void APIENTRY lazy_glColor3iv(const GLint *v) {
+	glad_glColor3iv = (PFNGLCOLOR3IVPROC)lazy_resolve("glColor3iv");
+	glad_glColor3iv(v);
+}
+static void APIENTRY lazy_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glColor3s = (PFNGLCOLOR3SPROC)lazy_resolve("glColor3s");
+	glad_glColor3s(red, green, blue);
+}
+static void APIENTRY lazy_glColor3sv(const GLshort *v) {
+	glad_glColor3sv = (PFNGLCOLOR3SVPROC)lazy_resolve("glColor3sv");
+	glad_glColor3sv(v);
+}
+static void APIENTRY lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glColor3ub = (PFNGLCOLOR3UBPROC)lazy_resolve("glColor3ub");
+	glad_glColor3ub(red, green, blue);
+}
+static void APIENTRY lazy_glColor3ubv(const GLubyte *v) {
+	glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)lazy_resolve("glColor3ubv");
+	glad_glColor3ubv(v);
+}
+static void APIENTRY lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glColor3ui = (PFNGLCOLOR3UIPROC)lazy_resolve("glColor3ui");
+	glad_glColor3ui(red, green, blue);
+}
+static void APIENTRY lazy_glColor3uiv(const GLuint *v) {
+	glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)lazy_resolve("glColor3uiv");
+	glad_glColor3uiv(v);
+}
+static void APIENTRY lazy_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glColor3us = (PFNGLCOLOR3USPROC)lazy_resolve("glColor3us");
+	glad_glColor3us(red, green, blue);
+}
+static void APIENTRY lazy_glColor3usv(const GLushort *v) {
+	glad_glColor3usv = (PFNGLCOLOR3USVPROC)lazy_resolve("glColor3usv");
+	glad_glColor3usv(v);
+}
+static void APIENTRY lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	glad_glColor4b = (PFNGLCOLOR4BPROC)lazy_resolve("glColor4b");
+	glad_glColor4b(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4bv(const GLbyte *v) {
+	glad_glColor4bv = (PFNGLCOLOR4BVPROC)lazy_resolve("glColor4bv");
+	glad_glColor4bv(v);
+}
+static void APIENTRY lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	glad_glColor4d = (PFNGLCOLOR4DPROC)lazy_resolve("glColor4d");
+	glad_glColor4d(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4dv(const GLdouble *v) {
+	glad_glColor4dv = (PFNGLCOLOR4DVPROC)lazy_resolve("glColor4dv");
+	glad_glColor4dv(v);
+}
+static void APIENTRY lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glColor4f = (PFNGLCOLOR4FPROC)lazy_resolve("glColor4f");
+	glad_glColor4f(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4fv(const GLfloat *v) {
+	glad_glColor4fv = (PFNGLCOLOR4FVPROC)lazy_resolve("glColor4fv");
+	glad_glColor4fv(v);
+}
+static void APIENTRY lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	glad_glColor4i = (PFNGLCOLOR4IPROC)lazy_resolve("glColor4i");
+	glad_glColor4i(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4iv(const GLint *v) {
+	glad_glColor4iv = (PFNGLCOLOR4IVPROC)lazy_resolve("glColor4iv");
+	glad_glColor4iv(v);
+}
+static void APIENTRY lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	glad_glColor4s = (PFNGLCOLOR4SPROC)lazy_resolve("glColor4s");
+	glad_glColor4s(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4sv(const GLshort *v) {
+	glad_glColor4sv = (PFNGLCOLOR4SVPROC)lazy_resolve("glColor4sv");
+	glad_glColor4sv(v);
+}
+static void APIENTRY lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	glad_glColor4ub = (PFNGLCOLOR4UBPROC)lazy_resolve("glColor4ub");
+	glad_glColor4ub(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4ubv(const GLubyte *v) {
+	glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)lazy_resolve("glColor4ubv");
+	glad_glColor4ubv(v);
+}
+static void APIENTRY lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	glad_glColor4ui = (PFNGLCOLOR4UIPROC)lazy_resolve("glColor4ui");
+	glad_glColor4ui(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4uiv(const GLuint *v) {
+	glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)lazy_resolve("glColor4uiv");
+	glad_glColor4uiv(v);
+}
+static void APIENTRY lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	glad_glColor4us = (PFNGLCOLOR4USPROC)lazy_resolve("glColor4us");
+	glad_glColor4us(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4usv(const GLushort *v) {
+	glad_glColor4usv = (PFNGLCOLOR4USVPROC)lazy_resolve("glColor4usv");
+	glad_glColor4usv(v);
+}
+static void APIENTRY lazy_glEdgeFlag(GLboolean flag) {
+	glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)lazy_resolve("glEdgeFlag");
+	glad_glEdgeFlag(flag);
+}
+static void APIENTRY lazy_glEdgeFlagv(const GLboolean *flag) {
+	glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)lazy_resolve("glEdgeFlagv");
+	glad_glEdgeFlagv(flag);
+}
+static void APIENTRY lazy_glEnd(void) {
+	glad_glEnd = (PFNGLENDPROC)lazy_resolve("glEnd");
+	glad_glEnd();
+}
+static void APIENTRY lazy_glIndexd(GLdouble c) {
+	glad_glIndexd = (PFNGLINDEXDPROC)lazy_resolve("glIndexd");
+	glad_glIndexd(c);
+}
+static void APIENTRY lazy_glIndexdv(const GLdouble *c) {
+	glad_glIndexdv = (PFNGLINDEXDVPROC)lazy_resolve("glIndexdv");
+	glad_glIndexdv(c);
+}
+static void APIENTRY lazy_glIndexf(GLfloat c) {
+	glad_glIndexf = (PFNGLINDEXFPROC)lazy_resolve("glIndexf");
+	glad_glIndexf(c);
+}
+static void APIENTRY lazy_glIndexfv(const GLfloat *c) {
+	glad_glIndexfv = (PFNGLINDEXFVPROC)lazy_resolve("glIndexfv");
+	glad_glIndexfv(c);
+}
+static void APIENTRY lazy_glIndexi(GLint c) {
+	glad_glIndexi = (PFNGLINDEXIPROC)lazy_resolve("glIndexi");
+	glad_glIndexi(c);
+}
+static void APIENTRY lazy_glIndexiv(const GLint *c) {
+	glad_glIndexiv = (PFNGLINDEXIVPROC)lazy_resolve("glIndexiv");
+	glad_glIndexiv(c);
+}
+static void APIENTRY lazy_glIndexs(GLshort c) {
+	glad_glIndexs = (PFNGLINDEXSPROC)lazy_resolve("glIndexs");
+	glad_glIndexs(c);
+}
+static void APIENTRY lazy_glIndexsv(const GLshort *c) {
+	glad_glIndexsv = (PFNGLINDEXSVPROC)lazy_resolve("glIndexsv");
+	glad_glIndexsv(c);
+}
+static void APIENTRY lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	glad_glNormal3b = (PFNGLNORMAL3BPROC)lazy_resolve("glNormal3b");
+	glad_glNormal3b(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3bv(const GLbyte *v) {
+	glad_glNormal3bv = (PFNGLNORMAL3BVPROC)lazy_resolve("glNormal3bv");
+	glad_glNormal3bv(v);
+}
+static void APIENTRY lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	glad_glNormal3d = (PFNGLNORMAL3DPROC)lazy_resolve("glNormal3d");
+	glad_glNormal3d(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3dv(const GLdouble *v) {
+	glad_glNormal3dv = (PFNGLNORMAL3DVPROC)lazy_resolve("glNormal3dv");
+	glad_glNormal3dv(v);
+}
+static void APIENTRY lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	glad_glNormal3f = (PFNGLNORMAL3FPROC)lazy_resolve("glNormal3f");
+	glad_glNormal3f(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3fv(const GLfloat *v) {
+	glad_glNormal3fv = (PFNGLNORMAL3FVPROC)lazy_resolve("glNormal3fv");
+	glad_glNormal3fv(v);
+}
+static void APIENTRY lazy_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	glad_glNormal3i = (PFNGLNORMAL3IPROC)lazy_resolve("glNormal3i");
+	glad_glNormal3i(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3iv(const GLint *v) {
+	glad_glNormal3iv = (PFNGLNORMAL3IVPROC)lazy_resolve("glNormal3iv");
+	glad_glNormal3iv(v);
+}
+static void APIENTRY lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	glad_glNormal3s = (PFNGLNORMAL3SPROC)lazy_resolve("glNormal3s");
+	glad_glNormal3s(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3sv(const GLshort *v) {
+	glad_glNormal3sv = (PFNGLNORMAL3SVPROC)lazy_resolve("glNormal3sv");
+	glad_glNormal3sv(v);
+}
+static void APIENTRY lazy_glRasterPos2d(GLdouble x, GLdouble y) {
+	glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)lazy_resolve("glRasterPos2d");
+	glad_glRasterPos2d(x, y);
+}
+static void APIENTRY lazy_glRasterPos2dv(const GLdouble *v) {
+	glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)lazy_resolve("glRasterPos2dv");
+	glad_glRasterPos2dv(v);
+}
+static void APIENTRY lazy_glRasterPos2f(GLfloat x, GLfloat y) {
+	glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)lazy_resolve("glRasterPos2f");
+	glad_glRasterPos2f(x, y);
+}
+static void APIENTRY lazy_glRasterPos2fv(const GLfloat *v) {
+	glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)lazy_resolve("glRasterPos2fv");
+	glad_glRasterPos2fv(v);
+}
+static void APIENTRY lazy_glRasterPos2i(GLint x, GLint y) {
+	glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)lazy_resolve("glRasterPos2i");
+	glad_glRasterPos2i(x, y);
+}
+static void APIENTRY lazy_glRasterPos2iv(const GLint *v) {
+	glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)lazy_resolve("glRasterPos2iv");
+	glad_glRasterPos2iv(v);
+}
+static void APIENTRY lazy_glRasterPos2s(GLshort x, GLshort y) {
+	glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)lazy_resolve("glRasterPos2s");
+	glad_glRasterPos2s(x, y);
+}
+static void APIENTRY lazy_glRasterPos2sv(const GLshort *v) {
+	glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)lazy_resolve("glRasterPos2sv");
+	glad_glRasterPos2sv(v);
+}
+static void APIENTRY lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)lazy_resolve("glRasterPos3d");
+	glad_glRasterPos3d(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3dv(const GLdouble *v) {
+	glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)lazy_resolve("glRasterPos3dv");
+	glad_glRasterPos3dv(v);
+}
+static void APIENTRY lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)lazy_resolve("glRasterPos3f");
+	glad_glRasterPos3f(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3fv(const GLfloat *v) {
+	glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)lazy_resolve("glRasterPos3fv");
+	glad_glRasterPos3fv(v);
+}
+static void APIENTRY lazy_glRasterPos3i(GLint x, GLint y, GLint z) {
+	glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)lazy_resolve("glRasterPos3i");
+	glad_glRasterPos3i(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3iv(const GLint *v) {
+	glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)lazy_resolve("glRasterPos3iv");
+	glad_glRasterPos3iv(v);
+}
+static void APIENTRY lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)lazy_resolve("glRasterPos3s");
+	glad_glRasterPos3s(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3sv(const GLshort *v) {
+	glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)lazy_resolve("glRasterPos3sv");
+	glad_glRasterPos3sv(v);
+}
+static void APIENTRY lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)lazy_resolve("glRasterPos4d");
+	glad_glRasterPos4d(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4dv(const GLdouble *v) {
+	glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)lazy_resolve("glRasterPos4dv");
+	glad_glRasterPos4dv(v);
+}
+static void APIENTRY lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)lazy_resolve("glRasterPos4f");
+	glad_glRasterPos4f(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4fv(const GLfloat *v) {
+	glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)lazy_resolve("glRasterPos4fv");
+	glad_glRasterPos4fv(v);
+}
+static void APIENTRY lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)lazy_resolve("glRasterPos4i");
+	glad_glRasterPos4i(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4iv(const GLint *v) {
+	glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)lazy_resolve("glRasterPos4iv");
+	glad_glRasterPos4iv(v);
+}
+static void APIENTRY lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)lazy_resolve("glRasterPos4s");
+	glad_glRasterPos4s(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4sv(const GLshort *v) {
+	glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)lazy_resolve("glRasterPos4sv");
+	glad_glRasterPos4sv(v);
+}
+static void APIENTRY lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	glad_glRectd = (PFNGLRECTDPROC)lazy_resolve("glRectd");
+	glad_glRectd(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	glad_glRectdv = (PFNGLRECTDVPROC)lazy_resolve("glRectdv");
+	glad_glRectdv(v1, v2);
+}
+static void APIENTRY lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	glad_glRectf = (PFNGLRECTFPROC)lazy_resolve("glRectf");
+	glad_glRectf(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	glad_glRectfv = (PFNGLRECTFVPROC)lazy_resolve("glRectfv");
+	glad_glRectfv(v1, v2);
+}
+static void APIENTRY lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	glad_glRecti = (PFNGLRECTIPROC)lazy_resolve("glRecti");
+	glad_glRecti(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectiv(const GLint *v1, const GLint *v2) {
+	glad_glRectiv = (PFNGLRECTIVPROC)lazy_resolve("glRectiv");
+	glad_glRectiv(v1, v2);
+}
+static void APIENTRY lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	glad_glRects = (PFNGLRECTSPROC)lazy_resolve("glRects");
+	glad_glRects(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectsv(const GLshort *v1, const GLshort *v2) {
+	glad_glRectsv = (PFNGLRECTSVPROC)lazy_resolve("glRectsv");
+	glad_glRectsv(v1, v2);
+}
+static void APIENTRY lazy_glTexCoord1d(GLdouble s) {
+	glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)lazy_resolve("glTexCoord1d");
+	glad_glTexCoord1d(s);
+}
+static void APIENTRY lazy_glTexCoord1dv(const GLdouble *v) {
+	glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)lazy_resolve("glTexCoord1dv");
+	glad_glTexCoord1dv(v);
+}
+static void APIENTRY lazy_glTexCoord1f(GLfloat s) {
+	glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)lazy_resolve("glTexCoord1f");
+	glad_glTexCoord1f(s);
+}
+static void APIENTRY lazy_glTexCoord1fv(const GLfloat *v) {
+	glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)lazy_resolve("glTexCoord1fv");
+	glad_glTexCoord1fv(v);
+}
+static void APIENTRY lazy_glTexCoord1i(GLint s) {
+	glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)lazy_resolve("glTexCoord1i");
+	glad_glTexCoord1i(s);
+}
+static void APIENTRY lazy_glTexCoord1iv(const GLint *v) {
+	glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)lazy_resolve("glTexCoord1iv");
+	glad_glTexCoord1iv(v);
+}
+static void APIENTRY lazy_glTexCoord1s(GLshort s) {
+	glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)lazy_resolve("glTexCoord1s");
+	glad_glTexCoord1s(s);
+}
+static void APIENTRY lazy_glTexCoord1sv(const GLshort *v) {
+	glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)lazy_resolve("glTexCoord1sv");
+	glad_glTexCoord1sv(v);
+}
+static void APIENTRY lazy_glTexCoord2d(GLdouble s, GLdouble t) {
+	glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)lazy_resolve("glTexCoord2d");
+	glad_glTexCoord2d(s, t);
+}
+static void APIENTRY lazy_glTexCoord2dv(const GLdouble *v) {
+	glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)lazy_resolve("glTexCoord2dv");
+	glad_glTexCoord2dv(v);
+}
+static void APIENTRY lazy_glTexCoord2f(GLfloat s, GLfloat t) {
+	glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)lazy_resolve("glTexCoord2f");
+	glad_glTexCoord2f(s, t);
+}
+static void APIENTRY lazy_glTexCoord2fv(const GLfloat *v) {
+	glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)lazy_resolve("glTexCoord2fv");
+	glad_glTexCoord2fv(v);
+}
+static void APIENTRY lazy_glTexCoord2i(GLint s, GLint t) {
+	glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)lazy_resolve("glTexCoord2i");
+	glad_glTexCoord2i(s, t);
+}
+static void APIENTRY lazy_glTexCoord2iv(const GLint *v) {
+	glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)lazy_resolve("glTexCoord2iv");
+	glad_glTexCoord2iv(v);
+}
+static void APIENTRY lazy_glTexCoord2s(GLshort s, GLshort t) {
+	glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)lazy_resolve("glTexCoord2s");
+	glad_glTexCoord2s(s, t);
+}
+static void APIENTRY lazy_glTexCoord2sv(const GLshort *v) {
+	glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)lazy_resolve("glTexCoord2sv");
+	glad_glTexCoord2sv(v);
+}
+static void APIENTRY lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)lazy_resolve("glTexCoord3d");
+	glad_glTexCoord3d(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3dv(const GLdouble *v) {
+	glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)lazy_resolve("glTexCoord3dv");
+	glad_glTexCoord3dv(v);
+}
+static void APIENTRY lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)lazy_resolve("glTexCoord3f");
+	glad_glTexCoord3f(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3fv(const GLfloat *v) {
+	glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)lazy_resolve("glTexCoord3fv");
+	glad_glTexCoord3fv(v);
+}
+static void APIENTRY lazy_glTexCoord3i(GLint s, GLint t, GLint r) {
+	glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)lazy_resolve("glTexCoord3i");
+	glad_glTexCoord3i(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3iv(const GLint *v) {
+	glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)lazy_resolve("glTexCoord3iv");
+	glad_glTexCoord3iv(v);
+}
+static void APIENTRY lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)lazy_resolve("glTexCoord3s");
+	glad_glTexCoord3s(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3sv(const GLshort *v) {
+	glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)lazy_resolve("glTexCoord3sv");
+	glad_glTexCoord3sv(v);
+}
+static void APIENTRY lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)lazy_resolve("glTexCoord4d");
+	glad_glTexCoord4d(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4dv(const GLdouble *v) {
+	glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)lazy_resolve("glTexCoord4dv");
+	glad_glTexCoord4dv(v);
+}
+static void APIENTRY lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)lazy_resolve("glTexCoord4f");
+	glad_glTexCoord4f(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4fv(const GLfloat *v) {
+	glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)lazy_resolve("glTexCoord4fv");
+	glad_glTexCoord4fv(v);
+}
+static void APIENTRY lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)lazy_resolve("glTexCoord4i");
+	glad_glTexCoord4i(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4iv(const GLint *v) {
+	glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)lazy_resolve("glTexCoord4iv");
+	glad_glTexCoord4iv(v);
+}
+static void APIENTRY lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)lazy_resolve("glTexCoord4s");
+	glad_glTexCoord4s(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4sv(const GLshort *v) {
+	glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)lazy_resolve("glTexCoord4sv");
+	glad_glTexCoord4sv(v);
+}
+static void APIENTRY lazy_glVertex2d(GLdouble x, GLdouble y) {
+	glad_glVertex2d = (PFNGLVERTEX2DPROC)lazy_resolve("glVertex2d");
+	glad_glVertex2d(x, y);
+}
+static void APIENTRY lazy_glVertex2dv(const GLdouble *v) {
+	glad_glVertex2dv = (PFNGLVERTEX2DVPROC)lazy_resolve("glVertex2dv");
+	glad_glVertex2dv(v);
+}
+static void APIENTRY lazy_glVertex2f(GLfloat x, GLfloat y) {
+	glad_glVertex2f = (PFNGLVERTEX2FPROC)lazy_resolve("glVertex2f");
+	glad_glVertex2f(x, y);
+}
+static void APIENTRY lazy_glVertex2fv(const GLfloat *v) {
+	glad_glVertex2fv = (PFNGLVERTEX2FVPROC)lazy_resolve("glVertex2fv");
+	glad_glVertex2fv(v);
+}
+static void APIENTRY lazy_glVertex2i(GLint x, GLint y) {
+	glad_glVertex2i = (PFNGLVERTEX2IPROC)lazy_resolve("glVertex2i");
+	glad_glVertex2i(x, y);
+}
+static void APIENTRY lazy_glVertex2iv(const GLint *v) {
+	glad_glVertex2iv = (PFNGLVERTEX2IVPROC)lazy_resolve("glVertex2iv");
+	glad_glVertex2iv(v);
+}
+static void APIENTRY lazy_glVertex2s(GLshort x, GLshort y) {
+	glad_glVertex2s = (PFNGLVERTEX2SPROC)lazy_resolve("glVertex2s");
+	glad_glVertex2s(x, y);
+}
+static void APIENTRY lazy_glVertex2sv(const GLshort *v) {
+	glad_glVertex2sv = (PFNGLVERTEX2SVPROC)lazy_resolve("glVertex2sv");
+	glad_glVertex2sv(v);
+}
+static void APIENTRY lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertex3d = (PFNGLVERTEX3DPROC)lazy_resolve("glVertex3d");
+	glad_glVertex3d(x, y, z);
+}
+static void APIENTRY lazy_glVertex3dv(const GLdouble *v) {
+	glad_glVertex3dv = (PFNGLVERTEX3DVPROC)lazy_resolve("glVertex3dv");
+	glad_glVertex3dv(v);
+}
+static void APIENTRY lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertex3f = (PFNGLVERTEX3FPROC)lazy_resolve("glVertex3f");
+	glad_glVertex3f(x, y, z);
+}
+static void APIENTRY lazy_glVertex3fv(const GLfloat *v) {
+	glad_glVertex3fv = (PFNGLVERTEX3FVPROC)lazy_resolve("glVertex3fv");
+	glad_glVertex3fv(v);
+}
+static void APIENTRY lazy_glVertex3i(GLint x, GLint y, GLint z) {
+	glad_glVertex3i = (PFNGLVERTEX3IPROC)lazy_resolve("glVertex3i");
+	glad_glVertex3i(x, y, z);
+}
+static void APIENTRY lazy_glVertex3iv(const GLint *v) {
+	glad_glVertex3iv = (PFNGLVERTEX3IVPROC)lazy_resolve("glVertex3iv");
+	glad_glVertex3iv(v);
+}
+static void APIENTRY lazy_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	glad_glVertex3s = (PFNGLVERTEX3SPROC)lazy_resolve("glVertex3s");
+	glad_glVertex3s(x, y, z);
+}
+static void APIENTRY lazy_glVertex3sv(const GLshort *v) {
+	glad_glVertex3sv = (PFNGLVERTEX3SVPROC)lazy_resolve("glVertex3sv");
+	glad_glVertex3sv(v);
+}
+static void APIENTRY lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertex4d = (PFNGLVERTEX4DPROC)lazy_resolve("glVertex4d");
+	glad_glVertex4d(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4dv(const GLdouble *v) {
+	glad_glVertex4dv = (PFNGLVERTEX4DVPROC)lazy_resolve("glVertex4dv");
+	glad_glVertex4dv(v);
+}
+static void APIENTRY lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertex4f = (PFNGLVERTEX4FPROC)lazy_resolve("glVertex4f");
+	glad_glVertex4f(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4fv(const GLfloat *v) {
+	glad_glVertex4fv = (PFNGLVERTEX4FVPROC)lazy_resolve("glVertex4fv");
+	glad_glVertex4fv(v);
+}
+static void APIENTRY lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertex4i = (PFNGLVERTEX4IPROC)lazy_resolve("glVertex4i");
+	glad_glVertex4i(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4iv(const GLint *v) {
+	glad_glVertex4iv = (PFNGLVERTEX4IVPROC)lazy_resolve("glVertex4iv");
+	glad_glVertex4iv(v);
+}
+static void APIENTRY lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertex4s = (PFNGLVERTEX4SPROC)lazy_resolve("glVertex4s");
+	glad_glVertex4s(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4sv(const GLshort *v) {
+	glad_glVertex4sv = (PFNGLVERTEX4SVPROC)lazy_resolve("glVertex4sv");
+	glad_glVertex4sv(v);
+}
+static void APIENTRY lazy_glClipPlane(GLenum plane, const GLdouble *equation) {
+	glad_glClipPlane = (PFNGLCLIPPLANEPROC)lazy_resolve("glClipPlane");
+	glad_glClipPlane(plane, equation);
+}
+static void APIENTRY lazy_glColorMaterial(GLenum face, GLenum mode) {
+	glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)lazy_resolve("glColorMaterial");
+	glad_glColorMaterial(face, mode);
+}
+static void APIENTRY lazy_glFogf(GLenum pname, GLfloat param) {
+	glad_glFogf = (PFNGLFOGFPROC)lazy_resolve("glFogf");
+	glad_glFogf(pname, param);
+}
+static void APIENTRY lazy_glFogfv(GLenum pname, const GLfloat *params) {
+	glad_glFogfv = (PFNGLFOGFVPROC)lazy_resolve("glFogfv");
+	glad_glFogfv(pname, params);
+}
+static void APIENTRY lazy_glFogi(GLenum pname, GLint param) {
+	glad_glFogi = (PFNGLFOGIPROC)lazy_resolve("glFogi");
+	glad_glFogi(pname, param);
+}
+static void APIENTRY lazy_glFogiv(GLenum pname, const GLint *params) {
+	glad_glFogiv = (PFNGLFOGIVPROC)lazy_resolve("glFogiv");
+	glad_glFogiv(pname, params);
+}
+static void APIENTRY lazy_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	glad_glLightf = (PFNGLLIGHTFPROC)lazy_resolve("glLightf");
+	glad_glLightf(light, pname, param);
+}
+static void APIENTRY lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	glad_glLightfv = (PFNGLLIGHTFVPROC)lazy_resolve("glLightfv");
+	glad_glLightfv(light, pname, params);
+}
+static void APIENTRY lazy_glLighti(GLenum light, GLenum pname, GLint param) {
+	glad_glLighti = (PFNGLLIGHTIPROC)lazy_resolve("glLighti");
+	glad_glLighti(light, pname, param);
+}
+static void APIENTRY lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	glad_glLightiv = (PFNGLLIGHTIVPROC)lazy_resolve("glLightiv");
+	glad_glLightiv(light, pname, params);
+}
+static void APIENTRY lazy_glLightModelf(GLenum pname, GLfloat param) {
+	glad_glLightModelf = (PFNGLLIGHTMODELFPROC)lazy_resolve("glLightModelf");
+	glad_glLightModelf(pname, param);
+}
+static void APIENTRY lazy_glLightModelfv(GLenum pname, const GLfloat *params) {
+	glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)lazy_resolve("glLightModelfv");
+	glad_glLightModelfv(pname, params);
+}
+static void APIENTRY lazy_glLightModeli(GLenum pname, GLint param) {
+	glad_glLightModeli = (PFNGLLIGHTMODELIPROC)lazy_resolve("glLightModeli");
+	glad_glLightModeli(pname, param);
+}
+static void APIENTRY lazy_glLightModeliv(GLenum pname, const GLint *params) {
+	glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)lazy_resolve("glLightModeliv");
+	glad_glLightModeliv(pname, params);
+}
+static void APIENTRY lazy_glLineStipple(GLint factor, GLushort pattern) {
+	glad_glLineStipple = (PFNGLLINESTIPPLEPROC)lazy_resolve("glLineStipple");
+	glad_glLineStipple(factor, pattern);
+}
+static void APIENTRY lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	glad_glMaterialf = (PFNGLMATERIALFPROC)lazy_resolve("glMaterialf");
+	glad_glMaterialf(face, pname, param);
+}
+static void APIENTRY lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	glad_glMaterialfv = (PFNGLMATERIALFVPROC)lazy_resolve("glMaterialfv");
+	glad_glMaterialfv(face, pname, params);
+}
+static void APIENTRY lazy_glMateriali(GLenum face, GLenum pname, GLint param) {
+	glad_glMateriali = (PFNGLMATERIALIPROC)lazy_resolve("glMateriali");
+	glad_glMateriali(face, pname, param);
+}
+static void APIENTRY lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	glad_glMaterialiv = (PFNGLMATERIALIVPROC)lazy_resolve("glMaterialiv");
+	glad_glMaterialiv(face, pname, params);
+}
+static void APIENTRY lazy_glPolygonStipple(const GLubyte *mask) {
+	glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)lazy_resolve("glPolygonStipple");
+	glad_glPolygonStipple(mask);
+}
+static void APIENTRY lazy_glShadeModel(GLenum mode) {
+	glad_glShadeModel = (PFNGLSHADEMODELPROC)lazy_resolve("glShadeModel");
+	glad_glShadeModel(mode);
+}
+static void APIENTRY lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexEnvf = (PFNGLTEXENVFPROC)lazy_resolve("glTexEnvf");
+	glad_glTexEnvf(target, pname, param);
+}
+static void APIENTRY lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexEnvfv = (PFNGLTEXENVFVPROC)lazy_resolve("glTexEnvfv");
+	glad_glTexEnvfv(target, pname, params);
+}
+static void APIENTRY lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	glad_glTexEnvi = (PFNGLTEXENVIPROC)lazy_resolve("glTexEnvi");
+	glad_glTexEnvi(target, pname, param);
+}
+static void APIENTRY lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexEnviv = (PFNGLTEXENVIVPROC)lazy_resolve("glTexEnviv");
+	glad_glTexEnviv(target, pname, params);
+}
+static void APIENTRY lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	glad_glTexGend = (PFNGLTEXGENDPROC)lazy_resolve("glTexGend");
+	glad_glTexGend(coord, pname, param);
+}
+static void APIENTRY lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	glad_glTexGendv = (PFNGLTEXGENDVPROC)lazy_resolve("glTexGendv");
+	glad_glTexGendv(coord, pname, params);
+}
+static void APIENTRY lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	glad_glTexGenf = (PFNGLTEXGENFPROC)lazy_resolve("glTexGenf");
+	glad_glTexGenf(coord, pname, param);
+}
+static void APIENTRY lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	glad_glTexGenfv = (PFNGLTEXGENFVPROC)lazy_resolve("glTexGenfv");
+	glad_glTexGenfv(coord, pname, params);
+}
+static void APIENTRY lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	glad_glTexGeni = (PFNGLTEXGENIPROC)lazy_resolve("glTexGeni");
+	glad_glTexGeni(coord, pname, param);
+}
+static void APIENTRY lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	glad_glTexGeniv = (PFNGLTEXGENIVPROC)lazy_resolve("glTexGeniv");
+	glad_glTexGeniv(coord, pname, params);
+}
+static void APIENTRY lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)lazy_resolve("glFeedbackBuffer");
+	glad_glFeedbackBuffer(size, type, buffer);
+}
+static void APIENTRY lazy_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)lazy_resolve("glSelectBuffer");
+	glad_glSelectBuffer(size, buffer);
+}
+static GLint APIENTRY lazy_glRenderMode(GLenum mode) {
+	glad_glRenderMode = (PFNGLRENDERMODEPROC)lazy_resolve("glRenderMode");
+	return glad_glRenderMode(mode);
+}
+static void APIENTRY lazy_glInitNames(void) {
+	glad_glInitNames = (PFNGLINITNAMESPROC)lazy_resolve("glInitNames");
+	glad_glInitNames();
+}
+static void APIENTRY lazy_glLoadName(GLuint name) {
+	glad_glLoadName = (PFNGLLOADNAMEPROC)lazy_resolve("glLoadName");
+	glad_glLoadName(name);
+}
+static void APIENTRY lazy_glPassThrough(GLfloat token) {
+	glad_glPassThrough = (PFNGLPASSTHROUGHPROC)lazy_resolve("glPassThrough");
+	glad_glPassThrough(token);
+}
+static void APIENTRY lazy_glPopName(void) {
+	glad_glPopName = (PFNGLPOPNAMEPROC)lazy_resolve("glPopName");
+	glad_glPopName();
+}
+static void APIENTRY lazy_glPushName(GLuint name) {
+	glad_glPushName = (PFNGLPUSHNAMEPROC)lazy_resolve("glPushName");
+	glad_glPushName(name);
+}
+static void APIENTRY lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearAccum = (PFNGLCLEARACCUMPROC)lazy_resolve("glClearAccum");
+	glad_glClearAccum(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearIndex(GLfloat c) {
+	glad_glClearIndex = (PFNGLCLEARINDEXPROC)lazy_resolve("glClearIndex");
+	glad_glClearIndex(c);
+}
+static void APIENTRY lazy_glIndexMask(GLuint mask) {
+	glad_glIndexMask = (PFNGLINDEXMASKPROC)lazy_resolve("glIndexMask");
+	glad_glIndexMask(mask);
+}
+static void APIENTRY lazy_glAccum(GLenum op, GLfloat value) {
+	glad_glAccum = (PFNGLACCUMPROC)lazy_resolve("glAccum");
+	glad_glAccum(op, value);
+}
+static void APIENTRY lazy_glPopAttrib(void) {
+	glad_glPopAttrib = (PFNGLPOPATTRIBPROC)lazy_resolve("glPopAttrib");
+	glad_glPopAttrib();
+}
+static void APIENTRY lazy_glPushAttrib(GLbitfield mask) {
+	glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)lazy_resolve("glPushAttrib");
+	glad_glPushAttrib(mask);
+}
+static void APIENTRY lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	glad_glMap1d = (PFNGLMAP1DPROC)lazy_resolve("glMap1d");
+	glad_glMap1d(target, u1, u2, stride, order, points);
+}
+static void APIENTRY lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	glad_glMap1f = (PFNGLMAP1FPROC)lazy_resolve("glMap1f");
+	glad_glMap1f(target, u1, u2, stride, order, points);
+}
+static void APIENTRY lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	glad_glMap2d = (PFNGLMAP2DPROC)lazy_resolve("glMap2d");
+	glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	glad_glMap2f = (PFNGLMAP2FPROC)lazy_resolve("glMap2f");
+	glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)lazy_resolve("glMapGrid1d");
+	glad_glMapGrid1d(un, u1, u2);
+}
+static void APIENTRY lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)lazy_resolve("glMapGrid1f");
+	glad_glMapGrid1f(un, u1, u2);
+}
+static void APIENTRY lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)lazy_resolve("glMapGrid2d");
+	glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)lazy_resolve("glMapGrid2f");
+	glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY lazy_glEvalCoord1d(GLdouble u) {
+	glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)lazy_resolve("glEvalCoord1d");
+	glad_glEvalCoord1d(u);
+}
+static void APIENTRY lazy_glEvalCoord1dv(const GLdouble *u) {
+	glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)lazy_resolve("glEvalCoord1dv");
+	glad_glEvalCoord1dv(u);
+}
+static void APIENTRY lazy_glEvalCoord1f(GLfloat u) {
+	glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)lazy_resolve("glEvalCoord1f");
+	glad_glEvalCoord1f(u);
+}
+static void APIENTRY lazy_glEvalCoord1fv(const GLfloat *u) {
+	glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)lazy_resolve("glEvalCoord1fv");
+	glad_glEvalCoord1fv(u);
+}
+static void APIENTRY lazy_glEvalCoord2d(GLdouble u, GLdouble v) {
+	glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)lazy_resolve("glEvalCoord2d");
+	glad_glEvalCoord2d(u, v);
+}
+static void APIENTRY lazy_glEvalCoord2dv(const GLdouble *u) {
+	glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)lazy_resolve("glEvalCoord2dv");
+	glad_glEvalCoord2dv(u);
+}
+static void APIENTRY lazy_glEvalCoord2f(GLfloat u, GLfloat v) {
+	glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)lazy_resolve("glEvalCoord2f");
+	glad_glEvalCoord2f(u, v);
+}
+static void APIENTRY lazy_glEvalCoord2fv(const GLfloat *u) {
+	glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)lazy_resolve("glEvalCoord2fv");
+	glad_glEvalCoord2fv(u);
+}
+static void APIENTRY lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)lazy_resolve("glEvalMesh1");
+	glad_glEvalMesh1(mode, i1, i2);
+}
+static void APIENTRY lazy_glEvalPoint1(GLint i) {
+	glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)lazy_resolve("glEvalPoint1");
+	glad_glEvalPoint1(i);
+}
+static void APIENTRY lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)lazy_resolve("glEvalMesh2");
+	glad_glEvalMesh2(mode, i1, i2, j1, j2);
+}
+static void APIENTRY lazy_glEvalPoint2(GLint i, GLint j) {
+	glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)lazy_resolve("glEvalPoint2");
+	glad_glEvalPoint2(i, j);
+}
+static void APIENTRY lazy_glAlphaFunc(GLenum func, GLfloat ref) {
+	glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)lazy_resolve("glAlphaFunc");
+	glad_glAlphaFunc(func, ref);
+}
+static void APIENTRY lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	glad_glPixelZoom = (PFNGLPIXELZOOMPROC)lazy_resolve("glPixelZoom");
+	glad_glPixelZoom(xfactor, yfactor);
+}
+static void APIENTRY lazy_glPixelTransferf(GLenum pname, GLfloat param) {
+	glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)lazy_resolve("glPixelTransferf");
+	glad_glPixelTransferf(pname, param);
+}
+static void APIENTRY lazy_glPixelTransferi(GLenum pname, GLint param) {
+	glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)lazy_resolve("glPixelTransferi");
+	glad_glPixelTransferi(pname, param);
+}
+static void APIENTRY lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)lazy_resolve("glPixelMapfv");
+	glad_glPixelMapfv(map, mapsize, values);
+}
+static void APIENTRY lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)lazy_resolve("glPixelMapuiv");
+	glad_glPixelMapuiv(map, mapsize, values);
+}
+static void APIENTRY lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)lazy_resolve("glPixelMapusv");
+	glad_glPixelMapusv(map, mapsize, values);
+}
+static void APIENTRY lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)lazy_resolve("glCopyPixels");
+	glad_glCopyPixels(x, y, width, height, type);
+}
+static void APIENTRY lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)lazy_resolve("glDrawPixels");
+	glad_glDrawPixels(width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)lazy_resolve("glGetClipPlane");
+	glad_glGetClipPlane(plane, equation);
+}
+static void APIENTRY lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)lazy_resolve("glGetLightfv");
+	glad_glGetLightfv(light, pname, params);
+}
+static void APIENTRY lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)lazy_resolve("glGetLightiv");
+	glad_glGetLightiv(light, pname, params);
+}
+static void APIENTRY lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	glad_glGetMapdv = (PFNGLGETMAPDVPROC)lazy_resolve("glGetMapdv");
+	glad_glGetMapdv(target, query, v);
+}
+static void APIENTRY lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	glad_glGetMapfv = (PFNGLGETMAPFVPROC)lazy_resolve("glGetMapfv");
+	glad_glGetMapfv(target, query, v);
+}
+static void APIENTRY lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	glad_glGetMapiv = (PFNGLGETMAPIVPROC)lazy_resolve("glGetMapiv");
+	glad_glGetMapiv(target, query, v);
+}
+static void APIENTRY lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)lazy_resolve("glGetMaterialfv");
+	glad_glGetMaterialfv(face, pname, params);
+}
+static void APIENTRY lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)lazy_resolve("glGetMaterialiv");
+	glad_glGetMaterialiv(face, pname, params);
+}
+static void APIENTRY lazy_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)lazy_resolve("glGetPixelMapfv");
+	glad_glGetPixelMapfv(map, values);
+}
+static void APIENTRY lazy_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)lazy_resolve("glGetPixelMapuiv");
+	glad_glGetPixelMapuiv(map, values);
+}
+static void APIENTRY lazy_glGetPixelMapusv(GLenum map, GLushort *values) {
+	glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)lazy_resolve("glGetPixelMapusv");
+	glad_glGetPixelMapusv(map, values);
+}
+static void APIENTRY lazy_glGetPolygonStipple(GLubyte *mask) {
+	glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)lazy_resolve("glGetPolygonStipple");
+	glad_glGetPolygonStipple(mask);
+}
+static void APIENTRY lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)lazy_resolve("glGetTexEnvfv");
+	glad_glGetTexEnvfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)lazy_resolve("glGetTexEnviv");
+	glad_glGetTexEnviv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)lazy_resolve("glGetTexGendv");
+	glad_glGetTexGendv(coord, pname, params);
+}
+static void APIENTRY lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)lazy_resolve("glGetTexGenfv");
+	glad_glGetTexGenfv(coord, pname, params);
+}
+static void APIENTRY lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)lazy_resolve("glGetTexGeniv");
+	glad_glGetTexGeniv(coord, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsList(GLuint list) {
+	glad_glIsList = (PFNGLISLISTPROC)lazy_resolve("glIsList");
+	return glad_glIsList(list);
+}
+static void APIENTRY lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glFrustum = (PFNGLFRUSTUMPROC)lazy_resolve("glFrustum");
+	glad_glFrustum(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY lazy_glLoadIdentity(void) {
+	glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)lazy_resolve("glLoadIdentity");
+	glad_glLoadIdentity();
+}
+static void APIENTRY lazy_glLoadMatrixf(const GLfloat *m) {
+	glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)lazy_resolve("glLoadMatrixf");
+	glad_glLoadMatrixf(m);
+}
+static void APIENTRY lazy_glLoadMatrixd(const GLdouble *m) {
+	glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)lazy_resolve("glLoadMatrixd");
+	glad_glLoadMatrixd(m);
+}
+static void APIENTRY lazy_glMatrixMode(GLenum mode) {
+	glad_glMatrixMode = (PFNGLMATRIXMODEPROC)lazy_resolve("glMatrixMode");
+	glad_glMatrixMode(mode);
+}
+static void APIENTRY lazy_glMultMatrixf(const GLfloat *m) {
+	glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)lazy_resolve("glMultMatrixf");
+	glad_glMultMatrixf(m);
+}
+static void APIENTRY lazy_glMultMatrixd(const GLdouble *m) {
+	glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)lazy_resolve("glMultMatrixd");
+	glad_glMultMatrixd(m);
+}
+static void APIENTRY lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glOrtho = (PFNGLORTHOPROC)lazy_resolve("glOrtho");
+	glad_glOrtho(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY lazy_glPopMatrix(void) {
+	glad_glPopMatrix = (PFNGLPOPMATRIXPROC)lazy_resolve("glPopMatrix");
+	glad_glPopMatrix();
+}
+static void APIENTRY lazy_glPushMatrix(void) {
+	glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)lazy_resolve("glPushMatrix");
+	glad_glPushMatrix();
+}
+static void APIENTRY lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRotated = (PFNGLROTATEDPROC)lazy_resolve("glRotated");
+	glad_glRotated(angle, x, y, z);
+}
+static void APIENTRY lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRotatef = (PFNGLROTATEFPROC)lazy_resolve("glRotatef");
+	glad_glRotatef(angle, x, y, z);
+}
+static void APIENTRY lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glScaled = (PFNGLSCALEDPROC)lazy_resolve("glScaled");
+	glad_glScaled(x, y, z);
+}
+static void APIENTRY lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glScalef = (PFNGLSCALEFPROC)lazy_resolve("glScalef");
+	glad_glScalef(x, y, z);
+}
+static void APIENTRY lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glTranslated = (PFNGLTRANSLATEDPROC)lazy_resolve("glTranslated");
+	glad_glTranslated(x, y, z);
+}
+static void APIENTRY lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTranslatef = (PFNGLTRANSLATEFPROC)lazy_resolve("glTranslatef");
+	glad_glTranslatef(x, y, z);
+}
+static void APIENTRY lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)lazy_resolve("glDrawArrays");
+	glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)lazy_resolve("glDrawElements");
+	glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY lazy_glGetPointerv(GLenum pname, void **params) {
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)lazy_resolve("glGetPointerv");
+	glad_glGetPointerv(pname, params);
+}
+static void APIENTRY lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)lazy_resolve("glPolygonOffset");
+	glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)lazy_resolve("glCopyTexImage1D");
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)lazy_resolve("glCopyTexImage2D");
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)lazy_resolve("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)lazy_resolve("glCopyTexSubImage2D");
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)lazy_resolve("glTexSubImage1D");
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)lazy_resolve("glTexSubImage2D");
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glBindTexture(GLenum target, GLuint texture) {
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)lazy_resolve("glBindTexture");
+	glad_glBindTexture(target, texture);
+}
+static void APIENTRY lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)lazy_resolve("glDeleteTextures");
+	glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)lazy_resolve("glGenTextures");
+	glad_glGenTextures(n, textures);
+}
+static GLboolean APIENTRY lazy_glIsTexture(GLuint texture) {
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)lazy_resolve("glIsTexture");
+	return glad_glIsTexture(texture);
+}
+static void APIENTRY lazy_glArrayElement(GLint i) {
+	glad_glArrayElement = (PFNGLARRAYELEMENTPROC)lazy_resolve("glArrayElement");
+	glad_glArrayElement(i);
+}
+static void APIENTRY lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glColorPointer = (PFNGLCOLORPOINTERPROC)lazy_resolve("glColorPointer");
+	glad_glColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glDisableClientState(GLenum array) {
+	glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)lazy_resolve("glDisableClientState");
+	glad_glDisableClientState(array);
+}
+static void APIENTRY lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)lazy_resolve("glEdgeFlagPointer");
+	glad_glEdgeFlagPointer(stride, pointer);
+}
+static void APIENTRY lazy_glEnableClientState(GLenum array) {
+	glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)lazy_resolve("glEnableClientState");
+	glad_glEnableClientState(array);
+}
+static void APIENTRY lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)lazy_resolve("glIndexPointer");
+	glad_glIndexPointer(type, stride, pointer);
+}
+static void APIENTRY lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)lazy_resolve("glInterleavedArrays");
+	glad_glInterleavedArrays(format, stride, pointer);
+}
+static void APIENTRY lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)lazy_resolve("glNormalPointer");
+	glad_glNormalPointer(type, stride, pointer);
+}
+static void APIENTRY lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)lazy_resolve("glTexCoordPointer");
+	glad_glTexCoordPointer(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)lazy_resolve("glVertexPointer");
+	glad_glVertexPointer(size, type, stride, pointer);
+}
+static GLboolean APIENTRY lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)lazy_resolve("glAreTexturesResident");
+	return glad_glAreTexturesResident(n, textures, residences);
+}
+static void APIENTRY lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)lazy_resolve("glPrioritizeTextures");
+	glad_glPrioritizeTextures(n, textures, priorities);
+}
+static void APIENTRY lazy_glIndexub(GLubyte c) {
+	glad_glIndexub = (PFNGLINDEXUBPROC)lazy_resolve("glIndexub");
+	glad_glIndexub(c);
+}
+static void APIENTRY lazy_glIndexubv(const GLubyte *c) {
+	glad_glIndexubv = (PFNGLINDEXUBVPROC)lazy_resolve("glIndexubv");
+	glad_glIndexubv(c);
+}
+static void APIENTRY lazy_glPopClientAttrib(void) {
+	glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)lazy_resolve("glPopClientAttrib");
+	glad_glPopClientAttrib();
+}
+static void APIENTRY lazy_glPushClientAttrib(GLbitfield mask) {
+	glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)lazy_resolve("glPushClientAttrib");
+	glad_glPushClientAttrib(mask);
+}
+static void APIENTRY lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)lazy_resolve("glDrawRangeElements");
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)lazy_resolve("glTexImage3D");
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)lazy_resolve("glTexSubImage3D");
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)lazy_resolve("glCopyTexSubImage3D");
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glActiveTexture(GLenum texture) {
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)lazy_resolve("glActiveTexture");
+	glad_glActiveTexture(texture);
+}
+static void APIENTRY lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)lazy_resolve("glSampleCoverage");
+	glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)lazy_resolve("glCompressedTexImage3D");
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)lazy_resolve("glCompressedTexImage2D");
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)lazy_resolve("glCompressedTexImage1D");
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)lazy_resolve("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)lazy_resolve("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)lazy_resolve("glCompressedTexSubImage1D");
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)lazy_resolve("glGetCompressedTexImage");
+	glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY lazy_glClientActiveTexture(GLenum texture) {
+	glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)lazy_resolve("glClientActiveTexture");
+	glad_glClientActiveTexture(texture);
+}
+static void APIENTRY lazy_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)lazy_resolve("glMultiTexCoord1d");
+	glad_glMultiTexCoord1d(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)lazy_resolve("glMultiTexCoord1dv");
+	glad_glMultiTexCoord1dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)lazy_resolve("glMultiTexCoord1f");
+	glad_glMultiTexCoord1f(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)lazy_resolve("glMultiTexCoord1fv");
+	glad_glMultiTexCoord1fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1i(GLenum target, GLint s) {
+	glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)lazy_resolve("glMultiTexCoord1i");
+	glad_glMultiTexCoord1i(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)lazy_resolve("glMultiTexCoord1iv");
+	glad_glMultiTexCoord1iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1s(GLenum target, GLshort s) {
+	glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)lazy_resolve("glMultiTexCoord1s");
+	glad_glMultiTexCoord1s(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)lazy_resolve("glMultiTexCoord1sv");
+	glad_glMultiTexCoord1sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)lazy_resolve("glMultiTexCoord2d");
+	glad_glMultiTexCoord2d(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)lazy_resolve("glMultiTexCoord2dv");
+	glad_glMultiTexCoord2dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)lazy_resolve("glMultiTexCoord2f");
+	glad_glMultiTexCoord2f(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)lazy_resolve("glMultiTexCoord2fv");
+	glad_glMultiTexCoord2fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)lazy_resolve("glMultiTexCoord2i");
+	glad_glMultiTexCoord2i(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)lazy_resolve("glMultiTexCoord2iv");
+	glad_glMultiTexCoord2iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)lazy_resolve("glMultiTexCoord2s");
+	glad_glMultiTexCoord2s(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)lazy_resolve("glMultiTexCoord2sv");
+	glad_glMultiTexCoord2sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)lazy_resolve("glMultiTexCoord3d");
+	glad_glMultiTexCoord3d(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)lazy_resolve("glMultiTexCoord3dv");
+	glad_glMultiTexCoord3dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)lazy_resolve("glMultiTexCoord3f");
+	glad_glMultiTexCoord3f(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)lazy_resolve("glMultiTexCoord3fv");
+	glad_glMultiTexCoord3fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)lazy_resolve("glMultiTexCoord3i");
+	glad_glMultiTexCoord3i(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)lazy_resolve("glMultiTexCoord3iv");
+	glad_glMultiTexCoord3iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)lazy_resolve("glMultiTexCoord3s");
+	glad_glMultiTexCoord3s(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)lazy_resolve("glMultiTexCoord3sv");
+	glad_glMultiTexCoord3sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)lazy_resolve("glMultiTexCoord4d");
+	glad_glMultiTexCoord4d(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)lazy_resolve("glMultiTexCoord4dv");
+	glad_glMultiTexCoord4dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)lazy_resolve("glMultiTexCoord4f");
+	glad_glMultiTexCoord4f(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)lazy_resolve("glMultiTexCoord4fv");
+	glad_glMultiTexCoord4fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)lazy_resolve("glMultiTexCoord4i");
+	glad_glMultiTexCoord4i(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)lazy_resolve("glMultiTexCoord4iv");
+	glad_glMultiTexCoord4iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)lazy_resolve("glMultiTexCoord4s");
+	glad_glMultiTexCoord4s(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)lazy_resolve("glMultiTexCoord4sv");
+	glad_glMultiTexCoord4sv(target, v);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixf(const GLfloat *m) {
+	glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)lazy_resolve("glLoadTransposeMatrixf");
+	glad_glLoadTransposeMatrixf(m);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixd(const GLdouble *m) {
+	glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)lazy_resolve("glLoadTransposeMatrixd");
+	glad_glLoadTransposeMatrixd(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixf(const GLfloat *m) {
+	glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)lazy_resolve("glMultTransposeMatrixf");
+	glad_glMultTransposeMatrixf(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixd(const GLdouble *m) {
+	glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)lazy_resolve("glMultTransposeMatrixd");
+	glad_glMultTransposeMatrixd(m);
+}
+static void APIENTRY lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)lazy_resolve("glBlendFuncSeparate");
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)lazy_resolve("glMultiDrawArrays");
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)lazy_resolve("glMultiDrawElements");
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)lazy_resolve("glPointParameterf");
+	glad_glPointParameterf(pname, param);
+}
+static void APIENTRY lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)lazy_resolve("glPointParameterfv");
+	glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY lazy_glPointParameteri(GLenum pname, GLint param) {
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)lazy_resolve("glPointParameteri");
+	glad_glPointParameteri(pname, param);
+}
+static void APIENTRY lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)lazy_resolve("glPointParameteriv");
+	glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY lazy_glFogCoordf(GLfloat coord) {
+	glad_glFogCoordf = (PFNGLFOGCOORDFPROC)lazy_resolve("glFogCoordf");
+	glad_glFogCoordf(coord);
+}
+static void APIENTRY lazy_glFogCoordfv(const GLfloat *coord) {
+	glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)lazy_resolve("glFogCoordfv");
+	glad_glFogCoordfv(coord);
+}
+static void APIENTRY lazy_glFogCoordd(GLdouble coord) {
+	glad_glFogCoordd = (PFNGLFOGCOORDDPROC)lazy_resolve("glFogCoordd");
+	glad_glFogCoordd(coord);
+}
+static void APIENTRY lazy_glFogCoorddv(const GLdouble *coord) {
+	glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)lazy_resolve("glFogCoorddv");
+	glad_glFogCoorddv(coord);
+}
+static void APIENTRY lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)lazy_resolve("glFogCoordPointer");
+	glad_glFogCoordPointer(type, stride, pointer);
+}
+static void APIENTRY lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)lazy_resolve("glSecondaryColor3b");
+	glad_glSecondaryColor3b(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3bv(const GLbyte *v) {
+	glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)lazy_resolve("glSecondaryColor3bv");
+	glad_glSecondaryColor3bv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)lazy_resolve("glSecondaryColor3d");
+	glad_glSecondaryColor3d(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3dv(const GLdouble *v) {
+	glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)lazy_resolve("glSecondaryColor3dv");
+	glad_glSecondaryColor3dv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)lazy_resolve("glSecondaryColor3f");
+	glad_glSecondaryColor3f(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3fv(const GLfloat *v) {
+	glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)lazy_resolve("glSecondaryColor3fv");
+	glad_glSecondaryColor3fv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)lazy_resolve("glSecondaryColor3i");
+	glad_glSecondaryColor3i(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3iv(const GLint *v) {
+	glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)lazy_resolve("glSecondaryColor3iv");
+	glad_glSecondaryColor3iv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)lazy_resolve("glSecondaryColor3s");
+	glad_glSecondaryColor3s(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3sv(const GLshort *v) {
+	glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)lazy_resolve("glSecondaryColor3sv");
+	glad_glSecondaryColor3sv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)lazy_resolve("glSecondaryColor3ub");
+	glad_glSecondaryColor3ub(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3ubv(const GLubyte *v) {
+	glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)lazy_resolve("glSecondaryColor3ubv");
+	glad_glSecondaryColor3ubv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)lazy_resolve("glSecondaryColor3ui");
+	glad_glSecondaryColor3ui(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3uiv(const GLuint *v) {
+	glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)lazy_resolve("glSecondaryColor3uiv");
+	glad_glSecondaryColor3uiv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)lazy_resolve("glSecondaryColor3us");
+	glad_glSecondaryColor3us(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3usv(const GLushort *v) {
+	glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)lazy_resolve("glSecondaryColor3usv");
+	glad_glSecondaryColor3usv(v);
+}
+static void APIENTRY lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)lazy_resolve("glSecondaryColorPointer");
+	glad_glSecondaryColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glWindowPos2d(GLdouble x, GLdouble y) {
+	glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)lazy_resolve("glWindowPos2d");
+	glad_glWindowPos2d(x, y);
+}
+static void APIENTRY lazy_glWindowPos2dv(const GLdouble *v) {
+	glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)lazy_resolve("glWindowPos2dv");
+	glad_glWindowPos2dv(v);
+}
+static void APIENTRY lazy_glWindowPos2f(GLfloat x, GLfloat y) {
+	glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)lazy_resolve("glWindowPos2f");
+	glad_glWindowPos2f(x, y);
+}
+static void APIENTRY lazy_glWindowPos2fv(const GLfloat *v) {
+	glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)lazy_resolve("glWindowPos2fv");
+	glad_glWindowPos2fv(v);
+}
+static void APIENTRY lazy_glWindowPos2i(GLint x, GLint y) {
+	glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)lazy_resolve("glWindowPos2i");
+	glad_glWindowPos2i(x, y);
+}
+static void APIENTRY lazy_glWindowPos2iv(const GLint *v) {
+	glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)lazy_resolve("glWindowPos2iv");
+	glad_glWindowPos2iv(v);
+}
+static void APIENTRY lazy_glWindowPos2s(GLshort x, GLshort y) {
+	glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)lazy_resolve("glWindowPos2s");
+	glad_glWindowPos2s(x, y);
+}
+static void APIENTRY lazy_glWindowPos2sv(const GLshort *v) {
+	glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)lazy_resolve("glWindowPos2sv");
+	glad_glWindowPos2sv(v);
+}
+static void APIENTRY lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)lazy_resolve("glWindowPos3d");
+	glad_glWindowPos3d(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3dv(const GLdouble *v) {
+	glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)lazy_resolve("glWindowPos3dv");
+	glad_glWindowPos3dv(v);
+}
+static void APIENTRY lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)lazy_resolve("glWindowPos3f");
+	glad_glWindowPos3f(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3fv(const GLfloat *v) {
+	glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)lazy_resolve("glWindowPos3fv");
+	glad_glWindowPos3fv(v);
+}
+static void APIENTRY lazy_glWindowPos3i(GLint x, GLint y, GLint z) {
+	glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)lazy_resolve("glWindowPos3i");
+	glad_glWindowPos3i(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3iv(const GLint *v) {
+	glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)lazy_resolve("glWindowPos3iv");
+	glad_glWindowPos3iv(v);
+}
+static void APIENTRY lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)lazy_resolve("glWindowPos3s");
+	glad_glWindowPos3s(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3sv(const GLshort *v) {
+	glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)lazy_resolve("glWindowPos3sv");
+	glad_glWindowPos3sv(v);
+}
+static void APIENTRY lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)lazy_resolve("glBlendColor");
+	glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glBlendEquation(GLenum mode) {
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)lazy_resolve("glBlendEquation");
+	glad_glBlendEquation(mode);
+}
+static void APIENTRY lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)lazy_resolve("glGenQueries");
+	glad_glGenQueries(n, ids);
+}
+static void APIENTRY lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)lazy_resolve("glDeleteQueries");
+	glad_glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsQuery(GLuint id) {
+	glad_glIsQuery = (PFNGLISQUERYPROC)lazy_resolve("glIsQuery");
+	return glad_glIsQuery(id);
+}
+static void APIENTRY lazy_glBeginQuery(GLenum target, GLuint id) {
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)lazy_resolve("glBeginQuery");
+	glad_glBeginQuery(target, id);
+}
+static void APIENTRY lazy_glEndQuery(GLenum target) {
+	glad_glEndQuery = (PFNGLENDQUERYPROC)lazy_resolve("glEndQuery");
+	glad_glEndQuery(target);
+}
+static void APIENTRY lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)lazy_resolve("glGetQueryiv");
+	glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)lazy_resolve("glGetQueryObjectiv");
+	glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)lazy_resolve("glGetQueryObjectuiv");
+	glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)lazy_resolve("glBindBuffer");
+	glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)lazy_resolve("glDeleteBuffers");
+	glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)lazy_resolve("glGenBuffers");
+	glad_glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY lazy_glIsBuffer(GLuint buffer) {
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)lazy_resolve("glIsBuffer");
+	return glad_glIsBuffer(buffer);
+}
+static void APIENTRY lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)lazy_resolve("glBufferData");
+	glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)lazy_resolve("glBufferSubData");
+	glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)lazy_resolve("glGetBufferSubData");
+	glad_glGetBufferSubData(target, offset, size, data);
+}
+static void * APIENTRY lazy_glMapBuffer(GLenum target, GLenum access) {
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)lazy_resolve("glMapBuffer");
+	return glad_glMapBuffer(target, access);
+}
+static GLboolean APIENTRY lazy_glUnmapBuffer(GLenum target) {
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)lazy_resolve("glUnmapBuffer");
+	return glad_glUnmapBuffer(target);
+}
+static void APIENTRY lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)lazy_resolve("glGetBufferParameteriv");
+	glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)lazy_resolve("glGetBufferPointerv");
+	glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)lazy_resolve("glBlendEquationSeparate");
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)lazy_resolve("glDrawBuffers");
+	glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)lazy_resolve("glStencilOpSeparate");
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)lazy_resolve("glStencilFuncSeparate");
+	glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)lazy_resolve("glStencilMaskSeparate");
+	glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY lazy_glAttachShader(GLuint program, GLuint shader) {
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)lazy_resolve("glAttachShader");
+	glad_glAttachShader(program, shader);
+}
+static void APIENTRY lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)lazy_resolve("glBindAttribLocation");
+	glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY lazy_glCompileShader(GLuint shader) {
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)lazy_resolve("glCompileShader");
+	glad_glCompileShader(shader);
+}
+static GLuint APIENTRY lazy_glCreateProgram(void) {
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)lazy_resolve("glCreateProgram");
+	return glad_glCreateProgram();
+}
+static GLuint APIENTRY lazy_glCreateShader(GLenum type) {
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)lazy_resolve("glCreateShader");
+	return glad_glCreateShader(type);
+}
+static void APIENTRY lazy_glDeleteProgram(GLuint program) {
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)lazy_resolve("glDeleteProgram");
+	glad_glDeleteProgram(program);
+}
+static void APIENTRY lazy_glDeleteShader(GLuint shader) {
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)lazy_resolve("glDeleteShader");
+	glad_glDeleteShader(shader);
+}
+static void APIENTRY lazy_glDetachShader(GLuint program, GLuint shader) {
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)lazy_resolve("glDetachShader");
+	glad_glDetachShader(program, shader);
+}
+static void APIENTRY lazy_glDisableVertexAttribArray(GLuint index) {
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)lazy_resolve("glDisableVertexAttribArray");
+	glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glEnableVertexAttribArray(GLuint index) {
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)lazy_resolve("glEnableVertexAttribArray");
+	glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)lazy_resolve("glGetActiveAttrib");
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)lazy_resolve("glGetActiveUniform");
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)lazy_resolve("glGetAttachedShaders");
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)lazy_resolve("glGetAttribLocation");
+	return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)lazy_resolve("glGetProgramiv");
+	glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)lazy_resolve("glGetProgramInfoLog");
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)lazy_resolve("glGetShaderiv");
+	glad_glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)lazy_resolve("glGetShaderInfoLog");
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)lazy_resolve("glGetShaderSource");
+	glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)lazy_resolve("glGetUniformLocation");
+	return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)lazy_resolve("glGetUniformfv");
+	glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)lazy_resolve("glGetUniformiv");
+	glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)lazy_resolve("glGetVertexAttribdv");
+	glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)lazy_resolve("glGetVertexAttribfv");
+	glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)lazy_resolve("glGetVertexAttribiv");
+	glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)lazy_resolve("glGetVertexAttribPointerv");
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY lazy_glIsProgram(GLuint program) {
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)lazy_resolve("glIsProgram");
+	return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY lazy_glIsShader(GLuint shader) {
+	glad_glIsShader = (PFNGLISSHADERPROC)lazy_resolve("glIsShader");
+	return glad_glIsShader(shader);
+}
+static void APIENTRY lazy_glLinkProgram(GLuint program) {
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)lazy_resolve("glLinkProgram");
+	glad_glLinkProgram(program);
+}
+static void APIENTRY lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)lazy_resolve("glShaderSource");
+	glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY lazy_glUseProgram(GLuint program) {
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)lazy_resolve("glUseProgram");
+	glad_glUseProgram(program);
+}
+static void APIENTRY lazy_glUniform1f(GLint location, GLfloat v0) {
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)lazy_resolve("glUniform1f");
+	glad_glUniform1f(location, v0);
+}
+static void APIENTRY lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)lazy_resolve("glUniform2f");
+	glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)lazy_resolve("glUniform3f");
+	glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)lazy_resolve("glUniform4f");
+	glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1i(GLint location, GLint v0) {
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)lazy_resolve("glUniform1i");
+	glad_glUniform1i(location, v0);
+}
+static void APIENTRY lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)lazy_resolve("glUniform2i");
+	glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)lazy_resolve("glUniform3i");
+	glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)lazy_resolve("glUniform4i");
+	glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)lazy_resolve("glUniform1fv");
+	glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)lazy_resolve("glUniform2fv");
+	glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)lazy_resolve("glUniform3fv");
+	glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)lazy_resolve("glUniform4fv");
+	glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)lazy_resolve("glUniform1iv");
+	glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)lazy_resolve("glUniform2iv");
+	glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)lazy_resolve("glUniform3iv");
+	glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)lazy_resolve("glUniform4iv");
+	glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)lazy_resolve("glUniformMatrix2fv");
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)lazy_resolve("glUniformMatrix3fv");
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)lazy_resolve("glUniformMatrix4fv");
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glValidateProgram(GLuint program) {
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)lazy_resolve("glValidateProgram");
+	glad_glValidateProgram(program);
+}
+static void APIENTRY lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)lazy_resolve("glVertexAttrib1d");
+	glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)lazy_resolve("glVertexAttrib1dv");
+	glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)lazy_resolve("glVertexAttrib1f");
+	glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)lazy_resolve("glVertexAttrib1fv");
+	glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)lazy_resolve("glVertexAttrib1s");
+	glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)lazy_resolve("glVertexAttrib1sv");
+	glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)lazy_resolve("glVertexAttrib2d");
+	glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)lazy_resolve("glVertexAttrib2dv");
+	glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)lazy_resolve("glVertexAttrib2f");
+	glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)lazy_resolve("glVertexAttrib2fv");
+	glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)lazy_resolve("glVertexAttrib2s");
+	glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)lazy_resolve("glVertexAttrib2sv");
+	glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)lazy_resolve("glVertexAttrib3d");
+	glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)lazy_resolve("glVertexAttrib3dv");
+	glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)lazy_resolve("glVertexAttrib3f");
+	glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)lazy_resolve("glVertexAttrib3fv");
+	glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)lazy_resolve("glVertexAttrib3s");
+	glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)lazy_resolve("glVertexAttrib3sv");
+	glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)lazy_resolve("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)lazy_resolve("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)lazy_resolve("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)lazy_resolve("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)lazy_resolve("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)lazy_resolve("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)lazy_resolve("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)lazy_resolve("glVertexAttrib4bv");
+	glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)lazy_resolve("glVertexAttrib4d");
+	glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)lazy_resolve("glVertexAttrib4dv");
+	glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)lazy_resolve("glVertexAttrib4f");
+	glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)lazy_resolve("glVertexAttrib4fv");
+	glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)lazy_resolve("glVertexAttrib4iv");
+	glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)lazy_resolve("glVertexAttrib4s");
+	glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)lazy_resolve("glVertexAttrib4sv");
+	glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)lazy_resolve("glVertexAttrib4ubv");
+	glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)lazy_resolve("glVertexAttrib4uiv");
+	glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)lazy_resolve("glVertexAttrib4usv");
+	glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)lazy_resolve("glVertexAttribPointer");
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)lazy_resolve("glUniformMatrix2x3fv");
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)lazy_resolve("glUniformMatrix3x2fv");
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)lazy_resolve("glUniformMatrix2x4fv");
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)lazy_resolve("glUniformMatrix4x2fv");
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)lazy_resolve("glUniformMatrix3x4fv");
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)lazy_resolve("glUniformMatrix4x3fv");
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)lazy_resolve("glColorMaski");
+	glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)lazy_resolve("glGetBooleani_v");
+	glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)lazy_resolve("glGetIntegeri_v");
+	glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY lazy_glEnablei(GLenum target, GLuint index) {
+	glad_glEnablei = (PFNGLENABLEIPROC)lazy_resolve("glEnablei");
+	glad_glEnablei(target, index);
+}
+static void APIENTRY lazy_glDisablei(GLenum target, GLuint index) {
+	glad_glDisablei = (PFNGLDISABLEIPROC)lazy_resolve("glDisablei");
+	glad_glDisablei(target, index);
+}
+static GLboolean APIENTRY lazy_glIsEnabledi(GLenum target, GLuint index) {
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)lazy_resolve("glIsEnabledi");
+	return glad_glIsEnabledi(target, index);
+}
+static void APIENTRY lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)lazy_resolve("glBeginTransformFeedback");
+	glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY lazy_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)lazy_resolve("glEndTransformFeedback");
+	glad_glEndTransformFeedback();
+}
+static void APIENTRY lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)lazy_resolve("glBindBufferRange");
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)lazy_resolve("glBindBufferBase");
+	glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)lazy_resolve("glTransformFeedbackVaryings");
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)lazy_resolve("glGetTransformFeedbackVarying");
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glClampColor(GLenum target, GLenum clamp) {
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)lazy_resolve("glClampColor");
+	glad_glClampColor(target, clamp);
+}
+static void APIENTRY lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)lazy_resolve("glBeginConditionalRender");
+	glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY lazy_glEndConditionalRender(void) {
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)lazy_resolve("glEndConditionalRender");
+	glad_glEndConditionalRender();
+}
+static void APIENTRY lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)lazy_resolve("glVertexAttribIPointer");
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)lazy_resolve("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)lazy_resolve("glGetVertexAttribIuiv");
+	glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)lazy_resolve("glVertexAttribI1i");
+	glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)lazy_resolve("glVertexAttribI2i");
+	glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)lazy_resolve("glVertexAttribI3i");
+	glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)lazy_resolve("glVertexAttribI4i");
+	glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)lazy_resolve("glVertexAttribI1ui");
+	glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)lazy_resolve("glVertexAttribI2ui");
+	glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)lazy_resolve("glVertexAttribI3ui");
+	glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)lazy_resolve("glVertexAttribI4ui");
+	glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)lazy_resolve("glVertexAttribI1iv");
+	glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)lazy_resolve("glVertexAttribI2iv");
+	glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)lazy_resolve("glVertexAttribI3iv");
+	glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)lazy_resolve("glVertexAttribI4iv");
+	glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)lazy_resolve("glVertexAttribI1uiv");
+	glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)lazy_resolve("glVertexAttribI2uiv");
+	glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)lazy_resolve("glVertexAttribI3uiv");
+	glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)lazy_resolve("glVertexAttribI4uiv");
+	glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)lazy_resolve("glVertexAttribI4bv");
+	glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)lazy_resolve("glVertexAttribI4sv");
+	glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)lazy_resolve("glVertexAttribI4ubv");
+	glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)lazy_resolve("glVertexAttribI4usv");
+	glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)lazy_resolve("glGetUniformuiv");
+	glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)lazy_resolve("glBindFragDataLocation");
+	glad_glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)lazy_resolve("glGetFragDataLocation");
+	return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY lazy_glUniform1ui(GLint location, GLuint v0) {
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)lazy_resolve("glUniform1ui");
+	glad_glUniform1ui(location, v0);
+}
+static void APIENTRY lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)lazy_resolve("glUniform2ui");
+	glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)lazy_resolve("glUniform3ui");
+	glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)lazy_resolve("glUniform4ui");
+	glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)lazy_resolve("glUniform1uiv");
+	glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)lazy_resolve("glUniform2uiv");
+	glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)lazy_resolve("glUniform3uiv");
+	glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)lazy_resolve("glUniform4uiv");
+	glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)lazy_resolve("glTexParameterIiv");
+	glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)lazy_resolve("glTexParameterIuiv");
+	glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)lazy_resolve("glGetTexParameterIiv");
+	glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)lazy_resolve("glGetTexParameterIuiv");
+	glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)lazy_resolve("glClearBufferiv");
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)lazy_resolve("glClearBufferuiv");
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)lazy_resolve("glClearBufferfv");
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)lazy_resolve("glClearBufferfi");
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY lazy_glGetStringi(GLenum name, GLuint index) {
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)lazy_resolve("glGetStringi");
+	return glad_glGetStringi(name, index);
+}
+static GLboolean APIENTRY lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)lazy_resolve("glIsRenderbuffer");
+	return glad_glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)lazy_resolve("glBindRenderbuffer");
+	glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)lazy_resolve("glDeleteRenderbuffers");
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)lazy_resolve("glGenRenderbuffers");
+	glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)lazy_resolve("glRenderbufferStorage");
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)lazy_resolve("glGetRenderbufferParameteriv");
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsFramebuffer(GLuint framebuffer) {
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)lazy_resolve("glIsFramebuffer");
+	return glad_glIsFramebuffer(framebuffer);
+}
+static void APIENTRY lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)lazy_resolve("glBindFramebuffer");
+	glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)lazy_resolve("glDeleteFramebuffers");
+	glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)lazy_resolve("glGenFramebuffers");
+	glad_glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY lazy_glCheckFramebufferStatus(GLenum target) {
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)lazy_resolve("glCheckFramebufferStatus");
+	return glad_glCheckFramebufferStatus(target);
+}
+static void APIENTRY lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)lazy_resolve("glFramebufferTexture1D");
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)lazy_resolve("glFramebufferTexture2D");
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)lazy_resolve("glFramebufferTexture3D");
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)lazy_resolve("glFramebufferRenderbuffer");
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)lazy_resolve("glGetFramebufferAttachmentParameteriv");
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY lazy_glGenerateMipmap(GLenum target) {
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)lazy_resolve("glGenerateMipmap");
+	glad_glGenerateMipmap(target);
+}
+static void APIENTRY lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)lazy_resolve("glBlitFramebuffer");
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)lazy_resolve("glRenderbufferStorageMultisample");
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)lazy_resolve("glFramebufferTextureLayer");
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void * APIENTRY lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)lazy_resolve("glMapBufferRange");
+	return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)lazy_resolve("glFlushMappedBufferRange");
+	glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY lazy_glBindVertexArray(GLuint array) {
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)lazy_resolve("glBindVertexArray");
+	glad_glBindVertexArray(array);
+}
+static void APIENTRY lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)lazy_resolve("glDeleteVertexArrays");
+	glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)lazy_resolve("glGenVertexArrays");
+	glad_glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY lazy_glIsVertexArray(GLuint array) {
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)lazy_resolve("glIsVertexArray");
+	return glad_glIsVertexArray(array);
+}
+static void APIENTRY lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)lazy_resolve("glDrawArraysInstanced");
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)lazy_resolve("glDrawElementsInstanced");
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)lazy_resolve("glTexBuffer");
+	glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY lazy_glPrimitiveRestartIndex(GLuint index) {
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)lazy_resolve("glPrimitiveRestartIndex");
+	glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)lazy_resolve("glCopyBufferSubData");
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)lazy_resolve("glGetUniformIndices");
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)lazy_resolve("glGetActiveUniformsiv");
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)lazy_resolve("glGetActiveUniformName");
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)lazy_resolve("glGetUniformBlockIndex");
+	return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)lazy_resolve("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)lazy_resolve("glGetActiveUniformBlockName");
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)lazy_resolve("glUniformBlockBinding");
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)lazy_resolve("glDrawElementsBaseVertex");
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)lazy_resolve("glDrawRangeElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)lazy_resolve("glDrawElementsInstancedBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)lazy_resolve("glMultiDrawElementsBaseVertex");
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY lazy_glProvokingVertex(GLenum mode) {
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)lazy_resolve("glProvokingVertex");
+	glad_glProvokingVertex(mode);
+}
+static GLsync APIENTRY lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)lazy_resolve("glFenceSync");
+	return glad_glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY lazy_glIsSync(GLsync sync) {
+	glad_glIsSync = (PFNGLISSYNCPROC)lazy_resolve("glIsSync");
+	return glad_glIsSync(sync);
+}
+static void APIENTRY lazy_glDeleteSync(GLsync sync) {
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)lazy_resolve("glDeleteSync");
+	glad_glDeleteSync(sync);
+}
+static GLenum APIENTRY lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)lazy_resolve("glClientWaitSync");
+	return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)lazy_resolve("glWaitSync");
+	glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)lazy_resolve("glGetInteger64v");
+	glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)lazy_resolve("glGetSynciv");
+	glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)lazy_resolve("glGetInteger64i_v");
+	glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)lazy_resolve("glGetBufferParameteri64v");
+	glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)lazy_resolve("glFramebufferTexture");
+	glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)lazy_resolve("glTexImage2DMultisample");
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)lazy_resolve("glTexImage3DMultisample");
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)lazy_resolve("glGetMultisamplefv");
+	glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)lazy_resolve("glSampleMaski");
+	glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)lazy_resolve("glBindFragDataLocationIndexed");
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)lazy_resolve("glGetFragDataIndex");
+	return glad_glGetFragDataIndex(program, name);
+}
+static void APIENTRY lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)lazy_resolve("glGenSamplers");
+	glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)lazy_resolve("glDeleteSamplers");
+	glad_glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY lazy_glIsSampler(GLuint sampler) {
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)lazy_resolve("glIsSampler");
+	return glad_glIsSampler(sampler);
+}
+static void APIENTRY lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)lazy_resolve("glBindSampler");
+	glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)lazy_resolve("glSamplerParameteri");
+	glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)lazy_resolve("glSamplerParameteriv");
+	glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)lazy_resolve("glSamplerParameterf");
+	glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)lazy_resolve("glSamplerParameterfv");
+	glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)lazy_resolve("glSamplerParameterIiv");
+	glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)lazy_resolve("glSamplerParameterIuiv");
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)lazy_resolve("glGetSamplerParameteriv");
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)lazy_resolve("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)lazy_resolve("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)lazy_resolve("glGetSamplerParameterIuiv");
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glQueryCounter(GLuint id, GLenum target) {
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)lazy_resolve("glQueryCounter");
+	glad_glQueryCounter(id, target);
+}
+static void APIENTRY lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)lazy_resolve("glGetQueryObjecti64v");
+	glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)lazy_resolve("glGetQueryObjectui64v");
+	glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)lazy_resolve("glVertexAttribDivisor");
+	glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)lazy_resolve("glVertexAttribP1ui");
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)lazy_resolve("glVertexAttribP1uiv");
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)lazy_resolve("glVertexAttribP2ui");
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)lazy_resolve("glVertexAttribP2uiv");
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)lazy_resolve("glVertexAttribP3ui");
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)lazy_resolve("glVertexAttribP3uiv");
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)lazy_resolve("glVertexAttribP4ui");
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)lazy_resolve("glVertexAttribP4uiv");
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexP2ui(GLenum type, GLuint value) {
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)lazy_resolve("glVertexP2ui");
+	glad_glVertexP2ui(type, value);
+}
+static void APIENTRY lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)lazy_resolve("glVertexP2uiv");
+	glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP3ui(GLenum type, GLuint value) {
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)lazy_resolve("glVertexP3ui");
+	glad_glVertexP3ui(type, value);
+}
+static void APIENTRY lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)lazy_resolve("glVertexP3uiv");
+	glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP4ui(GLenum type, GLuint value) {
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)lazy_resolve("glVertexP4ui");
+	glad_glVertexP4ui(type, value);
+}
+static void APIENTRY lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)lazy_resolve("glVertexP4uiv");
+	glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)lazy_resolve("glTexCoordP1ui");
+	glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)lazy_resolve("glTexCoordP1uiv");
+	glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)lazy_resolve("glTexCoordP2ui");
+	glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)lazy_resolve("glTexCoordP2uiv");
+	glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)lazy_resolve("glTexCoordP3ui");
+	glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)lazy_resolve("glTexCoordP3uiv");
+	glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)lazy_resolve("glTexCoordP4ui");
+	glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)lazy_resolve("glTexCoordP4uiv");
+	glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)lazy_resolve("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)lazy_resolve("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)lazy_resolve("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)lazy_resolve("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)lazy_resolve("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)lazy_resolve("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)lazy_resolve("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)lazy_resolve("glMultiTexCoordP4uiv");
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)lazy_resolve("glNormalP3ui");
+	glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)lazy_resolve("glNormalP3uiv");
+	glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY lazy_glColorP3ui(GLenum type, GLuint color) {
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)lazy_resolve("glColorP3ui");
+	glad_glColorP3ui(type, color);
+}
+static void APIENTRY lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)lazy_resolve("glColorP3uiv");
+	glad_glColorP3uiv(type, color);
+}
+static void APIENTRY lazy_glColorP4ui(GLenum type, GLuint color) {
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)lazy_resolve("glColorP4ui");
+	glad_glColorP4ui(type, color);
+}
+static void APIENTRY lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)lazy_resolve("glColorP4uiv");
+	glad_glColorP4uiv(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)lazy_resolve("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)lazy_resolve("glSecondaryColorP3uiv");
+	glad_glSecondaryColorP3uiv(type, color);
+}
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = lazy_glCullFace;
+	glad_glFrontFace = lazy_glFrontFace;
+	glad_glHint = lazy_glHint;
+	glad_glLineWidth = lazy_glLineWidth;
+	glad_glPointSize = lazy_glPointSize;
+	glad_glPolygonMode = lazy_glPolygonMode;
+	glad_glScissor = lazy_glScissor;
+	glad_glTexParameterf = lazy_glTexParameterf;
+	glad_glTexParameterfv = lazy_glTexParameterfv;
+	glad_glTexParameteri = lazy_glTexParameteri;
+	glad_glTexParameteriv = lazy_glTexParameteriv;
+	glad_glTexImage1D = lazy_glTexImage1D;
+	glad_glTexImage2D = lazy_glTexImage2D;
+	glad_glDrawBuffer = lazy_glDrawBuffer;
+	glad_glClear = lazy_glClear;
+	glad_glClearColor = lazy_glClearColor;
+	glad_glClearStencil = lazy_glClearStencil;
+	glad_glClearDepth = lazy_glClearDepth;
+	glad_glStencilMask = lazy_glStencilMask;
+	glad_glColorMask = lazy_glColorMask;
+	glad_glDepthMask = lazy_glDepthMask;
+	glad_glDisable = lazy_glDisable;
+	glad_glEnable = lazy_glEnable;
+	glad_glFinish = lazy_glFinish;
+	glad_glFlush = lazy_glFlush;
+	glad_glBlendFunc = lazy_glBlendFunc;
+	glad_glLogicOp = lazy_glLogicOp;
+	glad_glStencilFunc = lazy_glStencilFunc;
+	glad_glStencilOp = lazy_glStencilOp;
+	glad_glDepthFunc = lazy_glDepthFunc;
+	glad_glPixelStoref = lazy_glPixelStoref;
+	glad_glPixelStorei = lazy_glPixelStorei;
+	glad_glReadBuffer = lazy_glReadBuffer;
+	glad_glReadPixels = lazy_glReadPixels;
+	glad_glGetBooleanv = lazy_glGetBooleanv;
+	glad_glGetDoublev = lazy_glGetDoublev;
+	glad_glGetError = lazy_glGetError;
+	glad_glGetFloatv = lazy_glGetFloatv;
+	glad_glGetIntegerv = lazy_glGetIntegerv;
+	glad_glGetTexImage = lazy_glGetTexImage;
+	glad_glGetTexParameterfv = lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = lazy_glIsEnabled;
+	glad_glDepthRange = lazy_glDepthRange;
+	glad_glViewport = lazy_glViewport;
+	glad_glNewList = lazy_glNewList;
+	glad_glEndList = lazy_glEndList;
+	glad_glCallList = lazy_glCallList;
+	glad_glCallLists = lazy_glCallLists;
+	glad_glDeleteLists = lazy_glDeleteLists;
+	glad_glGenLists = lazy_glGenLists;
+	glad_glListBase = lazy_glListBase;
+	glad_glBegin = lazy_glBegin;
+	glad_glBitmap = lazy_glBitmap;
+	glad_glColor3b = lazy_glColor3b;
+	glad_glColor3bv = lazy_glColor3bv;
+	glad_glColor3d = lazy_glColor3d;
+	glad_glColor3dv = lazy_glColor3dv;
+	glad_glColor3f = lazy_glColor3f;
+	glad_glColor3fv = lazy_glColor3fv;
+	glad_glColor3i = lazy_glColor3i;
+	glad_glColor3iv = lazy_glColor3iv;
+	glad_glColor3s = lazy_glColor3s;
+	glad_glColor3sv = lazy_glColor3sv;
+	glad_glColor3ub = lazy_glColor3ub;
+	glad_glColor3ubv = lazy_glColor3ubv;
+	glad_glColor3ui = lazy_glColor3ui;
+	glad_glColor3uiv = lazy_glColor3uiv;
+	glad_glColor3us = lazy_glColor3us;
+	glad_glColor3usv = lazy_glColor3usv;
+	glad_glColor4b = lazy_glColor4b;
+	glad_glColor4bv = lazy_glColor4bv;
+	glad_glColor4d = lazy_glColor4d;
+	glad_glColor4dv = lazy_glColor4dv;
+	glad_glColor4f = lazy_glColor4f;
+	glad_glColor4fv = lazy_glColor4fv;
+	glad_glColor4i = lazy_glColor4i;
+	glad_glColor4iv = lazy_glColor4iv;
+	glad_glColor4s = lazy_glColor4s;
+	glad_glColor4sv = lazy_glColor4sv;
+	glad_glColor4ub = lazy_glColor4ub;
+	glad_glColor4ubv = lazy_glColor4ubv;
+	glad_glColor4ui = lazy_glColor4ui;
+	glad_glColor4uiv = lazy_glColor4uiv;
+	glad_glColor4us = lazy_glColor4us;
+	glad_glColor4usv = lazy_glColor4usv;
+	glad_glEdgeFlag = lazy_glEdgeFlag;
+	glad_glEdgeFlagv = lazy_glEdgeFlagv;
+	glad_glEnd = lazy_glEnd;
+	glad_glIndexd = lazy_glIndexd;
+	glad_glIndexdv = lazy_glIndexdv;
+	glad_glIndexf = lazy_glIndexf;
+	glad_glIndexfv = lazy_glIndexfv;
+	glad_glIndexi = lazy_glIndexi;
+	glad_glIndexiv = lazy_glIndexiv;
+	glad_glIndexs = lazy_glIndexs;
+	glad_glIndexsv = lazy_glIndexsv;
+	glad_glNormal3b = lazy_glNormal3b;
+	glad_glNormal3bv = lazy_glNormal3bv;
+	glad_glNormal3d = lazy_glNormal3d;
+	glad_glNormal3dv = lazy_glNormal3dv;
+	glad_glNormal3f = lazy_glNormal3f;
+	glad_glNormal3fv = lazy_glNormal3fv;
+	glad_glNormal3i = lazy_glNormal3i;
+	glad_glNormal3iv = lazy_glNormal3iv;
+	glad_glNormal3s = lazy_glNormal3s;
+	glad_glNormal3sv = lazy_glNormal3sv;
+	glad_glRasterPos2d = lazy_glRasterPos2d;
+	glad_glRasterPos2dv = lazy_glRasterPos2dv;
+	glad_glRasterPos2f = lazy_glRasterPos2f;
+	glad_glRasterPos2fv = lazy_glRasterPos2fv;
+	glad_glRasterPos2i = lazy_glRasterPos2i;
+	glad_glRasterPos2iv = lazy_glRasterPos2iv;
+	glad_glRasterPos2s = lazy_glRasterPos2s;
+	glad_glRasterPos2sv = lazy_glRasterPos2sv;
+	glad_glRasterPos3d = lazy_glRasterPos3d;
+	glad_glRasterPos3dv = lazy_glRasterPos3dv;
+	glad_glRasterPos3f = lazy_glRasterPos3f;
+	glad_glRasterPos3fv = lazy_glRasterPos3fv;
+	glad_glRasterPos3i = lazy_glRasterPos3i;
+	glad_glRasterPos3iv = lazy_glRasterPos3iv;
+	glad_glRasterPos3s = lazy_glRasterPos3s;
+	glad_glRasterPos3sv = lazy_glRasterPos3sv;
+	glad_glRasterPos4d = lazy_glRasterPos4d;
+	glad_glRasterPos4dv = lazy_glRasterPos4dv;
+	glad_glRasterPos4f = lazy_glRasterPos4f;
+	glad_glRasterPos4fv = lazy_glRasterPos4fv;
+	glad_glRasterPos4i = lazy_glRasterPos4i;
+	glad_glRasterPos4iv = lazy_glRasterPos4iv;
+	glad_glRasterPos4s = lazy_glRasterPos4s;
+	glad_glRasterPos4sv = lazy_glRasterPos4sv;
+	glad_glRectd = lazy_glRectd;
+	glad_glRectdv = lazy_glRectdv;
+	glad_glRectf = lazy_glRectf;
+	glad_glRectfv = lazy_glRectfv;
+	glad_glRecti = lazy_glRecti;
+	glad_glRectiv = lazy_glRectiv;
+	glad_glRects = lazy_glRects;
+	glad_glRectsv = lazy_glRectsv;
+	glad_glTexCoord1d = lazy_glTexCoord1d;
+	glad_glTexCoord1dv = lazy_glTexCoord1dv;
+	glad_glTexCoord1f = lazy_glTexCoord1f;
+	glad_glTexCoord1fv = lazy_glTexCoord1fv;
+	glad_glTexCoord1i = lazy_glTexCoord1i;
+	glad_glTexCoord1iv = lazy_glTexCoord1iv;
+	glad_glTexCoord1s = lazy_glTexCoord1s;
+	glad_glTexCoord1sv = lazy_glTexCoord1sv;
+	glad_glTexCoord2d = lazy_glTexCoord2d;
+	glad_glTexCoord2dv = lazy_glTexCoord2dv;
+	glad_glTexCoord2f = lazy_glTexCoord2f;
+	glad_glTexCoord2fv = lazy_glTexCoord2fv;
+	glad_glTexCoord2i = lazy_glTexCoord2i;
+	glad_glTexCoord2iv = lazy_glTexCoord2iv;
+	glad_glTexCoord2s = lazy_glTexCoord2s;
+	glad_glTexCoord2sv = lazy_glTexCoord2sv;
+	glad_glTexCoord3d = lazy_glTexCoord3d;
+	glad_glTexCoord3dv = lazy_glTexCoord3dv;
+	glad_glTexCoord3f = lazy_glTexCoord3f;
+	glad_glTexCoord3fv = lazy_glTexCoord3fv;
+	glad_glTexCoord3i = lazy_glTexCoord3i;
+	glad_glTexCoord3iv = lazy_glTexCoord3iv;
+	glad_glTexCoord3s = lazy_glTexCoord3s;
+	glad_glTexCoord3sv = lazy_glTexCoord3sv;
+	glad_glTexCoord4d = lazy_glTexCoord4d;
+	glad_glTexCoord4dv = lazy_glTexCoord4dv;
+	glad_glTexCoord4f = lazy_glTexCoord4f;
+	glad_glTexCoord4fv = lazy_glTexCoord4fv;
+	glad_glTexCoord4i = lazy_glTexCoord4i;
+	glad_glTexCoord4iv = lazy_glTexCoord4iv;
+	glad_glTexCoord4s = lazy_glTexCoord4s;
+	glad_glTexCoord4sv = lazy_glTexCoord4sv;
+	glad_glVertex2d = lazy_glVertex2d;
+	glad_glVertex2dv = lazy_glVertex2dv;
+	glad_glVertex2f = lazy_glVertex2f;
+	glad_glVertex2fv = lazy_glVertex2fv;
+	glad_glVertex2i = lazy_glVertex2i;
+	glad_glVertex2iv = lazy_glVertex2iv;
+	glad_glVertex2s = lazy_glVertex2s;
+	glad_glVertex2sv = lazy_glVertex2sv;
+	glad_glVertex3d = lazy_glVertex3d;
+	glad_glVertex3dv = lazy_glVertex3dv;
+	glad_glVertex3f = lazy_glVertex3f;
+	glad_glVertex3fv = lazy_glVertex3fv;
+	glad_glVertex3i = lazy_glVertex3i;
+	glad_glVertex3iv = lazy_glVertex3iv;
+	glad_glVertex3s = lazy_glVertex3s;
+	glad_glVertex3sv = lazy_glVertex3sv;
+	glad_glVertex4d = lazy_glVertex4d;
+	glad_glVertex4dv = lazy_glVertex4dv;
+	glad_glVertex4f = lazy_glVertex4f;
+	glad_glVertex4fv = lazy_glVertex4fv;
+	glad_glVertex4i = lazy_glVertex4i;
+	glad_glVertex4iv = lazy_glVertex4iv;
+	glad_glVertex4s = lazy_glVertex4s;
+	glad_glVertex4sv = lazy_glVertex4sv;
+	glad_glClipPlane = lazy_glClipPlane;
+	glad_glColorMaterial = lazy_glColorMaterial;
+	glad_glFogf = lazy_glFogf;
+	glad_glFogfv = lazy_glFogfv;
+	glad_glFogi = lazy_glFogi;
+	glad_glFogiv = lazy_glFogiv;
+	glad_glLightf = lazy_glLightf;
+	glad_glLightfv = lazy_glLightfv;
+	glad_glLighti = lazy_glLighti;
+	glad_glLightiv = lazy_glLightiv;
+	glad_glLightModelf = lazy_glLightModelf;
+	glad_glLightModelfv = lazy_glLightModelfv;
+	glad_glLightModeli = lazy_glLightModeli;
+	glad_glLightModeliv = lazy_glLightModeliv;
+	glad_glLineStipple = lazy_glLineStipple;
+	glad_glMaterialf = lazy_glMaterialf;
+	glad_glMaterialfv = lazy_glMaterialfv;
+	glad_glMateriali = lazy_glMateriali;
+	glad_glMaterialiv = lazy_glMaterialiv;
+	glad_glPolygonStipple = lazy_glPolygonStipple;
+	glad_glShadeModel = lazy_glShadeModel;
+	glad_glTexEnvf = lazy_glTexEnvf;
+	glad_glTexEnvfv = lazy_glTexEnvfv;
+	glad_glTexEnvi = lazy_glTexEnvi;
+	glad_glTexEnviv = lazy_glTexEnviv;
+	glad_glTexGend = lazy_glTexGend;
+	glad_glTexGendv = lazy_glTexGendv;
+	glad_glTexGenf = lazy_glTexGenf;
+	glad_glTexGenfv = lazy_glTexGenfv;
+	glad_glTexGeni = lazy_glTexGeni;
+	glad_glTexGeniv = lazy_glTexGeniv;
+	glad_glFeedbackBuffer = lazy_glFeedbackBuffer;
+	glad_glSelectBuffer = lazy_glSelectBuffer;
+	glad_glRenderMode = lazy_glRenderMode;
+	glad_glInitNames = lazy_glInitNames;
+	glad_glLoadName = lazy_glLoadName;
+	glad_glPassThrough = lazy_glPassThrough;
+	glad_glPopName = lazy_glPopName;
+	glad_glPushName = lazy_glPushName;
+	glad_glClearAccum = lazy_glClearAccum;
+	glad_glClearIndex = lazy_glClearIndex;
+	glad_glIndexMask = lazy_glIndexMask;
+	glad_glAccum = lazy_glAccum;
+	glad_glPopAttrib = lazy_glPopAttrib;
+	glad_glPushAttrib = lazy_glPushAttrib;
+	glad_glMap1d = lazy_glMap1d;
+	glad_glMap1f = lazy_glMap1f;
+	glad_glMap2d = lazy_glMap2d;
+	glad_glMap2f = lazy_glMap2f;
+	glad_glMapGrid1d = lazy_glMapGrid1d;
+	glad_glMapGrid1f = lazy_glMapGrid1f;
+	glad_glMapGrid2d = lazy_glMapGrid2d;
+	glad_glMapGrid2f = lazy_glMapGrid2f;
+	glad_glEvalCoord1d = lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = lazy_glEvalMesh1;
+	glad_glEvalPoint1 = lazy_glEvalPoint1;
+	glad_glEvalMesh2 = lazy_glEvalMesh2;
+	glad_glEvalPoint2 = lazy_glEvalPoint2;
+	glad_glAlphaFunc = lazy_glAlphaFunc;
+	glad_glPixelZoom = lazy_glPixelZoom;
+	glad_glPixelTransferf = lazy_glPixelTransferf;
+	glad_glPixelTransferi = lazy_glPixelTransferi;
+	glad_glPixelMapfv = lazy_glPixelMapfv;
+	glad_glPixelMapuiv = lazy_glPixelMapuiv;
+	glad_glPixelMapusv = lazy_glPixelMapusv;
+	glad_glCopyPixels = lazy_glCopyPixels;
+	glad_glDrawPixels = lazy_glDrawPixels;
+	glad_glGetClipPlane = lazy_glGetClipPlane;
+	glad_glGetLightfv = lazy_glGetLightfv;
+	glad_glGetLightiv = lazy_glGetLightiv;
+	glad_glGetMapdv = lazy_glGetMapdv;
+	glad_glGetMapfv = lazy_glGetMapfv;
+	glad_glGetMapiv = lazy_glGetMapiv;
+	glad_glGetMaterialfv = lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = lazy_glGetMaterialiv;
+	glad_glGetPixelMapfv = lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = lazy_glGetPixelMapusv;
+	glad_glGetPolygonStipple = lazy_glGetPolygonStipple;
+	glad_glGetTexEnvfv = lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = lazy_glGetTexEnviv;
+	glad_glGetTexGendv = lazy_glGetTexGendv;
+	glad_glGetTexGenfv = lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = lazy_glGetTexGeniv;
+	glad_glIsList = lazy_glIsList;
+	glad_glFrustum = lazy_glFrustum;
+	glad_glLoadIdentity = lazy_glLoadIdentity;
+	glad_glLoadMatrixf = lazy_glLoadMatrixf;
+	glad_glLoadMatrixd = lazy_glLoadMatrixd;
+	glad_glMatrixMode = lazy_glMatrixMode;
+	glad_glMultMatrixf = lazy_glMultMatrixf;
+	glad_glMultMatrixd = lazy_glMultMatrixd;
+	glad_glOrtho = lazy_glOrtho;
+	glad_glPopMatrix = lazy_glPopMatrix;
+	glad_glPushMatrix = lazy_glPushMatrix;
+	glad_glRotated = lazy_glRotated;
+	glad_glRotatef = lazy_glRotatef;
+	glad_glScaled = lazy_glScaled;
+	glad_glScalef = lazy_glScalef;
+	glad_glTranslated = lazy_glTranslated;
+	glad_glTranslatef = lazy_glTranslatef;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = lazy_glDrawArrays;
+	glad_glDrawElements = lazy_glDrawElements;
+	glad_glGetPointerv = lazy_glGetPointerv;
+	glad_glPolygonOffset = lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = lazy_glTexSubImage2D;
+	glad_glBindTexture = lazy_glBindTexture;
+	glad_glDeleteTextures = lazy_glDeleteTextures;
+	glad_glGenTextures = lazy_glGenTextures;
+	glad_glIsTexture = lazy_glIsTexture;
+	glad_glArrayElement = lazy_glArrayElement;
+	glad_glColorPointer = lazy_glColorPointer;
+	glad_glDisableClientState = lazy_glDisableClientState;
+	glad_glEdgeFlagPointer = lazy_glEdgeFlagPointer;
+	glad_glEnableClientState = lazy_glEnableClientState;
+	glad_glIndexPointer = lazy_glIndexPointer;
+	glad_glInterleavedArrays = lazy_glInterleavedArrays;
+	glad_glNormalPointer = lazy_glNormalPointer;
+	glad_glTexCoordPointer = lazy_glTexCoordPointer;
+	glad_glVertexPointer = lazy_glVertexPointer;
+	glad_glAreTexturesResident = lazy_glAreTexturesResident;
+	glad_glPrioritizeTextures = lazy_glPrioritizeTextures;
+	glad_glIndexub = lazy_glIndexub;
+	glad_glIndexubv = lazy_glIndexubv;
+	glad_glPopClientAttrib = lazy_glPopClientAttrib;
+	glad_glPushClientAttrib = lazy_glPushClientAttrib;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = lazy_glDrawRangeElements;
+	glad_glTexImage3D = lazy_glTexImage3D;
+	glad_glTexSubImage3D = lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = lazy_glActiveTexture;
+	glad_glSampleCoverage = lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = lazy_glGetCompressedTexImage;
+	glad_glClientActiveTexture = lazy_glClientActiveTexture;
+	glad_glMultiTexCoord1d = lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = lazy_glMultiTexCoord4sv;
+	glad_glLoadTransposeMatrixf = lazy_glLoadTransposeMatrixf;
+	glad_glLoadTransposeMatrixd = lazy_glLoadTransposeMatrixd;
+	glad_glMultTransposeMatrixf = lazy_glMultTransposeMatrixf;
+	glad_glMultTransposeMatrixd = lazy_glMultTransposeMatrixd;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = lazy_glMultiDrawElements;
+	glad_glPointParameterf = lazy_glPointParameterf;
+	glad_glPointParameterfv = lazy_glPointParameterfv;
+	glad_glPointParameteri = lazy_glPointParameteri;
+	glad_glPointParameteriv = lazy_glPointParameteriv;
+	glad_glFogCoordf = lazy_glFogCoordf;
+	glad_glFogCoordfv = lazy_glFogCoordfv;
+	glad_glFogCoordd = lazy_glFogCoordd;
+	glad_glFogCoorddv = lazy_glFogCoorddv;
+	glad_glFogCoordPointer = lazy_glFogCoordPointer;
+	glad_glSecondaryColor3b = lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorPointer = lazy_glSecondaryColorPointer;
+	glad_glWindowPos2d = lazy_glWindowPos2d;
+	glad_glWindowPos2dv = lazy_glWindowPos2dv;
+	glad_glWindowPos2f = lazy_glWindowPos2f;
+	glad_glWindowPos2fv = lazy_glWindowPos2fv;
+	glad_glWindowPos2i = lazy_glWindowPos2i;
+	glad_glWindowPos2iv = lazy_glWindowPos2iv;
+	glad_glWindowPos2s = lazy_glWindowPos2s;
+	glad_glWindowPos2sv = lazy_glWindowPos2sv;
+	glad_glWindowPos3d = lazy_glWindowPos3d;
+	glad_glWindowPos3dv = lazy_glWindowPos3dv;
+	glad_glWindowPos3f = lazy_glWindowPos3f;
+	glad_glWindowPos3fv = lazy_glWindowPos3fv;
+	glad_glWindowPos3i = lazy_glWindowPos3i;
+	glad_glWindowPos3iv = lazy_glWindowPos3iv;
+	glad_glWindowPos3s = lazy_glWindowPos3s;
+	glad_glWindowPos3sv = lazy_glWindowPos3sv;
+	glad_glBlendColor = lazy_glBlendColor;
+	glad_glBlendEquation = lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = lazy_glGenQueries;
+	glad_glDeleteQueries = lazy_glDeleteQueries;
+	glad_glIsQuery = lazy_glIsQuery;
+	glad_glBeginQuery = lazy_glBeginQuery;
+	glad_glEndQuery = lazy_glEndQuery;
+	glad_glGetQueryiv = lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = lazy_glBindBuffer;
+	glad_glDeleteBuffers = lazy_glDeleteBuffers;
+	glad_glGenBuffers = lazy_glGenBuffers;
+	glad_glIsBuffer = lazy_glIsBuffer;
+	glad_glBufferData = lazy_glBufferData;
+	glad_glBufferSubData = lazy_glBufferSubData;
+	glad_glGetBufferSubData = lazy_glGetBufferSubData;
+	glad_glMapBuffer = lazy_glMapBuffer;
+	glad_glUnmapBuffer = lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = lazy_glStencilMaskSeparate;
+	glad_glAttachShader = lazy_glAttachShader;
+	glad_glBindAttribLocation = lazy_glBindAttribLocation;
+	glad_glCompileShader = lazy_glCompileShader;
+	glad_glCreateProgram = lazy_glCreateProgram;
+	glad_glCreateShader = lazy_glCreateShader;
+	glad_glDeleteProgram = lazy_glDeleteProgram;
+	glad_glDeleteShader = lazy_glDeleteShader;
+	glad_glDetachShader = lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = lazy_glGetAttribLocation;
+	glad_glGetProgramiv = lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = lazy_glGetShaderSource;
+	glad_glGetUniformLocation = lazy_glGetUniformLocation;
+	glad_glGetUniformfv = lazy_glGetUniformfv;
+	glad_glGetUniformiv = lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = lazy_glIsProgram;
+	glad_glIsShader = lazy_glIsShader;
+	glad_glLinkProgram = lazy_glLinkProgram;
+	glad_glShaderSource = lazy_glShaderSource;
+	glad_glUseProgram = lazy_glUseProgram;
+	glad_glUniform1f = lazy_glUniform1f;
+	glad_glUniform2f = lazy_glUniform2f;
+	glad_glUniform3f = lazy_glUniform3f;
+	glad_glUniform4f = lazy_glUniform4f;
+	glad_glUniform1i = lazy_glUniform1i;
+	glad_glUniform2i = lazy_glUniform2i;
+	glad_glUniform3i = lazy_glUniform3i;
+	glad_glUniform4i = lazy_glUniform4i;
+	glad_glUniform1fv = lazy_glUniform1fv;
+	glad_glUniform2fv = lazy_glUniform2fv;
+	glad_glUniform3fv = lazy_glUniform3fv;
+	glad_glUniform4fv = lazy_glUniform4fv;
+	glad_glUniform1iv = lazy_glUniform1iv;
+	glad_glUniform2iv = lazy_glUniform2iv;
+	glad_glUniform3iv = lazy_glUniform3iv;
+	glad_glUniform4iv = lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = lazy_glValidateProgram;
+	glad_glVertexAttrib1d = lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = lazy_glColorMaski;
+	glad_glGetBooleani_v = lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = lazy_glGetIntegeri_v;
+	glad_glEnablei = lazy_glEnablei;
+	glad_glDisablei = lazy_glDisablei;
+	glad_glIsEnabledi = lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = lazy_glBindBufferRange;
+	glad_glBindBufferBase = lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = lazy_glClampColor;
+	glad_glBeginConditionalRender = lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = lazy_glGetFragDataLocation;
+	glad_glUniform1ui = lazy_glUniform1ui;
+	glad_glUniform2ui = lazy_glUniform2ui;
+	glad_glUniform3ui = lazy_glUniform3ui;
+	glad_glUniform4ui = lazy_glUniform4ui;
+	glad_glUniform1uiv = lazy_glUniform1uiv;
+	glad_glUniform2uiv = lazy_glUniform2uiv;
+	glad_glUniform3uiv = lazy_glUniform3uiv;
+	glad_glUniform4uiv = lazy_glUniform4uiv;
+	glad_glTexParameterIiv = lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = lazy_glClearBufferiv;
+	glad_glClearBufferuiv = lazy_glClearBufferuiv;
+	glad_glClearBufferfv = lazy_glClearBufferfv;
+	glad_glClearBufferfi = lazy_glClearBufferfi;
+	glad_glGetStringi = lazy_glGetStringi;
+	glad_glIsRenderbuffer = lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = lazy_glGenVertexArrays;
+	glad_glIsVertexArray = lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = lazy_glBindBufferRange;
+	glad_glBindBufferBase = lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = lazy_glProvokingVertex;
+	glad_glFenceSync = lazy_glFenceSync;
+	glad_glIsSync = lazy_glIsSync;
+	glad_glDeleteSync = lazy_glDeleteSync;
+	glad_glClientWaitSync = lazy_glClientWaitSync;
+	glad_glWaitSync = lazy_glWaitSync;
+	glad_glGetInteger64v = lazy_glGetInteger64v;
+	glad_glGetSynciv = lazy_glGetSynciv;
+	glad_glGetInteger64i_v = lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = lazy_glGetMultisamplefv;
+	glad_glSampleMaski = lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = lazy_glGetFragDataIndex;
+	glad_glGenSamplers = lazy_glGenSamplers;
+	glad_glDeleteSamplers = lazy_glDeleteSamplers;
+	glad_glIsSampler = lazy_glIsSampler;
+	glad_glBindSampler = lazy_glBindSampler;
+	glad_glSamplerParameteri = lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = lazy_glVertexP2ui;
+	glad_glVertexP2uiv = lazy_glVertexP2uiv;
+	glad_glVertexP3ui = lazy_glVertexP3ui;
+	glad_glVertexP3uiv = lazy_glVertexP3uiv;
+	glad_glVertexP4ui = lazy_glVertexP4ui;
+	glad_glVertexP4uiv = lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = lazy_glNormalP3ui;
+	glad_glNormalP3uiv = lazy_glNormalP3uiv;
+	glad_glColorP3ui = lazy_glColorP3ui;
+	glad_glColorP3uiv = lazy_glColorP3uiv;
+	glad_glColorP4ui = lazy_glColorP4ui;
+	glad_glColorP4uiv = lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = lazy_glSecondaryColorP3uiv;
+}
+
+int gladLoadGLLoader(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glad_glGetString == NULL) return 0;
+	if(glad_glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	load_GL_VERSION_1_0(load);
+	load_GL_VERSION_1_1(load);
+	load_GL_VERSION_1_2(load);
+	load_GL_VERSION_1_3(load);
+	load_GL_VERSION_1_4(load);
+	load_GL_VERSION_1_5(load);
+	load_GL_VERSION_2_0(load);
+	load_GL_VERSION_2_1(load);
+	load_GL_VERSION_3_0(load);
+	load_GL_VERSION_3_1(load);
+	load_GL_VERSION_3_2(load);
+	load_GL_VERSION_3_3(load);
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	/* glGetString is always loaded up front, the version check needs it */
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glad_glGetString == NULL) return 0;
+	if(glad_glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_load = load;
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+#ifdef GLAD_DEBUG
+/* Debug build: every call goes through a wrapper that reports to the pre
+ * and post callbacks around the real function. Callbacks default to none. */
+static GLADcallback _pre_call_callback = NULL;
+static GLADcallback _post_call_callback = NULL;
+
+void glad_set_pre_callback(GLADcallback cb) {
+    _pre_call_callback = cb;
+}
+
+void glad_set_post_callback(GLADcallback cb) {
+    _post_call_callback = cb;
+}
+
+static void APIENTRY glad_debug_impl_glCullFace(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCullFace", (void*)glad_glCullFace, 1, mode);
+	glad_glCullFace(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glCullFace", (void*)glad_glCullFace, 1, mode);
+}
+PFNGLCULLFACEPROC glad_debug_glCullFace = glad_debug_impl_glCullFace;
+static void APIENTRY glad_debug_impl_glFrontFace(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFrontFace", (void*)glad_glFrontFace, 1, mode);
+	glad_glFrontFace(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glFrontFace", (void*)glad_glFrontFace, 1, mode);
+}
+PFNGLFRONTFACEPROC glad_debug_glFrontFace = glad_debug_impl_glFrontFace;
+static void APIENTRY glad_debug_impl_glHint(GLenum target, GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glHint", (void*)glad_glHint, 2, target, mode);
+	glad_glHint(target, mode);
+	if(_post_call_callback != NULL) _post_call_callback("glHint", (void*)glad_glHint, 2, target, mode);
+}
+PFNGLHINTPROC glad_debug_glHint = glad_debug_impl_glHint;
+static void APIENTRY glad_debug_impl_glLineWidth(GLfloat width) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLineWidth", (void*)glad_glLineWidth, 1, width);
+	glad_glLineWidth(width);
+	if(_post_call_callback != NULL) _post_call_callback("glLineWidth", (void*)glad_glLineWidth, 1, width);
+}
+PFNGLLINEWIDTHPROC glad_debug_glLineWidth = glad_debug_impl_glLineWidth;
+static void APIENTRY glad_debug_impl_glPointSize(GLfloat size) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPointSize", (void*)glad_glPointSize, 1, size);
+	glad_glPointSize(size);
+	if(_post_call_callback != NULL) _post_call_callback("glPointSize", (void*)glad_glPointSize, 1, size);
+}
+PFNGLPOINTSIZEPROC glad_debug_glPointSize = glad_debug_impl_glPointSize;
+static void APIENTRY glad_debug_impl_glPolygonMode(GLenum face, GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPolygonMode", (void*)glad_glPolygonMode, 2, face, mode);
+	glad_glPolygonMode(face, mode);
+	if(_post_call_callback != NULL) _post_call_callback("glPolygonMode", (void*)glad_glPolygonMode, 2, face, mode);
+}
+PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode = glad_debug_impl_glPolygonMode;
+static void APIENTRY glad_debug_impl_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glScissor", (void*)glad_glScissor, 4, x, y, width, height);
+	glad_glScissor(x, y, width, height);
+	if(_post_call_callback != NULL) _post_call_callback("glScissor", (void*)glad_glScissor, 4, x, y, width, height);
+}
+PFNGLSCISSORPROC glad_debug_glScissor = glad_debug_impl_glScissor;
+static void APIENTRY glad_debug_impl_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexParameterf", (void*)glad_glTexParameterf, 3, target, pname, param);
+	glad_glTexParameterf(target, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glTexParameterf", (void*)glad_glTexParameterf, 3, target, pname, param);
+}
+PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf = glad_debug_impl_glTexParameterf;
+static void APIENTRY glad_debug_impl_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexParameterfv", (void*)glad_glTexParameterfv, 3, target, pname, params);
+	glad_glTexParameterfv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexParameterfv", (void*)glad_glTexParameterfv, 3, target, pname, params);
+}
+PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv = glad_debug_impl_glTexParameterfv;
+static void APIENTRY glad_debug_impl_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexParameteri", (void*)glad_glTexParameteri, 3, target, pname, param);
+	glad_glTexParameteri(target, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glTexParameteri", (void*)glad_glTexParameteri, 3, target, pname, param);
+}
+PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri = glad_debug_impl_glTexParameteri;
+static void APIENTRY glad_debug_impl_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexParameteriv", (void*)glad_glTexParameteriv, 3, target, pname, params);
+	glad_glTexParameteriv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexParameteriv", (void*)glad_glTexParameteriv, 3, target, pname, params);
+}
+PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv = glad_debug_impl_glTexParameteriv;
+static void APIENTRY glad_debug_impl_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexImage1D", (void*)glad_glTexImage1D, 8, target, level, internalformat, width, border, format, type, pixels);
+	glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glTexImage1D", (void*)glad_glTexImage1D, 8, target, level, internalformat, width, border, format, type, pixels);
+}
+PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D = glad_debug_impl_glTexImage1D;
+static void APIENTRY glad_debug_impl_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexImage2D", (void*)glad_glTexImage2D, 9, target, level, internalformat, width, height, border, format, type, pixels);
+	glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glTexImage2D", (void*)glad_glTexImage2D, 9, target, level, internalformat, width, height, border, format, type, pixels);
+}
+PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D = glad_debug_impl_glTexImage2D;
+static void APIENTRY glad_debug_impl_glDrawBuffer(GLenum buf) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawBuffer", (void*)glad_glDrawBuffer, 1, buf);
+	glad_glDrawBuffer(buf);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawBuffer", (void*)glad_glDrawBuffer, 1, buf);
+}
+PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer = glad_debug_impl_glDrawBuffer;
+static void APIENTRY glad_debug_impl_glClear(GLbitfield mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClear", (void*)glad_glClear, 1, mask);
+	glad_glClear(mask);
+	if(_post_call_callback != NULL) _post_call_callback("glClear", (void*)glad_glClear, 1, mask);
+}
+PFNGLCLEARPROC glad_debug_glClear = glad_debug_impl_glClear;
+static void APIENTRY glad_debug_impl_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearColor", (void*)glad_glClearColor, 4, red, green, blue, alpha);
+	glad_glClearColor(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glClearColor", (void*)glad_glClearColor, 4, red, green, blue, alpha);
+}
+PFNGLCLEARCOLORPROC glad_debug_glClearColor = glad_debug_impl_glClearColor;
+static void APIENTRY glad_debug_impl_glClearStencil(GLint s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearStencil", (void*)glad_glClearStencil, 1, s);
+	glad_glClearStencil(s);
+	if(_post_call_callback != NULL) _post_call_callback("glClearStencil", (void*)glad_glClearStencil, 1, s);
+}
+PFNGLCLEARSTENCILPROC glad_debug_glClearStencil = glad_debug_impl_glClearStencil;
+static void APIENTRY glad_debug_impl_glClearDepth(GLdouble depth) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearDepth", (void*)glad_glClearDepth, 1, depth);
+	glad_glClearDepth(depth);
+	if(_post_call_callback != NULL) _post_call_callback("glClearDepth", (void*)glad_glClearDepth, 1, depth);
+}
+PFNGLCLEARDEPTHPROC glad_debug_glClearDepth = glad_debug_impl_glClearDepth;
+static void APIENTRY glad_debug_impl_glStencilMask(GLuint mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glStencilMask", (void*)glad_glStencilMask, 1, mask);
+	glad_glStencilMask(mask);
+	if(_post_call_callback != NULL) _post_call_callback("glStencilMask", (void*)glad_glStencilMask, 1, mask);
+}
+PFNGLSTENCILMASKPROC glad_debug_glStencilMask = glad_debug_impl_glStencilMask;
+static void APIENTRY glad_debug_impl_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorMask", (void*)glad_glColorMask, 4, red, green, blue, alpha);
+	glad_glColorMask(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColorMask", (void*)glad_glColorMask, 4, red, green, blue, alpha);
+}
+PFNGLCOLORMASKPROC glad_debug_glColorMask = glad_debug_impl_glColorMask;
+static void APIENTRY glad_debug_impl_glDepthMask(GLboolean flag) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDepthMask", (void*)glad_glDepthMask, 1, flag);
+	glad_glDepthMask(flag);
+	if(_post_call_callback != NULL) _post_call_callback("glDepthMask", (void*)glad_glDepthMask, 1, flag);
+}
+PFNGLDEPTHMASKPROC glad_debug_glDepthMask = glad_debug_impl_glDepthMask;
+static void APIENTRY glad_debug_impl_glDisable(GLenum cap) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDisable", (void*)glad_glDisable, 1, cap);
+	glad_glDisable(cap);
+	if(_post_call_callback != NULL) _post_call_callback("glDisable", (void*)glad_glDisable, 1, cap);
+}
+PFNGLDISABLEPROC glad_debug_glDisable = glad_debug_impl_glDisable;
+static void APIENTRY glad_debug_impl_glEnable(GLenum cap) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEnable", (void*)glad_glEnable, 1, cap);
+	glad_glEnable(cap);
+	if(_post_call_callback != NULL) _post_call_callback("glEnable", (void*)glad_glEnable, 1, cap);
+}
+PFNGLENABLEPROC glad_debug_glEnable = glad_debug_impl_glEnable;
+static void APIENTRY glad_debug_impl_glFinish(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFinish", (void*)glad_glFinish, 0);
+	glad_glFinish();
+	if(_post_call_callback != NULL) _post_call_callback("glFinish", (void*)glad_glFinish, 0);
+}
+PFNGLFINISHPROC glad_debug_glFinish = glad_debug_impl_glFinish;
+static void APIENTRY glad_debug_impl_glFlush(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFlush", (void*)glad_glFlush, 0);
+	glad_glFlush();
+	if(_post_call_callback != NULL) _post_call_callback("glFlush", (void*)glad_glFlush, 0);
+}
+PFNGLFLUSHPROC glad_debug_glFlush = glad_debug_impl_glFlush;
+static void APIENTRY glad_debug_impl_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBlendFunc", (void*)glad_glBlendFunc, 2, sfactor, dfactor);
+	glad_glBlendFunc(sfactor, dfactor);
+	if(_post_call_callback != NULL) _post_call_callback("glBlendFunc", (void*)glad_glBlendFunc, 2, sfactor, dfactor);
+}
+PFNGLBLENDFUNCPROC glad_debug_glBlendFunc = glad_debug_impl_glBlendFunc;
+static void APIENTRY glad_debug_impl_glLogicOp(GLenum opcode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLogicOp", (void*)glad_glLogicOp, 1, opcode);
+	glad_glLogicOp(opcode);
+	if(_post_call_callback != NULL) _post_call_callback("glLogicOp", (void*)glad_glLogicOp, 1, opcode);
+}
+PFNGLLOGICOPPROC glad_debug_glLogicOp = glad_debug_impl_glLogicOp;
+static void APIENTRY glad_debug_impl_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glStencilFunc", (void*)glad_glStencilFunc, 3, func, ref, mask);
+	glad_glStencilFunc(func, ref, mask);
+	if(_post_call_callback != NULL) _post_call_callback("glStencilFunc", (void*)glad_glStencilFunc, 3, func, ref, mask);
+}
+PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc = glad_debug_impl_glStencilFunc;
+static void APIENTRY glad_debug_impl_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glStencilOp", (void*)glad_glStencilOp, 3, fail, zfail, zpass);
+	glad_glStencilOp(fail, zfail, zpass);
+	if(_post_call_callback != NULL) _post_call_callback("glStencilOp", (void*)glad_glStencilOp, 3, fail, zfail, zpass);
+}
+PFNGLSTENCILOPPROC glad_debug_glStencilOp = glad_debug_impl_glStencilOp;
+static void APIENTRY glad_debug_impl_glDepthFunc(GLenum func) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDepthFunc", (void*)glad_glDepthFunc, 1, func);
+	glad_glDepthFunc(func);
+	if(_post_call_callback != NULL) _post_call_callback("glDepthFunc", (void*)glad_glDepthFunc, 1, func);
+}
+PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc = glad_debug_impl_glDepthFunc;
+static void APIENTRY glad_debug_impl_glPixelStoref(GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelStoref", (void*)glad_glPixelStoref, 2, pname, param);
+	glad_glPixelStoref(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelStoref", (void*)glad_glPixelStoref, 2, pname, param);
+}
+PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref = glad_debug_impl_glPixelStoref;
+static void APIENTRY glad_debug_impl_glPixelStorei(GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelStorei", (void*)glad_glPixelStorei, 2, pname, param);
+	glad_glPixelStorei(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelStorei", (void*)glad_glPixelStorei, 2, pname, param);
+}
+PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei = glad_debug_impl_glPixelStorei;
+static void APIENTRY glad_debug_impl_glReadBuffer(GLenum src) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glReadBuffer", (void*)glad_glReadBuffer, 1, src);
+	glad_glReadBuffer(src);
+	if(_post_call_callback != NULL) _post_call_callback("glReadBuffer", (void*)glad_glReadBuffer, 1, src);
+}
+PFNGLREADBUFFERPROC glad_debug_glReadBuffer = glad_debug_impl_glReadBuffer;
+static void APIENTRY glad_debug_impl_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glReadPixels", (void*)glad_glReadPixels, 7, x, y, width, height, format, type, pixels);
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glReadPixels", (void*)glad_glReadPixels, 7, x, y, width, height, format, type, pixels);
+}
+PFNGLREADPIXELSPROC glad_debug_glReadPixels = glad_debug_impl_glReadPixels;
+static void APIENTRY glad_debug_impl_glGetBooleanv(GLenum pname, GLboolean *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetBooleanv", (void*)glad_glGetBooleanv, 2, pname, data);
+	glad_glGetBooleanv(pname, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetBooleanv", (void*)glad_glGetBooleanv, 2, pname, data);
+}
+PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv = glad_debug_impl_glGetBooleanv;
+static void APIENTRY glad_debug_impl_glGetDoublev(GLenum pname, GLdouble *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetDoublev", (void*)glad_glGetDoublev, 2, pname, data);
+	glad_glGetDoublev(pname, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetDoublev", (void*)glad_glGetDoublev, 2, pname, data);
+}
+PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev = glad_debug_impl_glGetDoublev;
+static GLenum APIENTRY glad_debug_impl_glGetError(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetError", (void*)glad_glGetError, 0);
+	GLenum ret = glad_glGetError();
+	if(_post_call_callback != NULL) _post_call_callback("glGetError", (void*)glad_glGetError, 0);
+	return ret;
+}
+PFNGLGETERRORPROC glad_debug_glGetError = glad_debug_impl_glGetError;
+static void APIENTRY glad_debug_impl_glGetFloatv(GLenum pname, GLfloat *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetFloatv", (void*)glad_glGetFloatv, 2, pname, data);
+	glad_glGetFloatv(pname, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetFloatv", (void*)glad_glGetFloatv, 2, pname, data);
+}
+PFNGLGETFLOATVPROC glad_debug_glGetFloatv = glad_debug_impl_glGetFloatv;
+static void APIENTRY glad_debug_impl_glGetIntegerv(GLenum pname, GLint *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetIntegerv", (void*)glad_glGetIntegerv, 2, pname, data);
+	glad_glGetIntegerv(pname, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetIntegerv", (void*)glad_glGetIntegerv, 2, pname, data);
+}
+PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv = glad_debug_impl_glGetIntegerv;
+static const GLubyte * APIENTRY glad_debug_impl_glGetString(GLenum name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetString", (void*)glad_glGetString, 1, name);
+	const GLubyte * ret = glad_glGetString(name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetString", (void*)glad_glGetString, 1, name);
+	return ret;
+}
+PFNGLGETSTRINGPROC glad_debug_glGetString = glad_debug_impl_glGetString;
+static void APIENTRY glad_debug_impl_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexImage", (void*)glad_glGetTexImage, 5, target, level, format, type, pixels);
+	glad_glGetTexImage(target, level, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexImage", (void*)glad_glGetTexImage, 5, target, level, format, type, pixels);
+}
+PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage = glad_debug_impl_glGetTexImage;
+static void APIENTRY glad_debug_impl_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexParameterfv", (void*)glad_glGetTexParameterfv, 3, target, pname, params);
+	glad_glGetTexParameterfv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexParameterfv", (void*)glad_glGetTexParameterfv, 3, target, pname, params);
+}
+PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv = glad_debug_impl_glGetTexParameterfv;
+static void APIENTRY glad_debug_impl_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexParameteriv", (void*)glad_glGetTexParameteriv, 3, target, pname, params);
+	glad_glGetTexParameteriv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexParameteriv", (void*)glad_glGetTexParameteriv, 3, target, pname, params);
+}
+PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv = glad_debug_impl_glGetTexParameteriv;
+static void APIENTRY glad_debug_impl_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexLevelParameterfv", (void*)glad_glGetTexLevelParameterfv, 4, target, level, pname, params);
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexLevelParameterfv", (void*)glad_glGetTexLevelParameterfv, 4, target, level, pname, params);
+}
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv = glad_debug_impl_glGetTexLevelParameterfv;
+static void APIENTRY glad_debug_impl_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexLevelParameteriv", (void*)glad_glGetTexLevelParameteriv, 4, target, level, pname, params);
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexLevelParameteriv", (void*)glad_glGetTexLevelParameteriv, 4, target, level, pname, params);
+}
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv = glad_debug_impl_glGetTexLevelParameteriv;
+static GLboolean APIENTRY glad_debug_impl_glIsEnabled(GLenum cap) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsEnabled", (void*)glad_glIsEnabled, 1, cap);
+	GLboolean ret = glad_glIsEnabled(cap);
+	if(_post_call_callback != NULL) _post_call_callback("glIsEnabled", (void*)glad_glIsEnabled, 1, cap);
+	return ret;
+}
+PFNGLISENABLEDPROC glad_debug_glIsEnabled = glad_debug_impl_glIsEnabled;
+static void APIENTRY glad_debug_impl_glDepthRange(GLdouble n, GLdouble f) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDepthRange", (void*)glad_glDepthRange, 2, n, f);
+	glad_glDepthRange(n, f);
+	if(_post_call_callback != NULL) _post_call_callback("glDepthRange", (void*)glad_glDepthRange, 2, n, f);
+}
+PFNGLDEPTHRANGEPROC glad_debug_glDepthRange = glad_debug_impl_glDepthRange;
+static void APIENTRY glad_debug_impl_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glViewport", (void*)glad_glViewport, 4, x, y, width, height);
+	glad_glViewport(x, y, width, height);
+	if(_post_call_callback != NULL) _post_call_callback("glViewport", (void*)glad_glViewport, 4, x, y, width, height);
+}
+PFNGLVIEWPORTPROC glad_debug_glViewport = glad_debug_impl_glViewport;
+static void APIENTRY glad_debug_impl_glNewList(GLuint list, GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNewList", (void*)glad_glNewList, 2, list, mode);
+	glad_glNewList(list, mode);
+	if(_post_call_callback != NULL) _post_call_callback("glNewList", (void*)glad_glNewList, 2, list, mode);
+}
+PFNGLNEWLISTPROC glad_debug_glNewList = glad_debug_impl_glNewList;
+static void APIENTRY glad_debug_impl_glEndList(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEndList", (void*)glad_glEndList, 0);
+	glad_glEndList();
+	if(_post_call_callback != NULL) _post_call_callback("glEndList", (void*)glad_glEndList, 0);
+}
+PFNGLENDLISTPROC glad_debug_glEndList = glad_debug_impl_glEndList;
+static void APIENTRY glad_debug_impl_glCallList(GLuint list) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCallList", (void*)glad_glCallList, 1, list);
+	glad_glCallList(list);
+	if(_post_call_callback != NULL) _post_call_callback("glCallList", (void*)glad_glCallList, 1, list);
+}
+PFNGLCALLLISTPROC glad_debug_glCallList = glad_debug_impl_glCallList;
+static void APIENTRY glad_debug_impl_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCallLists", (void*)glad_glCallLists, 3, n, type, lists);
+	glad_glCallLists(n, type, lists);
+	if(_post_call_callback != NULL) _post_call_callback("glCallLists", (void*)glad_glCallLists, 3, n, type, lists);
+}
+PFNGLCALLLISTSPROC glad_debug_glCallLists = glad_debug_impl_glCallLists;
+static void APIENTRY glad_debug_impl_glDeleteLists(GLuint list, GLsizei range) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteLists", (void*)glad_glDeleteLists, 2, list, range);
+	glad_glDeleteLists(list, range);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteLists", (void*)glad_glDeleteLists, 2, list, range);
+}
+PFNGLDELETELISTSPROC glad_debug_glDeleteLists = glad_debug_impl_glDeleteLists;
+static GLuint APIENTRY glad_debug_impl_glGenLists(GLsizei range) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenLists", (void*)glad_glGenLists, 1, range);
+	GLuint ret = glad_glGenLists(range);
+	if(_post_call_callback != NULL) _post_call_callback("glGenLists", (void*)glad_glGenLists, 1, range);
+	return ret;
+}
+PFNGLGENLISTSPROC glad_debug_glGenLists = glad_debug_impl_glGenLists;
+static void APIENTRY glad_debug_impl_glListBase(GLuint base) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glListBase", (void*)glad_glListBase, 1, base);
+	glad_glListBase(base);
+	if(_post_call_callback != NULL) _post_call_callback("glListBase", (void*)glad_glListBase, 1, base);
+}
+PFNGLLISTBASEPROC glad_debug_glListBase = glad_debug_impl_glListBase;
+static void APIENTRY glad_debug_impl_glBegin(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBegin", (void*)glad_glBegin, 1, mode);
+	glad_glBegin(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glBegin", (void*)glad_glBegin, 1, mode);
+}
+PFNGLBEGINPROC glad_debug_glBegin = glad_debug_impl_glBegin;
+static void APIENTRY glad_debug_impl_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBitmap", (void*)glad_glBitmap, 7, width, height, xorig, yorig, xmove, ymove, bitmap);
+	glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+	if(_post_call_callback != NULL) _post_call_callback("glBitmap", (void*)glad_glBitmap, 7, width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+PFNGLBITMAPPROC glad_debug_glBitmap = glad_debug_impl_glBitmap;
+static void APIENTRY glad_debug_impl_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3b", (void*)glad_glColor3b, 3, red, green, blue);
+	glad_glColor3b(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3b", (void*)glad_glColor3b, 3, red, green, blue);
+}
+PFNGLCOLOR3BPROC glad_debug_glColor3b = glad_debug_impl_glColor3b;
+static void APIENTRY glad_debug_impl_glColor3bv(const GLbyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3bv", (void*)glad_glColor3bv, 1, v);
+	glad_glColor3bv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3bv", (void*)glad_glColor3bv, 1, v);
+}
+PFNGLCOLOR3BVPROC glad_debug_glColor3bv = glad_debug_impl_glColor3bv;
+static void APIENTRY glad_debug_impl_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3d", (void*)glad_glColor3d, 3, red, green, blue);
+	glad_glColor3d(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3d", (void*)glad_glColor3d, 3, red, green, blue);
+}
+PFNGLCOLOR3DPROC glad_debug_glColor3d = glad_debug_impl_glColor3d;
+static void APIENTRY glad_debug_impl_glColor3dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3dv", (void*)glad_glColor3dv, 1, v);
+	glad_glColor3dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3dv", (void*)glad_glColor3dv, 1, v);
+}
+PFNGLCOLOR3DVPROC glad_debug_glColor3dv = glad_debug_impl_glColor3dv;
+static void APIENTRY glad_debug_impl_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3f", (void*)glad_glColor3f, 3, red, green, blue);
+	glad_glColor3f(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3f", (void*)glad_glColor3f, 3, red, green, blue);
+}
+PFNGLCOLOR3FPROC glad_debug_glColor3f = glad_debug_impl_glColor3f;
+static void APIENTRY glad_debug_impl_glColor3fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3fv", (void*)glad_glColor3fv, 1, v);
+	glad_glColor3fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3fv", (void*)glad_glColor3fv, 1, v);
+}
+PFNGLCOLOR3FVPROC glad_debug_glColor3fv = glad_debug_impl_glColor3fv;
+static void APIENTRY glad_debug_impl_glColor3i(GLint red, GLint green, GLint blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3i", (void*)glad_glColor3i, 3, red, green, blue);
+	glad_glColor3i(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3i", (void*)glad_glColor3i, 3, red, green, blue);
+}
+PFNGLCOLOR3IPROC glad_debug_glColor3i = glad_debug_impl_glColor3i;
+static void APIENTRY glad_debug_impl_glColor3iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3iv", (void*)glad_glColor3iv, 1, v);
+	glad_glColor3iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3iv", (void*)glad_glColor3iv, 1, v);
+}
+PFNGLCOLOR3IVPROC glad_debug_glColor3iv = glad_debug_impl_glColor3iv;
+static void APIENTRY glad_debug_impl_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3s", (void*)glad_glColor3s, 3, red, green, blue);
+	glad_glColor3s(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3s", (void*)glad_glColor3s, 3, red, green, blue);
+}
+PFNGLCOLOR3SPROC glad_debug_glColor3s = glad_debug_impl_glColor3s;
+static void APIENTRY glad_debug_impl_glColor3sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3sv", (void*)glad_glColor3sv, 1, v);
+	glad_glColor3sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3sv", (void*)glad_glColor3sv, 1, v);
+}
+PFNGLCOLOR3SVPROC glad_debug_glColor3sv = glad_debug_impl_glColor3sv;
+static void APIENTRY glad_debug_impl_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3ub", (void*)glad_glColor3ub, 3, red, green, blue);
+	glad_glColor3ub(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3ub", (void*)glad_glColor3ub, 3, red, green, blue);
+}
+PFNGLCOLOR3UBPROC glad_debug_glColor3ub = glad_debug_impl_glColor3ub;
+static void APIENTRY glad_debug_impl_glColor3ubv(const GLubyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3ubv", (void*)glad_glColor3ubv, 1, v);
+	glad_glColor3ubv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3ubv", (void*)glad_glColor3ubv, 1, v);
+}
+PFNGLCOLOR3UBVPROC glad_debug_glColor3ubv = glad_debug_impl_glColor3ubv;
+static void APIENTRY glad_debug_impl_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3ui", (void*)glad_glColor3ui, 3, red, green, blue);
+	glad_glColor3ui(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3ui", (void*)glad_glColor3ui, 3, red, green, blue);
+}
+PFNGLCOLOR3UIPROC glad_debug_glColor3ui = glad_debug_impl_glColor3ui;
+static void APIENTRY glad_debug_impl_glColor3uiv(const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3uiv", (void*)glad_glColor3uiv, 1, v);
+	glad_glColor3uiv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3uiv", (void*)glad_glColor3uiv, 1, v);
+}
+PFNGLCOLOR3UIVPROC glad_debug_glColor3uiv = glad_debug_impl_glColor3uiv;
+static void APIENTRY glad_debug_impl_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3us", (void*)glad_glColor3us, 3, red, green, blue);
+	glad_glColor3us(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3us", (void*)glad_glColor3us, 3, red, green, blue);
+}
+PFNGLCOLOR3USPROC glad_debug_glColor3us = glad_debug_impl_glColor3us;
+static void APIENTRY glad_debug_impl_glColor3usv(const GLushort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor3usv", (void*)glad_glColor3usv, 1, v);
+	glad_glColor3usv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor3usv", (void*)glad_glColor3usv, 1, v);
+}
+PFNGLCOLOR3USVPROC glad_debug_glColor3usv = glad_debug_impl_glColor3usv;
+static void APIENTRY glad_debug_impl_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4b", (void*)glad_glColor4b, 4, red, green, blue, alpha);
+	glad_glColor4b(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4b", (void*)glad_glColor4b, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4BPROC glad_debug_glColor4b = glad_debug_impl_glColor4b;
+static void APIENTRY glad_debug_impl_glColor4bv(const GLbyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4bv", (void*)glad_glColor4bv, 1, v);
+	glad_glColor4bv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4bv", (void*)glad_glColor4bv, 1, v);
+}
+PFNGLCOLOR4BVPROC glad_debug_glColor4bv = glad_debug_impl_glColor4bv;
+static void APIENTRY glad_debug_impl_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4d", (void*)glad_glColor4d, 4, red, green, blue, alpha);
+	glad_glColor4d(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4d", (void*)glad_glColor4d, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4DPROC glad_debug_glColor4d = glad_debug_impl_glColor4d;
+static void APIENTRY glad_debug_impl_glColor4dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4dv", (void*)glad_glColor4dv, 1, v);
+	glad_glColor4dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4dv", (void*)glad_glColor4dv, 1, v);
+}
+PFNGLCOLOR4DVPROC glad_debug_glColor4dv = glad_debug_impl_glColor4dv;
+static void APIENTRY glad_debug_impl_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4f", (void*)glad_glColor4f, 4, red, green, blue, alpha);
+	glad_glColor4f(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4f", (void*)glad_glColor4f, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4FPROC glad_debug_glColor4f = glad_debug_impl_glColor4f;
+static void APIENTRY glad_debug_impl_glColor4fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4fv", (void*)glad_glColor4fv, 1, v);
+	glad_glColor4fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4fv", (void*)glad_glColor4fv, 1, v);
+}
+PFNGLCOLOR4FVPROC glad_debug_glColor4fv = glad_debug_impl_glColor4fv;
+static void APIENTRY glad_debug_impl_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4i", (void*)glad_glColor4i, 4, red, green, blue, alpha);
+	glad_glColor4i(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4i", (void*)glad_glColor4i, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4IPROC glad_debug_glColor4i = glad_debug_impl_glColor4i;
+static void APIENTRY glad_debug_impl_glColor4iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4iv", (void*)glad_glColor4iv, 1, v);
+	glad_glColor4iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4iv", (void*)glad_glColor4iv, 1, v);
+}
+PFNGLCOLOR4IVPROC glad_debug_glColor4iv = glad_debug_impl_glColor4iv;
+static void APIENTRY glad_debug_impl_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4s", (void*)glad_glColor4s, 4, red, green, blue, alpha);
+	glad_glColor4s(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4s", (void*)glad_glColor4s, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4SPROC glad_debug_glColor4s = glad_debug_impl_glColor4s;
+static void APIENTRY glad_debug_impl_glColor4sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4sv", (void*)glad_glColor4sv, 1, v);
+	glad_glColor4sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4sv", (void*)glad_glColor4sv, 1, v);
+}
+PFNGLCOLOR4SVPROC glad_debug_glColor4sv = glad_debug_impl_glColor4sv;
+static void APIENTRY glad_debug_impl_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4ub", (void*)glad_glColor4ub, 4, red, green, blue, alpha);
+	glad_glColor4ub(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4ub", (void*)glad_glColor4ub, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4UBPROC glad_debug_glColor4ub = glad_debug_impl_glColor4ub;
+static void APIENTRY glad_debug_impl_glColor4ubv(const GLubyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4ubv", (void*)glad_glColor4ubv, 1, v);
+	glad_glColor4ubv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4ubv", (void*)glad_glColor4ubv, 1, v);
+}
+PFNGLCOLOR4UBVPROC glad_debug_glColor4ubv = glad_debug_impl_glColor4ubv;
+static void APIENTRY glad_debug_impl_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4ui", (void*)glad_glColor4ui, 4, red, green, blue, alpha);
+	glad_glColor4ui(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4ui", (void*)glad_glColor4ui, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4UIPROC glad_debug_glColor4ui = glad_debug_impl_glColor4ui;
+static void APIENTRY glad_debug_impl_glColor4uiv(const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4uiv", (void*)glad_glColor4uiv, 1, v);
+	glad_glColor4uiv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4uiv", (void*)glad_glColor4uiv, 1, v);
+}
+PFNGLCOLOR4UIVPROC glad_debug_glColor4uiv = glad_debug_impl_glColor4uiv;
+static void APIENTRY glad_debug_impl_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4us", (void*)glad_glColor4us, 4, red, green, blue, alpha);
+	glad_glColor4us(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4us", (void*)glad_glColor4us, 4, red, green, blue, alpha);
+}
+PFNGLCOLOR4USPROC glad_debug_glColor4us = glad_debug_impl_glColor4us;
+static void APIENTRY glad_debug_impl_glColor4usv(const GLushort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColor4usv", (void*)glad_glColor4usv, 1, v);
+	glad_glColor4usv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glColor4usv", (void*)glad_glColor4usv, 1, v);
+}
+PFNGLCOLOR4USVPROC glad_debug_glColor4usv = glad_debug_impl_glColor4usv;
+static void APIENTRY glad_debug_impl_glEdgeFlag(GLboolean flag) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEdgeFlag", (void*)glad_glEdgeFlag, 1, flag);
+	glad_glEdgeFlag(flag);
+	if(_post_call_callback != NULL) _post_call_callback("glEdgeFlag", (void*)glad_glEdgeFlag, 1, flag);
+}
+PFNGLEDGEFLAGPROC glad_debug_glEdgeFlag = glad_debug_impl_glEdgeFlag;
+static void APIENTRY glad_debug_impl_glEdgeFlagv(const GLboolean *flag) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEdgeFlagv", (void*)glad_glEdgeFlagv, 1, flag);
+	glad_glEdgeFlagv(flag);
+	if(_post_call_callback != NULL) _post_call_callback("glEdgeFlagv", (void*)glad_glEdgeFlagv, 1, flag);
+}
+PFNGLEDGEFLAGVPROC glad_debug_glEdgeFlagv = glad_debug_impl_glEdgeFlagv;
+static void APIENTRY glad_debug_impl_glEnd(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEnd", (void*)glad_glEnd, 0);
+	glad_glEnd();
+	if(_post_call_callback != NULL) _post_call_callback("glEnd", (void*)glad_glEnd, 0);
+}
+PFNGLENDPROC glad_debug_glEnd = glad_debug_impl_glEnd;
+static void APIENTRY glad_debug_impl_glIndexd(GLdouble c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexd", (void*)glad_glIndexd, 1, c);
+	glad_glIndexd(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexd", (void*)glad_glIndexd, 1, c);
+}
+PFNGLINDEXDPROC glad_debug_glIndexd = glad_debug_impl_glIndexd;
+static void APIENTRY glad_debug_impl_glIndexdv(const GLdouble *c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexdv", (void*)glad_glIndexdv, 1, c);
+	glad_glIndexdv(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexdv", (void*)glad_glIndexdv, 1, c);
+}
+PFNGLINDEXDVPROC glad_debug_glIndexdv = glad_debug_impl_glIndexdv;
+static void APIENTRY glad_debug_impl_glIndexf(GLfloat c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexf", (void*)glad_glIndexf, 1, c);
+	glad_glIndexf(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexf", (void*)glad_glIndexf, 1, c);
+}
+PFNGLINDEXFPROC glad_debug_glIndexf = glad_debug_impl_glIndexf;
+static void APIENTRY glad_debug_impl_glIndexfv(const GLfloat *c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexfv", (void*)glad_glIndexfv, 1, c);
+	glad_glIndexfv(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexfv", (void*)glad_glIndexfv, 1, c);
+}
+PFNGLINDEXFVPROC glad_debug_glIndexfv = glad_debug_impl_glIndexfv;
+static void APIENTRY glad_debug_impl_glIndexi(GLint c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexi", (void*)glad_glIndexi, 1, c);
+	glad_glIndexi(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexi", (void*)glad_glIndexi, 1, c);
+}
+PFNGLINDEXIPROC glad_debug_glIndexi = glad_debug_impl_glIndexi;
+static void APIENTRY glad_debug_impl_glIndexiv(const GLint *c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexiv", (void*)glad_glIndexiv, 1, c);
+	glad_glIndexiv(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexiv", (void*)glad_glIndexiv, 1, c);
+}
+PFNGLINDEXIVPROC glad_debug_glIndexiv = glad_debug_impl_glIndexiv;
+static void APIENTRY glad_debug_impl_glIndexs(GLshort c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexs", (void*)glad_glIndexs, 1, c);
+	glad_glIndexs(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexs", (void*)glad_glIndexs, 1, c);
+}
+PFNGLINDEXSPROC glad_debug_glIndexs = glad_debug_impl_glIndexs;
+static void APIENTRY glad_debug_impl_glIndexsv(const GLshort *c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexsv", (void*)glad_glIndexsv, 1, c);
+	glad_glIndexsv(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexsv", (void*)glad_glIndexsv, 1, c);
+}
+PFNGLINDEXSVPROC glad_debug_glIndexsv = glad_debug_impl_glIndexsv;
+static void APIENTRY glad_debug_impl_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3b", (void*)glad_glNormal3b, 3, nx, ny, nz);
+	glad_glNormal3b(nx, ny, nz);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3b", (void*)glad_glNormal3b, 3, nx, ny, nz);
+}
+PFNGLNORMAL3BPROC glad_debug_glNormal3b = glad_debug_impl_glNormal3b;
+static void APIENTRY glad_debug_impl_glNormal3bv(const GLbyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3bv", (void*)glad_glNormal3bv, 1, v);
+	glad_glNormal3bv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3bv", (void*)glad_glNormal3bv, 1, v);
+}
+PFNGLNORMAL3BVPROC glad_debug_glNormal3bv = glad_debug_impl_glNormal3bv;
+static void APIENTRY glad_debug_impl_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3d", (void*)glad_glNormal3d, 3, nx, ny, nz);
+	glad_glNormal3d(nx, ny, nz);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3d", (void*)glad_glNormal3d, 3, nx, ny, nz);
+}
+PFNGLNORMAL3DPROC glad_debug_glNormal3d = glad_debug_impl_glNormal3d;
+static void APIENTRY glad_debug_impl_glNormal3dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3dv", (void*)glad_glNormal3dv, 1, v);
+	glad_glNormal3dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3dv", (void*)glad_glNormal3dv, 1, v);
+}
+PFNGLNORMAL3DVPROC glad_debug_glNormal3dv = glad_debug_impl_glNormal3dv;
+static void APIENTRY glad_debug_impl_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3f", (void*)glad_glNormal3f, 3, nx, ny, nz);
+	glad_glNormal3f(nx, ny, nz);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3f", (void*)glad_glNormal3f, 3, nx, ny, nz);
+}
+PFNGLNORMAL3FPROC glad_debug_glNormal3f = glad_debug_impl_glNormal3f;
+static void APIENTRY glad_debug_impl_glNormal3fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3fv", (void*)glad_glNormal3fv, 1, v);
+	glad_glNormal3fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3fv", (void*)glad_glNormal3fv, 1, v);
+}
+PFNGLNORMAL3FVPROC glad_debug_glNormal3fv = glad_debug_impl_glNormal3fv;
+static void APIENTRY glad_debug_impl_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3i", (void*)glad_glNormal3i, 3, nx, ny, nz);
+	glad_glNormal3i(nx, ny, nz);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3i", (void*)glad_glNormal3i, 3, nx, ny, nz);
+}
+PFNGLNORMAL3IPROC glad_debug_glNormal3i = glad_debug_impl_glNormal3i;
+static void APIENTRY glad_debug_impl_glNormal3iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3iv", (void*)glad_glNormal3iv, 1, v);
+	glad_glNormal3iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3iv", (void*)glad_glNormal3iv, 1, v);
+}
+PFNGLNORMAL3IVPROC glad_debug_glNormal3iv = glad_debug_impl_glNormal3iv;
+static void APIENTRY glad_debug_impl_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3s", (void*)glad_glNormal3s, 3, nx, ny, nz);
+	glad_glNormal3s(nx, ny, nz);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3s", (void*)glad_glNormal3s, 3, nx, ny, nz);
+}
+PFNGLNORMAL3SPROC glad_debug_glNormal3s = glad_debug_impl_glNormal3s;
+static void APIENTRY glad_debug_impl_glNormal3sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormal3sv", (void*)glad_glNormal3sv, 1, v);
+	glad_glNormal3sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glNormal3sv", (void*)glad_glNormal3sv, 1, v);
+}
+PFNGLNORMAL3SVPROC glad_debug_glNormal3sv = glad_debug_impl_glNormal3sv;
+static void APIENTRY glad_debug_impl_glRasterPos2d(GLdouble x, GLdouble y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2d", (void*)glad_glRasterPos2d, 2, x, y);
+	glad_glRasterPos2d(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2d", (void*)glad_glRasterPos2d, 2, x, y);
+}
+PFNGLRASTERPOS2DPROC glad_debug_glRasterPos2d = glad_debug_impl_glRasterPos2d;
+static void APIENTRY glad_debug_impl_glRasterPos2dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2dv", (void*)glad_glRasterPos2dv, 1, v);
+	glad_glRasterPos2dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2dv", (void*)glad_glRasterPos2dv, 1, v);
+}
+PFNGLRASTERPOS2DVPROC glad_debug_glRasterPos2dv = glad_debug_impl_glRasterPos2dv;
+static void APIENTRY glad_debug_impl_glRasterPos2f(GLfloat x, GLfloat y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2f", (void*)glad_glRasterPos2f, 2, x, y);
+	glad_glRasterPos2f(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2f", (void*)glad_glRasterPos2f, 2, x, y);
+}
+PFNGLRASTERPOS2FPROC glad_debug_glRasterPos2f = glad_debug_impl_glRasterPos2f;
+static void APIENTRY glad_debug_impl_glRasterPos2fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2fv", (void*)glad_glRasterPos2fv, 1, v);
+	glad_glRasterPos2fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2fv", (void*)glad_glRasterPos2fv, 1, v);
+}
+PFNGLRASTERPOS2FVPROC glad_debug_glRasterPos2fv = glad_debug_impl_glRasterPos2fv;
+static void APIENTRY glad_debug_impl_glRasterPos2i(GLint x, GLint y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2i", (void*)glad_glRasterPos2i, 2, x, y);
+	glad_glRasterPos2i(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2i", (void*)glad_glRasterPos2i, 2, x, y);
+}
+PFNGLRASTERPOS2IPROC glad_debug_glRasterPos2i = glad_debug_impl_glRasterPos2i;
+static void APIENTRY glad_debug_impl_glRasterPos2iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2iv", (void*)glad_glRasterPos2iv, 1, v);
+	glad_glRasterPos2iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2iv", (void*)glad_glRasterPos2iv, 1, v);
+}
+PFNGLRASTERPOS2IVPROC glad_debug_glRasterPos2iv = glad_debug_impl_glRasterPos2iv;
+static void APIENTRY glad_debug_impl_glRasterPos2s(GLshort x, GLshort y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2s", (void*)glad_glRasterPos2s, 2, x, y);
+	glad_glRasterPos2s(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2s", (void*)glad_glRasterPos2s, 2, x, y);
+}
+PFNGLRASTERPOS2SPROC glad_debug_glRasterPos2s = glad_debug_impl_glRasterPos2s;
+static void APIENTRY glad_debug_impl_glRasterPos2sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos2sv", (void*)glad_glRasterPos2sv, 1, v);
+	glad_glRasterPos2sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos2sv", (void*)glad_glRasterPos2sv, 1, v);
+}
+PFNGLRASTERPOS2SVPROC glad_debug_glRasterPos2sv = glad_debug_impl_glRasterPos2sv;
+static void APIENTRY glad_debug_impl_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3d", (void*)glad_glRasterPos3d, 3, x, y, z);
+	glad_glRasterPos3d(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3d", (void*)glad_glRasterPos3d, 3, x, y, z);
+}
+PFNGLRASTERPOS3DPROC glad_debug_glRasterPos3d = glad_debug_impl_glRasterPos3d;
+static void APIENTRY glad_debug_impl_glRasterPos3dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3dv", (void*)glad_glRasterPos3dv, 1, v);
+	glad_glRasterPos3dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3dv", (void*)glad_glRasterPos3dv, 1, v);
+}
+PFNGLRASTERPOS3DVPROC glad_debug_glRasterPos3dv = glad_debug_impl_glRasterPos3dv;
+static void APIENTRY glad_debug_impl_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3f", (void*)glad_glRasterPos3f, 3, x, y, z);
+	glad_glRasterPos3f(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3f", (void*)glad_glRasterPos3f, 3, x, y, z);
+}
+PFNGLRASTERPOS3FPROC glad_debug_glRasterPos3f = glad_debug_impl_glRasterPos3f;
+static void APIENTRY glad_debug_impl_glRasterPos3fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3fv", (void*)glad_glRasterPos3fv, 1, v);
+	glad_glRasterPos3fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3fv", (void*)glad_glRasterPos3fv, 1, v);
+}
+PFNGLRASTERPOS3FVPROC glad_debug_glRasterPos3fv = glad_debug_impl_glRasterPos3fv;
+static void APIENTRY glad_debug_impl_glRasterPos3i(GLint x, GLint y, GLint z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3i", (void*)glad_glRasterPos3i, 3, x, y, z);
+	glad_glRasterPos3i(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3i", (void*)glad_glRasterPos3i, 3, x, y, z);
+}
+PFNGLRASTERPOS3IPROC glad_debug_glRasterPos3i = glad_debug_impl_glRasterPos3i;
+static void APIENTRY glad_debug_impl_glRasterPos3iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3iv", (void*)glad_glRasterPos3iv, 1, v);
+	glad_glRasterPos3iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3iv", (void*)glad_glRasterPos3iv, 1, v);
+}
+PFNGLRASTERPOS3IVPROC glad_debug_glRasterPos3iv = glad_debug_impl_glRasterPos3iv;
+static void APIENTRY glad_debug_impl_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3s", (void*)glad_glRasterPos3s, 3, x, y, z);
+	glad_glRasterPos3s(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3s", (void*)glad_glRasterPos3s, 3, x, y, z);
+}
+PFNGLRASTERPOS3SPROC glad_debug_glRasterPos3s = glad_debug_impl_glRasterPos3s;
+static void APIENTRY glad_debug_impl_glRasterPos3sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos3sv", (void*)glad_glRasterPos3sv, 1, v);
+	glad_glRasterPos3sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos3sv", (void*)glad_glRasterPos3sv, 1, v);
+}
+PFNGLRASTERPOS3SVPROC glad_debug_glRasterPos3sv = glad_debug_impl_glRasterPos3sv;
+static void APIENTRY glad_debug_impl_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4d", (void*)glad_glRasterPos4d, 4, x, y, z, w);
+	glad_glRasterPos4d(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4d", (void*)glad_glRasterPos4d, 4, x, y, z, w);
+}
+PFNGLRASTERPOS4DPROC glad_debug_glRasterPos4d = glad_debug_impl_glRasterPos4d;
+static void APIENTRY glad_debug_impl_glRasterPos4dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4dv", (void*)glad_glRasterPos4dv, 1, v);
+	glad_glRasterPos4dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4dv", (void*)glad_glRasterPos4dv, 1, v);
+}
+PFNGLRASTERPOS4DVPROC glad_debug_glRasterPos4dv = glad_debug_impl_glRasterPos4dv;
+static void APIENTRY glad_debug_impl_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4f", (void*)glad_glRasterPos4f, 4, x, y, z, w);
+	glad_glRasterPos4f(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4f", (void*)glad_glRasterPos4f, 4, x, y, z, w);
+}
+PFNGLRASTERPOS4FPROC glad_debug_glRasterPos4f = glad_debug_impl_glRasterPos4f;
+static void APIENTRY glad_debug_impl_glRasterPos4fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4fv", (void*)glad_glRasterPos4fv, 1, v);
+	glad_glRasterPos4fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4fv", (void*)glad_glRasterPos4fv, 1, v);
+}
+PFNGLRASTERPOS4FVPROC glad_debug_glRasterPos4fv = glad_debug_impl_glRasterPos4fv;
+static void APIENTRY glad_debug_impl_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4i", (void*)glad_glRasterPos4i, 4, x, y, z, w);
+	glad_glRasterPos4i(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4i", (void*)glad_glRasterPos4i, 4, x, y, z, w);
+}
+PFNGLRASTERPOS4IPROC glad_debug_glRasterPos4i = glad_debug_impl_glRasterPos4i;
+static void APIENTRY glad_debug_impl_glRasterPos4iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4iv", (void*)glad_glRasterPos4iv, 1, v);
+	glad_glRasterPos4iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4iv", (void*)glad_glRasterPos4iv, 1, v);
+}
+PFNGLRASTERPOS4IVPROC glad_debug_glRasterPos4iv = glad_debug_impl_glRasterPos4iv;
+static void APIENTRY glad_debug_impl_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4s", (void*)glad_glRasterPos4s, 4, x, y, z, w);
+	glad_glRasterPos4s(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4s", (void*)glad_glRasterPos4s, 4, x, y, z, w);
+}
+PFNGLRASTERPOS4SPROC glad_debug_glRasterPos4s = glad_debug_impl_glRasterPos4s;
+static void APIENTRY glad_debug_impl_glRasterPos4sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRasterPos4sv", (void*)glad_glRasterPos4sv, 1, v);
+	glad_glRasterPos4sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glRasterPos4sv", (void*)glad_glRasterPos4sv, 1, v);
+}
+PFNGLRASTERPOS4SVPROC glad_debug_glRasterPos4sv = glad_debug_impl_glRasterPos4sv;
+static void APIENTRY glad_debug_impl_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRectd", (void*)glad_glRectd, 4, x1, y1, x2, y2);
+	glad_glRectd(x1, y1, x2, y2);
+	if(_post_call_callback != NULL) _post_call_callback("glRectd", (void*)glad_glRectd, 4, x1, y1, x2, y2);
+}
+PFNGLRECTDPROC glad_debug_glRectd = glad_debug_impl_glRectd;
+static void APIENTRY glad_debug_impl_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRectdv", (void*)glad_glRectdv, 2, v1, v2);
+	glad_glRectdv(v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glRectdv", (void*)glad_glRectdv, 2, v1, v2);
+}
+PFNGLRECTDVPROC glad_debug_glRectdv = glad_debug_impl_glRectdv;
+static void APIENTRY glad_debug_impl_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRectf", (void*)glad_glRectf, 4, x1, y1, x2, y2);
+	glad_glRectf(x1, y1, x2, y2);
+	if(_post_call_callback != NULL) _post_call_callback("glRectf", (void*)glad_glRectf, 4, x1, y1, x2, y2);
+}
+PFNGLRECTFPROC glad_debug_glRectf = glad_debug_impl_glRectf;
+static void APIENTRY glad_debug_impl_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRectfv", (void*)glad_glRectfv, 2, v1, v2);
+	glad_glRectfv(v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glRectfv", (void*)glad_glRectfv, 2, v1, v2);
+}
+PFNGLRECTFVPROC glad_debug_glRectfv = glad_debug_impl_glRectfv;
+static void APIENTRY glad_debug_impl_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRecti", (void*)glad_glRecti, 4, x1, y1, x2, y2);
+	glad_glRecti(x1, y1, x2, y2);
+	if(_post_call_callback != NULL) _post_call_callback("glRecti", (void*)glad_glRecti, 4, x1, y1, x2, y2);
+}
+PFNGLRECTIPROC glad_debug_glRecti = glad_debug_impl_glRecti;
+static void APIENTRY glad_debug_impl_glRectiv(const GLint *v1, const GLint *v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRectiv", (void*)glad_glRectiv, 2, v1, v2);
+	glad_glRectiv(v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glRectiv", (void*)glad_glRectiv, 2, v1, v2);
+}
+PFNGLRECTIVPROC glad_debug_glRectiv = glad_debug_impl_glRectiv;
+static void APIENTRY glad_debug_impl_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRects", (void*)glad_glRects, 4, x1, y1, x2, y2);
+	glad_glRects(x1, y1, x2, y2);
+	if(_post_call_callback != NULL) _post_call_callback("glRects", (void*)glad_glRects, 4, x1, y1, x2, y2);
+}
+PFNGLRECTSPROC glad_debug_glRects = glad_debug_impl_glRects;
+static void APIENTRY glad_debug_impl_glRectsv(const GLshort *v1, const GLshort *v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRectsv", (void*)glad_glRectsv, 2, v1, v2);
+	glad_glRectsv(v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glRectsv", (void*)glad_glRectsv, 2, v1, v2);
+}
+PFNGLRECTSVPROC glad_debug_glRectsv = glad_debug_impl_glRectsv;
+static void APIENTRY glad_debug_impl_glTexCoord1d(GLdouble s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1d", (void*)glad_glTexCoord1d, 1, s);
+	glad_glTexCoord1d(s);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1d", (void*)glad_glTexCoord1d, 1, s);
+}
+PFNGLTEXCOORD1DPROC glad_debug_glTexCoord1d = glad_debug_impl_glTexCoord1d;
+static void APIENTRY glad_debug_impl_glTexCoord1dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1dv", (void*)glad_glTexCoord1dv, 1, v);
+	glad_glTexCoord1dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1dv", (void*)glad_glTexCoord1dv, 1, v);
+}
+PFNGLTEXCOORD1DVPROC glad_debug_glTexCoord1dv = glad_debug_impl_glTexCoord1dv;
+static void APIENTRY glad_debug_impl_glTexCoord1f(GLfloat s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1f", (void*)glad_glTexCoord1f, 1, s);
+	glad_glTexCoord1f(s);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1f", (void*)glad_glTexCoord1f, 1, s);
+}
+PFNGLTEXCOORD1FPROC glad_debug_glTexCoord1f = glad_debug_impl_glTexCoord1f;
+static void APIENTRY glad_debug_impl_glTexCoord1fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1fv", (void*)glad_glTexCoord1fv, 1, v);
+	glad_glTexCoord1fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1fv", (void*)glad_glTexCoord1fv, 1, v);
+}
+PFNGLTEXCOORD1FVPROC glad_debug_glTexCoord1fv = glad_debug_impl_glTexCoord1fv;
+static void APIENTRY glad_debug_impl_glTexCoord1i(GLint s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1i", (void*)glad_glTexCoord1i, 1, s);
+	glad_glTexCoord1i(s);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1i", (void*)glad_glTexCoord1i, 1, s);
+}
+PFNGLTEXCOORD1IPROC glad_debug_glTexCoord1i = glad_debug_impl_glTexCoord1i;
+static void APIENTRY glad_debug_impl_glTexCoord1iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1iv", (void*)glad_glTexCoord1iv, 1, v);
+	glad_glTexCoord1iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1iv", (void*)glad_glTexCoord1iv, 1, v);
+}
+PFNGLTEXCOORD1IVPROC glad_debug_glTexCoord1iv = glad_debug_impl_glTexCoord1iv;
+static void APIENTRY glad_debug_impl_glTexCoord1s(GLshort s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1s", (void*)glad_glTexCoord1s, 1, s);
+	glad_glTexCoord1s(s);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1s", (void*)glad_glTexCoord1s, 1, s);
+}
+PFNGLTEXCOORD1SPROC glad_debug_glTexCoord1s = glad_debug_impl_glTexCoord1s;
+static void APIENTRY glad_debug_impl_glTexCoord1sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord1sv", (void*)glad_glTexCoord1sv, 1, v);
+	glad_glTexCoord1sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord1sv", (void*)glad_glTexCoord1sv, 1, v);
+}
+PFNGLTEXCOORD1SVPROC glad_debug_glTexCoord1sv = glad_debug_impl_glTexCoord1sv;
+static void APIENTRY glad_debug_impl_glTexCoord2d(GLdouble s, GLdouble t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2d", (void*)glad_glTexCoord2d, 2, s, t);
+	glad_glTexCoord2d(s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2d", (void*)glad_glTexCoord2d, 2, s, t);
+}
+PFNGLTEXCOORD2DPROC glad_debug_glTexCoord2d = glad_debug_impl_glTexCoord2d;
+static void APIENTRY glad_debug_impl_glTexCoord2dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2dv", (void*)glad_glTexCoord2dv, 1, v);
+	glad_glTexCoord2dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2dv", (void*)glad_glTexCoord2dv, 1, v);
+}
+PFNGLTEXCOORD2DVPROC glad_debug_glTexCoord2dv = glad_debug_impl_glTexCoord2dv;
+static void APIENTRY glad_debug_impl_glTexCoord2f(GLfloat s, GLfloat t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2f", (void*)glad_glTexCoord2f, 2, s, t);
+	glad_glTexCoord2f(s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2f", (void*)glad_glTexCoord2f, 2, s, t);
+}
+PFNGLTEXCOORD2FPROC glad_debug_glTexCoord2f = glad_debug_impl_glTexCoord2f;
+static void APIENTRY glad_debug_impl_glTexCoord2fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2fv", (void*)glad_glTexCoord2fv, 1, v);
+	glad_glTexCoord2fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2fv", (void*)glad_glTexCoord2fv, 1, v);
+}
+PFNGLTEXCOORD2FVPROC glad_debug_glTexCoord2fv = glad_debug_impl_glTexCoord2fv;
+static void APIENTRY glad_debug_impl_glTexCoord2i(GLint s, GLint t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2i", (void*)glad_glTexCoord2i, 2, s, t);
+	glad_glTexCoord2i(s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2i", (void*)glad_glTexCoord2i, 2, s, t);
+}
+PFNGLTEXCOORD2IPROC glad_debug_glTexCoord2i = glad_debug_impl_glTexCoord2i;
+static void APIENTRY glad_debug_impl_glTexCoord2iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2iv", (void*)glad_glTexCoord2iv, 1, v);
+	glad_glTexCoord2iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2iv", (void*)glad_glTexCoord2iv, 1, v);
+}
+PFNGLTEXCOORD2IVPROC glad_debug_glTexCoord2iv = glad_debug_impl_glTexCoord2iv;
+static void APIENTRY glad_debug_impl_glTexCoord2s(GLshort s, GLshort t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2s", (void*)glad_glTexCoord2s, 2, s, t);
+	glad_glTexCoord2s(s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2s", (void*)glad_glTexCoord2s, 2, s, t);
+}
+PFNGLTEXCOORD2SPROC glad_debug_glTexCoord2s = glad_debug_impl_glTexCoord2s;
+static void APIENTRY glad_debug_impl_glTexCoord2sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord2sv", (void*)glad_glTexCoord2sv, 1, v);
+	glad_glTexCoord2sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord2sv", (void*)glad_glTexCoord2sv, 1, v);
+}
+PFNGLTEXCOORD2SVPROC glad_debug_glTexCoord2sv = glad_debug_impl_glTexCoord2sv;
+static void APIENTRY glad_debug_impl_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3d", (void*)glad_glTexCoord3d, 3, s, t, r);
+	glad_glTexCoord3d(s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3d", (void*)glad_glTexCoord3d, 3, s, t, r);
+}
+PFNGLTEXCOORD3DPROC glad_debug_glTexCoord3d = glad_debug_impl_glTexCoord3d;
+static void APIENTRY glad_debug_impl_glTexCoord3dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3dv", (void*)glad_glTexCoord3dv, 1, v);
+	glad_glTexCoord3dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3dv", (void*)glad_glTexCoord3dv, 1, v);
+}
+PFNGLTEXCOORD3DVPROC glad_debug_glTexCoord3dv = glad_debug_impl_glTexCoord3dv;
+static void APIENTRY glad_debug_impl_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3f", (void*)glad_glTexCoord3f, 3, s, t, r);
+	glad_glTexCoord3f(s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3f", (void*)glad_glTexCoord3f, 3, s, t, r);
+}
+PFNGLTEXCOORD3FPROC glad_debug_glTexCoord3f = glad_debug_impl_glTexCoord3f;
+static void APIENTRY glad_debug_impl_glTexCoord3fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3fv", (void*)glad_glTexCoord3fv, 1, v);
+	glad_glTexCoord3fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3fv", (void*)glad_glTexCoord3fv, 1, v);
+}
+PFNGLTEXCOORD3FVPROC glad_debug_glTexCoord3fv = glad_debug_impl_glTexCoord3fv;
+static void APIENTRY glad_debug_impl_glTexCoord3i(GLint s, GLint t, GLint r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3i", (void*)glad_glTexCoord3i, 3, s, t, r);
+	glad_glTexCoord3i(s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3i", (void*)glad_glTexCoord3i, 3, s, t, r);
+}
+PFNGLTEXCOORD3IPROC glad_debug_glTexCoord3i = glad_debug_impl_glTexCoord3i;
+static void APIENTRY glad_debug_impl_glTexCoord3iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3iv", (void*)glad_glTexCoord3iv, 1, v);
+	glad_glTexCoord3iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3iv", (void*)glad_glTexCoord3iv, 1, v);
+}
+PFNGLTEXCOORD3IVPROC glad_debug_glTexCoord3iv = glad_debug_impl_glTexCoord3iv;
+static void APIENTRY glad_debug_impl_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3s", (void*)glad_glTexCoord3s, 3, s, t, r);
+	glad_glTexCoord3s(s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3s", (void*)glad_glTexCoord3s, 3, s, t, r);
+}
+PFNGLTEXCOORD3SPROC glad_debug_glTexCoord3s = glad_debug_impl_glTexCoord3s;
+static void APIENTRY glad_debug_impl_glTexCoord3sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord3sv", (void*)glad_glTexCoord3sv, 1, v);
+	glad_glTexCoord3sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord3sv", (void*)glad_glTexCoord3sv, 1, v);
+}
+PFNGLTEXCOORD3SVPROC glad_debug_glTexCoord3sv = glad_debug_impl_glTexCoord3sv;
+static void APIENTRY glad_debug_impl_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4d", (void*)glad_glTexCoord4d, 4, s, t, r, q);
+	glad_glTexCoord4d(s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4d", (void*)glad_glTexCoord4d, 4, s, t, r, q);
+}
+PFNGLTEXCOORD4DPROC glad_debug_glTexCoord4d = glad_debug_impl_glTexCoord4d;
+static void APIENTRY glad_debug_impl_glTexCoord4dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4dv", (void*)glad_glTexCoord4dv, 1, v);
+	glad_glTexCoord4dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4dv", (void*)glad_glTexCoord4dv, 1, v);
+}
+PFNGLTEXCOORD4DVPROC glad_debug_glTexCoord4dv = glad_debug_impl_glTexCoord4dv;
+static void APIENTRY glad_debug_impl_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4f", (void*)glad_glTexCoord4f, 4, s, t, r, q);
+	glad_glTexCoord4f(s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4f", (void*)glad_glTexCoord4f, 4, s, t, r, q);
+}
+PFNGLTEXCOORD4FPROC glad_debug_glTexCoord4f = glad_debug_impl_glTexCoord4f;
+static void APIENTRY glad_debug_impl_glTexCoord4fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4fv", (void*)glad_glTexCoord4fv, 1, v);
+	glad_glTexCoord4fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4fv", (void*)glad_glTexCoord4fv, 1, v);
+}
+PFNGLTEXCOORD4FVPROC glad_debug_glTexCoord4fv = glad_debug_impl_glTexCoord4fv;
+static void APIENTRY glad_debug_impl_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4i", (void*)glad_glTexCoord4i, 4, s, t, r, q);
+	glad_glTexCoord4i(s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4i", (void*)glad_glTexCoord4i, 4, s, t, r, q);
+}
+PFNGLTEXCOORD4IPROC glad_debug_glTexCoord4i = glad_debug_impl_glTexCoord4i;
+static void APIENTRY glad_debug_impl_glTexCoord4iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4iv", (void*)glad_glTexCoord4iv, 1, v);
+	glad_glTexCoord4iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4iv", (void*)glad_glTexCoord4iv, 1, v);
+}
+PFNGLTEXCOORD4IVPROC glad_debug_glTexCoord4iv = glad_debug_impl_glTexCoord4iv;
+static void APIENTRY glad_debug_impl_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4s", (void*)glad_glTexCoord4s, 4, s, t, r, q);
+	glad_glTexCoord4s(s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4s", (void*)glad_glTexCoord4s, 4, s, t, r, q);
+}
+PFNGLTEXCOORD4SPROC glad_debug_glTexCoord4s = glad_debug_impl_glTexCoord4s;
+static void APIENTRY glad_debug_impl_glTexCoord4sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoord4sv", (void*)glad_glTexCoord4sv, 1, v);
+	glad_glTexCoord4sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoord4sv", (void*)glad_glTexCoord4sv, 1, v);
+}
+PFNGLTEXCOORD4SVPROC glad_debug_glTexCoord4sv = glad_debug_impl_glTexCoord4sv;
+static void APIENTRY glad_debug_impl_glVertex2d(GLdouble x, GLdouble y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2d", (void*)glad_glVertex2d, 2, x, y);
+	glad_glVertex2d(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2d", (void*)glad_glVertex2d, 2, x, y);
+}
+PFNGLVERTEX2DPROC glad_debug_glVertex2d = glad_debug_impl_glVertex2d;
+static void APIENTRY glad_debug_impl_glVertex2dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2dv", (void*)glad_glVertex2dv, 1, v);
+	glad_glVertex2dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2dv", (void*)glad_glVertex2dv, 1, v);
+}
+PFNGLVERTEX2DVPROC glad_debug_glVertex2dv = glad_debug_impl_glVertex2dv;
+static void APIENTRY glad_debug_impl_glVertex2f(GLfloat x, GLfloat y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2f", (void*)glad_glVertex2f, 2, x, y);
+	glad_glVertex2f(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2f", (void*)glad_glVertex2f, 2, x, y);
+}
+PFNGLVERTEX2FPROC glad_debug_glVertex2f = glad_debug_impl_glVertex2f;
+static void APIENTRY glad_debug_impl_glVertex2fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2fv", (void*)glad_glVertex2fv, 1, v);
+	glad_glVertex2fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2fv", (void*)glad_glVertex2fv, 1, v);
+}
+PFNGLVERTEX2FVPROC glad_debug_glVertex2fv = glad_debug_impl_glVertex2fv;
+static void APIENTRY glad_debug_impl_glVertex2i(GLint x, GLint y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2i", (void*)glad_glVertex2i, 2, x, y);
+	glad_glVertex2i(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2i", (void*)glad_glVertex2i, 2, x, y);
+}
+PFNGLVERTEX2IPROC glad_debug_glVertex2i = glad_debug_impl_glVertex2i;
+static void APIENTRY glad_debug_impl_glVertex2iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2iv", (void*)glad_glVertex2iv, 1, v);
+	glad_glVertex2iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2iv", (void*)glad_glVertex2iv, 1, v);
+}
+PFNGLVERTEX2IVPROC glad_debug_glVertex2iv = glad_debug_impl_glVertex2iv;
+static void APIENTRY glad_debug_impl_glVertex2s(GLshort x, GLshort y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2s", (void*)glad_glVertex2s, 2, x, y);
+	glad_glVertex2s(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2s", (void*)glad_glVertex2s, 2, x, y);
+}
+PFNGLVERTEX2SPROC glad_debug_glVertex2s = glad_debug_impl_glVertex2s;
+static void APIENTRY glad_debug_impl_glVertex2sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex2sv", (void*)glad_glVertex2sv, 1, v);
+	glad_glVertex2sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex2sv", (void*)glad_glVertex2sv, 1, v);
+}
+PFNGLVERTEX2SVPROC glad_debug_glVertex2sv = glad_debug_impl_glVertex2sv;
+static void APIENTRY glad_debug_impl_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3d", (void*)glad_glVertex3d, 3, x, y, z);
+	glad_glVertex3d(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3d", (void*)glad_glVertex3d, 3, x, y, z);
+}
+PFNGLVERTEX3DPROC glad_debug_glVertex3d = glad_debug_impl_glVertex3d;
+static void APIENTRY glad_debug_impl_glVertex3dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3dv", (void*)glad_glVertex3dv, 1, v);
+	glad_glVertex3dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3dv", (void*)glad_glVertex3dv, 1, v);
+}
+PFNGLVERTEX3DVPROC glad_debug_glVertex3dv = glad_debug_impl_glVertex3dv;
+static void APIENTRY glad_debug_impl_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3f", (void*)glad_glVertex3f, 3, x, y, z);
+	glad_glVertex3f(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3f", (void*)glad_glVertex3f, 3, x, y, z);
+}
+PFNGLVERTEX3FPROC glad_debug_glVertex3f = glad_debug_impl_glVertex3f;
+static void APIENTRY glad_debug_impl_glVertex3fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3fv", (void*)glad_glVertex3fv, 1, v);
+	glad_glVertex3fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3fv", (void*)glad_glVertex3fv, 1, v);
+}
+PFNGLVERTEX3FVPROC glad_debug_glVertex3fv = glad_debug_impl_glVertex3fv;
+static void APIENTRY glad_debug_impl_glVertex3i(GLint x, GLint y, GLint z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3i", (void*)glad_glVertex3i, 3, x, y, z);
+	glad_glVertex3i(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3i", (void*)glad_glVertex3i, 3, x, y, z);
+}
+PFNGLVERTEX3IPROC glad_debug_glVertex3i = glad_debug_impl_glVertex3i;
+static void APIENTRY glad_debug_impl_glVertex3iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3iv", (void*)glad_glVertex3iv, 1, v);
+	glad_glVertex3iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3iv", (void*)glad_glVertex3iv, 1, v);
+}
+PFNGLVERTEX3IVPROC glad_debug_glVertex3iv = glad_debug_impl_glVertex3iv;
+static void APIENTRY glad_debug_impl_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3s", (void*)glad_glVertex3s, 3, x, y, z);
+	glad_glVertex3s(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3s", (void*)glad_glVertex3s, 3, x, y, z);
+}
+PFNGLVERTEX3SPROC glad_debug_glVertex3s = glad_debug_impl_glVertex3s;
+static void APIENTRY glad_debug_impl_glVertex3sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex3sv", (void*)glad_glVertex3sv, 1, v);
+	glad_glVertex3sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex3sv", (void*)glad_glVertex3sv, 1, v);
+}
+PFNGLVERTEX3SVPROC glad_debug_glVertex3sv = glad_debug_impl_glVertex3sv;
+static void APIENTRY glad_debug_impl_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4d", (void*)glad_glVertex4d, 4, x, y, z, w);
+	glad_glVertex4d(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4d", (void*)glad_glVertex4d, 4, x, y, z, w);
+}
+PFNGLVERTEX4DPROC glad_debug_glVertex4d = glad_debug_impl_glVertex4d;
+static void APIENTRY glad_debug_impl_glVertex4dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4dv", (void*)glad_glVertex4dv, 1, v);
+	glad_glVertex4dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4dv", (void*)glad_glVertex4dv, 1, v);
+}
+PFNGLVERTEX4DVPROC glad_debug_glVertex4dv = glad_debug_impl_glVertex4dv;
+static void APIENTRY glad_debug_impl_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4f", (void*)glad_glVertex4f, 4, x, y, z, w);
+	glad_glVertex4f(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4f", (void*)glad_glVertex4f, 4, x, y, z, w);
+}
+PFNGLVERTEX4FPROC glad_debug_glVertex4f = glad_debug_impl_glVertex4f;
+static void APIENTRY glad_debug_impl_glVertex4fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4fv", (void*)glad_glVertex4fv, 1, v);
+	glad_glVertex4fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4fv", (void*)glad_glVertex4fv, 1, v);
+}
+PFNGLVERTEX4FVPROC glad_debug_glVertex4fv = glad_debug_impl_glVertex4fv;
+static void APIENTRY glad_debug_impl_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4i", (void*)glad_glVertex4i, 4, x, y, z, w);
+	glad_glVertex4i(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4i", (void*)glad_glVertex4i, 4, x, y, z, w);
+}
+PFNGLVERTEX4IPROC glad_debug_glVertex4i = glad_debug_impl_glVertex4i;
+static void APIENTRY glad_debug_impl_glVertex4iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4iv", (void*)glad_glVertex4iv, 1, v);
+	glad_glVertex4iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4iv", (void*)glad_glVertex4iv, 1, v);
+}
+PFNGLVERTEX4IVPROC glad_debug_glVertex4iv = glad_debug_impl_glVertex4iv;
+static void APIENTRY glad_debug_impl_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4s", (void*)glad_glVertex4s, 4, x, y, z, w);
+	glad_glVertex4s(x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4s", (void*)glad_glVertex4s, 4, x, y, z, w);
+}
+PFNGLVERTEX4SPROC glad_debug_glVertex4s = glad_debug_impl_glVertex4s;
+static void APIENTRY glad_debug_impl_glVertex4sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertex4sv", (void*)glad_glVertex4sv, 1, v);
+	glad_glVertex4sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertex4sv", (void*)glad_glVertex4sv, 1, v);
+}
+PFNGLVERTEX4SVPROC glad_debug_glVertex4sv = glad_debug_impl_glVertex4sv;
+static void APIENTRY glad_debug_impl_glClipPlane(GLenum plane, const GLdouble *equation) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClipPlane", (void*)glad_glClipPlane, 2, plane, equation);
+	glad_glClipPlane(plane, equation);
+	if(_post_call_callback != NULL) _post_call_callback("glClipPlane", (void*)glad_glClipPlane, 2, plane, equation);
+}
+PFNGLCLIPPLANEPROC glad_debug_glClipPlane = glad_debug_impl_glClipPlane;
+static void APIENTRY glad_debug_impl_glColorMaterial(GLenum face, GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorMaterial", (void*)glad_glColorMaterial, 2, face, mode);
+	glad_glColorMaterial(face, mode);
+	if(_post_call_callback != NULL) _post_call_callback("glColorMaterial", (void*)glad_glColorMaterial, 2, face, mode);
+}
+PFNGLCOLORMATERIALPROC glad_debug_glColorMaterial = glad_debug_impl_glColorMaterial;
+static void APIENTRY glad_debug_impl_glFogf(GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogf", (void*)glad_glFogf, 2, pname, param);
+	glad_glFogf(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glFogf", (void*)glad_glFogf, 2, pname, param);
+}
+PFNGLFOGFPROC glad_debug_glFogf = glad_debug_impl_glFogf;
+static void APIENTRY glad_debug_impl_glFogfv(GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogfv", (void*)glad_glFogfv, 2, pname, params);
+	glad_glFogfv(pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glFogfv", (void*)glad_glFogfv, 2, pname, params);
+}
+PFNGLFOGFVPROC glad_debug_glFogfv = glad_debug_impl_glFogfv;
+static void APIENTRY glad_debug_impl_glFogi(GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogi", (void*)glad_glFogi, 2, pname, param);
+	glad_glFogi(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glFogi", (void*)glad_glFogi, 2, pname, param);
+}
+PFNGLFOGIPROC glad_debug_glFogi = glad_debug_impl_glFogi;
+static void APIENTRY glad_debug_impl_glFogiv(GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogiv", (void*)glad_glFogiv, 2, pname, params);
+	glad_glFogiv(pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glFogiv", (void*)glad_glFogiv, 2, pname, params);
+}
+PFNGLFOGIVPROC glad_debug_glFogiv = glad_debug_impl_glFogiv;
+static void APIENTRY glad_debug_impl_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLightf", (void*)glad_glLightf, 3, light, pname, param);
+	glad_glLightf(light, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glLightf", (void*)glad_glLightf, 3, light, pname, param);
+}
+PFNGLLIGHTFPROC glad_debug_glLightf = glad_debug_impl_glLightf;
+static void APIENTRY glad_debug_impl_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLightfv", (void*)glad_glLightfv, 3, light, pname, params);
+	glad_glLightfv(light, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glLightfv", (void*)glad_glLightfv, 3, light, pname, params);
+}
+PFNGLLIGHTFVPROC glad_debug_glLightfv = glad_debug_impl_glLightfv;
+static void APIENTRY glad_debug_impl_glLighti(GLenum light, GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLighti", (void*)glad_glLighti, 3, light, pname, param);
+	glad_glLighti(light, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glLighti", (void*)glad_glLighti, 3, light, pname, param);
+}
+PFNGLLIGHTIPROC glad_debug_glLighti = glad_debug_impl_glLighti;
+static void APIENTRY glad_debug_impl_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLightiv", (void*)glad_glLightiv, 3, light, pname, params);
+	glad_glLightiv(light, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glLightiv", (void*)glad_glLightiv, 3, light, pname, params);
+}
+PFNGLLIGHTIVPROC glad_debug_glLightiv = glad_debug_impl_glLightiv;
+static void APIENTRY glad_debug_impl_glLightModelf(GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLightModelf", (void*)glad_glLightModelf, 2, pname, param);
+	glad_glLightModelf(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glLightModelf", (void*)glad_glLightModelf, 2, pname, param);
+}
+PFNGLLIGHTMODELFPROC glad_debug_glLightModelf = glad_debug_impl_glLightModelf;
+static void APIENTRY glad_debug_impl_glLightModelfv(GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLightModelfv", (void*)glad_glLightModelfv, 2, pname, params);
+	glad_glLightModelfv(pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glLightModelfv", (void*)glad_glLightModelfv, 2, pname, params);
+}
+PFNGLLIGHTMODELFVPROC glad_debug_glLightModelfv = glad_debug_impl_glLightModelfv;
+static void APIENTRY glad_debug_impl_glLightModeli(GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLightModeli", (void*)glad_glLightModeli, 2, pname, param);
+	glad_glLightModeli(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glLightModeli", (void*)glad_glLightModeli, 2, pname, param);
+}
+PFNGLLIGHTMODELIPROC glad_debug_glLightModeli = glad_debug_impl_glLightModeli;
+static void APIENTRY glad_debug_impl_glLightModeliv(GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLightModeliv", (void*)glad_glLightModeliv, 2, pname, params);
+	glad_glLightModeliv(pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glLightModeliv", (void*)glad_glLightModeliv, 2, pname, params);
+}
+PFNGLLIGHTMODELIVPROC glad_debug_glLightModeliv = glad_debug_impl_glLightModeliv;
+static void APIENTRY glad_debug_impl_glLineStipple(GLint factor, GLushort pattern) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLineStipple", (void*)glad_glLineStipple, 2, factor, pattern);
+	glad_glLineStipple(factor, pattern);
+	if(_post_call_callback != NULL) _post_call_callback("glLineStipple", (void*)glad_glLineStipple, 2, factor, pattern);
+}
+PFNGLLINESTIPPLEPROC glad_debug_glLineStipple = glad_debug_impl_glLineStipple;
+static void APIENTRY glad_debug_impl_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMaterialf", (void*)glad_glMaterialf, 3, face, pname, param);
+	glad_glMaterialf(face, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glMaterialf", (void*)glad_glMaterialf, 3, face, pname, param);
+}
+PFNGLMATERIALFPROC glad_debug_glMaterialf = glad_debug_impl_glMaterialf;
+static void APIENTRY glad_debug_impl_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMaterialfv", (void*)glad_glMaterialfv, 3, face, pname, params);
+	glad_glMaterialfv(face, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glMaterialfv", (void*)glad_glMaterialfv, 3, face, pname, params);
+}
+PFNGLMATERIALFVPROC glad_debug_glMaterialfv = glad_debug_impl_glMaterialfv;
+static void APIENTRY glad_debug_impl_glMateriali(GLenum face, GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMateriali", (void*)glad_glMateriali, 3, face, pname, param);
+	glad_glMateriali(face, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glMateriali", (void*)glad_glMateriali, 3, face, pname, param);
+}
+PFNGLMATERIALIPROC glad_debug_glMateriali = glad_debug_impl_glMateriali;
+static void APIENTRY glad_debug_impl_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMaterialiv", (void*)glad_glMaterialiv, 3, face, pname, params);
+	glad_glMaterialiv(face, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glMaterialiv", (void*)glad_glMaterialiv, 3, face, pname, params);
+}
+PFNGLMATERIALIVPROC glad_debug_glMaterialiv = glad_debug_impl_glMaterialiv;
+static void APIENTRY glad_debug_impl_glPolygonStipple(const GLubyte *mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPolygonStipple", (void*)glad_glPolygonStipple, 1, mask);
+	glad_glPolygonStipple(mask);
+	if(_post_call_callback != NULL) _post_call_callback("glPolygonStipple", (void*)glad_glPolygonStipple, 1, mask);
+}
+PFNGLPOLYGONSTIPPLEPROC glad_debug_glPolygonStipple = glad_debug_impl_glPolygonStipple;
+static void APIENTRY glad_debug_impl_glShadeModel(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glShadeModel", (void*)glad_glShadeModel, 1, mode);
+	glad_glShadeModel(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glShadeModel", (void*)glad_glShadeModel, 1, mode);
+}
+PFNGLSHADEMODELPROC glad_debug_glShadeModel = glad_debug_impl_glShadeModel;
+static void APIENTRY glad_debug_impl_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexEnvf", (void*)glad_glTexEnvf, 3, target, pname, param);
+	glad_glTexEnvf(target, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glTexEnvf", (void*)glad_glTexEnvf, 3, target, pname, param);
+}
+PFNGLTEXENVFPROC glad_debug_glTexEnvf = glad_debug_impl_glTexEnvf;
+static void APIENTRY glad_debug_impl_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexEnvfv", (void*)glad_glTexEnvfv, 3, target, pname, params);
+	glad_glTexEnvfv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexEnvfv", (void*)glad_glTexEnvfv, 3, target, pname, params);
+}
+PFNGLTEXENVFVPROC glad_debug_glTexEnvfv = glad_debug_impl_glTexEnvfv;
+static void APIENTRY glad_debug_impl_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexEnvi", (void*)glad_glTexEnvi, 3, target, pname, param);
+	glad_glTexEnvi(target, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glTexEnvi", (void*)glad_glTexEnvi, 3, target, pname, param);
+}
+PFNGLTEXENVIPROC glad_debug_glTexEnvi = glad_debug_impl_glTexEnvi;
+static void APIENTRY glad_debug_impl_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexEnviv", (void*)glad_glTexEnviv, 3, target, pname, params);
+	glad_glTexEnviv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexEnviv", (void*)glad_glTexEnviv, 3, target, pname, params);
+}
+PFNGLTEXENVIVPROC glad_debug_glTexEnviv = glad_debug_impl_glTexEnviv;
+static void APIENTRY glad_debug_impl_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexGend", (void*)glad_glTexGend, 3, coord, pname, param);
+	glad_glTexGend(coord, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glTexGend", (void*)glad_glTexGend, 3, coord, pname, param);
+}
+PFNGLTEXGENDPROC glad_debug_glTexGend = glad_debug_impl_glTexGend;
+static void APIENTRY glad_debug_impl_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexGendv", (void*)glad_glTexGendv, 3, coord, pname, params);
+	glad_glTexGendv(coord, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexGendv", (void*)glad_glTexGendv, 3, coord, pname, params);
+}
+PFNGLTEXGENDVPROC glad_debug_glTexGendv = glad_debug_impl_glTexGendv;
+static void APIENTRY glad_debug_impl_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexGenf", (void*)glad_glTexGenf, 3, coord, pname, param);
+	glad_glTexGenf(coord, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glTexGenf", (void*)glad_glTexGenf, 3, coord, pname, param);
+}
+PFNGLTEXGENFPROC glad_debug_glTexGenf = glad_debug_impl_glTexGenf;
+static void APIENTRY glad_debug_impl_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexGenfv", (void*)glad_glTexGenfv, 3, coord, pname, params);
+	glad_glTexGenfv(coord, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexGenfv", (void*)glad_glTexGenfv, 3, coord, pname, params);
+}
+PFNGLTEXGENFVPROC glad_debug_glTexGenfv = glad_debug_impl_glTexGenfv;
+static void APIENTRY glad_debug_impl_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexGeni", (void*)glad_glTexGeni, 3, coord, pname, param);
+	glad_glTexGeni(coord, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glTexGeni", (void*)glad_glTexGeni, 3, coord, pname, param);
+}
+PFNGLTEXGENIPROC glad_debug_glTexGeni = glad_debug_impl_glTexGeni;
+static void APIENTRY glad_debug_impl_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexGeniv", (void*)glad_glTexGeniv, 3, coord, pname, params);
+	glad_glTexGeniv(coord, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexGeniv", (void*)glad_glTexGeniv, 3, coord, pname, params);
+}
+PFNGLTEXGENIVPROC glad_debug_glTexGeniv = glad_debug_impl_glTexGeniv;
+static void APIENTRY glad_debug_impl_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFeedbackBuffer", (void*)glad_glFeedbackBuffer, 3, size, type, buffer);
+	glad_glFeedbackBuffer(size, type, buffer);
+	if(_post_call_callback != NULL) _post_call_callback("glFeedbackBuffer", (void*)glad_glFeedbackBuffer, 3, size, type, buffer);
+}
+PFNGLFEEDBACKBUFFERPROC glad_debug_glFeedbackBuffer = glad_debug_impl_glFeedbackBuffer;
+static void APIENTRY glad_debug_impl_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSelectBuffer", (void*)glad_glSelectBuffer, 2, size, buffer);
+	glad_glSelectBuffer(size, buffer);
+	if(_post_call_callback != NULL) _post_call_callback("glSelectBuffer", (void*)glad_glSelectBuffer, 2, size, buffer);
+}
+PFNGLSELECTBUFFERPROC glad_debug_glSelectBuffer = glad_debug_impl_glSelectBuffer;
+static GLint APIENTRY glad_debug_impl_glRenderMode(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRenderMode", (void*)glad_glRenderMode, 1, mode);
+	GLint ret = glad_glRenderMode(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glRenderMode", (void*)glad_glRenderMode, 1, mode);
+	return ret;
+}
+PFNGLRENDERMODEPROC glad_debug_glRenderMode = glad_debug_impl_glRenderMode;
+static void APIENTRY glad_debug_impl_glInitNames(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glInitNames", (void*)glad_glInitNames, 0);
+	glad_glInitNames();
+	if(_post_call_callback != NULL) _post_call_callback("glInitNames", (void*)glad_glInitNames, 0);
+}
+PFNGLINITNAMESPROC glad_debug_glInitNames = glad_debug_impl_glInitNames;
+static void APIENTRY glad_debug_impl_glLoadName(GLuint name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLoadName", (void*)glad_glLoadName, 1, name);
+	glad_glLoadName(name);
+	if(_post_call_callback != NULL) _post_call_callback("glLoadName", (void*)glad_glLoadName, 1, name);
+}
+PFNGLLOADNAMEPROC glad_debug_glLoadName = glad_debug_impl_glLoadName;
+static void APIENTRY glad_debug_impl_glPassThrough(GLfloat token) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPassThrough", (void*)glad_glPassThrough, 1, token);
+	glad_glPassThrough(token);
+	if(_post_call_callback != NULL) _post_call_callback("glPassThrough", (void*)glad_glPassThrough, 1, token);
+}
+PFNGLPASSTHROUGHPROC glad_debug_glPassThrough = glad_debug_impl_glPassThrough;
+static void APIENTRY glad_debug_impl_glPopName(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPopName", (void*)glad_glPopName, 0);
+	glad_glPopName();
+	if(_post_call_callback != NULL) _post_call_callback("glPopName", (void*)glad_glPopName, 0);
+}
+PFNGLPOPNAMEPROC glad_debug_glPopName = glad_debug_impl_glPopName;
+static void APIENTRY glad_debug_impl_glPushName(GLuint name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPushName", (void*)glad_glPushName, 1, name);
+	glad_glPushName(name);
+	if(_post_call_callback != NULL) _post_call_callback("glPushName", (void*)glad_glPushName, 1, name);
+}
+PFNGLPUSHNAMEPROC glad_debug_glPushName = glad_debug_impl_glPushName;
+static void APIENTRY glad_debug_impl_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearAccum", (void*)glad_glClearAccum, 4, red, green, blue, alpha);
+	glad_glClearAccum(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glClearAccum", (void*)glad_glClearAccum, 4, red, green, blue, alpha);
+}
+PFNGLCLEARACCUMPROC glad_debug_glClearAccum = glad_debug_impl_glClearAccum;
+static void APIENTRY glad_debug_impl_glClearIndex(GLfloat c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearIndex", (void*)glad_glClearIndex, 1, c);
+	glad_glClearIndex(c);
+	if(_post_call_callback != NULL) _post_call_callback("glClearIndex", (void*)glad_glClearIndex, 1, c);
+}
+PFNGLCLEARINDEXPROC glad_debug_glClearIndex = glad_debug_impl_glClearIndex;
+static void APIENTRY glad_debug_impl_glIndexMask(GLuint mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexMask", (void*)glad_glIndexMask, 1, mask);
+	glad_glIndexMask(mask);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexMask", (void*)glad_glIndexMask, 1, mask);
+}
+PFNGLINDEXMASKPROC glad_debug_glIndexMask = glad_debug_impl_glIndexMask;
+static void APIENTRY glad_debug_impl_glAccum(GLenum op, GLfloat value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glAccum", (void*)glad_glAccum, 2, op, value);
+	glad_glAccum(op, value);
+	if(_post_call_callback != NULL) _post_call_callback("glAccum", (void*)glad_glAccum, 2, op, value);
+}
+PFNGLACCUMPROC glad_debug_glAccum = glad_debug_impl_glAccum;
+static void APIENTRY glad_debug_impl_glPopAttrib(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPopAttrib", (void*)glad_glPopAttrib, 0);
+	glad_glPopAttrib();
+	if(_post_call_callback != NULL) _post_call_callback("glPopAttrib", (void*)glad_glPopAttrib, 0);
+}
+PFNGLPOPATTRIBPROC glad_debug_glPopAttrib = glad_debug_impl_glPopAttrib;
+static void APIENTRY glad_debug_impl_glPushAttrib(GLbitfield mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPushAttrib", (void*)glad_glPushAttrib, 1, mask);
+	glad_glPushAttrib(mask);
+	if(_post_call_callback != NULL) _post_call_callback("glPushAttrib", (void*)glad_glPushAttrib, 1, mask);
+}
+PFNGLPUSHATTRIBPROC glad_debug_glPushAttrib = glad_debug_impl_glPushAttrib;
+static void APIENTRY glad_debug_impl_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMap1d", (void*)glad_glMap1d, 6, target, u1, u2, stride, order, points);
+	glad_glMap1d(target, u1, u2, stride, order, points);
+	if(_post_call_callback != NULL) _post_call_callback("glMap1d", (void*)glad_glMap1d, 6, target, u1, u2, stride, order, points);
+}
+PFNGLMAP1DPROC glad_debug_glMap1d = glad_debug_impl_glMap1d;
+static void APIENTRY glad_debug_impl_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMap1f", (void*)glad_glMap1f, 6, target, u1, u2, stride, order, points);
+	glad_glMap1f(target, u1, u2, stride, order, points);
+	if(_post_call_callback != NULL) _post_call_callback("glMap1f", (void*)glad_glMap1f, 6, target, u1, u2, stride, order, points);
+}
+PFNGLMAP1FPROC glad_debug_glMap1f = glad_debug_impl_glMap1f;
+static void APIENTRY glad_debug_impl_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMap2d", (void*)glad_glMap2d, 10, target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	if(_post_call_callback != NULL) _post_call_callback("glMap2d", (void*)glad_glMap2d, 10, target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+PFNGLMAP2DPROC glad_debug_glMap2d = glad_debug_impl_glMap2d;
+static void APIENTRY glad_debug_impl_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMap2f", (void*)glad_glMap2f, 10, target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	if(_post_call_callback != NULL) _post_call_callback("glMap2f", (void*)glad_glMap2f, 10, target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+PFNGLMAP2FPROC glad_debug_glMap2f = glad_debug_impl_glMap2f;
+static void APIENTRY glad_debug_impl_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMapGrid1d", (void*)glad_glMapGrid1d, 3, un, u1, u2);
+	glad_glMapGrid1d(un, u1, u2);
+	if(_post_call_callback != NULL) _post_call_callback("glMapGrid1d", (void*)glad_glMapGrid1d, 3, un, u1, u2);
+}
+PFNGLMAPGRID1DPROC glad_debug_glMapGrid1d = glad_debug_impl_glMapGrid1d;
+static void APIENTRY glad_debug_impl_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMapGrid1f", (void*)glad_glMapGrid1f, 3, un, u1, u2);
+	glad_glMapGrid1f(un, u1, u2);
+	if(_post_call_callback != NULL) _post_call_callback("glMapGrid1f", (void*)glad_glMapGrid1f, 3, un, u1, u2);
+}
+PFNGLMAPGRID1FPROC glad_debug_glMapGrid1f = glad_debug_impl_glMapGrid1f;
+static void APIENTRY glad_debug_impl_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMapGrid2d", (void*)glad_glMapGrid2d, 6, un, u1, u2, vn, v1, v2);
+	glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glMapGrid2d", (void*)glad_glMapGrid2d, 6, un, u1, u2, vn, v1, v2);
+}
+PFNGLMAPGRID2DPROC glad_debug_glMapGrid2d = glad_debug_impl_glMapGrid2d;
+static void APIENTRY glad_debug_impl_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMapGrid2f", (void*)glad_glMapGrid2f, 6, un, u1, u2, vn, v1, v2);
+	glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glMapGrid2f", (void*)glad_glMapGrid2f, 6, un, u1, u2, vn, v1, v2);
+}
+PFNGLMAPGRID2FPROC glad_debug_glMapGrid2f = glad_debug_impl_glMapGrid2f;
+static void APIENTRY glad_debug_impl_glEvalCoord1d(GLdouble u) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord1d", (void*)glad_glEvalCoord1d, 1, u);
+	glad_glEvalCoord1d(u);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord1d", (void*)glad_glEvalCoord1d, 1, u);
+}
+PFNGLEVALCOORD1DPROC glad_debug_glEvalCoord1d = glad_debug_impl_glEvalCoord1d;
+static void APIENTRY glad_debug_impl_glEvalCoord1dv(const GLdouble *u) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord1dv", (void*)glad_glEvalCoord1dv, 1, u);
+	glad_glEvalCoord1dv(u);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord1dv", (void*)glad_glEvalCoord1dv, 1, u);
+}
+PFNGLEVALCOORD1DVPROC glad_debug_glEvalCoord1dv = glad_debug_impl_glEvalCoord1dv;
+static void APIENTRY glad_debug_impl_glEvalCoord1f(GLfloat u) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord1f", (void*)glad_glEvalCoord1f, 1, u);
+	glad_glEvalCoord1f(u);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord1f", (void*)glad_glEvalCoord1f, 1, u);
+}
+PFNGLEVALCOORD1FPROC glad_debug_glEvalCoord1f = glad_debug_impl_glEvalCoord1f;
+static void APIENTRY glad_debug_impl_glEvalCoord1fv(const GLfloat *u) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord1fv", (void*)glad_glEvalCoord1fv, 1, u);
+	glad_glEvalCoord1fv(u);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord1fv", (void*)glad_glEvalCoord1fv, 1, u);
+}
+PFNGLEVALCOORD1FVPROC glad_debug_glEvalCoord1fv = glad_debug_impl_glEvalCoord1fv;
+static void APIENTRY glad_debug_impl_glEvalCoord2d(GLdouble u, GLdouble v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord2d", (void*)glad_glEvalCoord2d, 2, u, v);
+	glad_glEvalCoord2d(u, v);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord2d", (void*)glad_glEvalCoord2d, 2, u, v);
+}
+PFNGLEVALCOORD2DPROC glad_debug_glEvalCoord2d = glad_debug_impl_glEvalCoord2d;
+static void APIENTRY glad_debug_impl_glEvalCoord2dv(const GLdouble *u) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord2dv", (void*)glad_glEvalCoord2dv, 1, u);
+	glad_glEvalCoord2dv(u);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord2dv", (void*)glad_glEvalCoord2dv, 1, u);
+}
+PFNGLEVALCOORD2DVPROC glad_debug_glEvalCoord2dv = glad_debug_impl_glEvalCoord2dv;
+static void APIENTRY glad_debug_impl_glEvalCoord2f(GLfloat u, GLfloat v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord2f", (void*)glad_glEvalCoord2f, 2, u, v);
+	glad_glEvalCoord2f(u, v);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord2f", (void*)glad_glEvalCoord2f, 2, u, v);
+}
+PFNGLEVALCOORD2FPROC glad_debug_glEvalCoord2f = glad_debug_impl_glEvalCoord2f;
+static void APIENTRY glad_debug_impl_glEvalCoord2fv(const GLfloat *u) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalCoord2fv", (void*)glad_glEvalCoord2fv, 1, u);
+	glad_glEvalCoord2fv(u);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalCoord2fv", (void*)glad_glEvalCoord2fv, 1, u);
+}
+PFNGLEVALCOORD2FVPROC glad_debug_glEvalCoord2fv = glad_debug_impl_glEvalCoord2fv;
+static void APIENTRY glad_debug_impl_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalMesh1", (void*)glad_glEvalMesh1, 3, mode, i1, i2);
+	glad_glEvalMesh1(mode, i1, i2);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalMesh1", (void*)glad_glEvalMesh1, 3, mode, i1, i2);
+}
+PFNGLEVALMESH1PROC glad_debug_glEvalMesh1 = glad_debug_impl_glEvalMesh1;
+static void APIENTRY glad_debug_impl_glEvalPoint1(GLint i) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalPoint1", (void*)glad_glEvalPoint1, 1, i);
+	glad_glEvalPoint1(i);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalPoint1", (void*)glad_glEvalPoint1, 1, i);
+}
+PFNGLEVALPOINT1PROC glad_debug_glEvalPoint1 = glad_debug_impl_glEvalPoint1;
+static void APIENTRY glad_debug_impl_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalMesh2", (void*)glad_glEvalMesh2, 5, mode, i1, i2, j1, j2);
+	glad_glEvalMesh2(mode, i1, i2, j1, j2);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalMesh2", (void*)glad_glEvalMesh2, 5, mode, i1, i2, j1, j2);
+}
+PFNGLEVALMESH2PROC glad_debug_glEvalMesh2 = glad_debug_impl_glEvalMesh2;
+static void APIENTRY glad_debug_impl_glEvalPoint2(GLint i, GLint j) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEvalPoint2", (void*)glad_glEvalPoint2, 2, i, j);
+	glad_glEvalPoint2(i, j);
+	if(_post_call_callback != NULL) _post_call_callback("glEvalPoint2", (void*)glad_glEvalPoint2, 2, i, j);
+}
+PFNGLEVALPOINT2PROC glad_debug_glEvalPoint2 = glad_debug_impl_glEvalPoint2;
+static void APIENTRY glad_debug_impl_glAlphaFunc(GLenum func, GLfloat ref) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glAlphaFunc", (void*)glad_glAlphaFunc, 2, func, ref);
+	glad_glAlphaFunc(func, ref);
+	if(_post_call_callback != NULL) _post_call_callback("glAlphaFunc", (void*)glad_glAlphaFunc, 2, func, ref);
+}
+PFNGLALPHAFUNCPROC glad_debug_glAlphaFunc = glad_debug_impl_glAlphaFunc;
+static void APIENTRY glad_debug_impl_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelZoom", (void*)glad_glPixelZoom, 2, xfactor, yfactor);
+	glad_glPixelZoom(xfactor, yfactor);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelZoom", (void*)glad_glPixelZoom, 2, xfactor, yfactor);
+}
+PFNGLPIXELZOOMPROC glad_debug_glPixelZoom = glad_debug_impl_glPixelZoom;
+static void APIENTRY glad_debug_impl_glPixelTransferf(GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelTransferf", (void*)glad_glPixelTransferf, 2, pname, param);
+	glad_glPixelTransferf(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelTransferf", (void*)glad_glPixelTransferf, 2, pname, param);
+}
+PFNGLPIXELTRANSFERFPROC glad_debug_glPixelTransferf = glad_debug_impl_glPixelTransferf;
+static void APIENTRY glad_debug_impl_glPixelTransferi(GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelTransferi", (void*)glad_glPixelTransferi, 2, pname, param);
+	glad_glPixelTransferi(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelTransferi", (void*)glad_glPixelTransferi, 2, pname, param);
+}
+PFNGLPIXELTRANSFERIPROC glad_debug_glPixelTransferi = glad_debug_impl_glPixelTransferi;
+static void APIENTRY glad_debug_impl_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelMapfv", (void*)glad_glPixelMapfv, 3, map, mapsize, values);
+	glad_glPixelMapfv(map, mapsize, values);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelMapfv", (void*)glad_glPixelMapfv, 3, map, mapsize, values);
+}
+PFNGLPIXELMAPFVPROC glad_debug_glPixelMapfv = glad_debug_impl_glPixelMapfv;
+static void APIENTRY glad_debug_impl_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelMapuiv", (void*)glad_glPixelMapuiv, 3, map, mapsize, values);
+	glad_glPixelMapuiv(map, mapsize, values);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelMapuiv", (void*)glad_glPixelMapuiv, 3, map, mapsize, values);
+}
+PFNGLPIXELMAPUIVPROC glad_debug_glPixelMapuiv = glad_debug_impl_glPixelMapuiv;
+static void APIENTRY glad_debug_impl_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPixelMapusv", (void*)glad_glPixelMapusv, 3, map, mapsize, values);
+	glad_glPixelMapusv(map, mapsize, values);
+	if(_post_call_callback != NULL) _post_call_callback("glPixelMapusv", (void*)glad_glPixelMapusv, 3, map, mapsize, values);
+}
+PFNGLPIXELMAPUSVPROC glad_debug_glPixelMapusv = glad_debug_impl_glPixelMapusv;
+static void APIENTRY glad_debug_impl_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCopyPixels", (void*)glad_glCopyPixels, 5, x, y, width, height, type);
+	glad_glCopyPixels(x, y, width, height, type);
+	if(_post_call_callback != NULL) _post_call_callback("glCopyPixels", (void*)glad_glCopyPixels, 5, x, y, width, height, type);
+}
+PFNGLCOPYPIXELSPROC glad_debug_glCopyPixels = glad_debug_impl_glCopyPixels;
+static void APIENTRY glad_debug_impl_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawPixels", (void*)glad_glDrawPixels, 5, width, height, format, type, pixels);
+	glad_glDrawPixels(width, height, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawPixels", (void*)glad_glDrawPixels, 5, width, height, format, type, pixels);
+}
+PFNGLDRAWPIXELSPROC glad_debug_glDrawPixels = glad_debug_impl_glDrawPixels;
+static void APIENTRY glad_debug_impl_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetClipPlane", (void*)glad_glGetClipPlane, 2, plane, equation);
+	glad_glGetClipPlane(plane, equation);
+	if(_post_call_callback != NULL) _post_call_callback("glGetClipPlane", (void*)glad_glGetClipPlane, 2, plane, equation);
+}
+PFNGLGETCLIPPLANEPROC glad_debug_glGetClipPlane = glad_debug_impl_glGetClipPlane;
+static void APIENTRY glad_debug_impl_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetLightfv", (void*)glad_glGetLightfv, 3, light, pname, params);
+	glad_glGetLightfv(light, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetLightfv", (void*)glad_glGetLightfv, 3, light, pname, params);
+}
+PFNGLGETLIGHTFVPROC glad_debug_glGetLightfv = glad_debug_impl_glGetLightfv;
+static void APIENTRY glad_debug_impl_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetLightiv", (void*)glad_glGetLightiv, 3, light, pname, params);
+	glad_glGetLightiv(light, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetLightiv", (void*)glad_glGetLightiv, 3, light, pname, params);
+}
+PFNGLGETLIGHTIVPROC glad_debug_glGetLightiv = glad_debug_impl_glGetLightiv;
+static void APIENTRY glad_debug_impl_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetMapdv", (void*)glad_glGetMapdv, 3, target, query, v);
+	glad_glGetMapdv(target, query, v);
+	if(_post_call_callback != NULL) _post_call_callback("glGetMapdv", (void*)glad_glGetMapdv, 3, target, query, v);
+}
+PFNGLGETMAPDVPROC glad_debug_glGetMapdv = glad_debug_impl_glGetMapdv;
+static void APIENTRY glad_debug_impl_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetMapfv", (void*)glad_glGetMapfv, 3, target, query, v);
+	glad_glGetMapfv(target, query, v);
+	if(_post_call_callback != NULL) _post_call_callback("glGetMapfv", (void*)glad_glGetMapfv, 3, target, query, v);
+}
+PFNGLGETMAPFVPROC glad_debug_glGetMapfv = glad_debug_impl_glGetMapfv;
+static void APIENTRY glad_debug_impl_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetMapiv", (void*)glad_glGetMapiv, 3, target, query, v);
+	glad_glGetMapiv(target, query, v);
+	if(_post_call_callback != NULL) _post_call_callback("glGetMapiv", (void*)glad_glGetMapiv, 3, target, query, v);
+}
+PFNGLGETMAPIVPROC glad_debug_glGetMapiv = glad_debug_impl_glGetMapiv;
+static void APIENTRY glad_debug_impl_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetMaterialfv", (void*)glad_glGetMaterialfv, 3, face, pname, params);
+	glad_glGetMaterialfv(face, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetMaterialfv", (void*)glad_glGetMaterialfv, 3, face, pname, params);
+}
+PFNGLGETMATERIALFVPROC glad_debug_glGetMaterialfv = glad_debug_impl_glGetMaterialfv;
+static void APIENTRY glad_debug_impl_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetMaterialiv", (void*)glad_glGetMaterialiv, 3, face, pname, params);
+	glad_glGetMaterialiv(face, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetMaterialiv", (void*)glad_glGetMaterialiv, 3, face, pname, params);
+}
+PFNGLGETMATERIALIVPROC glad_debug_glGetMaterialiv = glad_debug_impl_glGetMaterialiv;
+static void APIENTRY glad_debug_impl_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetPixelMapfv", (void*)glad_glGetPixelMapfv, 2, map, values);
+	glad_glGetPixelMapfv(map, values);
+	if(_post_call_callback != NULL) _post_call_callback("glGetPixelMapfv", (void*)glad_glGetPixelMapfv, 2, map, values);
+}
+PFNGLGETPIXELMAPFVPROC glad_debug_glGetPixelMapfv = glad_debug_impl_glGetPixelMapfv;
+static void APIENTRY glad_debug_impl_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetPixelMapuiv", (void*)glad_glGetPixelMapuiv, 2, map, values);
+	glad_glGetPixelMapuiv(map, values);
+	if(_post_call_callback != NULL) _post_call_callback("glGetPixelMapuiv", (void*)glad_glGetPixelMapuiv, 2, map, values);
+}
+PFNGLGETPIXELMAPUIVPROC glad_debug_glGetPixelMapuiv = glad_debug_impl_glGetPixelMapuiv;
+static void APIENTRY glad_debug_impl_glGetPixelMapusv(GLenum map, GLushort *values) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetPixelMapusv", (void*)glad_glGetPixelMapusv, 2, map, values);
+	glad_glGetPixelMapusv(map, values);
+	if(_post_call_callback != NULL) _post_call_callback("glGetPixelMapusv", (void*)glad_glGetPixelMapusv, 2, map, values);
+}
+PFNGLGETPIXELMAPUSVPROC glad_debug_glGetPixelMapusv = glad_debug_impl_glGetPixelMapusv;
+static void APIENTRY glad_debug_impl_glGetPolygonStipple(GLubyte *mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetPolygonStipple", (void*)glad_glGetPolygonStipple, 1, mask);
+	glad_glGetPolygonStipple(mask);
+	if(_post_call_callback != NULL) _post_call_callback("glGetPolygonStipple", (void*)glad_glGetPolygonStipple, 1, mask);
+}
+PFNGLGETPOLYGONSTIPPLEPROC glad_debug_glGetPolygonStipple = glad_debug_impl_glGetPolygonStipple;
+static void APIENTRY glad_debug_impl_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexEnvfv", (void*)glad_glGetTexEnvfv, 3, target, pname, params);
+	glad_glGetTexEnvfv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexEnvfv", (void*)glad_glGetTexEnvfv, 3, target, pname, params);
+}
+PFNGLGETTEXENVFVPROC glad_debug_glGetTexEnvfv = glad_debug_impl_glGetTexEnvfv;
+static void APIENTRY glad_debug_impl_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexEnviv", (void*)glad_glGetTexEnviv, 3, target, pname, params);
+	glad_glGetTexEnviv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexEnviv", (void*)glad_glGetTexEnviv, 3, target, pname, params);
+}
+PFNGLGETTEXENVIVPROC glad_debug_glGetTexEnviv = glad_debug_impl_glGetTexEnviv;
+static void APIENTRY glad_debug_impl_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexGendv", (void*)glad_glGetTexGendv, 3, coord, pname, params);
+	glad_glGetTexGendv(coord, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexGendv", (void*)glad_glGetTexGendv, 3, coord, pname, params);
+}
+PFNGLGETTEXGENDVPROC glad_debug_glGetTexGendv = glad_debug_impl_glGetTexGendv;
+static void APIENTRY glad_debug_impl_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexGenfv", (void*)glad_glGetTexGenfv, 3, coord, pname, params);
+	glad_glGetTexGenfv(coord, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexGenfv", (void*)glad_glGetTexGenfv, 3, coord, pname, params);
+}
+PFNGLGETTEXGENFVPROC glad_debug_glGetTexGenfv = glad_debug_impl_glGetTexGenfv;
+static void APIENTRY glad_debug_impl_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexGeniv", (void*)glad_glGetTexGeniv, 3, coord, pname, params);
+	glad_glGetTexGeniv(coord, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexGeniv", (void*)glad_glGetTexGeniv, 3, coord, pname, params);
+}
+PFNGLGETTEXGENIVPROC glad_debug_glGetTexGeniv = glad_debug_impl_glGetTexGeniv;
+static GLboolean APIENTRY glad_debug_impl_glIsList(GLuint list) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsList", (void*)glad_glIsList, 1, list);
+	GLboolean ret = glad_glIsList(list);
+	if(_post_call_callback != NULL) _post_call_callback("glIsList", (void*)glad_glIsList, 1, list);
+	return ret;
+}
+PFNGLISLISTPROC glad_debug_glIsList = glad_debug_impl_glIsList;
+static void APIENTRY glad_debug_impl_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFrustum", (void*)glad_glFrustum, 6, left, right, bottom, top, zNear, zFar);
+	glad_glFrustum(left, right, bottom, top, zNear, zFar);
+	if(_post_call_callback != NULL) _post_call_callback("glFrustum", (void*)glad_glFrustum, 6, left, right, bottom, top, zNear, zFar);
+}
+PFNGLFRUSTUMPROC glad_debug_glFrustum = glad_debug_impl_glFrustum;
+static void APIENTRY glad_debug_impl_glLoadIdentity(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLoadIdentity", (void*)glad_glLoadIdentity, 0);
+	glad_glLoadIdentity();
+	if(_post_call_callback != NULL) _post_call_callback("glLoadIdentity", (void*)glad_glLoadIdentity, 0);
+}
+PFNGLLOADIDENTITYPROC glad_debug_glLoadIdentity = glad_debug_impl_glLoadIdentity;
+static void APIENTRY glad_debug_impl_glLoadMatrixf(const GLfloat *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLoadMatrixf", (void*)glad_glLoadMatrixf, 1, m);
+	glad_glLoadMatrixf(m);
+	if(_post_call_callback != NULL) _post_call_callback("glLoadMatrixf", (void*)glad_glLoadMatrixf, 1, m);
+}
+PFNGLLOADMATRIXFPROC glad_debug_glLoadMatrixf = glad_debug_impl_glLoadMatrixf;
+static void APIENTRY glad_debug_impl_glLoadMatrixd(const GLdouble *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLoadMatrixd", (void*)glad_glLoadMatrixd, 1, m);
+	glad_glLoadMatrixd(m);
+	if(_post_call_callback != NULL) _post_call_callback("glLoadMatrixd", (void*)glad_glLoadMatrixd, 1, m);
+}
+PFNGLLOADMATRIXDPROC glad_debug_glLoadMatrixd = glad_debug_impl_glLoadMatrixd;
+static void APIENTRY glad_debug_impl_glMatrixMode(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMatrixMode", (void*)glad_glMatrixMode, 1, mode);
+	glad_glMatrixMode(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glMatrixMode", (void*)glad_glMatrixMode, 1, mode);
+}
+PFNGLMATRIXMODEPROC glad_debug_glMatrixMode = glad_debug_impl_glMatrixMode;
+static void APIENTRY glad_debug_impl_glMultMatrixf(const GLfloat *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultMatrixf", (void*)glad_glMultMatrixf, 1, m);
+	glad_glMultMatrixf(m);
+	if(_post_call_callback != NULL) _post_call_callback("glMultMatrixf", (void*)glad_glMultMatrixf, 1, m);
+}
+PFNGLMULTMATRIXFPROC glad_debug_glMultMatrixf = glad_debug_impl_glMultMatrixf;
+static void APIENTRY glad_debug_impl_glMultMatrixd(const GLdouble *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultMatrixd", (void*)glad_glMultMatrixd, 1, m);
+	glad_glMultMatrixd(m);
+	if(_post_call_callback != NULL) _post_call_callback("glMultMatrixd", (void*)glad_glMultMatrixd, 1, m);
+}
+PFNGLMULTMATRIXDPROC glad_debug_glMultMatrixd = glad_debug_impl_glMultMatrixd;
+static void APIENTRY glad_debug_impl_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glOrtho", (void*)glad_glOrtho, 6, left, right, bottom, top, zNear, zFar);
+	glad_glOrtho(left, right, bottom, top, zNear, zFar);
+	if(_post_call_callback != NULL) _post_call_callback("glOrtho", (void*)glad_glOrtho, 6, left, right, bottom, top, zNear, zFar);
+}
+PFNGLORTHOPROC glad_debug_glOrtho = glad_debug_impl_glOrtho;
+static void APIENTRY glad_debug_impl_glPopMatrix(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPopMatrix", (void*)glad_glPopMatrix, 0);
+	glad_glPopMatrix();
+	if(_post_call_callback != NULL) _post_call_callback("glPopMatrix", (void*)glad_glPopMatrix, 0);
+}
+PFNGLPOPMATRIXPROC glad_debug_glPopMatrix = glad_debug_impl_glPopMatrix;
+static void APIENTRY glad_debug_impl_glPushMatrix(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPushMatrix", (void*)glad_glPushMatrix, 0);
+	glad_glPushMatrix();
+	if(_post_call_callback != NULL) _post_call_callback("glPushMatrix", (void*)glad_glPushMatrix, 0);
+}
+PFNGLPUSHMATRIXPROC glad_debug_glPushMatrix = glad_debug_impl_glPushMatrix;
+static void APIENTRY glad_debug_impl_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRotated", (void*)glad_glRotated, 4, angle, x, y, z);
+	glad_glRotated(angle, x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glRotated", (void*)glad_glRotated, 4, angle, x, y, z);
+}
+PFNGLROTATEDPROC glad_debug_glRotated = glad_debug_impl_glRotated;
+static void APIENTRY glad_debug_impl_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRotatef", (void*)glad_glRotatef, 4, angle, x, y, z);
+	glad_glRotatef(angle, x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glRotatef", (void*)glad_glRotatef, 4, angle, x, y, z);
+}
+PFNGLROTATEFPROC glad_debug_glRotatef = glad_debug_impl_glRotatef;
+static void APIENTRY glad_debug_impl_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glScaled", (void*)glad_glScaled, 3, x, y, z);
+	glad_glScaled(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glScaled", (void*)glad_glScaled, 3, x, y, z);
+}
+PFNGLSCALEDPROC glad_debug_glScaled = glad_debug_impl_glScaled;
+static void APIENTRY glad_debug_impl_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glScalef", (void*)glad_glScalef, 3, x, y, z);
+	glad_glScalef(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glScalef", (void*)glad_glScalef, 3, x, y, z);
+}
+PFNGLSCALEFPROC glad_debug_glScalef = glad_debug_impl_glScalef;
+static void APIENTRY glad_debug_impl_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTranslated", (void*)glad_glTranslated, 3, x, y, z);
+	glad_glTranslated(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glTranslated", (void*)glad_glTranslated, 3, x, y, z);
+}
+PFNGLTRANSLATEDPROC glad_debug_glTranslated = glad_debug_impl_glTranslated;
+static void APIENTRY glad_debug_impl_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTranslatef", (void*)glad_glTranslatef, 3, x, y, z);
+	glad_glTranslatef(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glTranslatef", (void*)glad_glTranslatef, 3, x, y, z);
+}
+PFNGLTRANSLATEFPROC glad_debug_glTranslatef = glad_debug_impl_glTranslatef;
+static void APIENTRY glad_debug_impl_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawArrays", (void*)glad_glDrawArrays, 3, mode, first, count);
+	glad_glDrawArrays(mode, first, count);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawArrays", (void*)glad_glDrawArrays, 3, mode, first, count);
+}
+PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays = glad_debug_impl_glDrawArrays;
+static void APIENTRY glad_debug_impl_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawElements", (void*)glad_glDrawElements, 4, mode, count, type, indices);
+	glad_glDrawElements(mode, count, type, indices);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawElements", (void*)glad_glDrawElements, 4, mode, count, type, indices);
+}
+PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements = glad_debug_impl_glDrawElements;
+static void APIENTRY glad_debug_impl_glGetPointerv(GLenum pname, void **params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetPointerv", (void*)glad_glGetPointerv, 2, pname, params);
+	glad_glGetPointerv(pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetPointerv", (void*)glad_glGetPointerv, 2, pname, params);
+}
+PFNGLGETPOINTERVPROC glad_debug_glGetPointerv = glad_debug_impl_glGetPointerv;
+static void APIENTRY glad_debug_impl_glPolygonOffset(GLfloat factor, GLfloat units) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPolygonOffset", (void*)glad_glPolygonOffset, 2, factor, units);
+	glad_glPolygonOffset(factor, units);
+	if(_post_call_callback != NULL) _post_call_callback("glPolygonOffset", (void*)glad_glPolygonOffset, 2, factor, units);
+}
+PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset = glad_debug_impl_glPolygonOffset;
+static void APIENTRY glad_debug_impl_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCopyTexImage1D", (void*)glad_glCopyTexImage1D, 7, target, level, internalformat, x, y, width, border);
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	if(_post_call_callback != NULL) _post_call_callback("glCopyTexImage1D", (void*)glad_glCopyTexImage1D, 7, target, level, internalformat, x, y, width, border);
+}
+PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D = glad_debug_impl_glCopyTexImage1D;
+static void APIENTRY glad_debug_impl_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCopyTexImage2D", (void*)glad_glCopyTexImage2D, 8, target, level, internalformat, x, y, width, height, border);
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	if(_post_call_callback != NULL) _post_call_callback("glCopyTexImage2D", (void*)glad_glCopyTexImage2D, 8, target, level, internalformat, x, y, width, height, border);
+}
+PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D = glad_debug_impl_glCopyTexImage2D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCopyTexSubImage1D", (void*)glad_glCopyTexSubImage1D, 6, target, level, xoffset, x, y, width);
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	if(_post_call_callback != NULL) _post_call_callback("glCopyTexSubImage1D", (void*)glad_glCopyTexSubImage1D, 6, target, level, xoffset, x, y, width);
+}
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D = glad_debug_impl_glCopyTexSubImage1D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCopyTexSubImage2D", (void*)glad_glCopyTexSubImage2D, 8, target, level, xoffset, yoffset, x, y, width, height);
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	if(_post_call_callback != NULL) _post_call_callback("glCopyTexSubImage2D", (void*)glad_glCopyTexSubImage2D, 8, target, level, xoffset, yoffset, x, y, width, height);
+}
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D = glad_debug_impl_glCopyTexSubImage2D;
+static void APIENTRY glad_debug_impl_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexSubImage1D", (void*)glad_glTexSubImage1D, 7, target, level, xoffset, width, format, type, pixels);
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glTexSubImage1D", (void*)glad_glTexSubImage1D, 7, target, level, xoffset, width, format, type, pixels);
+}
+PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D = glad_debug_impl_glTexSubImage1D;
+static void APIENTRY glad_debug_impl_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexSubImage2D", (void*)glad_glTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, type, pixels);
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glTexSubImage2D", (void*)glad_glTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D = glad_debug_impl_glTexSubImage2D;
+static void APIENTRY glad_debug_impl_glBindTexture(GLenum target, GLuint texture) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindTexture", (void*)glad_glBindTexture, 2, target, texture);
+	glad_glBindTexture(target, texture);
+	if(_post_call_callback != NULL) _post_call_callback("glBindTexture", (void*)glad_glBindTexture, 2, target, texture);
+}
+PFNGLBINDTEXTUREPROC glad_debug_glBindTexture = glad_debug_impl_glBindTexture;
+static void APIENTRY glad_debug_impl_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteTextures", (void*)glad_glDeleteTextures, 2, n, textures);
+	glad_glDeleteTextures(n, textures);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteTextures", (void*)glad_glDeleteTextures, 2, n, textures);
+}
+PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures = glad_debug_impl_glDeleteTextures;
+static void APIENTRY glad_debug_impl_glGenTextures(GLsizei n, GLuint *textures) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenTextures", (void*)glad_glGenTextures, 2, n, textures);
+	glad_glGenTextures(n, textures);
+	if(_post_call_callback != NULL) _post_call_callback("glGenTextures", (void*)glad_glGenTextures, 2, n, textures);
+}
+PFNGLGENTEXTURESPROC glad_debug_glGenTextures = glad_debug_impl_glGenTextures;
+static GLboolean APIENTRY glad_debug_impl_glIsTexture(GLuint texture) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsTexture", (void*)glad_glIsTexture, 1, texture);
+	GLboolean ret = glad_glIsTexture(texture);
+	if(_post_call_callback != NULL) _post_call_callback("glIsTexture", (void*)glad_glIsTexture, 1, texture);
+	return ret;
+}
+PFNGLISTEXTUREPROC glad_debug_glIsTexture = glad_debug_impl_glIsTexture;
+static void APIENTRY glad_debug_impl_glArrayElement(GLint i) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glArrayElement", (void*)glad_glArrayElement, 1, i);
+	glad_glArrayElement(i);
+	if(_post_call_callback != NULL) _post_call_callback("glArrayElement", (void*)glad_glArrayElement, 1, i);
+}
+PFNGLARRAYELEMENTPROC glad_debug_glArrayElement = glad_debug_impl_glArrayElement;
+static void APIENTRY glad_debug_impl_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorPointer", (void*)glad_glColorPointer, 4, size, type, stride, pointer);
+	glad_glColorPointer(size, type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glColorPointer", (void*)glad_glColorPointer, 4, size, type, stride, pointer);
+}
+PFNGLCOLORPOINTERPROC glad_debug_glColorPointer = glad_debug_impl_glColorPointer;
+static void APIENTRY glad_debug_impl_glDisableClientState(GLenum array) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDisableClientState", (void*)glad_glDisableClientState, 1, array);
+	glad_glDisableClientState(array);
+	if(_post_call_callback != NULL) _post_call_callback("glDisableClientState", (void*)glad_glDisableClientState, 1, array);
+}
+PFNGLDISABLECLIENTSTATEPROC glad_debug_glDisableClientState = glad_debug_impl_glDisableClientState;
+static void APIENTRY glad_debug_impl_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEdgeFlagPointer", (void*)glad_glEdgeFlagPointer, 2, stride, pointer);
+	glad_glEdgeFlagPointer(stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glEdgeFlagPointer", (void*)glad_glEdgeFlagPointer, 2, stride, pointer);
+}
+PFNGLEDGEFLAGPOINTERPROC glad_debug_glEdgeFlagPointer = glad_debug_impl_glEdgeFlagPointer;
+static void APIENTRY glad_debug_impl_glEnableClientState(GLenum array) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEnableClientState", (void*)glad_glEnableClientState, 1, array);
+	glad_glEnableClientState(array);
+	if(_post_call_callback != NULL) _post_call_callback("glEnableClientState", (void*)glad_glEnableClientState, 1, array);
+}
+PFNGLENABLECLIENTSTATEPROC glad_debug_glEnableClientState = glad_debug_impl_glEnableClientState;
+static void APIENTRY glad_debug_impl_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexPointer", (void*)glad_glIndexPointer, 3, type, stride, pointer);
+	glad_glIndexPointer(type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexPointer", (void*)glad_glIndexPointer, 3, type, stride, pointer);
+}
+PFNGLINDEXPOINTERPROC glad_debug_glIndexPointer = glad_debug_impl_glIndexPointer;
+static void APIENTRY glad_debug_impl_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glInterleavedArrays", (void*)glad_glInterleavedArrays, 3, format, stride, pointer);
+	glad_glInterleavedArrays(format, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glInterleavedArrays", (void*)glad_glInterleavedArrays, 3, format, stride, pointer);
+}
+PFNGLINTERLEAVEDARRAYSPROC glad_debug_glInterleavedArrays = glad_debug_impl_glInterleavedArrays;
+static void APIENTRY glad_debug_impl_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormalPointer", (void*)glad_glNormalPointer, 3, type, stride, pointer);
+	glad_glNormalPointer(type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glNormalPointer", (void*)glad_glNormalPointer, 3, type, stride, pointer);
+}
+PFNGLNORMALPOINTERPROC glad_debug_glNormalPointer = glad_debug_impl_glNormalPointer;
+static void APIENTRY glad_debug_impl_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordPointer", (void*)glad_glTexCoordPointer, 4, size, type, stride, pointer);
+	glad_glTexCoordPointer(size, type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordPointer", (void*)glad_glTexCoordPointer, 4, size, type, stride, pointer);
+}
+PFNGLTEXCOORDPOINTERPROC glad_debug_glTexCoordPointer = glad_debug_impl_glTexCoordPointer;
+static void APIENTRY glad_debug_impl_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexPointer", (void*)glad_glVertexPointer, 4, size, type, stride, pointer);
+	glad_glVertexPointer(size, type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexPointer", (void*)glad_glVertexPointer, 4, size, type, stride, pointer);
+}
+PFNGLVERTEXPOINTERPROC glad_debug_glVertexPointer = glad_debug_impl_glVertexPointer;
+static GLboolean APIENTRY glad_debug_impl_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glAreTexturesResident", (void*)glad_glAreTexturesResident, 3, n, textures, residences);
+	GLboolean ret = glad_glAreTexturesResident(n, textures, residences);
+	if(_post_call_callback != NULL) _post_call_callback("glAreTexturesResident", (void*)glad_glAreTexturesResident, 3, n, textures, residences);
+	return ret;
+}
+PFNGLARETEXTURESRESIDENTPROC glad_debug_glAreTexturesResident = glad_debug_impl_glAreTexturesResident;
+static void APIENTRY glad_debug_impl_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPrioritizeTextures", (void*)glad_glPrioritizeTextures, 3, n, textures, priorities);
+	glad_glPrioritizeTextures(n, textures, priorities);
+	if(_post_call_callback != NULL) _post_call_callback("glPrioritizeTextures", (void*)glad_glPrioritizeTextures, 3, n, textures, priorities);
+}
+PFNGLPRIORITIZETEXTURESPROC glad_debug_glPrioritizeTextures = glad_debug_impl_glPrioritizeTextures;
+static void APIENTRY glad_debug_impl_glIndexub(GLubyte c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexub", (void*)glad_glIndexub, 1, c);
+	glad_glIndexub(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexub", (void*)glad_glIndexub, 1, c);
+}
+PFNGLINDEXUBPROC glad_debug_glIndexub = glad_debug_impl_glIndexub;
+static void APIENTRY glad_debug_impl_glIndexubv(const GLubyte *c) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIndexubv", (void*)glad_glIndexubv, 1, c);
+	glad_glIndexubv(c);
+	if(_post_call_callback != NULL) _post_call_callback("glIndexubv", (void*)glad_glIndexubv, 1, c);
+}
+PFNGLINDEXUBVPROC glad_debug_glIndexubv = glad_debug_impl_glIndexubv;
+static void APIENTRY glad_debug_impl_glPopClientAttrib(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPopClientAttrib", (void*)glad_glPopClientAttrib, 0);
+	glad_glPopClientAttrib();
+	if(_post_call_callback != NULL) _post_call_callback("glPopClientAttrib", (void*)glad_glPopClientAttrib, 0);
+}
+PFNGLPOPCLIENTATTRIBPROC glad_debug_glPopClientAttrib = glad_debug_impl_glPopClientAttrib;
+static void APIENTRY glad_debug_impl_glPushClientAttrib(GLbitfield mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPushClientAttrib", (void*)glad_glPushClientAttrib, 1, mask);
+	glad_glPushClientAttrib(mask);
+	if(_post_call_callback != NULL) _post_call_callback("glPushClientAttrib", (void*)glad_glPushClientAttrib, 1, mask);
+}
+PFNGLPUSHCLIENTATTRIBPROC glad_debug_glPushClientAttrib = glad_debug_impl_glPushClientAttrib;
+static void APIENTRY glad_debug_impl_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawRangeElements", (void*)glad_glDrawRangeElements, 6, mode, start, end, count, type, indices);
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawRangeElements", (void*)glad_glDrawRangeElements, 6, mode, start, end, count, type, indices);
+}
+PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements = glad_debug_impl_glDrawRangeElements;
+static void APIENTRY glad_debug_impl_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexImage3D", (void*)glad_glTexImage3D, 10, target, level, internalformat, width, height, depth, border, format, type, pixels);
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glTexImage3D", (void*)glad_glTexImage3D, 10, target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D = glad_debug_impl_glTexImage3D;
+static void APIENTRY glad_debug_impl_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexSubImage3D", (void*)glad_glTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if(_post_call_callback != NULL) _post_call_callback("glTexSubImage3D", (void*)glad_glTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D = glad_debug_impl_glTexSubImage3D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCopyTexSubImage3D", (void*)glad_glCopyTexSubImage3D, 9, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if(_post_call_callback != NULL) _post_call_callback("glCopyTexSubImage3D", (void*)glad_glCopyTexSubImage3D, 9, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D = glad_debug_impl_glCopyTexSubImage3D;
+static void APIENTRY glad_debug_impl_glActiveTexture(GLenum texture) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glActiveTexture", (void*)glad_glActiveTexture, 1, texture);
+	glad_glActiveTexture(texture);
+	if(_post_call_callback != NULL) _post_call_callback("glActiveTexture", (void*)glad_glActiveTexture, 1, texture);
+}
+PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture = glad_debug_impl_glActiveTexture;
+static void APIENTRY glad_debug_impl_glSampleCoverage(GLfloat value, GLboolean invert) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSampleCoverage", (void*)glad_glSampleCoverage, 2, value, invert);
+	glad_glSampleCoverage(value, invert);
+	if(_post_call_callback != NULL) _post_call_callback("glSampleCoverage", (void*)glad_glSampleCoverage, 2, value, invert);
+}
+PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage = glad_debug_impl_glSampleCoverage;
+static void APIENTRY glad_debug_impl_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCompressedTexImage3D", (void*)glad_glCompressedTexImage3D, 9, target, level, internalformat, width, height, depth, border, imageSize, data);
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	if(_post_call_callback != NULL) _post_call_callback("glCompressedTexImage3D", (void*)glad_glCompressedTexImage3D, 9, target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D = glad_debug_impl_glCompressedTexImage3D;
+static void APIENTRY glad_debug_impl_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCompressedTexImage2D", (void*)glad_glCompressedTexImage2D, 8, target, level, internalformat, width, height, border, imageSize, data);
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	if(_post_call_callback != NULL) _post_call_callback("glCompressedTexImage2D", (void*)glad_glCompressedTexImage2D, 8, target, level, internalformat, width, height, border, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D = glad_debug_impl_glCompressedTexImage2D;
+static void APIENTRY glad_debug_impl_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCompressedTexImage1D", (void*)glad_glCompressedTexImage1D, 7, target, level, internalformat, width, border, imageSize, data);
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	if(_post_call_callback != NULL) _post_call_callback("glCompressedTexImage1D", (void*)glad_glCompressedTexImage1D, 7, target, level, internalformat, width, border, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D = glad_debug_impl_glCompressedTexImage1D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCompressedTexSubImage3D", (void*)glad_glCompressedTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	if(_post_call_callback != NULL) _post_call_callback("glCompressedTexSubImage3D", (void*)glad_glCompressedTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D = glad_debug_impl_glCompressedTexSubImage3D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCompressedTexSubImage2D", (void*)glad_glCompressedTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	if(_post_call_callback != NULL) _post_call_callback("glCompressedTexSubImage2D", (void*)glad_glCompressedTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D = glad_debug_impl_glCompressedTexSubImage2D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCompressedTexSubImage1D", (void*)glad_glCompressedTexSubImage1D, 7, target, level, xoffset, width, format, imageSize, data);
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	if(_post_call_callback != NULL) _post_call_callback("glCompressedTexSubImage1D", (void*)glad_glCompressedTexSubImage1D, 7, target, level, xoffset, width, format, imageSize, data);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D = glad_debug_impl_glCompressedTexSubImage1D;
+static void APIENTRY glad_debug_impl_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetCompressedTexImage", (void*)glad_glGetCompressedTexImage, 3, target, level, img);
+	glad_glGetCompressedTexImage(target, level, img);
+	if(_post_call_callback != NULL) _post_call_callback("glGetCompressedTexImage", (void*)glad_glGetCompressedTexImage, 3, target, level, img);
+}
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage = glad_debug_impl_glGetCompressedTexImage;
+static void APIENTRY glad_debug_impl_glClientActiveTexture(GLenum texture) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClientActiveTexture", (void*)glad_glClientActiveTexture, 1, texture);
+	glad_glClientActiveTexture(texture);
+	if(_post_call_callback != NULL) _post_call_callback("glClientActiveTexture", (void*)glad_glClientActiveTexture, 1, texture);
+}
+PFNGLCLIENTACTIVETEXTUREPROC glad_debug_glClientActiveTexture = glad_debug_impl_glClientActiveTexture;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1d", (void*)glad_glMultiTexCoord1d, 2, target, s);
+	glad_glMultiTexCoord1d(target, s);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1d", (void*)glad_glMultiTexCoord1d, 2, target, s);
+}
+PFNGLMULTITEXCOORD1DPROC glad_debug_glMultiTexCoord1d = glad_debug_impl_glMultiTexCoord1d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1dv", (void*)glad_glMultiTexCoord1dv, 2, target, v);
+	glad_glMultiTexCoord1dv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1dv", (void*)glad_glMultiTexCoord1dv, 2, target, v);
+}
+PFNGLMULTITEXCOORD1DVPROC glad_debug_glMultiTexCoord1dv = glad_debug_impl_glMultiTexCoord1dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1f", (void*)glad_glMultiTexCoord1f, 2, target, s);
+	glad_glMultiTexCoord1f(target, s);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1f", (void*)glad_glMultiTexCoord1f, 2, target, s);
+}
+PFNGLMULTITEXCOORD1FPROC glad_debug_glMultiTexCoord1f = glad_debug_impl_glMultiTexCoord1f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1fv", (void*)glad_glMultiTexCoord1fv, 2, target, v);
+	glad_glMultiTexCoord1fv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1fv", (void*)glad_glMultiTexCoord1fv, 2, target, v);
+}
+PFNGLMULTITEXCOORD1FVPROC glad_debug_glMultiTexCoord1fv = glad_debug_impl_glMultiTexCoord1fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1i(GLenum target, GLint s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1i", (void*)glad_glMultiTexCoord1i, 2, target, s);
+	glad_glMultiTexCoord1i(target, s);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1i", (void*)glad_glMultiTexCoord1i, 2, target, s);
+}
+PFNGLMULTITEXCOORD1IPROC glad_debug_glMultiTexCoord1i = glad_debug_impl_glMultiTexCoord1i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1iv", (void*)glad_glMultiTexCoord1iv, 2, target, v);
+	glad_glMultiTexCoord1iv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1iv", (void*)glad_glMultiTexCoord1iv, 2, target, v);
+}
+PFNGLMULTITEXCOORD1IVPROC glad_debug_glMultiTexCoord1iv = glad_debug_impl_glMultiTexCoord1iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1s(GLenum target, GLshort s) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1s", (void*)glad_glMultiTexCoord1s, 2, target, s);
+	glad_glMultiTexCoord1s(target, s);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1s", (void*)glad_glMultiTexCoord1s, 2, target, s);
+}
+PFNGLMULTITEXCOORD1SPROC glad_debug_glMultiTexCoord1s = glad_debug_impl_glMultiTexCoord1s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord1sv", (void*)glad_glMultiTexCoord1sv, 2, target, v);
+	glad_glMultiTexCoord1sv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord1sv", (void*)glad_glMultiTexCoord1sv, 2, target, v);
+}
+PFNGLMULTITEXCOORD1SVPROC glad_debug_glMultiTexCoord1sv = glad_debug_impl_glMultiTexCoord1sv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2d", (void*)glad_glMultiTexCoord2d, 3, target, s, t);
+	glad_glMultiTexCoord2d(target, s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2d", (void*)glad_glMultiTexCoord2d, 3, target, s, t);
+}
+PFNGLMULTITEXCOORD2DPROC glad_debug_glMultiTexCoord2d = glad_debug_impl_glMultiTexCoord2d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2dv", (void*)glad_glMultiTexCoord2dv, 2, target, v);
+	glad_glMultiTexCoord2dv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2dv", (void*)glad_glMultiTexCoord2dv, 2, target, v);
+}
+PFNGLMULTITEXCOORD2DVPROC glad_debug_glMultiTexCoord2dv = glad_debug_impl_glMultiTexCoord2dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2f", (void*)glad_glMultiTexCoord2f, 3, target, s, t);
+	glad_glMultiTexCoord2f(target, s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2f", (void*)glad_glMultiTexCoord2f, 3, target, s, t);
+}
+PFNGLMULTITEXCOORD2FPROC glad_debug_glMultiTexCoord2f = glad_debug_impl_glMultiTexCoord2f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2fv", (void*)glad_glMultiTexCoord2fv, 2, target, v);
+	glad_glMultiTexCoord2fv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2fv", (void*)glad_glMultiTexCoord2fv, 2, target, v);
+}
+PFNGLMULTITEXCOORD2FVPROC glad_debug_glMultiTexCoord2fv = glad_debug_impl_glMultiTexCoord2fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2i", (void*)glad_glMultiTexCoord2i, 3, target, s, t);
+	glad_glMultiTexCoord2i(target, s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2i", (void*)glad_glMultiTexCoord2i, 3, target, s, t);
+}
+PFNGLMULTITEXCOORD2IPROC glad_debug_glMultiTexCoord2i = glad_debug_impl_glMultiTexCoord2i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2iv", (void*)glad_glMultiTexCoord2iv, 2, target, v);
+	glad_glMultiTexCoord2iv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2iv", (void*)glad_glMultiTexCoord2iv, 2, target, v);
+}
+PFNGLMULTITEXCOORD2IVPROC glad_debug_glMultiTexCoord2iv = glad_debug_impl_glMultiTexCoord2iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2s", (void*)glad_glMultiTexCoord2s, 3, target, s, t);
+	glad_glMultiTexCoord2s(target, s, t);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2s", (void*)glad_glMultiTexCoord2s, 3, target, s, t);
+}
+PFNGLMULTITEXCOORD2SPROC glad_debug_glMultiTexCoord2s = glad_debug_impl_glMultiTexCoord2s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord2sv", (void*)glad_glMultiTexCoord2sv, 2, target, v);
+	glad_glMultiTexCoord2sv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord2sv", (void*)glad_glMultiTexCoord2sv, 2, target, v);
+}
+PFNGLMULTITEXCOORD2SVPROC glad_debug_glMultiTexCoord2sv = glad_debug_impl_glMultiTexCoord2sv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3d", (void*)glad_glMultiTexCoord3d, 4, target, s, t, r);
+	glad_glMultiTexCoord3d(target, s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3d", (void*)glad_glMultiTexCoord3d, 4, target, s, t, r);
+}
+PFNGLMULTITEXCOORD3DPROC glad_debug_glMultiTexCoord3d = glad_debug_impl_glMultiTexCoord3d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3dv", (void*)glad_glMultiTexCoord3dv, 2, target, v);
+	glad_glMultiTexCoord3dv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3dv", (void*)glad_glMultiTexCoord3dv, 2, target, v);
+}
+PFNGLMULTITEXCOORD3DVPROC glad_debug_glMultiTexCoord3dv = glad_debug_impl_glMultiTexCoord3dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3f", (void*)glad_glMultiTexCoord3f, 4, target, s, t, r);
+	glad_glMultiTexCoord3f(target, s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3f", (void*)glad_glMultiTexCoord3f, 4, target, s, t, r);
+}
+PFNGLMULTITEXCOORD3FPROC glad_debug_glMultiTexCoord3f = glad_debug_impl_glMultiTexCoord3f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3fv", (void*)glad_glMultiTexCoord3fv, 2, target, v);
+	glad_glMultiTexCoord3fv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3fv", (void*)glad_glMultiTexCoord3fv, 2, target, v);
+}
+PFNGLMULTITEXCOORD3FVPROC glad_debug_glMultiTexCoord3fv = glad_debug_impl_glMultiTexCoord3fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3i", (void*)glad_glMultiTexCoord3i, 4, target, s, t, r);
+	glad_glMultiTexCoord3i(target, s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3i", (void*)glad_glMultiTexCoord3i, 4, target, s, t, r);
+}
+PFNGLMULTITEXCOORD3IPROC glad_debug_glMultiTexCoord3i = glad_debug_impl_glMultiTexCoord3i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3iv", (void*)glad_glMultiTexCoord3iv, 2, target, v);
+	glad_glMultiTexCoord3iv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3iv", (void*)glad_glMultiTexCoord3iv, 2, target, v);
+}
+PFNGLMULTITEXCOORD3IVPROC glad_debug_glMultiTexCoord3iv = glad_debug_impl_glMultiTexCoord3iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3s", (void*)glad_glMultiTexCoord3s, 4, target, s, t, r);
+	glad_glMultiTexCoord3s(target, s, t, r);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3s", (void*)glad_glMultiTexCoord3s, 4, target, s, t, r);
+}
+PFNGLMULTITEXCOORD3SPROC glad_debug_glMultiTexCoord3s = glad_debug_impl_glMultiTexCoord3s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord3sv", (void*)glad_glMultiTexCoord3sv, 2, target, v);
+	glad_glMultiTexCoord3sv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord3sv", (void*)glad_glMultiTexCoord3sv, 2, target, v);
+}
+PFNGLMULTITEXCOORD3SVPROC glad_debug_glMultiTexCoord3sv = glad_debug_impl_glMultiTexCoord3sv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4d", (void*)glad_glMultiTexCoord4d, 5, target, s, t, r, q);
+	glad_glMultiTexCoord4d(target, s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4d", (void*)glad_glMultiTexCoord4d, 5, target, s, t, r, q);
+}
+PFNGLMULTITEXCOORD4DPROC glad_debug_glMultiTexCoord4d = glad_debug_impl_glMultiTexCoord4d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4dv", (void*)glad_glMultiTexCoord4dv, 2, target, v);
+	glad_glMultiTexCoord4dv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4dv", (void*)glad_glMultiTexCoord4dv, 2, target, v);
+}
+PFNGLMULTITEXCOORD4DVPROC glad_debug_glMultiTexCoord4dv = glad_debug_impl_glMultiTexCoord4dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4f", (void*)glad_glMultiTexCoord4f, 5, target, s, t, r, q);
+	glad_glMultiTexCoord4f(target, s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4f", (void*)glad_glMultiTexCoord4f, 5, target, s, t, r, q);
+}
+PFNGLMULTITEXCOORD4FPROC glad_debug_glMultiTexCoord4f = glad_debug_impl_glMultiTexCoord4f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4fv", (void*)glad_glMultiTexCoord4fv, 2, target, v);
+	glad_glMultiTexCoord4fv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4fv", (void*)glad_glMultiTexCoord4fv, 2, target, v);
+}
+PFNGLMULTITEXCOORD4FVPROC glad_debug_glMultiTexCoord4fv = glad_debug_impl_glMultiTexCoord4fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4i", (void*)glad_glMultiTexCoord4i, 5, target, s, t, r, q);
+	glad_glMultiTexCoord4i(target, s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4i", (void*)glad_glMultiTexCoord4i, 5, target, s, t, r, q);
+}
+PFNGLMULTITEXCOORD4IPROC glad_debug_glMultiTexCoord4i = glad_debug_impl_glMultiTexCoord4i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4iv", (void*)glad_glMultiTexCoord4iv, 2, target, v);
+	glad_glMultiTexCoord4iv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4iv", (void*)glad_glMultiTexCoord4iv, 2, target, v);
+}
+PFNGLMULTITEXCOORD4IVPROC glad_debug_glMultiTexCoord4iv = glad_debug_impl_glMultiTexCoord4iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4s", (void*)glad_glMultiTexCoord4s, 5, target, s, t, r, q);
+	glad_glMultiTexCoord4s(target, s, t, r, q);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4s", (void*)glad_glMultiTexCoord4s, 5, target, s, t, r, q);
+}
+PFNGLMULTITEXCOORD4SPROC glad_debug_glMultiTexCoord4s = glad_debug_impl_glMultiTexCoord4s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoord4sv", (void*)glad_glMultiTexCoord4sv, 2, target, v);
+	glad_glMultiTexCoord4sv(target, v);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoord4sv", (void*)glad_glMultiTexCoord4sv, 2, target, v);
+}
+PFNGLMULTITEXCOORD4SVPROC glad_debug_glMultiTexCoord4sv = glad_debug_impl_glMultiTexCoord4sv;
+static void APIENTRY glad_debug_impl_glLoadTransposeMatrixf(const GLfloat *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLoadTransposeMatrixf", (void*)glad_glLoadTransposeMatrixf, 1, m);
+	glad_glLoadTransposeMatrixf(m);
+	if(_post_call_callback != NULL) _post_call_callback("glLoadTransposeMatrixf", (void*)glad_glLoadTransposeMatrixf, 1, m);
+}
+PFNGLLOADTRANSPOSEMATRIXFPROC glad_debug_glLoadTransposeMatrixf = glad_debug_impl_glLoadTransposeMatrixf;
+static void APIENTRY glad_debug_impl_glLoadTransposeMatrixd(const GLdouble *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLoadTransposeMatrixd", (void*)glad_glLoadTransposeMatrixd, 1, m);
+	glad_glLoadTransposeMatrixd(m);
+	if(_post_call_callback != NULL) _post_call_callback("glLoadTransposeMatrixd", (void*)glad_glLoadTransposeMatrixd, 1, m);
+}
+PFNGLLOADTRANSPOSEMATRIXDPROC glad_debug_glLoadTransposeMatrixd = glad_debug_impl_glLoadTransposeMatrixd;
+static void APIENTRY glad_debug_impl_glMultTransposeMatrixf(const GLfloat *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultTransposeMatrixf", (void*)glad_glMultTransposeMatrixf, 1, m);
+	glad_glMultTransposeMatrixf(m);
+	if(_post_call_callback != NULL) _post_call_callback("glMultTransposeMatrixf", (void*)glad_glMultTransposeMatrixf, 1, m);
+}
+PFNGLMULTTRANSPOSEMATRIXFPROC glad_debug_glMultTransposeMatrixf = glad_debug_impl_glMultTransposeMatrixf;
+static void APIENTRY glad_debug_impl_glMultTransposeMatrixd(const GLdouble *m) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultTransposeMatrixd", (void*)glad_glMultTransposeMatrixd, 1, m);
+	glad_glMultTransposeMatrixd(m);
+	if(_post_call_callback != NULL) _post_call_callback("glMultTransposeMatrixd", (void*)glad_glMultTransposeMatrixd, 1, m);
+}
+PFNGLMULTTRANSPOSEMATRIXDPROC glad_debug_glMultTransposeMatrixd = glad_debug_impl_glMultTransposeMatrixd;
+static void APIENTRY glad_debug_impl_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBlendFuncSeparate", (void*)glad_glBlendFuncSeparate, 4, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	if(_post_call_callback != NULL) _post_call_callback("glBlendFuncSeparate", (void*)glad_glBlendFuncSeparate, 4, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate = glad_debug_impl_glBlendFuncSeparate;
+static void APIENTRY glad_debug_impl_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiDrawArrays", (void*)glad_glMultiDrawArrays, 4, mode, first, count, drawcount);
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiDrawArrays", (void*)glad_glMultiDrawArrays, 4, mode, first, count, drawcount);
+}
+PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays = glad_debug_impl_glMultiDrawArrays;
+static void APIENTRY glad_debug_impl_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiDrawElements", (void*)glad_glMultiDrawElements, 5, mode, count, type, indices, drawcount);
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiDrawElements", (void*)glad_glMultiDrawElements, 5, mode, count, type, indices, drawcount);
+}
+PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements = glad_debug_impl_glMultiDrawElements;
+static void APIENTRY glad_debug_impl_glPointParameterf(GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPointParameterf", (void*)glad_glPointParameterf, 2, pname, param);
+	glad_glPointParameterf(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glPointParameterf", (void*)glad_glPointParameterf, 2, pname, param);
+}
+PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf = glad_debug_impl_glPointParameterf;
+static void APIENTRY glad_debug_impl_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPointParameterfv", (void*)glad_glPointParameterfv, 2, pname, params);
+	glad_glPointParameterfv(pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glPointParameterfv", (void*)glad_glPointParameterfv, 2, pname, params);
+}
+PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv = glad_debug_impl_glPointParameterfv;
+static void APIENTRY glad_debug_impl_glPointParameteri(GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPointParameteri", (void*)glad_glPointParameteri, 2, pname, param);
+	glad_glPointParameteri(pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glPointParameteri", (void*)glad_glPointParameteri, 2, pname, param);
+}
+PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri = glad_debug_impl_glPointParameteri;
+static void APIENTRY glad_debug_impl_glPointParameteriv(GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPointParameteriv", (void*)glad_glPointParameteriv, 2, pname, params);
+	glad_glPointParameteriv(pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glPointParameteriv", (void*)glad_glPointParameteriv, 2, pname, params);
+}
+PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv = glad_debug_impl_glPointParameteriv;
+static void APIENTRY glad_debug_impl_glFogCoordf(GLfloat coord) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogCoordf", (void*)glad_glFogCoordf, 1, coord);
+	glad_glFogCoordf(coord);
+	if(_post_call_callback != NULL) _post_call_callback("glFogCoordf", (void*)glad_glFogCoordf, 1, coord);
+}
+PFNGLFOGCOORDFPROC glad_debug_glFogCoordf = glad_debug_impl_glFogCoordf;
+static void APIENTRY glad_debug_impl_glFogCoordfv(const GLfloat *coord) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogCoordfv", (void*)glad_glFogCoordfv, 1, coord);
+	glad_glFogCoordfv(coord);
+	if(_post_call_callback != NULL) _post_call_callback("glFogCoordfv", (void*)glad_glFogCoordfv, 1, coord);
+}
+PFNGLFOGCOORDFVPROC glad_debug_glFogCoordfv = glad_debug_impl_glFogCoordfv;
+static void APIENTRY glad_debug_impl_glFogCoordd(GLdouble coord) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogCoordd", (void*)glad_glFogCoordd, 1, coord);
+	glad_glFogCoordd(coord);
+	if(_post_call_callback != NULL) _post_call_callback("glFogCoordd", (void*)glad_glFogCoordd, 1, coord);
+}
+PFNGLFOGCOORDDPROC glad_debug_glFogCoordd = glad_debug_impl_glFogCoordd;
+static void APIENTRY glad_debug_impl_glFogCoorddv(const GLdouble *coord) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogCoorddv", (void*)glad_glFogCoorddv, 1, coord);
+	glad_glFogCoorddv(coord);
+	if(_post_call_callback != NULL) _post_call_callback("glFogCoorddv", (void*)glad_glFogCoorddv, 1, coord);
+}
+PFNGLFOGCOORDDVPROC glad_debug_glFogCoorddv = glad_debug_impl_glFogCoorddv;
+static void APIENTRY glad_debug_impl_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFogCoordPointer", (void*)glad_glFogCoordPointer, 3, type, stride, pointer);
+	glad_glFogCoordPointer(type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glFogCoordPointer", (void*)glad_glFogCoordPointer, 3, type, stride, pointer);
+}
+PFNGLFOGCOORDPOINTERPROC glad_debug_glFogCoordPointer = glad_debug_impl_glFogCoordPointer;
+static void APIENTRY glad_debug_impl_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3b", (void*)glad_glSecondaryColor3b, 3, red, green, blue);
+	glad_glSecondaryColor3b(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3b", (void*)glad_glSecondaryColor3b, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3BPROC glad_debug_glSecondaryColor3b = glad_debug_impl_glSecondaryColor3b;
+static void APIENTRY glad_debug_impl_glSecondaryColor3bv(const GLbyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3bv", (void*)glad_glSecondaryColor3bv, 1, v);
+	glad_glSecondaryColor3bv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3bv", (void*)glad_glSecondaryColor3bv, 1, v);
+}
+PFNGLSECONDARYCOLOR3BVPROC glad_debug_glSecondaryColor3bv = glad_debug_impl_glSecondaryColor3bv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3d", (void*)glad_glSecondaryColor3d, 3, red, green, blue);
+	glad_glSecondaryColor3d(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3d", (void*)glad_glSecondaryColor3d, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3DPROC glad_debug_glSecondaryColor3d = glad_debug_impl_glSecondaryColor3d;
+static void APIENTRY glad_debug_impl_glSecondaryColor3dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3dv", (void*)glad_glSecondaryColor3dv, 1, v);
+	glad_glSecondaryColor3dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3dv", (void*)glad_glSecondaryColor3dv, 1, v);
+}
+PFNGLSECONDARYCOLOR3DVPROC glad_debug_glSecondaryColor3dv = glad_debug_impl_glSecondaryColor3dv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3f", (void*)glad_glSecondaryColor3f, 3, red, green, blue);
+	glad_glSecondaryColor3f(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3f", (void*)glad_glSecondaryColor3f, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3FPROC glad_debug_glSecondaryColor3f = glad_debug_impl_glSecondaryColor3f;
+static void APIENTRY glad_debug_impl_glSecondaryColor3fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3fv", (void*)glad_glSecondaryColor3fv, 1, v);
+	glad_glSecondaryColor3fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3fv", (void*)glad_glSecondaryColor3fv, 1, v);
+}
+PFNGLSECONDARYCOLOR3FVPROC glad_debug_glSecondaryColor3fv = glad_debug_impl_glSecondaryColor3fv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3i", (void*)glad_glSecondaryColor3i, 3, red, green, blue);
+	glad_glSecondaryColor3i(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3i", (void*)glad_glSecondaryColor3i, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3IPROC glad_debug_glSecondaryColor3i = glad_debug_impl_glSecondaryColor3i;
+static void APIENTRY glad_debug_impl_glSecondaryColor3iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3iv", (void*)glad_glSecondaryColor3iv, 1, v);
+	glad_glSecondaryColor3iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3iv", (void*)glad_glSecondaryColor3iv, 1, v);
+}
+PFNGLSECONDARYCOLOR3IVPROC glad_debug_glSecondaryColor3iv = glad_debug_impl_glSecondaryColor3iv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3s", (void*)glad_glSecondaryColor3s, 3, red, green, blue);
+	glad_glSecondaryColor3s(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3s", (void*)glad_glSecondaryColor3s, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3SPROC glad_debug_glSecondaryColor3s = glad_debug_impl_glSecondaryColor3s;
+static void APIENTRY glad_debug_impl_glSecondaryColor3sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3sv", (void*)glad_glSecondaryColor3sv, 1, v);
+	glad_glSecondaryColor3sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3sv", (void*)glad_glSecondaryColor3sv, 1, v);
+}
+PFNGLSECONDARYCOLOR3SVPROC glad_debug_glSecondaryColor3sv = glad_debug_impl_glSecondaryColor3sv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3ub", (void*)glad_glSecondaryColor3ub, 3, red, green, blue);
+	glad_glSecondaryColor3ub(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3ub", (void*)glad_glSecondaryColor3ub, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3UBPROC glad_debug_glSecondaryColor3ub = glad_debug_impl_glSecondaryColor3ub;
+static void APIENTRY glad_debug_impl_glSecondaryColor3ubv(const GLubyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3ubv", (void*)glad_glSecondaryColor3ubv, 1, v);
+	glad_glSecondaryColor3ubv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3ubv", (void*)glad_glSecondaryColor3ubv, 1, v);
+}
+PFNGLSECONDARYCOLOR3UBVPROC glad_debug_glSecondaryColor3ubv = glad_debug_impl_glSecondaryColor3ubv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3ui", (void*)glad_glSecondaryColor3ui, 3, red, green, blue);
+	glad_glSecondaryColor3ui(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3ui", (void*)glad_glSecondaryColor3ui, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3UIPROC glad_debug_glSecondaryColor3ui = glad_debug_impl_glSecondaryColor3ui;
+static void APIENTRY glad_debug_impl_glSecondaryColor3uiv(const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3uiv", (void*)glad_glSecondaryColor3uiv, 1, v);
+	glad_glSecondaryColor3uiv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3uiv", (void*)glad_glSecondaryColor3uiv, 1, v);
+}
+PFNGLSECONDARYCOLOR3UIVPROC glad_debug_glSecondaryColor3uiv = glad_debug_impl_glSecondaryColor3uiv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3us", (void*)glad_glSecondaryColor3us, 3, red, green, blue);
+	glad_glSecondaryColor3us(red, green, blue);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3us", (void*)glad_glSecondaryColor3us, 3, red, green, blue);
+}
+PFNGLSECONDARYCOLOR3USPROC glad_debug_glSecondaryColor3us = glad_debug_impl_glSecondaryColor3us;
+static void APIENTRY glad_debug_impl_glSecondaryColor3usv(const GLushort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColor3usv", (void*)glad_glSecondaryColor3usv, 1, v);
+	glad_glSecondaryColor3usv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColor3usv", (void*)glad_glSecondaryColor3usv, 1, v);
+}
+PFNGLSECONDARYCOLOR3USVPROC glad_debug_glSecondaryColor3usv = glad_debug_impl_glSecondaryColor3usv;
+static void APIENTRY glad_debug_impl_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColorPointer", (void*)glad_glSecondaryColorPointer, 4, size, type, stride, pointer);
+	glad_glSecondaryColorPointer(size, type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColorPointer", (void*)glad_glSecondaryColorPointer, 4, size, type, stride, pointer);
+}
+PFNGLSECONDARYCOLORPOINTERPROC glad_debug_glSecondaryColorPointer = glad_debug_impl_glSecondaryColorPointer;
+static void APIENTRY glad_debug_impl_glWindowPos2d(GLdouble x, GLdouble y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2d", (void*)glad_glWindowPos2d, 2, x, y);
+	glad_glWindowPos2d(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2d", (void*)glad_glWindowPos2d, 2, x, y);
+}
+PFNGLWINDOWPOS2DPROC glad_debug_glWindowPos2d = glad_debug_impl_glWindowPos2d;
+static void APIENTRY glad_debug_impl_glWindowPos2dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2dv", (void*)glad_glWindowPos2dv, 1, v);
+	glad_glWindowPos2dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2dv", (void*)glad_glWindowPos2dv, 1, v);
+}
+PFNGLWINDOWPOS2DVPROC glad_debug_glWindowPos2dv = glad_debug_impl_glWindowPos2dv;
+static void APIENTRY glad_debug_impl_glWindowPos2f(GLfloat x, GLfloat y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2f", (void*)glad_glWindowPos2f, 2, x, y);
+	glad_glWindowPos2f(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2f", (void*)glad_glWindowPos2f, 2, x, y);
+}
+PFNGLWINDOWPOS2FPROC glad_debug_glWindowPos2f = glad_debug_impl_glWindowPos2f;
+static void APIENTRY glad_debug_impl_glWindowPos2fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2fv", (void*)glad_glWindowPos2fv, 1, v);
+	glad_glWindowPos2fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2fv", (void*)glad_glWindowPos2fv, 1, v);
+}
+PFNGLWINDOWPOS2FVPROC glad_debug_glWindowPos2fv = glad_debug_impl_glWindowPos2fv;
+static void APIENTRY glad_debug_impl_glWindowPos2i(GLint x, GLint y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2i", (void*)glad_glWindowPos2i, 2, x, y);
+	glad_glWindowPos2i(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2i", (void*)glad_glWindowPos2i, 2, x, y);
+}
+PFNGLWINDOWPOS2IPROC glad_debug_glWindowPos2i = glad_debug_impl_glWindowPos2i;
+static void APIENTRY glad_debug_impl_glWindowPos2iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2iv", (void*)glad_glWindowPos2iv, 1, v);
+	glad_glWindowPos2iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2iv", (void*)glad_glWindowPos2iv, 1, v);
+}
+PFNGLWINDOWPOS2IVPROC glad_debug_glWindowPos2iv = glad_debug_impl_glWindowPos2iv;
+static void APIENTRY glad_debug_impl_glWindowPos2s(GLshort x, GLshort y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2s", (void*)glad_glWindowPos2s, 2, x, y);
+	glad_glWindowPos2s(x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2s", (void*)glad_glWindowPos2s, 2, x, y);
+}
+PFNGLWINDOWPOS2SPROC glad_debug_glWindowPos2s = glad_debug_impl_glWindowPos2s;
+static void APIENTRY glad_debug_impl_glWindowPos2sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos2sv", (void*)glad_glWindowPos2sv, 1, v);
+	glad_glWindowPos2sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos2sv", (void*)glad_glWindowPos2sv, 1, v);
+}
+PFNGLWINDOWPOS2SVPROC glad_debug_glWindowPos2sv = glad_debug_impl_glWindowPos2sv;
+static void APIENTRY glad_debug_impl_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3d", (void*)glad_glWindowPos3d, 3, x, y, z);
+	glad_glWindowPos3d(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3d", (void*)glad_glWindowPos3d, 3, x, y, z);
+}
+PFNGLWINDOWPOS3DPROC glad_debug_glWindowPos3d = glad_debug_impl_glWindowPos3d;
+static void APIENTRY glad_debug_impl_glWindowPos3dv(const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3dv", (void*)glad_glWindowPos3dv, 1, v);
+	glad_glWindowPos3dv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3dv", (void*)glad_glWindowPos3dv, 1, v);
+}
+PFNGLWINDOWPOS3DVPROC glad_debug_glWindowPos3dv = glad_debug_impl_glWindowPos3dv;
+static void APIENTRY glad_debug_impl_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3f", (void*)glad_glWindowPos3f, 3, x, y, z);
+	glad_glWindowPos3f(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3f", (void*)glad_glWindowPos3f, 3, x, y, z);
+}
+PFNGLWINDOWPOS3FPROC glad_debug_glWindowPos3f = glad_debug_impl_glWindowPos3f;
+static void APIENTRY glad_debug_impl_glWindowPos3fv(const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3fv", (void*)glad_glWindowPos3fv, 1, v);
+	glad_glWindowPos3fv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3fv", (void*)glad_glWindowPos3fv, 1, v);
+}
+PFNGLWINDOWPOS3FVPROC glad_debug_glWindowPos3fv = glad_debug_impl_glWindowPos3fv;
+static void APIENTRY glad_debug_impl_glWindowPos3i(GLint x, GLint y, GLint z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3i", (void*)glad_glWindowPos3i, 3, x, y, z);
+	glad_glWindowPos3i(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3i", (void*)glad_glWindowPos3i, 3, x, y, z);
+}
+PFNGLWINDOWPOS3IPROC glad_debug_glWindowPos3i = glad_debug_impl_glWindowPos3i;
+static void APIENTRY glad_debug_impl_glWindowPos3iv(const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3iv", (void*)glad_glWindowPos3iv, 1, v);
+	glad_glWindowPos3iv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3iv", (void*)glad_glWindowPos3iv, 1, v);
+}
+PFNGLWINDOWPOS3IVPROC glad_debug_glWindowPos3iv = glad_debug_impl_glWindowPos3iv;
+static void APIENTRY glad_debug_impl_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3s", (void*)glad_glWindowPos3s, 3, x, y, z);
+	glad_glWindowPos3s(x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3s", (void*)glad_glWindowPos3s, 3, x, y, z);
+}
+PFNGLWINDOWPOS3SPROC glad_debug_glWindowPos3s = glad_debug_impl_glWindowPos3s;
+static void APIENTRY glad_debug_impl_glWindowPos3sv(const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWindowPos3sv", (void*)glad_glWindowPos3sv, 1, v);
+	glad_glWindowPos3sv(v);
+	if(_post_call_callback != NULL) _post_call_callback("glWindowPos3sv", (void*)glad_glWindowPos3sv, 1, v);
+}
+PFNGLWINDOWPOS3SVPROC glad_debug_glWindowPos3sv = glad_debug_impl_glWindowPos3sv;
+static void APIENTRY glad_debug_impl_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBlendColor", (void*)glad_glBlendColor, 4, red, green, blue, alpha);
+	glad_glBlendColor(red, green, blue, alpha);
+	if(_post_call_callback != NULL) _post_call_callback("glBlendColor", (void*)glad_glBlendColor, 4, red, green, blue, alpha);
+}
+PFNGLBLENDCOLORPROC glad_debug_glBlendColor = glad_debug_impl_glBlendColor;
+static void APIENTRY glad_debug_impl_glBlendEquation(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBlendEquation", (void*)glad_glBlendEquation, 1, mode);
+	glad_glBlendEquation(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glBlendEquation", (void*)glad_glBlendEquation, 1, mode);
+}
+PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation = glad_debug_impl_glBlendEquation;
+static void APIENTRY glad_debug_impl_glGenQueries(GLsizei n, GLuint *ids) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenQueries", (void*)glad_glGenQueries, 2, n, ids);
+	glad_glGenQueries(n, ids);
+	if(_post_call_callback != NULL) _post_call_callback("glGenQueries", (void*)glad_glGenQueries, 2, n, ids);
+}
+PFNGLGENQUERIESPROC glad_debug_glGenQueries = glad_debug_impl_glGenQueries;
+static void APIENTRY glad_debug_impl_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteQueries", (void*)glad_glDeleteQueries, 2, n, ids);
+	glad_glDeleteQueries(n, ids);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteQueries", (void*)glad_glDeleteQueries, 2, n, ids);
+}
+PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries = glad_debug_impl_glDeleteQueries;
+static GLboolean APIENTRY glad_debug_impl_glIsQuery(GLuint id) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsQuery", (void*)glad_glIsQuery, 1, id);
+	GLboolean ret = glad_glIsQuery(id);
+	if(_post_call_callback != NULL) _post_call_callback("glIsQuery", (void*)glad_glIsQuery, 1, id);
+	return ret;
+}
+PFNGLISQUERYPROC glad_debug_glIsQuery = glad_debug_impl_glIsQuery;
+static void APIENTRY glad_debug_impl_glBeginQuery(GLenum target, GLuint id) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBeginQuery", (void*)glad_glBeginQuery, 2, target, id);
+	glad_glBeginQuery(target, id);
+	if(_post_call_callback != NULL) _post_call_callback("glBeginQuery", (void*)glad_glBeginQuery, 2, target, id);
+}
+PFNGLBEGINQUERYPROC glad_debug_glBeginQuery = glad_debug_impl_glBeginQuery;
+static void APIENTRY glad_debug_impl_glEndQuery(GLenum target) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEndQuery", (void*)glad_glEndQuery, 1, target);
+	glad_glEndQuery(target);
+	if(_post_call_callback != NULL) _post_call_callback("glEndQuery", (void*)glad_glEndQuery, 1, target);
+}
+PFNGLENDQUERYPROC glad_debug_glEndQuery = glad_debug_impl_glEndQuery;
+static void APIENTRY glad_debug_impl_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetQueryiv", (void*)glad_glGetQueryiv, 3, target, pname, params);
+	glad_glGetQueryiv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetQueryiv", (void*)glad_glGetQueryiv, 3, target, pname, params);
+}
+PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv = glad_debug_impl_glGetQueryiv;
+static void APIENTRY glad_debug_impl_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetQueryObjectiv", (void*)glad_glGetQueryObjectiv, 3, id, pname, params);
+	glad_glGetQueryObjectiv(id, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetQueryObjectiv", (void*)glad_glGetQueryObjectiv, 3, id, pname, params);
+}
+PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv = glad_debug_impl_glGetQueryObjectiv;
+static void APIENTRY glad_debug_impl_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetQueryObjectuiv", (void*)glad_glGetQueryObjectuiv, 3, id, pname, params);
+	glad_glGetQueryObjectuiv(id, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetQueryObjectuiv", (void*)glad_glGetQueryObjectuiv, 3, id, pname, params);
+}
+PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv = glad_debug_impl_glGetQueryObjectuiv;
+static void APIENTRY glad_debug_impl_glBindBuffer(GLenum target, GLuint buffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindBuffer", (void*)glad_glBindBuffer, 2, target, buffer);
+	glad_glBindBuffer(target, buffer);
+	if(_post_call_callback != NULL) _post_call_callback("glBindBuffer", (void*)glad_glBindBuffer, 2, target, buffer);
+}
+PFNGLBINDBUFFERPROC glad_debug_glBindBuffer = glad_debug_impl_glBindBuffer;
+static void APIENTRY glad_debug_impl_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteBuffers", (void*)glad_glDeleteBuffers, 2, n, buffers);
+	glad_glDeleteBuffers(n, buffers);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteBuffers", (void*)glad_glDeleteBuffers, 2, n, buffers);
+}
+PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers = glad_debug_impl_glDeleteBuffers;
+static void APIENTRY glad_debug_impl_glGenBuffers(GLsizei n, GLuint *buffers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenBuffers", (void*)glad_glGenBuffers, 2, n, buffers);
+	glad_glGenBuffers(n, buffers);
+	if(_post_call_callback != NULL) _post_call_callback("glGenBuffers", (void*)glad_glGenBuffers, 2, n, buffers);
+}
+PFNGLGENBUFFERSPROC glad_debug_glGenBuffers = glad_debug_impl_glGenBuffers;
+static GLboolean APIENTRY glad_debug_impl_glIsBuffer(GLuint buffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsBuffer", (void*)glad_glIsBuffer, 1, buffer);
+	GLboolean ret = glad_glIsBuffer(buffer);
+	if(_post_call_callback != NULL) _post_call_callback("glIsBuffer", (void*)glad_glIsBuffer, 1, buffer);
+	return ret;
+}
+PFNGLISBUFFERPROC glad_debug_glIsBuffer = glad_debug_impl_glIsBuffer;
+static void APIENTRY glad_debug_impl_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBufferData", (void*)glad_glBufferData, 4, target, size, data, usage);
+	glad_glBufferData(target, size, data, usage);
+	if(_post_call_callback != NULL) _post_call_callback("glBufferData", (void*)glad_glBufferData, 4, target, size, data, usage);
+}
+PFNGLBUFFERDATAPROC glad_debug_glBufferData = glad_debug_impl_glBufferData;
+static void APIENTRY glad_debug_impl_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBufferSubData", (void*)glad_glBufferSubData, 4, target, offset, size, data);
+	glad_glBufferSubData(target, offset, size, data);
+	if(_post_call_callback != NULL) _post_call_callback("glBufferSubData", (void*)glad_glBufferSubData, 4, target, offset, size, data);
+}
+PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData = glad_debug_impl_glBufferSubData;
+static void APIENTRY glad_debug_impl_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetBufferSubData", (void*)glad_glGetBufferSubData, 4, target, offset, size, data);
+	glad_glGetBufferSubData(target, offset, size, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetBufferSubData", (void*)glad_glGetBufferSubData, 4, target, offset, size, data);
+}
+PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData = glad_debug_impl_glGetBufferSubData;
+static void * APIENTRY glad_debug_impl_glMapBuffer(GLenum target, GLenum access) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMapBuffer", (void*)glad_glMapBuffer, 2, target, access);
+	void * ret = glad_glMapBuffer(target, access);
+	if(_post_call_callback != NULL) _post_call_callback("glMapBuffer", (void*)glad_glMapBuffer, 2, target, access);
+	return ret;
+}
+PFNGLMAPBUFFERPROC glad_debug_glMapBuffer = glad_debug_impl_glMapBuffer;
+static GLboolean APIENTRY glad_debug_impl_glUnmapBuffer(GLenum target) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUnmapBuffer", (void*)glad_glUnmapBuffer, 1, target);
+	GLboolean ret = glad_glUnmapBuffer(target);
+	if(_post_call_callback != NULL) _post_call_callback("glUnmapBuffer", (void*)glad_glUnmapBuffer, 1, target);
+	return ret;
+}
+PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer = glad_debug_impl_glUnmapBuffer;
+static void APIENTRY glad_debug_impl_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetBufferParameteriv", (void*)glad_glGetBufferParameteriv, 3, target, pname, params);
+	glad_glGetBufferParameteriv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetBufferParameteriv", (void*)glad_glGetBufferParameteriv, 3, target, pname, params);
+}
+PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv = glad_debug_impl_glGetBufferParameteriv;
+static void APIENTRY glad_debug_impl_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetBufferPointerv", (void*)glad_glGetBufferPointerv, 3, target, pname, params);
+	glad_glGetBufferPointerv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetBufferPointerv", (void*)glad_glGetBufferPointerv, 3, target, pname, params);
+}
+PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv = glad_debug_impl_glGetBufferPointerv;
+static void APIENTRY glad_debug_impl_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBlendEquationSeparate", (void*)glad_glBlendEquationSeparate, 2, modeRGB, modeAlpha);
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+	if(_post_call_callback != NULL) _post_call_callback("glBlendEquationSeparate", (void*)glad_glBlendEquationSeparate, 2, modeRGB, modeAlpha);
+}
+PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate = glad_debug_impl_glBlendEquationSeparate;
+static void APIENTRY glad_debug_impl_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawBuffers", (void*)glad_glDrawBuffers, 2, n, bufs);
+	glad_glDrawBuffers(n, bufs);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawBuffers", (void*)glad_glDrawBuffers, 2, n, bufs);
+}
+PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers = glad_debug_impl_glDrawBuffers;
+static void APIENTRY glad_debug_impl_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glStencilOpSeparate", (void*)glad_glStencilOpSeparate, 4, face, sfail, dpfail, dppass);
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	if(_post_call_callback != NULL) _post_call_callback("glStencilOpSeparate", (void*)glad_glStencilOpSeparate, 4, face, sfail, dpfail, dppass);
+}
+PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate = glad_debug_impl_glStencilOpSeparate;
+static void APIENTRY glad_debug_impl_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glStencilFuncSeparate", (void*)glad_glStencilFuncSeparate, 4, face, func, ref, mask);
+	glad_glStencilFuncSeparate(face, func, ref, mask);
+	if(_post_call_callback != NULL) _post_call_callback("glStencilFuncSeparate", (void*)glad_glStencilFuncSeparate, 4, face, func, ref, mask);
+}
+PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate = glad_debug_impl_glStencilFuncSeparate;
+static void APIENTRY glad_debug_impl_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glStencilMaskSeparate", (void*)glad_glStencilMaskSeparate, 2, face, mask);
+	glad_glStencilMaskSeparate(face, mask);
+	if(_post_call_callback != NULL) _post_call_callback("glStencilMaskSeparate", (void*)glad_glStencilMaskSeparate, 2, face, mask);
+}
+PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate = glad_debug_impl_glStencilMaskSeparate;
+static void APIENTRY glad_debug_impl_glAttachShader(GLuint program, GLuint shader) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glAttachShader", (void*)glad_glAttachShader, 2, program, shader);
+	glad_glAttachShader(program, shader);
+	if(_post_call_callback != NULL) _post_call_callback("glAttachShader", (void*)glad_glAttachShader, 2, program, shader);
+}
+PFNGLATTACHSHADERPROC glad_debug_glAttachShader = glad_debug_impl_glAttachShader;
+static void APIENTRY glad_debug_impl_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindAttribLocation", (void*)glad_glBindAttribLocation, 3, program, index, name);
+	glad_glBindAttribLocation(program, index, name);
+	if(_post_call_callback != NULL) _post_call_callback("glBindAttribLocation", (void*)glad_glBindAttribLocation, 3, program, index, name);
+}
+PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation = glad_debug_impl_glBindAttribLocation;
+static void APIENTRY glad_debug_impl_glCompileShader(GLuint shader) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCompileShader", (void*)glad_glCompileShader, 1, shader);
+	glad_glCompileShader(shader);
+	if(_post_call_callback != NULL) _post_call_callback("glCompileShader", (void*)glad_glCompileShader, 1, shader);
+}
+PFNGLCOMPILESHADERPROC glad_debug_glCompileShader = glad_debug_impl_glCompileShader;
+static GLuint APIENTRY glad_debug_impl_glCreateProgram(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCreateProgram", (void*)glad_glCreateProgram, 0);
+	GLuint ret = glad_glCreateProgram();
+	if(_post_call_callback != NULL) _post_call_callback("glCreateProgram", (void*)glad_glCreateProgram, 0);
+	return ret;
+}
+PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram = glad_debug_impl_glCreateProgram;
+static GLuint APIENTRY glad_debug_impl_glCreateShader(GLenum type) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCreateShader", (void*)glad_glCreateShader, 1, type);
+	GLuint ret = glad_glCreateShader(type);
+	if(_post_call_callback != NULL) _post_call_callback("glCreateShader", (void*)glad_glCreateShader, 1, type);
+	return ret;
+}
+PFNGLCREATESHADERPROC glad_debug_glCreateShader = glad_debug_impl_glCreateShader;
+static void APIENTRY glad_debug_impl_glDeleteProgram(GLuint program) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteProgram", (void*)glad_glDeleteProgram, 1, program);
+	glad_glDeleteProgram(program);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteProgram", (void*)glad_glDeleteProgram, 1, program);
+}
+PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram = glad_debug_impl_glDeleteProgram;
+static void APIENTRY glad_debug_impl_glDeleteShader(GLuint shader) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteShader", (void*)glad_glDeleteShader, 1, shader);
+	glad_glDeleteShader(shader);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteShader", (void*)glad_glDeleteShader, 1, shader);
+}
+PFNGLDELETESHADERPROC glad_debug_glDeleteShader = glad_debug_impl_glDeleteShader;
+static void APIENTRY glad_debug_impl_glDetachShader(GLuint program, GLuint shader) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDetachShader", (void*)glad_glDetachShader, 2, program, shader);
+	glad_glDetachShader(program, shader);
+	if(_post_call_callback != NULL) _post_call_callback("glDetachShader", (void*)glad_glDetachShader, 2, program, shader);
+}
+PFNGLDETACHSHADERPROC glad_debug_glDetachShader = glad_debug_impl_glDetachShader;
+static void APIENTRY glad_debug_impl_glDisableVertexAttribArray(GLuint index) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDisableVertexAttribArray", (void*)glad_glDisableVertexAttribArray, 1, index);
+	glad_glDisableVertexAttribArray(index);
+	if(_post_call_callback != NULL) _post_call_callback("glDisableVertexAttribArray", (void*)glad_glDisableVertexAttribArray, 1, index);
+}
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray = glad_debug_impl_glDisableVertexAttribArray;
+static void APIENTRY glad_debug_impl_glEnableVertexAttribArray(GLuint index) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEnableVertexAttribArray", (void*)glad_glEnableVertexAttribArray, 1, index);
+	glad_glEnableVertexAttribArray(index);
+	if(_post_call_callback != NULL) _post_call_callback("glEnableVertexAttribArray", (void*)glad_glEnableVertexAttribArray, 1, index);
+}
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray = glad_debug_impl_glEnableVertexAttribArray;
+static void APIENTRY glad_debug_impl_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetActiveAttrib", (void*)glad_glGetActiveAttrib, 7, program, index, bufSize, length, size, type, name);
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetActiveAttrib", (void*)glad_glGetActiveAttrib, 7, program, index, bufSize, length, size, type, name);
+}
+PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib = glad_debug_impl_glGetActiveAttrib;
+static void APIENTRY glad_debug_impl_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetActiveUniform", (void*)glad_glGetActiveUniform, 7, program, index, bufSize, length, size, type, name);
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetActiveUniform", (void*)glad_glGetActiveUniform, 7, program, index, bufSize, length, size, type, name);
+}
+PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform = glad_debug_impl_glGetActiveUniform;
+static void APIENTRY glad_debug_impl_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetAttachedShaders", (void*)glad_glGetAttachedShaders, 4, program, maxCount, count, shaders);
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+	if(_post_call_callback != NULL) _post_call_callback("glGetAttachedShaders", (void*)glad_glGetAttachedShaders, 4, program, maxCount, count, shaders);
+}
+PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders = glad_debug_impl_glGetAttachedShaders;
+static GLint APIENTRY glad_debug_impl_glGetAttribLocation(GLuint program, const GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetAttribLocation", (void*)glad_glGetAttribLocation, 2, program, name);
+	GLint ret = glad_glGetAttribLocation(program, name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetAttribLocation", (void*)glad_glGetAttribLocation, 2, program, name);
+	return ret;
+}
+PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation = glad_debug_impl_glGetAttribLocation;
+static void APIENTRY glad_debug_impl_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetProgramiv", (void*)glad_glGetProgramiv, 3, program, pname, params);
+	glad_glGetProgramiv(program, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetProgramiv", (void*)glad_glGetProgramiv, 3, program, pname, params);
+}
+PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv = glad_debug_impl_glGetProgramiv;
+static void APIENTRY glad_debug_impl_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetProgramInfoLog", (void*)glad_glGetProgramInfoLog, 4, program, bufSize, length, infoLog);
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	if(_post_call_callback != NULL) _post_call_callback("glGetProgramInfoLog", (void*)glad_glGetProgramInfoLog, 4, program, bufSize, length, infoLog);
+}
+PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog = glad_debug_impl_glGetProgramInfoLog;
+static void APIENTRY glad_debug_impl_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetShaderiv", (void*)glad_glGetShaderiv, 3, shader, pname, params);
+	glad_glGetShaderiv(shader, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetShaderiv", (void*)glad_glGetShaderiv, 3, shader, pname, params);
+}
+PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv = glad_debug_impl_glGetShaderiv;
+static void APIENTRY glad_debug_impl_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetShaderInfoLog", (void*)glad_glGetShaderInfoLog, 4, shader, bufSize, length, infoLog);
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	if(_post_call_callback != NULL) _post_call_callback("glGetShaderInfoLog", (void*)glad_glGetShaderInfoLog, 4, shader, bufSize, length, infoLog);
+}
+PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog = glad_debug_impl_glGetShaderInfoLog;
+static void APIENTRY glad_debug_impl_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetShaderSource", (void*)glad_glGetShaderSource, 4, shader, bufSize, length, source);
+	glad_glGetShaderSource(shader, bufSize, length, source);
+	if(_post_call_callback != NULL) _post_call_callback("glGetShaderSource", (void*)glad_glGetShaderSource, 4, shader, bufSize, length, source);
+}
+PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource = glad_debug_impl_glGetShaderSource;
+static GLint APIENTRY glad_debug_impl_glGetUniformLocation(GLuint program, const GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetUniformLocation", (void*)glad_glGetUniformLocation, 2, program, name);
+	GLint ret = glad_glGetUniformLocation(program, name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetUniformLocation", (void*)glad_glGetUniformLocation, 2, program, name);
+	return ret;
+}
+PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation = glad_debug_impl_glGetUniformLocation;
+static void APIENTRY glad_debug_impl_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetUniformfv", (void*)glad_glGetUniformfv, 3, program, location, params);
+	glad_glGetUniformfv(program, location, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetUniformfv", (void*)glad_glGetUniformfv, 3, program, location, params);
+}
+PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv = glad_debug_impl_glGetUniformfv;
+static void APIENTRY glad_debug_impl_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetUniformiv", (void*)glad_glGetUniformiv, 3, program, location, params);
+	glad_glGetUniformiv(program, location, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetUniformiv", (void*)glad_glGetUniformiv, 3, program, location, params);
+}
+PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv = glad_debug_impl_glGetUniformiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetVertexAttribdv", (void*)glad_glGetVertexAttribdv, 3, index, pname, params);
+	glad_glGetVertexAttribdv(index, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetVertexAttribdv", (void*)glad_glGetVertexAttribdv, 3, index, pname, params);
+}
+PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv = glad_debug_impl_glGetVertexAttribdv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetVertexAttribfv", (void*)glad_glGetVertexAttribfv, 3, index, pname, params);
+	glad_glGetVertexAttribfv(index, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetVertexAttribfv", (void*)glad_glGetVertexAttribfv, 3, index, pname, params);
+}
+PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv = glad_debug_impl_glGetVertexAttribfv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetVertexAttribiv", (void*)glad_glGetVertexAttribiv, 3, index, pname, params);
+	glad_glGetVertexAttribiv(index, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetVertexAttribiv", (void*)glad_glGetVertexAttribiv, 3, index, pname, params);
+}
+PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv = glad_debug_impl_glGetVertexAttribiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetVertexAttribPointerv", (void*)glad_glGetVertexAttribPointerv, 3, index, pname, pointer);
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glGetVertexAttribPointerv", (void*)glad_glGetVertexAttribPointerv, 3, index, pname, pointer);
+}
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv = glad_debug_impl_glGetVertexAttribPointerv;
+static GLboolean APIENTRY glad_debug_impl_glIsProgram(GLuint program) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsProgram", (void*)glad_glIsProgram, 1, program);
+	GLboolean ret = glad_glIsProgram(program);
+	if(_post_call_callback != NULL) _post_call_callback("glIsProgram", (void*)glad_glIsProgram, 1, program);
+	return ret;
+}
+PFNGLISPROGRAMPROC glad_debug_glIsProgram = glad_debug_impl_glIsProgram;
+static GLboolean APIENTRY glad_debug_impl_glIsShader(GLuint shader) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsShader", (void*)glad_glIsShader, 1, shader);
+	GLboolean ret = glad_glIsShader(shader);
+	if(_post_call_callback != NULL) _post_call_callback("glIsShader", (void*)glad_glIsShader, 1, shader);
+	return ret;
+}
+PFNGLISSHADERPROC glad_debug_glIsShader = glad_debug_impl_glIsShader;
+static void APIENTRY glad_debug_impl_glLinkProgram(GLuint program) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glLinkProgram", (void*)glad_glLinkProgram, 1, program);
+	glad_glLinkProgram(program);
+	if(_post_call_callback != NULL) _post_call_callback("glLinkProgram", (void*)glad_glLinkProgram, 1, program);
+}
+PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram = glad_debug_impl_glLinkProgram;
+static void APIENTRY glad_debug_impl_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glShaderSource", (void*)glad_glShaderSource, 4, shader, count, string, length);
+	glad_glShaderSource(shader, count, string, length);
+	if(_post_call_callback != NULL) _post_call_callback("glShaderSource", (void*)glad_glShaderSource, 4, shader, count, string, length);
+}
+PFNGLSHADERSOURCEPROC glad_debug_glShaderSource = glad_debug_impl_glShaderSource;
+static void APIENTRY glad_debug_impl_glUseProgram(GLuint program) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUseProgram", (void*)glad_glUseProgram, 1, program);
+	glad_glUseProgram(program);
+	if(_post_call_callback != NULL) _post_call_callback("glUseProgram", (void*)glad_glUseProgram, 1, program);
+}
+PFNGLUSEPROGRAMPROC glad_debug_glUseProgram = glad_debug_impl_glUseProgram;
+static void APIENTRY glad_debug_impl_glUniform1f(GLint location, GLfloat v0) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform1f", (void*)glad_glUniform1f, 2, location, v0);
+	glad_glUniform1f(location, v0);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform1f", (void*)glad_glUniform1f, 2, location, v0);
+}
+PFNGLUNIFORM1FPROC glad_debug_glUniform1f = glad_debug_impl_glUniform1f;
+static void APIENTRY glad_debug_impl_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform2f", (void*)glad_glUniform2f, 3, location, v0, v1);
+	glad_glUniform2f(location, v0, v1);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform2f", (void*)glad_glUniform2f, 3, location, v0, v1);
+}
+PFNGLUNIFORM2FPROC glad_debug_glUniform2f = glad_debug_impl_glUniform2f;
+static void APIENTRY glad_debug_impl_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform3f", (void*)glad_glUniform3f, 4, location, v0, v1, v2);
+	glad_glUniform3f(location, v0, v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform3f", (void*)glad_glUniform3f, 4, location, v0, v1, v2);
+}
+PFNGLUNIFORM3FPROC glad_debug_glUniform3f = glad_debug_impl_glUniform3f;
+static void APIENTRY glad_debug_impl_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform4f", (void*)glad_glUniform4f, 5, location, v0, v1, v2, v3);
+	glad_glUniform4f(location, v0, v1, v2, v3);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform4f", (void*)glad_glUniform4f, 5, location, v0, v1, v2, v3);
+}
+PFNGLUNIFORM4FPROC glad_debug_glUniform4f = glad_debug_impl_glUniform4f;
+static void APIENTRY glad_debug_impl_glUniform1i(GLint location, GLint v0) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform1i", (void*)glad_glUniform1i, 2, location, v0);
+	glad_glUniform1i(location, v0);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform1i", (void*)glad_glUniform1i, 2, location, v0);
+}
+PFNGLUNIFORM1IPROC glad_debug_glUniform1i = glad_debug_impl_glUniform1i;
+static void APIENTRY glad_debug_impl_glUniform2i(GLint location, GLint v0, GLint v1) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform2i", (void*)glad_glUniform2i, 3, location, v0, v1);
+	glad_glUniform2i(location, v0, v1);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform2i", (void*)glad_glUniform2i, 3, location, v0, v1);
+}
+PFNGLUNIFORM2IPROC glad_debug_glUniform2i = glad_debug_impl_glUniform2i;
+static void APIENTRY glad_debug_impl_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform3i", (void*)glad_glUniform3i, 4, location, v0, v1, v2);
+	glad_glUniform3i(location, v0, v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform3i", (void*)glad_glUniform3i, 4, location, v0, v1, v2);
+}
+PFNGLUNIFORM3IPROC glad_debug_glUniform3i = glad_debug_impl_glUniform3i;
+static void APIENTRY glad_debug_impl_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform4i", (void*)glad_glUniform4i, 5, location, v0, v1, v2, v3);
+	glad_glUniform4i(location, v0, v1, v2, v3);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform4i", (void*)glad_glUniform4i, 5, location, v0, v1, v2, v3);
+}
+PFNGLUNIFORM4IPROC glad_debug_glUniform4i = glad_debug_impl_glUniform4i;
+static void APIENTRY glad_debug_impl_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform1fv", (void*)glad_glUniform1fv, 3, location, count, value);
+	glad_glUniform1fv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform1fv", (void*)glad_glUniform1fv, 3, location, count, value);
+}
+PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv = glad_debug_impl_glUniform1fv;
+static void APIENTRY glad_debug_impl_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform2fv", (void*)glad_glUniform2fv, 3, location, count, value);
+	glad_glUniform2fv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform2fv", (void*)glad_glUniform2fv, 3, location, count, value);
+}
+PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv = glad_debug_impl_glUniform2fv;
+static void APIENTRY glad_debug_impl_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform3fv", (void*)glad_glUniform3fv, 3, location, count, value);
+	glad_glUniform3fv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform3fv", (void*)glad_glUniform3fv, 3, location, count, value);
+}
+PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv = glad_debug_impl_glUniform3fv;
+static void APIENTRY glad_debug_impl_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform4fv", (void*)glad_glUniform4fv, 3, location, count, value);
+	glad_glUniform4fv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform4fv", (void*)glad_glUniform4fv, 3, location, count, value);
+}
+PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv = glad_debug_impl_glUniform4fv;
+static void APIENTRY glad_debug_impl_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform1iv", (void*)glad_glUniform1iv, 3, location, count, value);
+	glad_glUniform1iv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform1iv", (void*)glad_glUniform1iv, 3, location, count, value);
+}
+PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv = glad_debug_impl_glUniform1iv;
+static void APIENTRY glad_debug_impl_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform2iv", (void*)glad_glUniform2iv, 3, location, count, value);
+	glad_glUniform2iv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform2iv", (void*)glad_glUniform2iv, 3, location, count, value);
+}
+PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv = glad_debug_impl_glUniform2iv;
+static void APIENTRY glad_debug_impl_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform3iv", (void*)glad_glUniform3iv, 3, location, count, value);
+	glad_glUniform3iv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform3iv", (void*)glad_glUniform3iv, 3, location, count, value);
+}
+PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv = glad_debug_impl_glUniform3iv;
+static void APIENTRY glad_debug_impl_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform4iv", (void*)glad_glUniform4iv, 3, location, count, value);
+	glad_glUniform4iv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform4iv", (void*)glad_glUniform4iv, 3, location, count, value);
+}
+PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv = glad_debug_impl_glUniform4iv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix2fv", (void*)glad_glUniformMatrix2fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix2fv", (void*)glad_glUniformMatrix2fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv = glad_debug_impl_glUniformMatrix2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix3fv", (void*)glad_glUniformMatrix3fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix3fv", (void*)glad_glUniformMatrix3fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv = glad_debug_impl_glUniformMatrix3fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix4fv", (void*)glad_glUniformMatrix4fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix4fv", (void*)glad_glUniformMatrix4fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv = glad_debug_impl_glUniformMatrix4fv;
+static void APIENTRY glad_debug_impl_glValidateProgram(GLuint program) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glValidateProgram", (void*)glad_glValidateProgram, 1, program);
+	glad_glValidateProgram(program);
+	if(_post_call_callback != NULL) _post_call_callback("glValidateProgram", (void*)glad_glValidateProgram, 1, program);
+}
+PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram = glad_debug_impl_glValidateProgram;
+static void APIENTRY glad_debug_impl_glVertexAttrib1d(GLuint index, GLdouble x) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib1d", (void*)glad_glVertexAttrib1d, 2, index, x);
+	glad_glVertexAttrib1d(index, x);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib1d", (void*)glad_glVertexAttrib1d, 2, index, x);
+}
+PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d = glad_debug_impl_glVertexAttrib1d;
+static void APIENTRY glad_debug_impl_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib1dv", (void*)glad_glVertexAttrib1dv, 2, index, v);
+	glad_glVertexAttrib1dv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib1dv", (void*)glad_glVertexAttrib1dv, 2, index, v);
+}
+PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv = glad_debug_impl_glVertexAttrib1dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib1f(GLuint index, GLfloat x) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib1f", (void*)glad_glVertexAttrib1f, 2, index, x);
+	glad_glVertexAttrib1f(index, x);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib1f", (void*)glad_glVertexAttrib1f, 2, index, x);
+}
+PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f = glad_debug_impl_glVertexAttrib1f;
+static void APIENTRY glad_debug_impl_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib1fv", (void*)glad_glVertexAttrib1fv, 2, index, v);
+	glad_glVertexAttrib1fv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib1fv", (void*)glad_glVertexAttrib1fv, 2, index, v);
+}
+PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv = glad_debug_impl_glVertexAttrib1fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib1s(GLuint index, GLshort x) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib1s", (void*)glad_glVertexAttrib1s, 2, index, x);
+	glad_glVertexAttrib1s(index, x);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib1s", (void*)glad_glVertexAttrib1s, 2, index, x);
+}
+PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s = glad_debug_impl_glVertexAttrib1s;
+static void APIENTRY glad_debug_impl_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib1sv", (void*)glad_glVertexAttrib1sv, 2, index, v);
+	glad_glVertexAttrib1sv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib1sv", (void*)glad_glVertexAttrib1sv, 2, index, v);
+}
+PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv = glad_debug_impl_glVertexAttrib1sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib2d", (void*)glad_glVertexAttrib2d, 3, index, x, y);
+	glad_glVertexAttrib2d(index, x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib2d", (void*)glad_glVertexAttrib2d, 3, index, x, y);
+}
+PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d = glad_debug_impl_glVertexAttrib2d;
+static void APIENTRY glad_debug_impl_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib2dv", (void*)glad_glVertexAttrib2dv, 2, index, v);
+	glad_glVertexAttrib2dv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib2dv", (void*)glad_glVertexAttrib2dv, 2, index, v);
+}
+PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv = glad_debug_impl_glVertexAttrib2dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib2f", (void*)glad_glVertexAttrib2f, 3, index, x, y);
+	glad_glVertexAttrib2f(index, x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib2f", (void*)glad_glVertexAttrib2f, 3, index, x, y);
+}
+PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f = glad_debug_impl_glVertexAttrib2f;
+static void APIENTRY glad_debug_impl_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib2fv", (void*)glad_glVertexAttrib2fv, 2, index, v);
+	glad_glVertexAttrib2fv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib2fv", (void*)glad_glVertexAttrib2fv, 2, index, v);
+}
+PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv = glad_debug_impl_glVertexAttrib2fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib2s", (void*)glad_glVertexAttrib2s, 3, index, x, y);
+	glad_glVertexAttrib2s(index, x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib2s", (void*)glad_glVertexAttrib2s, 3, index, x, y);
+}
+PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s = glad_debug_impl_glVertexAttrib2s;
+static void APIENTRY glad_debug_impl_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib2sv", (void*)glad_glVertexAttrib2sv, 2, index, v);
+	glad_glVertexAttrib2sv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib2sv", (void*)glad_glVertexAttrib2sv, 2, index, v);
+}
+PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv = glad_debug_impl_glVertexAttrib2sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib3d", (void*)glad_glVertexAttrib3d, 4, index, x, y, z);
+	glad_glVertexAttrib3d(index, x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib3d", (void*)glad_glVertexAttrib3d, 4, index, x, y, z);
+}
+PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d = glad_debug_impl_glVertexAttrib3d;
+static void APIENTRY glad_debug_impl_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib3dv", (void*)glad_glVertexAttrib3dv, 2, index, v);
+	glad_glVertexAttrib3dv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib3dv", (void*)glad_glVertexAttrib3dv, 2, index, v);
+}
+PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv = glad_debug_impl_glVertexAttrib3dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib3f", (void*)glad_glVertexAttrib3f, 4, index, x, y, z);
+	glad_glVertexAttrib3f(index, x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib3f", (void*)glad_glVertexAttrib3f, 4, index, x, y, z);
+}
+PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f = glad_debug_impl_glVertexAttrib3f;
+static void APIENTRY glad_debug_impl_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib3fv", (void*)glad_glVertexAttrib3fv, 2, index, v);
+	glad_glVertexAttrib3fv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib3fv", (void*)glad_glVertexAttrib3fv, 2, index, v);
+}
+PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv = glad_debug_impl_glVertexAttrib3fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib3s", (void*)glad_glVertexAttrib3s, 4, index, x, y, z);
+	glad_glVertexAttrib3s(index, x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib3s", (void*)glad_glVertexAttrib3s, 4, index, x, y, z);
+}
+PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s = glad_debug_impl_glVertexAttrib3s;
+static void APIENTRY glad_debug_impl_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib3sv", (void*)glad_glVertexAttrib3sv, 2, index, v);
+	glad_glVertexAttrib3sv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib3sv", (void*)glad_glVertexAttrib3sv, 2, index, v);
+}
+PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv = glad_debug_impl_glVertexAttrib3sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4Nbv", (void*)glad_glVertexAttrib4Nbv, 2, index, v);
+	glad_glVertexAttrib4Nbv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4Nbv", (void*)glad_glVertexAttrib4Nbv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv = glad_debug_impl_glVertexAttrib4Nbv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4Niv", (void*)glad_glVertexAttrib4Niv, 2, index, v);
+	glad_glVertexAttrib4Niv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4Niv", (void*)glad_glVertexAttrib4Niv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv = glad_debug_impl_glVertexAttrib4Niv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4Nsv", (void*)glad_glVertexAttrib4Nsv, 2, index, v);
+	glad_glVertexAttrib4Nsv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4Nsv", (void*)glad_glVertexAttrib4Nsv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv = glad_debug_impl_glVertexAttrib4Nsv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4Nub", (void*)glad_glVertexAttrib4Nub, 5, index, x, y, z, w);
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4Nub", (void*)glad_glVertexAttrib4Nub, 5, index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub = glad_debug_impl_glVertexAttrib4Nub;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4Nubv", (void*)glad_glVertexAttrib4Nubv, 2, index, v);
+	glad_glVertexAttrib4Nubv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4Nubv", (void*)glad_glVertexAttrib4Nubv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv = glad_debug_impl_glVertexAttrib4Nubv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4Nuiv", (void*)glad_glVertexAttrib4Nuiv, 2, index, v);
+	glad_glVertexAttrib4Nuiv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4Nuiv", (void*)glad_glVertexAttrib4Nuiv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv = glad_debug_impl_glVertexAttrib4Nuiv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4Nusv", (void*)glad_glVertexAttrib4Nusv, 2, index, v);
+	glad_glVertexAttrib4Nusv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4Nusv", (void*)glad_glVertexAttrib4Nusv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv = glad_debug_impl_glVertexAttrib4Nusv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4bv", (void*)glad_glVertexAttrib4bv, 2, index, v);
+	glad_glVertexAttrib4bv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4bv", (void*)glad_glVertexAttrib4bv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv = glad_debug_impl_glVertexAttrib4bv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4d", (void*)glad_glVertexAttrib4d, 5, index, x, y, z, w);
+	glad_glVertexAttrib4d(index, x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4d", (void*)glad_glVertexAttrib4d, 5, index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d = glad_debug_impl_glVertexAttrib4d;
+static void APIENTRY glad_debug_impl_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4dv", (void*)glad_glVertexAttrib4dv, 2, index, v);
+	glad_glVertexAttrib4dv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4dv", (void*)glad_glVertexAttrib4dv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv = glad_debug_impl_glVertexAttrib4dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4f", (void*)glad_glVertexAttrib4f, 5, index, x, y, z, w);
+	glad_glVertexAttrib4f(index, x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4f", (void*)glad_glVertexAttrib4f, 5, index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f = glad_debug_impl_glVertexAttrib4f;
+static void APIENTRY glad_debug_impl_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4fv", (void*)glad_glVertexAttrib4fv, 2, index, v);
+	glad_glVertexAttrib4fv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4fv", (void*)glad_glVertexAttrib4fv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv = glad_debug_impl_glVertexAttrib4fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4iv", (void*)glad_glVertexAttrib4iv, 2, index, v);
+	glad_glVertexAttrib4iv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4iv", (void*)glad_glVertexAttrib4iv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv = glad_debug_impl_glVertexAttrib4iv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4s", (void*)glad_glVertexAttrib4s, 5, index, x, y, z, w);
+	glad_glVertexAttrib4s(index, x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4s", (void*)glad_glVertexAttrib4s, 5, index, x, y, z, w);
+}
+PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s = glad_debug_impl_glVertexAttrib4s;
+static void APIENTRY glad_debug_impl_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4sv", (void*)glad_glVertexAttrib4sv, 2, index, v);
+	glad_glVertexAttrib4sv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4sv", (void*)glad_glVertexAttrib4sv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv = glad_debug_impl_glVertexAttrib4sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4ubv", (void*)glad_glVertexAttrib4ubv, 2, index, v);
+	glad_glVertexAttrib4ubv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4ubv", (void*)glad_glVertexAttrib4ubv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv = glad_debug_impl_glVertexAttrib4ubv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4uiv", (void*)glad_glVertexAttrib4uiv, 2, index, v);
+	glad_glVertexAttrib4uiv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4uiv", (void*)glad_glVertexAttrib4uiv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv = glad_debug_impl_glVertexAttrib4uiv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttrib4usv", (void*)glad_glVertexAttrib4usv, 2, index, v);
+	glad_glVertexAttrib4usv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttrib4usv", (void*)glad_glVertexAttrib4usv, 2, index, v);
+}
+PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv = glad_debug_impl_glVertexAttrib4usv;
+static void APIENTRY glad_debug_impl_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribPointer", (void*)glad_glVertexAttribPointer, 6, index, size, type, normalized, stride, pointer);
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribPointer", (void*)glad_glVertexAttribPointer, 6, index, size, type, normalized, stride, pointer);
+}
+PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer = glad_debug_impl_glVertexAttribPointer;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix2x3fv", (void*)glad_glUniformMatrix2x3fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix2x3fv", (void*)glad_glUniformMatrix2x3fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv = glad_debug_impl_glUniformMatrix2x3fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix3x2fv", (void*)glad_glUniformMatrix3x2fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix3x2fv", (void*)glad_glUniformMatrix3x2fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv = glad_debug_impl_glUniformMatrix3x2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix2x4fv", (void*)glad_glUniformMatrix2x4fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix2x4fv", (void*)glad_glUniformMatrix2x4fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv = glad_debug_impl_glUniformMatrix2x4fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix4x2fv", (void*)glad_glUniformMatrix4x2fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix4x2fv", (void*)glad_glUniformMatrix4x2fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv = glad_debug_impl_glUniformMatrix4x2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix3x4fv", (void*)glad_glUniformMatrix3x4fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix3x4fv", (void*)glad_glUniformMatrix3x4fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv = glad_debug_impl_glUniformMatrix3x4fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformMatrix4x3fv", (void*)glad_glUniformMatrix4x3fv, 4, location, count, transpose, value);
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformMatrix4x3fv", (void*)glad_glUniformMatrix4x3fv, 4, location, count, transpose, value);
+}
+PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv = glad_debug_impl_glUniformMatrix4x3fv;
+static void APIENTRY glad_debug_impl_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorMaski", (void*)glad_glColorMaski, 5, index, r, g, b, a);
+	glad_glColorMaski(index, r, g, b, a);
+	if(_post_call_callback != NULL) _post_call_callback("glColorMaski", (void*)glad_glColorMaski, 5, index, r, g, b, a);
+}
+PFNGLCOLORMASKIPROC glad_debug_glColorMaski = glad_debug_impl_glColorMaski;
+static void APIENTRY glad_debug_impl_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetBooleani_v", (void*)glad_glGetBooleani_v, 3, target, index, data);
+	glad_glGetBooleani_v(target, index, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetBooleani_v", (void*)glad_glGetBooleani_v, 3, target, index, data);
+}
+PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v = glad_debug_impl_glGetBooleani_v;
+static void APIENTRY glad_debug_impl_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetIntegeri_v", (void*)glad_glGetIntegeri_v, 3, target, index, data);
+	glad_glGetIntegeri_v(target, index, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetIntegeri_v", (void*)glad_glGetIntegeri_v, 3, target, index, data);
+}
+PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v = glad_debug_impl_glGetIntegeri_v;
+static void APIENTRY glad_debug_impl_glEnablei(GLenum target, GLuint index) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEnablei", (void*)glad_glEnablei, 2, target, index);
+	glad_glEnablei(target, index);
+	if(_post_call_callback != NULL) _post_call_callback("glEnablei", (void*)glad_glEnablei, 2, target, index);
+}
+PFNGLENABLEIPROC glad_debug_glEnablei = glad_debug_impl_glEnablei;
+static void APIENTRY glad_debug_impl_glDisablei(GLenum target, GLuint index) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDisablei", (void*)glad_glDisablei, 2, target, index);
+	glad_glDisablei(target, index);
+	if(_post_call_callback != NULL) _post_call_callback("glDisablei", (void*)glad_glDisablei, 2, target, index);
+}
+PFNGLDISABLEIPROC glad_debug_glDisablei = glad_debug_impl_glDisablei;
+static GLboolean APIENTRY glad_debug_impl_glIsEnabledi(GLenum target, GLuint index) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsEnabledi", (void*)glad_glIsEnabledi, 2, target, index);
+	GLboolean ret = glad_glIsEnabledi(target, index);
+	if(_post_call_callback != NULL) _post_call_callback("glIsEnabledi", (void*)glad_glIsEnabledi, 2, target, index);
+	return ret;
+}
+PFNGLISENABLEDIPROC glad_debug_glIsEnabledi = glad_debug_impl_glIsEnabledi;
+static void APIENTRY glad_debug_impl_glBeginTransformFeedback(GLenum primitiveMode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBeginTransformFeedback", (void*)glad_glBeginTransformFeedback, 1, primitiveMode);
+	glad_glBeginTransformFeedback(primitiveMode);
+	if(_post_call_callback != NULL) _post_call_callback("glBeginTransformFeedback", (void*)glad_glBeginTransformFeedback, 1, primitiveMode);
+}
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback = glad_debug_impl_glBeginTransformFeedback;
+static void APIENTRY glad_debug_impl_glEndTransformFeedback(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEndTransformFeedback", (void*)glad_glEndTransformFeedback, 0);
+	glad_glEndTransformFeedback();
+	if(_post_call_callback != NULL) _post_call_callback("glEndTransformFeedback", (void*)glad_glEndTransformFeedback, 0);
+}
+PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback = glad_debug_impl_glEndTransformFeedback;
+static void APIENTRY glad_debug_impl_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindBufferRange", (void*)glad_glBindBufferRange, 5, target, index, buffer, offset, size);
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+	if(_post_call_callback != NULL) _post_call_callback("glBindBufferRange", (void*)glad_glBindBufferRange, 5, target, index, buffer, offset, size);
+}
+PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange = glad_debug_impl_glBindBufferRange;
+static void APIENTRY glad_debug_impl_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindBufferBase", (void*)glad_glBindBufferBase, 3, target, index, buffer);
+	glad_glBindBufferBase(target, index, buffer);
+	if(_post_call_callback != NULL) _post_call_callback("glBindBufferBase", (void*)glad_glBindBufferBase, 3, target, index, buffer);
+}
+PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase = glad_debug_impl_glBindBufferBase;
+static void APIENTRY glad_debug_impl_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTransformFeedbackVaryings", (void*)glad_glTransformFeedbackVaryings, 4, program, count, varyings, bufferMode);
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	if(_post_call_callback != NULL) _post_call_callback("glTransformFeedbackVaryings", (void*)glad_glTransformFeedbackVaryings, 4, program, count, varyings, bufferMode);
+}
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings = glad_debug_impl_glTransformFeedbackVaryings;
+static void APIENTRY glad_debug_impl_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTransformFeedbackVarying", (void*)glad_glGetTransformFeedbackVarying, 7, program, index, bufSize, length, size, type, name);
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTransformFeedbackVarying", (void*)glad_glGetTransformFeedbackVarying, 7, program, index, bufSize, length, size, type, name);
+}
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying = glad_debug_impl_glGetTransformFeedbackVarying;
+static void APIENTRY glad_debug_impl_glClampColor(GLenum target, GLenum clamp) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClampColor", (void*)glad_glClampColor, 2, target, clamp);
+	glad_glClampColor(target, clamp);
+	if(_post_call_callback != NULL) _post_call_callback("glClampColor", (void*)glad_glClampColor, 2, target, clamp);
+}
+PFNGLCLAMPCOLORPROC glad_debug_glClampColor = glad_debug_impl_glClampColor;
+static void APIENTRY glad_debug_impl_glBeginConditionalRender(GLuint id, GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBeginConditionalRender", (void*)glad_glBeginConditionalRender, 2, id, mode);
+	glad_glBeginConditionalRender(id, mode);
+	if(_post_call_callback != NULL) _post_call_callback("glBeginConditionalRender", (void*)glad_glBeginConditionalRender, 2, id, mode);
+}
+PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender = glad_debug_impl_glBeginConditionalRender;
+static void APIENTRY glad_debug_impl_glEndConditionalRender(void) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glEndConditionalRender", (void*)glad_glEndConditionalRender, 0);
+	glad_glEndConditionalRender();
+	if(_post_call_callback != NULL) _post_call_callback("glEndConditionalRender", (void*)glad_glEndConditionalRender, 0);
+}
+PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender = glad_debug_impl_glEndConditionalRender;
+static void APIENTRY glad_debug_impl_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribIPointer", (void*)glad_glVertexAttribIPointer, 5, index, size, type, stride, pointer);
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribIPointer", (void*)glad_glVertexAttribIPointer, 5, index, size, type, stride, pointer);
+}
+PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer = glad_debug_impl_glVertexAttribIPointer;
+static void APIENTRY glad_debug_impl_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetVertexAttribIiv", (void*)glad_glGetVertexAttribIiv, 3, index, pname, params);
+	glad_glGetVertexAttribIiv(index, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetVertexAttribIiv", (void*)glad_glGetVertexAttribIiv, 3, index, pname, params);
+}
+PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv = glad_debug_impl_glGetVertexAttribIiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetVertexAttribIuiv", (void*)glad_glGetVertexAttribIuiv, 3, index, pname, params);
+	glad_glGetVertexAttribIuiv(index, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetVertexAttribIuiv", (void*)glad_glGetVertexAttribIuiv, 3, index, pname, params);
+}
+PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv = glad_debug_impl_glGetVertexAttribIuiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI1i(GLuint index, GLint x) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI1i", (void*)glad_glVertexAttribI1i, 2, index, x);
+	glad_glVertexAttribI1i(index, x);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI1i", (void*)glad_glVertexAttribI1i, 2, index, x);
+}
+PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i = glad_debug_impl_glVertexAttribI1i;
+static void APIENTRY glad_debug_impl_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI2i", (void*)glad_glVertexAttribI2i, 3, index, x, y);
+	glad_glVertexAttribI2i(index, x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI2i", (void*)glad_glVertexAttribI2i, 3, index, x, y);
+}
+PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i = glad_debug_impl_glVertexAttribI2i;
+static void APIENTRY glad_debug_impl_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI3i", (void*)glad_glVertexAttribI3i, 4, index, x, y, z);
+	glad_glVertexAttribI3i(index, x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI3i", (void*)glad_glVertexAttribI3i, 4, index, x, y, z);
+}
+PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i = glad_debug_impl_glVertexAttribI3i;
+static void APIENTRY glad_debug_impl_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4i", (void*)glad_glVertexAttribI4i, 5, index, x, y, z, w);
+	glad_glVertexAttribI4i(index, x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4i", (void*)glad_glVertexAttribI4i, 5, index, x, y, z, w);
+}
+PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i = glad_debug_impl_glVertexAttribI4i;
+static void APIENTRY glad_debug_impl_glVertexAttribI1ui(GLuint index, GLuint x) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI1ui", (void*)glad_glVertexAttribI1ui, 2, index, x);
+	glad_glVertexAttribI1ui(index, x);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI1ui", (void*)glad_glVertexAttribI1ui, 2, index, x);
+}
+PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui = glad_debug_impl_glVertexAttribI1ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI2ui", (void*)glad_glVertexAttribI2ui, 3, index, x, y);
+	glad_glVertexAttribI2ui(index, x, y);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI2ui", (void*)glad_glVertexAttribI2ui, 3, index, x, y);
+}
+PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui = glad_debug_impl_glVertexAttribI2ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI3ui", (void*)glad_glVertexAttribI3ui, 4, index, x, y, z);
+	glad_glVertexAttribI3ui(index, x, y, z);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI3ui", (void*)glad_glVertexAttribI3ui, 4, index, x, y, z);
+}
+PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui = glad_debug_impl_glVertexAttribI3ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4ui", (void*)glad_glVertexAttribI4ui, 5, index, x, y, z, w);
+	glad_glVertexAttribI4ui(index, x, y, z, w);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4ui", (void*)glad_glVertexAttribI4ui, 5, index, x, y, z, w);
+}
+PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui = glad_debug_impl_glVertexAttribI4ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI1iv", (void*)glad_glVertexAttribI1iv, 2, index, v);
+	glad_glVertexAttribI1iv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI1iv", (void*)glad_glVertexAttribI1iv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv = glad_debug_impl_glVertexAttribI1iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI2iv", (void*)glad_glVertexAttribI2iv, 2, index, v);
+	glad_glVertexAttribI2iv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI2iv", (void*)glad_glVertexAttribI2iv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv = glad_debug_impl_glVertexAttribI2iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI3iv", (void*)glad_glVertexAttribI3iv, 2, index, v);
+	glad_glVertexAttribI3iv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI3iv", (void*)glad_glVertexAttribI3iv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv = glad_debug_impl_glVertexAttribI3iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4iv", (void*)glad_glVertexAttribI4iv, 2, index, v);
+	glad_glVertexAttribI4iv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4iv", (void*)glad_glVertexAttribI4iv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv = glad_debug_impl_glVertexAttribI4iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI1uiv", (void*)glad_glVertexAttribI1uiv, 2, index, v);
+	glad_glVertexAttribI1uiv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI1uiv", (void*)glad_glVertexAttribI1uiv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv = glad_debug_impl_glVertexAttribI1uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI2uiv", (void*)glad_glVertexAttribI2uiv, 2, index, v);
+	glad_glVertexAttribI2uiv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI2uiv", (void*)glad_glVertexAttribI2uiv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv = glad_debug_impl_glVertexAttribI2uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI3uiv", (void*)glad_glVertexAttribI3uiv, 2, index, v);
+	glad_glVertexAttribI3uiv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI3uiv", (void*)glad_glVertexAttribI3uiv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv = glad_debug_impl_glVertexAttribI3uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4uiv", (void*)glad_glVertexAttribI4uiv, 2, index, v);
+	glad_glVertexAttribI4uiv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4uiv", (void*)glad_glVertexAttribI4uiv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv = glad_debug_impl_glVertexAttribI4uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4bv", (void*)glad_glVertexAttribI4bv, 2, index, v);
+	glad_glVertexAttribI4bv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4bv", (void*)glad_glVertexAttribI4bv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv = glad_debug_impl_glVertexAttribI4bv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4sv", (void*)glad_glVertexAttribI4sv, 2, index, v);
+	glad_glVertexAttribI4sv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4sv", (void*)glad_glVertexAttribI4sv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv = glad_debug_impl_glVertexAttribI4sv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4ubv", (void*)glad_glVertexAttribI4ubv, 2, index, v);
+	glad_glVertexAttribI4ubv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4ubv", (void*)glad_glVertexAttribI4ubv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv = glad_debug_impl_glVertexAttribI4ubv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribI4usv", (void*)glad_glVertexAttribI4usv, 2, index, v);
+	glad_glVertexAttribI4usv(index, v);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribI4usv", (void*)glad_glVertexAttribI4usv, 2, index, v);
+}
+PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv = glad_debug_impl_glVertexAttribI4usv;
+static void APIENTRY glad_debug_impl_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetUniformuiv", (void*)glad_glGetUniformuiv, 3, program, location, params);
+	glad_glGetUniformuiv(program, location, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetUniformuiv", (void*)glad_glGetUniformuiv, 3, program, location, params);
+}
+PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv = glad_debug_impl_glGetUniformuiv;
+static void APIENTRY glad_debug_impl_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindFragDataLocation", (void*)glad_glBindFragDataLocation, 3, program, color, name);
+	glad_glBindFragDataLocation(program, color, name);
+	if(_post_call_callback != NULL) _post_call_callback("glBindFragDataLocation", (void*)glad_glBindFragDataLocation, 3, program, color, name);
+}
+PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation = glad_debug_impl_glBindFragDataLocation;
+static GLint APIENTRY glad_debug_impl_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetFragDataLocation", (void*)glad_glGetFragDataLocation, 2, program, name);
+	GLint ret = glad_glGetFragDataLocation(program, name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetFragDataLocation", (void*)glad_glGetFragDataLocation, 2, program, name);
+	return ret;
+}
+PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation = glad_debug_impl_glGetFragDataLocation;
+static void APIENTRY glad_debug_impl_glUniform1ui(GLint location, GLuint v0) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform1ui", (void*)glad_glUniform1ui, 2, location, v0);
+	glad_glUniform1ui(location, v0);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform1ui", (void*)glad_glUniform1ui, 2, location, v0);
+}
+PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui = glad_debug_impl_glUniform1ui;
+static void APIENTRY glad_debug_impl_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform2ui", (void*)glad_glUniform2ui, 3, location, v0, v1);
+	glad_glUniform2ui(location, v0, v1);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform2ui", (void*)glad_glUniform2ui, 3, location, v0, v1);
+}
+PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui = glad_debug_impl_glUniform2ui;
+static void APIENTRY glad_debug_impl_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform3ui", (void*)glad_glUniform3ui, 4, location, v0, v1, v2);
+	glad_glUniform3ui(location, v0, v1, v2);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform3ui", (void*)glad_glUniform3ui, 4, location, v0, v1, v2);
+}
+PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui = glad_debug_impl_glUniform3ui;
+static void APIENTRY glad_debug_impl_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform4ui", (void*)glad_glUniform4ui, 5, location, v0, v1, v2, v3);
+	glad_glUniform4ui(location, v0, v1, v2, v3);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform4ui", (void*)glad_glUniform4ui, 5, location, v0, v1, v2, v3);
+}
+PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui = glad_debug_impl_glUniform4ui;
+static void APIENTRY glad_debug_impl_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform1uiv", (void*)glad_glUniform1uiv, 3, location, count, value);
+	glad_glUniform1uiv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform1uiv", (void*)glad_glUniform1uiv, 3, location, count, value);
+}
+PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv = glad_debug_impl_glUniform1uiv;
+static void APIENTRY glad_debug_impl_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform2uiv", (void*)glad_glUniform2uiv, 3, location, count, value);
+	glad_glUniform2uiv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform2uiv", (void*)glad_glUniform2uiv, 3, location, count, value);
+}
+PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv = glad_debug_impl_glUniform2uiv;
+static void APIENTRY glad_debug_impl_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform3uiv", (void*)glad_glUniform3uiv, 3, location, count, value);
+	glad_glUniform3uiv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform3uiv", (void*)glad_glUniform3uiv, 3, location, count, value);
+}
+PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv = glad_debug_impl_glUniform3uiv;
+static void APIENTRY glad_debug_impl_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniform4uiv", (void*)glad_glUniform4uiv, 3, location, count, value);
+	glad_glUniform4uiv(location, count, value);
+	if(_post_call_callback != NULL) _post_call_callback("glUniform4uiv", (void*)glad_glUniform4uiv, 3, location, count, value);
+}
+PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv = glad_debug_impl_glUniform4uiv;
+static void APIENTRY glad_debug_impl_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexParameterIiv", (void*)glad_glTexParameterIiv, 3, target, pname, params);
+	glad_glTexParameterIiv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexParameterIiv", (void*)glad_glTexParameterIiv, 3, target, pname, params);
+}
+PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv = glad_debug_impl_glTexParameterIiv;
+static void APIENTRY glad_debug_impl_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexParameterIuiv", (void*)glad_glTexParameterIuiv, 3, target, pname, params);
+	glad_glTexParameterIuiv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glTexParameterIuiv", (void*)glad_glTexParameterIuiv, 3, target, pname, params);
+}
+PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv = glad_debug_impl_glTexParameterIuiv;
+static void APIENTRY glad_debug_impl_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexParameterIiv", (void*)glad_glGetTexParameterIiv, 3, target, pname, params);
+	glad_glGetTexParameterIiv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexParameterIiv", (void*)glad_glGetTexParameterIiv, 3, target, pname, params);
+}
+PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv = glad_debug_impl_glGetTexParameterIiv;
+static void APIENTRY glad_debug_impl_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetTexParameterIuiv", (void*)glad_glGetTexParameterIuiv, 3, target, pname, params);
+	glad_glGetTexParameterIuiv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetTexParameterIuiv", (void*)glad_glGetTexParameterIuiv, 3, target, pname, params);
+}
+PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv = glad_debug_impl_glGetTexParameterIuiv;
+static void APIENTRY glad_debug_impl_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearBufferiv", (void*)glad_glClearBufferiv, 3, buffer, drawbuffer, value);
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+	if(_post_call_callback != NULL) _post_call_callback("glClearBufferiv", (void*)glad_glClearBufferiv, 3, buffer, drawbuffer, value);
+}
+PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv = glad_debug_impl_glClearBufferiv;
+static void APIENTRY glad_debug_impl_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearBufferuiv", (void*)glad_glClearBufferuiv, 3, buffer, drawbuffer, value);
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+	if(_post_call_callback != NULL) _post_call_callback("glClearBufferuiv", (void*)glad_glClearBufferuiv, 3, buffer, drawbuffer, value);
+}
+PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv = glad_debug_impl_glClearBufferuiv;
+static void APIENTRY glad_debug_impl_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearBufferfv", (void*)glad_glClearBufferfv, 3, buffer, drawbuffer, value);
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+	if(_post_call_callback != NULL) _post_call_callback("glClearBufferfv", (void*)glad_glClearBufferfv, 3, buffer, drawbuffer, value);
+}
+PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv = glad_debug_impl_glClearBufferfv;
+static void APIENTRY glad_debug_impl_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClearBufferfi", (void*)glad_glClearBufferfi, 4, buffer, drawbuffer, depth, stencil);
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	if(_post_call_callback != NULL) _post_call_callback("glClearBufferfi", (void*)glad_glClearBufferfi, 4, buffer, drawbuffer, depth, stencil);
+}
+PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi = glad_debug_impl_glClearBufferfi;
+static const GLubyte * APIENTRY glad_debug_impl_glGetStringi(GLenum name, GLuint index) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetStringi", (void*)glad_glGetStringi, 2, name, index);
+	const GLubyte * ret = glad_glGetStringi(name, index);
+	if(_post_call_callback != NULL) _post_call_callback("glGetStringi", (void*)glad_glGetStringi, 2, name, index);
+	return ret;
+}
+PFNGLGETSTRINGIPROC glad_debug_glGetStringi = glad_debug_impl_glGetStringi;
+static GLboolean APIENTRY glad_debug_impl_glIsRenderbuffer(GLuint renderbuffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsRenderbuffer", (void*)glad_glIsRenderbuffer, 1, renderbuffer);
+	GLboolean ret = glad_glIsRenderbuffer(renderbuffer);
+	if(_post_call_callback != NULL) _post_call_callback("glIsRenderbuffer", (void*)glad_glIsRenderbuffer, 1, renderbuffer);
+	return ret;
+}
+PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer = glad_debug_impl_glIsRenderbuffer;
+static void APIENTRY glad_debug_impl_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindRenderbuffer", (void*)glad_glBindRenderbuffer, 2, target, renderbuffer);
+	glad_glBindRenderbuffer(target, renderbuffer);
+	if(_post_call_callback != NULL) _post_call_callback("glBindRenderbuffer", (void*)glad_glBindRenderbuffer, 2, target, renderbuffer);
+}
+PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer = glad_debug_impl_glBindRenderbuffer;
+static void APIENTRY glad_debug_impl_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteRenderbuffers", (void*)glad_glDeleteRenderbuffers, 2, n, renderbuffers);
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteRenderbuffers", (void*)glad_glDeleteRenderbuffers, 2, n, renderbuffers);
+}
+PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers = glad_debug_impl_glDeleteRenderbuffers;
+static void APIENTRY glad_debug_impl_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenRenderbuffers", (void*)glad_glGenRenderbuffers, 2, n, renderbuffers);
+	glad_glGenRenderbuffers(n, renderbuffers);
+	if(_post_call_callback != NULL) _post_call_callback("glGenRenderbuffers", (void*)glad_glGenRenderbuffers, 2, n, renderbuffers);
+}
+PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers = glad_debug_impl_glGenRenderbuffers;
+static void APIENTRY glad_debug_impl_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRenderbufferStorage", (void*)glad_glRenderbufferStorage, 4, target, internalformat, width, height);
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+	if(_post_call_callback != NULL) _post_call_callback("glRenderbufferStorage", (void*)glad_glRenderbufferStorage, 4, target, internalformat, width, height);
+}
+PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage = glad_debug_impl_glRenderbufferStorage;
+static void APIENTRY glad_debug_impl_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetRenderbufferParameteriv", (void*)glad_glGetRenderbufferParameteriv, 3, target, pname, params);
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetRenderbufferParameteriv", (void*)glad_glGetRenderbufferParameteriv, 3, target, pname, params);
+}
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv = glad_debug_impl_glGetRenderbufferParameteriv;
+static GLboolean APIENTRY glad_debug_impl_glIsFramebuffer(GLuint framebuffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsFramebuffer", (void*)glad_glIsFramebuffer, 1, framebuffer);
+	GLboolean ret = glad_glIsFramebuffer(framebuffer);
+	if(_post_call_callback != NULL) _post_call_callback("glIsFramebuffer", (void*)glad_glIsFramebuffer, 1, framebuffer);
+	return ret;
+}
+PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer = glad_debug_impl_glIsFramebuffer;
+static void APIENTRY glad_debug_impl_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindFramebuffer", (void*)glad_glBindFramebuffer, 2, target, framebuffer);
+	glad_glBindFramebuffer(target, framebuffer);
+	if(_post_call_callback != NULL) _post_call_callback("glBindFramebuffer", (void*)glad_glBindFramebuffer, 2, target, framebuffer);
+}
+PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer = glad_debug_impl_glBindFramebuffer;
+static void APIENTRY glad_debug_impl_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteFramebuffers", (void*)glad_glDeleteFramebuffers, 2, n, framebuffers);
+	glad_glDeleteFramebuffers(n, framebuffers);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteFramebuffers", (void*)glad_glDeleteFramebuffers, 2, n, framebuffers);
+}
+PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers = glad_debug_impl_glDeleteFramebuffers;
+static void APIENTRY glad_debug_impl_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenFramebuffers", (void*)glad_glGenFramebuffers, 2, n, framebuffers);
+	glad_glGenFramebuffers(n, framebuffers);
+	if(_post_call_callback != NULL) _post_call_callback("glGenFramebuffers", (void*)glad_glGenFramebuffers, 2, n, framebuffers);
+}
+PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers = glad_debug_impl_glGenFramebuffers;
+static GLenum APIENTRY glad_debug_impl_glCheckFramebufferStatus(GLenum target) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCheckFramebufferStatus", (void*)glad_glCheckFramebufferStatus, 1, target);
+	GLenum ret = glad_glCheckFramebufferStatus(target);
+	if(_post_call_callback != NULL) _post_call_callback("glCheckFramebufferStatus", (void*)glad_glCheckFramebufferStatus, 1, target);
+	return ret;
+}
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus = glad_debug_impl_glCheckFramebufferStatus;
+static void APIENTRY glad_debug_impl_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFramebufferTexture1D", (void*)glad_glFramebufferTexture1D, 5, target, attachment, textarget, texture, level);
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	if(_post_call_callback != NULL) _post_call_callback("glFramebufferTexture1D", (void*)glad_glFramebufferTexture1D, 5, target, attachment, textarget, texture, level);
+}
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D = glad_debug_impl_glFramebufferTexture1D;
+static void APIENTRY glad_debug_impl_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFramebufferTexture2D", (void*)glad_glFramebufferTexture2D, 5, target, attachment, textarget, texture, level);
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	if(_post_call_callback != NULL) _post_call_callback("glFramebufferTexture2D", (void*)glad_glFramebufferTexture2D, 5, target, attachment, textarget, texture, level);
+}
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D = glad_debug_impl_glFramebufferTexture2D;
+static void APIENTRY glad_debug_impl_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFramebufferTexture3D", (void*)glad_glFramebufferTexture3D, 6, target, attachment, textarget, texture, level, zoffset);
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	if(_post_call_callback != NULL) _post_call_callback("glFramebufferTexture3D", (void*)glad_glFramebufferTexture3D, 6, target, attachment, textarget, texture, level, zoffset);
+}
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D = glad_debug_impl_glFramebufferTexture3D;
+static void APIENTRY glad_debug_impl_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFramebufferRenderbuffer", (void*)glad_glFramebufferRenderbuffer, 4, target, attachment, renderbuffertarget, renderbuffer);
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	if(_post_call_callback != NULL) _post_call_callback("glFramebufferRenderbuffer", (void*)glad_glFramebufferRenderbuffer, 4, target, attachment, renderbuffertarget, renderbuffer);
+}
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer = glad_debug_impl_glFramebufferRenderbuffer;
+static void APIENTRY glad_debug_impl_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_glGetFramebufferAttachmentParameteriv, 4, target, attachment, pname, params);
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_glGetFramebufferAttachmentParameteriv, 4, target, attachment, pname, params);
+}
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv = glad_debug_impl_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY glad_debug_impl_glGenerateMipmap(GLenum target) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenerateMipmap", (void*)glad_glGenerateMipmap, 1, target);
+	glad_glGenerateMipmap(target);
+	if(_post_call_callback != NULL) _post_call_callback("glGenerateMipmap", (void*)glad_glGenerateMipmap, 1, target);
+}
+PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap = glad_debug_impl_glGenerateMipmap;
+static void APIENTRY glad_debug_impl_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBlitFramebuffer", (void*)glad_glBlitFramebuffer, 10, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	if(_post_call_callback != NULL) _post_call_callback("glBlitFramebuffer", (void*)glad_glBlitFramebuffer, 10, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer = glad_debug_impl_glBlitFramebuffer;
+static void APIENTRY glad_debug_impl_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glRenderbufferStorageMultisample", (void*)glad_glRenderbufferStorageMultisample, 5, target, samples, internalformat, width, height);
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	if(_post_call_callback != NULL) _post_call_callback("glRenderbufferStorageMultisample", (void*)glad_glRenderbufferStorageMultisample, 5, target, samples, internalformat, width, height);
+}
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample = glad_debug_impl_glRenderbufferStorageMultisample;
+static void APIENTRY glad_debug_impl_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFramebufferTextureLayer", (void*)glad_glFramebufferTextureLayer, 5, target, attachment, texture, level, layer);
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	if(_post_call_callback != NULL) _post_call_callback("glFramebufferTextureLayer", (void*)glad_glFramebufferTextureLayer, 5, target, attachment, texture, level, layer);
+}
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer = glad_debug_impl_glFramebufferTextureLayer;
+static void * APIENTRY glad_debug_impl_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMapBufferRange", (void*)glad_glMapBufferRange, 4, target, offset, length, access);
+	void * ret = glad_glMapBufferRange(target, offset, length, access);
+	if(_post_call_callback != NULL) _post_call_callback("glMapBufferRange", (void*)glad_glMapBufferRange, 4, target, offset, length, access);
+	return ret;
+}
+PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange = glad_debug_impl_glMapBufferRange;
+static void APIENTRY glad_debug_impl_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFlushMappedBufferRange", (void*)glad_glFlushMappedBufferRange, 3, target, offset, length);
+	glad_glFlushMappedBufferRange(target, offset, length);
+	if(_post_call_callback != NULL) _post_call_callback("glFlushMappedBufferRange", (void*)glad_glFlushMappedBufferRange, 3, target, offset, length);
+}
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange = glad_debug_impl_glFlushMappedBufferRange;
+static void APIENTRY glad_debug_impl_glBindVertexArray(GLuint array) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindVertexArray", (void*)glad_glBindVertexArray, 1, array);
+	glad_glBindVertexArray(array);
+	if(_post_call_callback != NULL) _post_call_callback("glBindVertexArray", (void*)glad_glBindVertexArray, 1, array);
+}
+PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray = glad_debug_impl_glBindVertexArray;
+static void APIENTRY glad_debug_impl_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteVertexArrays", (void*)glad_glDeleteVertexArrays, 2, n, arrays);
+	glad_glDeleteVertexArrays(n, arrays);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteVertexArrays", (void*)glad_glDeleteVertexArrays, 2, n, arrays);
+}
+PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays = glad_debug_impl_glDeleteVertexArrays;
+static void APIENTRY glad_debug_impl_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenVertexArrays", (void*)glad_glGenVertexArrays, 2, n, arrays);
+	glad_glGenVertexArrays(n, arrays);
+	if(_post_call_callback != NULL) _post_call_callback("glGenVertexArrays", (void*)glad_glGenVertexArrays, 2, n, arrays);
+}
+PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays = glad_debug_impl_glGenVertexArrays;
+static GLboolean APIENTRY glad_debug_impl_glIsVertexArray(GLuint array) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsVertexArray", (void*)glad_glIsVertexArray, 1, array);
+	GLboolean ret = glad_glIsVertexArray(array);
+	if(_post_call_callback != NULL) _post_call_callback("glIsVertexArray", (void*)glad_glIsVertexArray, 1, array);
+	return ret;
+}
+PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray = glad_debug_impl_glIsVertexArray;
+static void APIENTRY glad_debug_impl_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawArraysInstanced", (void*)glad_glDrawArraysInstanced, 4, mode, first, count, instancecount);
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawArraysInstanced", (void*)glad_glDrawArraysInstanced, 4, mode, first, count, instancecount);
+}
+PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced = glad_debug_impl_glDrawArraysInstanced;
+static void APIENTRY glad_debug_impl_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawElementsInstanced", (void*)glad_glDrawElementsInstanced, 5, mode, count, type, indices, instancecount);
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawElementsInstanced", (void*)glad_glDrawElementsInstanced, 5, mode, count, type, indices, instancecount);
+}
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced = glad_debug_impl_glDrawElementsInstanced;
+static void APIENTRY glad_debug_impl_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexBuffer", (void*)glad_glTexBuffer, 3, target, internalformat, buffer);
+	glad_glTexBuffer(target, internalformat, buffer);
+	if(_post_call_callback != NULL) _post_call_callback("glTexBuffer", (void*)glad_glTexBuffer, 3, target, internalformat, buffer);
+}
+PFNGLTEXBUFFERPROC glad_debug_glTexBuffer = glad_debug_impl_glTexBuffer;
+static void APIENTRY glad_debug_impl_glPrimitiveRestartIndex(GLuint index) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glPrimitiveRestartIndex", (void*)glad_glPrimitiveRestartIndex, 1, index);
+	glad_glPrimitiveRestartIndex(index);
+	if(_post_call_callback != NULL) _post_call_callback("glPrimitiveRestartIndex", (void*)glad_glPrimitiveRestartIndex, 1, index);
+}
+PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex = glad_debug_impl_glPrimitiveRestartIndex;
+static void APIENTRY glad_debug_impl_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glCopyBufferSubData", (void*)glad_glCopyBufferSubData, 5, readTarget, writeTarget, readOffset, writeOffset, size);
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	if(_post_call_callback != NULL) _post_call_callback("glCopyBufferSubData", (void*)glad_glCopyBufferSubData, 5, readTarget, writeTarget, readOffset, writeOffset, size);
+}
+PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData = glad_debug_impl_glCopyBufferSubData;
+static void APIENTRY glad_debug_impl_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetUniformIndices", (void*)glad_glGetUniformIndices, 4, program, uniformCount, uniformNames, uniformIndices);
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	if(_post_call_callback != NULL) _post_call_callback("glGetUniformIndices", (void*)glad_glGetUniformIndices, 4, program, uniformCount, uniformNames, uniformIndices);
+}
+PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices = glad_debug_impl_glGetUniformIndices;
+static void APIENTRY glad_debug_impl_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetActiveUniformsiv", (void*)glad_glGetActiveUniformsiv, 5, program, uniformCount, uniformIndices, pname, params);
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetActiveUniformsiv", (void*)glad_glGetActiveUniformsiv, 5, program, uniformCount, uniformIndices, pname, params);
+}
+PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv = glad_debug_impl_glGetActiveUniformsiv;
+static void APIENTRY glad_debug_impl_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetActiveUniformName", (void*)glad_glGetActiveUniformName, 5, program, uniformIndex, bufSize, length, uniformName);
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	if(_post_call_callback != NULL) _post_call_callback("glGetActiveUniformName", (void*)glad_glGetActiveUniformName, 5, program, uniformIndex, bufSize, length, uniformName);
+}
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName = glad_debug_impl_glGetActiveUniformName;
+static GLuint APIENTRY glad_debug_impl_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetUniformBlockIndex", (void*)glad_glGetUniformBlockIndex, 2, program, uniformBlockName);
+	GLuint ret = glad_glGetUniformBlockIndex(program, uniformBlockName);
+	if(_post_call_callback != NULL) _post_call_callback("glGetUniformBlockIndex", (void*)glad_glGetUniformBlockIndex, 2, program, uniformBlockName);
+	return ret;
+}
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex = glad_debug_impl_glGetUniformBlockIndex;
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetActiveUniformBlockiv", (void*)glad_glGetActiveUniformBlockiv, 4, program, uniformBlockIndex, pname, params);
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetActiveUniformBlockiv", (void*)glad_glGetActiveUniformBlockiv, 4, program, uniformBlockIndex, pname, params);
+}
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv = glad_debug_impl_glGetActiveUniformBlockiv;
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetActiveUniformBlockName", (void*)glad_glGetActiveUniformBlockName, 5, program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	if(_post_call_callback != NULL) _post_call_callback("glGetActiveUniformBlockName", (void*)glad_glGetActiveUniformBlockName, 5, program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName = glad_debug_impl_glGetActiveUniformBlockName;
+static void APIENTRY glad_debug_impl_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glUniformBlockBinding", (void*)glad_glUniformBlockBinding, 3, program, uniformBlockIndex, uniformBlockBinding);
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	if(_post_call_callback != NULL) _post_call_callback("glUniformBlockBinding", (void*)glad_glUniformBlockBinding, 3, program, uniformBlockIndex, uniformBlockBinding);
+}
+PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding = glad_debug_impl_glUniformBlockBinding;
+static void APIENTRY glad_debug_impl_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawElementsBaseVertex", (void*)glad_glDrawElementsBaseVertex, 5, mode, count, type, indices, basevertex);
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawElementsBaseVertex", (void*)glad_glDrawElementsBaseVertex, 5, mode, count, type, indices, basevertex);
+}
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex = glad_debug_impl_glDrawElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawRangeElementsBaseVertex", (void*)glad_glDrawRangeElementsBaseVertex, 7, mode, start, end, count, type, indices, basevertex);
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawRangeElementsBaseVertex", (void*)glad_glDrawRangeElementsBaseVertex, 7, mode, start, end, count, type, indices, basevertex);
+}
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex = glad_debug_impl_glDrawRangeElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDrawElementsInstancedBaseVertex", (void*)glad_glDrawElementsInstancedBaseVertex, 6, mode, count, type, indices, instancecount, basevertex);
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	if(_post_call_callback != NULL) _post_call_callback("glDrawElementsInstancedBaseVertex", (void*)glad_glDrawElementsInstancedBaseVertex, 6, mode, count, type, indices, instancecount, basevertex);
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex = glad_debug_impl_glDrawElementsInstancedBaseVertex;
+static void APIENTRY glad_debug_impl_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiDrawElementsBaseVertex", (void*)glad_glMultiDrawElementsBaseVertex, 6, mode, count, type, indices, drawcount, basevertex);
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiDrawElementsBaseVertex", (void*)glad_glMultiDrawElementsBaseVertex, 6, mode, count, type, indices, drawcount, basevertex);
+}
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex = glad_debug_impl_glMultiDrawElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glProvokingVertex(GLenum mode) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glProvokingVertex", (void*)glad_glProvokingVertex, 1, mode);
+	glad_glProvokingVertex(mode);
+	if(_post_call_callback != NULL) _post_call_callback("glProvokingVertex", (void*)glad_glProvokingVertex, 1, mode);
+}
+PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex = glad_debug_impl_glProvokingVertex;
+static GLsync APIENTRY glad_debug_impl_glFenceSync(GLenum condition, GLbitfield flags) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFenceSync", (void*)glad_glFenceSync, 2, condition, flags);
+	GLsync ret = glad_glFenceSync(condition, flags);
+	if(_post_call_callback != NULL) _post_call_callback("glFenceSync", (void*)glad_glFenceSync, 2, condition, flags);
+	return ret;
+}
+PFNGLFENCESYNCPROC glad_debug_glFenceSync = glad_debug_impl_glFenceSync;
+static GLboolean APIENTRY glad_debug_impl_glIsSync(GLsync sync) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsSync", (void*)glad_glIsSync, 1, sync);
+	GLboolean ret = glad_glIsSync(sync);
+	if(_post_call_callback != NULL) _post_call_callback("glIsSync", (void*)glad_glIsSync, 1, sync);
+	return ret;
+}
+PFNGLISSYNCPROC glad_debug_glIsSync = glad_debug_impl_glIsSync;
+static void APIENTRY glad_debug_impl_glDeleteSync(GLsync sync) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteSync", (void*)glad_glDeleteSync, 1, sync);
+	glad_glDeleteSync(sync);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteSync", (void*)glad_glDeleteSync, 1, sync);
+}
+PFNGLDELETESYNCPROC glad_debug_glDeleteSync = glad_debug_impl_glDeleteSync;
+static GLenum APIENTRY glad_debug_impl_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glClientWaitSync", (void*)glad_glClientWaitSync, 3, sync, flags, timeout);
+	GLenum ret = glad_glClientWaitSync(sync, flags, timeout);
+	if(_post_call_callback != NULL) _post_call_callback("glClientWaitSync", (void*)glad_glClientWaitSync, 3, sync, flags, timeout);
+	return ret;
+}
+PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync = glad_debug_impl_glClientWaitSync;
+static void APIENTRY glad_debug_impl_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glWaitSync", (void*)glad_glWaitSync, 3, sync, flags, timeout);
+	glad_glWaitSync(sync, flags, timeout);
+	if(_post_call_callback != NULL) _post_call_callback("glWaitSync", (void*)glad_glWaitSync, 3, sync, flags, timeout);
+}
+PFNGLWAITSYNCPROC glad_debug_glWaitSync = glad_debug_impl_glWaitSync;
+static void APIENTRY glad_debug_impl_glGetInteger64v(GLenum pname, GLint64 *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetInteger64v", (void*)glad_glGetInteger64v, 2, pname, data);
+	glad_glGetInteger64v(pname, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetInteger64v", (void*)glad_glGetInteger64v, 2, pname, data);
+}
+PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v = glad_debug_impl_glGetInteger64v;
+static void APIENTRY glad_debug_impl_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetSynciv", (void*)glad_glGetSynciv, 5, sync, pname, count, length, values);
+	glad_glGetSynciv(sync, pname, count, length, values);
+	if(_post_call_callback != NULL) _post_call_callback("glGetSynciv", (void*)glad_glGetSynciv, 5, sync, pname, count, length, values);
+}
+PFNGLGETSYNCIVPROC glad_debug_glGetSynciv = glad_debug_impl_glGetSynciv;
+static void APIENTRY glad_debug_impl_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetInteger64i_v", (void*)glad_glGetInteger64i_v, 3, target, index, data);
+	glad_glGetInteger64i_v(target, index, data);
+	if(_post_call_callback != NULL) _post_call_callback("glGetInteger64i_v", (void*)glad_glGetInteger64i_v, 3, target, index, data);
+}
+PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v = glad_debug_impl_glGetInteger64i_v;
+static void APIENTRY glad_debug_impl_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetBufferParameteri64v", (void*)glad_glGetBufferParameteri64v, 3, target, pname, params);
+	glad_glGetBufferParameteri64v(target, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetBufferParameteri64v", (void*)glad_glGetBufferParameteri64v, 3, target, pname, params);
+}
+PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v = glad_debug_impl_glGetBufferParameteri64v;
+static void APIENTRY glad_debug_impl_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glFramebufferTexture", (void*)glad_glFramebufferTexture, 4, target, attachment, texture, level);
+	glad_glFramebufferTexture(target, attachment, texture, level);
+	if(_post_call_callback != NULL) _post_call_callback("glFramebufferTexture", (void*)glad_glFramebufferTexture, 4, target, attachment, texture, level);
+}
+PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture = glad_debug_impl_glFramebufferTexture;
+static void APIENTRY glad_debug_impl_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexImage2DMultisample", (void*)glad_glTexImage2DMultisample, 6, target, samples, internalformat, width, height, fixedsamplelocations);
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	if(_post_call_callback != NULL) _post_call_callback("glTexImage2DMultisample", (void*)glad_glTexImage2DMultisample, 6, target, samples, internalformat, width, height, fixedsamplelocations);
+}
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample = glad_debug_impl_glTexImage2DMultisample;
+static void APIENTRY glad_debug_impl_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexImage3DMultisample", (void*)glad_glTexImage3DMultisample, 7, target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if(_post_call_callback != NULL) _post_call_callback("glTexImage3DMultisample", (void*)glad_glTexImage3DMultisample, 7, target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample = glad_debug_impl_glTexImage3DMultisample;
+static void APIENTRY glad_debug_impl_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetMultisamplefv", (void*)glad_glGetMultisamplefv, 3, pname, index, val);
+	glad_glGetMultisamplefv(pname, index, val);
+	if(_post_call_callback != NULL) _post_call_callback("glGetMultisamplefv", (void*)glad_glGetMultisamplefv, 3, pname, index, val);
+}
+PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv = glad_debug_impl_glGetMultisamplefv;
+static void APIENTRY glad_debug_impl_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSampleMaski", (void*)glad_glSampleMaski, 2, maskNumber, mask);
+	glad_glSampleMaski(maskNumber, mask);
+	if(_post_call_callback != NULL) _post_call_callback("glSampleMaski", (void*)glad_glSampleMaski, 2, maskNumber, mask);
+}
+PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski = glad_debug_impl_glSampleMaski;
+static void APIENTRY glad_debug_impl_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindFragDataLocationIndexed", (void*)glad_glBindFragDataLocationIndexed, 4, program, colorNumber, index, name);
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	if(_post_call_callback != NULL) _post_call_callback("glBindFragDataLocationIndexed", (void*)glad_glBindFragDataLocationIndexed, 4, program, colorNumber, index, name);
+}
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed = glad_debug_impl_glBindFragDataLocationIndexed;
+static GLint APIENTRY glad_debug_impl_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetFragDataIndex", (void*)glad_glGetFragDataIndex, 2, program, name);
+	GLint ret = glad_glGetFragDataIndex(program, name);
+	if(_post_call_callback != NULL) _post_call_callback("glGetFragDataIndex", (void*)glad_glGetFragDataIndex, 2, program, name);
+	return ret;
+}
+PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex = glad_debug_impl_glGetFragDataIndex;
+static void APIENTRY glad_debug_impl_glGenSamplers(GLsizei count, GLuint *samplers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGenSamplers", (void*)glad_glGenSamplers, 2, count, samplers);
+	glad_glGenSamplers(count, samplers);
+	if(_post_call_callback != NULL) _post_call_callback("glGenSamplers", (void*)glad_glGenSamplers, 2, count, samplers);
+}
+PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers = glad_debug_impl_glGenSamplers;
+static void APIENTRY glad_debug_impl_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glDeleteSamplers", (void*)glad_glDeleteSamplers, 2, count, samplers);
+	glad_glDeleteSamplers(count, samplers);
+	if(_post_call_callback != NULL) _post_call_callback("glDeleteSamplers", (void*)glad_glDeleteSamplers, 2, count, samplers);
+}
+PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers = glad_debug_impl_glDeleteSamplers;
+static GLboolean APIENTRY glad_debug_impl_glIsSampler(GLuint sampler) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glIsSampler", (void*)glad_glIsSampler, 1, sampler);
+	GLboolean ret = glad_glIsSampler(sampler);
+	if(_post_call_callback != NULL) _post_call_callback("glIsSampler", (void*)glad_glIsSampler, 1, sampler);
+	return ret;
+}
+PFNGLISSAMPLERPROC glad_debug_glIsSampler = glad_debug_impl_glIsSampler;
+static void APIENTRY glad_debug_impl_glBindSampler(GLuint unit, GLuint sampler) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glBindSampler", (void*)glad_glBindSampler, 2, unit, sampler);
+	glad_glBindSampler(unit, sampler);
+	if(_post_call_callback != NULL) _post_call_callback("glBindSampler", (void*)glad_glBindSampler, 2, unit, sampler);
+}
+PFNGLBINDSAMPLERPROC glad_debug_glBindSampler = glad_debug_impl_glBindSampler;
+static void APIENTRY glad_debug_impl_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSamplerParameteri", (void*)glad_glSamplerParameteri, 3, sampler, pname, param);
+	glad_glSamplerParameteri(sampler, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glSamplerParameteri", (void*)glad_glSamplerParameteri, 3, sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri = glad_debug_impl_glSamplerParameteri;
+static void APIENTRY glad_debug_impl_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSamplerParameteriv", (void*)glad_glSamplerParameteriv, 3, sampler, pname, param);
+	glad_glSamplerParameteriv(sampler, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glSamplerParameteriv", (void*)glad_glSamplerParameteriv, 3, sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv = glad_debug_impl_glSamplerParameteriv;
+static void APIENTRY glad_debug_impl_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSamplerParameterf", (void*)glad_glSamplerParameterf, 3, sampler, pname, param);
+	glad_glSamplerParameterf(sampler, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glSamplerParameterf", (void*)glad_glSamplerParameterf, 3, sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf = glad_debug_impl_glSamplerParameterf;
+static void APIENTRY glad_debug_impl_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSamplerParameterfv", (void*)glad_glSamplerParameterfv, 3, sampler, pname, param);
+	glad_glSamplerParameterfv(sampler, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glSamplerParameterfv", (void*)glad_glSamplerParameterfv, 3, sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv = glad_debug_impl_glSamplerParameterfv;
+static void APIENTRY glad_debug_impl_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSamplerParameterIiv", (void*)glad_glSamplerParameterIiv, 3, sampler, pname, param);
+	glad_glSamplerParameterIiv(sampler, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glSamplerParameterIiv", (void*)glad_glSamplerParameterIiv, 3, sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv = glad_debug_impl_glSamplerParameterIiv;
+static void APIENTRY glad_debug_impl_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSamplerParameterIuiv", (void*)glad_glSamplerParameterIuiv, 3, sampler, pname, param);
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+	if(_post_call_callback != NULL) _post_call_callback("glSamplerParameterIuiv", (void*)glad_glSamplerParameterIuiv, 3, sampler, pname, param);
+}
+PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv = glad_debug_impl_glSamplerParameterIuiv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetSamplerParameteriv", (void*)glad_glGetSamplerParameteriv, 3, sampler, pname, params);
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetSamplerParameteriv", (void*)glad_glGetSamplerParameteriv, 3, sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv = glad_debug_impl_glGetSamplerParameteriv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetSamplerParameterIiv", (void*)glad_glGetSamplerParameterIiv, 3, sampler, pname, params);
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetSamplerParameterIiv", (void*)glad_glGetSamplerParameterIiv, 3, sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv = glad_debug_impl_glGetSamplerParameterIiv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetSamplerParameterfv", (void*)glad_glGetSamplerParameterfv, 3, sampler, pname, params);
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetSamplerParameterfv", (void*)glad_glGetSamplerParameterfv, 3, sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv = glad_debug_impl_glGetSamplerParameterfv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetSamplerParameterIuiv", (void*)glad_glGetSamplerParameterIuiv, 3, sampler, pname, params);
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetSamplerParameterIuiv", (void*)glad_glGetSamplerParameterIuiv, 3, sampler, pname, params);
+}
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv = glad_debug_impl_glGetSamplerParameterIuiv;
+static void APIENTRY glad_debug_impl_glQueryCounter(GLuint id, GLenum target) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glQueryCounter", (void*)glad_glQueryCounter, 2, id, target);
+	glad_glQueryCounter(id, target);
+	if(_post_call_callback != NULL) _post_call_callback("glQueryCounter", (void*)glad_glQueryCounter, 2, id, target);
+}
+PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter = glad_debug_impl_glQueryCounter;
+static void APIENTRY glad_debug_impl_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetQueryObjecti64v", (void*)glad_glGetQueryObjecti64v, 3, id, pname, params);
+	glad_glGetQueryObjecti64v(id, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetQueryObjecti64v", (void*)glad_glGetQueryObjecti64v, 3, id, pname, params);
+}
+PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v = glad_debug_impl_glGetQueryObjecti64v;
+static void APIENTRY glad_debug_impl_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glGetQueryObjectui64v", (void*)glad_glGetQueryObjectui64v, 3, id, pname, params);
+	glad_glGetQueryObjectui64v(id, pname, params);
+	if(_post_call_callback != NULL) _post_call_callback("glGetQueryObjectui64v", (void*)glad_glGetQueryObjectui64v, 3, id, pname, params);
+}
+PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v = glad_debug_impl_glGetQueryObjectui64v;
+static void APIENTRY glad_debug_impl_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribDivisor", (void*)glad_glVertexAttribDivisor, 2, index, divisor);
+	glad_glVertexAttribDivisor(index, divisor);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribDivisor", (void*)glad_glVertexAttribDivisor, 2, index, divisor);
+}
+PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor = glad_debug_impl_glVertexAttribDivisor;
+static void APIENTRY glad_debug_impl_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP1ui", (void*)glad_glVertexAttribP1ui, 4, index, type, normalized, value);
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP1ui", (void*)glad_glVertexAttribP1ui, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui = glad_debug_impl_glVertexAttribP1ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP1uiv", (void*)glad_glVertexAttribP1uiv, 4, index, type, normalized, value);
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP1uiv", (void*)glad_glVertexAttribP1uiv, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv = glad_debug_impl_glVertexAttribP1uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP2ui", (void*)glad_glVertexAttribP2ui, 4, index, type, normalized, value);
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP2ui", (void*)glad_glVertexAttribP2ui, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui = glad_debug_impl_glVertexAttribP2ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP2uiv", (void*)glad_glVertexAttribP2uiv, 4, index, type, normalized, value);
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP2uiv", (void*)glad_glVertexAttribP2uiv, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv = glad_debug_impl_glVertexAttribP2uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP3ui", (void*)glad_glVertexAttribP3ui, 4, index, type, normalized, value);
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP3ui", (void*)glad_glVertexAttribP3ui, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui = glad_debug_impl_glVertexAttribP3ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP3uiv", (void*)glad_glVertexAttribP3uiv, 4, index, type, normalized, value);
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP3uiv", (void*)glad_glVertexAttribP3uiv, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv = glad_debug_impl_glVertexAttribP3uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP4ui", (void*)glad_glVertexAttribP4ui, 4, index, type, normalized, value);
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP4ui", (void*)glad_glVertexAttribP4ui, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui = glad_debug_impl_glVertexAttribP4ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexAttribP4uiv", (void*)glad_glVertexAttribP4uiv, 4, index, type, normalized, value);
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexAttribP4uiv", (void*)glad_glVertexAttribP4uiv, 4, index, type, normalized, value);
+}
+PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv = glad_debug_impl_glVertexAttribP4uiv;
+static void APIENTRY glad_debug_impl_glVertexP2ui(GLenum type, GLuint value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexP2ui", (void*)glad_glVertexP2ui, 2, type, value);
+	glad_glVertexP2ui(type, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexP2ui", (void*)glad_glVertexP2ui, 2, type, value);
+}
+PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui = glad_debug_impl_glVertexP2ui;
+static void APIENTRY glad_debug_impl_glVertexP2uiv(GLenum type, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexP2uiv", (void*)glad_glVertexP2uiv, 2, type, value);
+	glad_glVertexP2uiv(type, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexP2uiv", (void*)glad_glVertexP2uiv, 2, type, value);
+}
+PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv = glad_debug_impl_glVertexP2uiv;
+static void APIENTRY glad_debug_impl_glVertexP3ui(GLenum type, GLuint value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexP3ui", (void*)glad_glVertexP3ui, 2, type, value);
+	glad_glVertexP3ui(type, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexP3ui", (void*)glad_glVertexP3ui, 2, type, value);
+}
+PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui = glad_debug_impl_glVertexP3ui;
+static void APIENTRY glad_debug_impl_glVertexP3uiv(GLenum type, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexP3uiv", (void*)glad_glVertexP3uiv, 2, type, value);
+	glad_glVertexP3uiv(type, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexP3uiv", (void*)glad_glVertexP3uiv, 2, type, value);
+}
+PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv = glad_debug_impl_glVertexP3uiv;
+static void APIENTRY glad_debug_impl_glVertexP4ui(GLenum type, GLuint value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexP4ui", (void*)glad_glVertexP4ui, 2, type, value);
+	glad_glVertexP4ui(type, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexP4ui", (void*)glad_glVertexP4ui, 2, type, value);
+}
+PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui = glad_debug_impl_glVertexP4ui;
+static void APIENTRY glad_debug_impl_glVertexP4uiv(GLenum type, const GLuint *value) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glVertexP4uiv", (void*)glad_glVertexP4uiv, 2, type, value);
+	glad_glVertexP4uiv(type, value);
+	if(_post_call_callback != NULL) _post_call_callback("glVertexP4uiv", (void*)glad_glVertexP4uiv, 2, type, value);
+}
+PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv = glad_debug_impl_glVertexP4uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP1ui(GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP1ui", (void*)glad_glTexCoordP1ui, 2, type, coords);
+	glad_glTexCoordP1ui(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP1ui", (void*)glad_glTexCoordP1ui, 2, type, coords);
+}
+PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui = glad_debug_impl_glTexCoordP1ui;
+static void APIENTRY glad_debug_impl_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP1uiv", (void*)glad_glTexCoordP1uiv, 2, type, coords);
+	glad_glTexCoordP1uiv(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP1uiv", (void*)glad_glTexCoordP1uiv, 2, type, coords);
+}
+PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv = glad_debug_impl_glTexCoordP1uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP2ui(GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP2ui", (void*)glad_glTexCoordP2ui, 2, type, coords);
+	glad_glTexCoordP2ui(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP2ui", (void*)glad_glTexCoordP2ui, 2, type, coords);
+}
+PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui = glad_debug_impl_glTexCoordP2ui;
+static void APIENTRY glad_debug_impl_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP2uiv", (void*)glad_glTexCoordP2uiv, 2, type, coords);
+	glad_glTexCoordP2uiv(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP2uiv", (void*)glad_glTexCoordP2uiv, 2, type, coords);
+}
+PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv = glad_debug_impl_glTexCoordP2uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP3ui(GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP3ui", (void*)glad_glTexCoordP3ui, 2, type, coords);
+	glad_glTexCoordP3ui(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP3ui", (void*)glad_glTexCoordP3ui, 2, type, coords);
+}
+PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui = glad_debug_impl_glTexCoordP3ui;
+static void APIENTRY glad_debug_impl_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP3uiv", (void*)glad_glTexCoordP3uiv, 2, type, coords);
+	glad_glTexCoordP3uiv(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP3uiv", (void*)glad_glTexCoordP3uiv, 2, type, coords);
+}
+PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv = glad_debug_impl_glTexCoordP3uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP4ui(GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP4ui", (void*)glad_glTexCoordP4ui, 2, type, coords);
+	glad_glTexCoordP4ui(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP4ui", (void*)glad_glTexCoordP4ui, 2, type, coords);
+}
+PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui = glad_debug_impl_glTexCoordP4ui;
+static void APIENTRY glad_debug_impl_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glTexCoordP4uiv", (void*)glad_glTexCoordP4uiv, 2, type, coords);
+	glad_glTexCoordP4uiv(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glTexCoordP4uiv", (void*)glad_glTexCoordP4uiv, 2, type, coords);
+}
+PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv = glad_debug_impl_glTexCoordP4uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP1ui", (void*)glad_glMultiTexCoordP1ui, 3, texture, type, coords);
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP1ui", (void*)glad_glMultiTexCoordP1ui, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui = glad_debug_impl_glMultiTexCoordP1ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP1uiv", (void*)glad_glMultiTexCoordP1uiv, 3, texture, type, coords);
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP1uiv", (void*)glad_glMultiTexCoordP1uiv, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv = glad_debug_impl_glMultiTexCoordP1uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP2ui", (void*)glad_glMultiTexCoordP2ui, 3, texture, type, coords);
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP2ui", (void*)glad_glMultiTexCoordP2ui, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui = glad_debug_impl_glMultiTexCoordP2ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP2uiv", (void*)glad_glMultiTexCoordP2uiv, 3, texture, type, coords);
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP2uiv", (void*)glad_glMultiTexCoordP2uiv, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv = glad_debug_impl_glMultiTexCoordP2uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP3ui", (void*)glad_glMultiTexCoordP3ui, 3, texture, type, coords);
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP3ui", (void*)glad_glMultiTexCoordP3ui, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui = glad_debug_impl_glMultiTexCoordP3ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP3uiv", (void*)glad_glMultiTexCoordP3uiv, 3, texture, type, coords);
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP3uiv", (void*)glad_glMultiTexCoordP3uiv, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv = glad_debug_impl_glMultiTexCoordP3uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP4ui", (void*)glad_glMultiTexCoordP4ui, 3, texture, type, coords);
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP4ui", (void*)glad_glMultiTexCoordP4ui, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui = glad_debug_impl_glMultiTexCoordP4ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glMultiTexCoordP4uiv", (void*)glad_glMultiTexCoordP4uiv, 3, texture, type, coords);
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glMultiTexCoordP4uiv", (void*)glad_glMultiTexCoordP4uiv, 3, texture, type, coords);
+}
+PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv = glad_debug_impl_glMultiTexCoordP4uiv;
+static void APIENTRY glad_debug_impl_glNormalP3ui(GLenum type, GLuint coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormalP3ui", (void*)glad_glNormalP3ui, 2, type, coords);
+	glad_glNormalP3ui(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glNormalP3ui", (void*)glad_glNormalP3ui, 2, type, coords);
+}
+PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui = glad_debug_impl_glNormalP3ui;
+static void APIENTRY glad_debug_impl_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glNormalP3uiv", (void*)glad_glNormalP3uiv, 2, type, coords);
+	glad_glNormalP3uiv(type, coords);
+	if(_post_call_callback != NULL) _post_call_callback("glNormalP3uiv", (void*)glad_glNormalP3uiv, 2, type, coords);
+}
+PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv = glad_debug_impl_glNormalP3uiv;
+static void APIENTRY glad_debug_impl_glColorP3ui(GLenum type, GLuint color) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorP3ui", (void*)glad_glColorP3ui, 2, type, color);
+	glad_glColorP3ui(type, color);
+	if(_post_call_callback != NULL) _post_call_callback("glColorP3ui", (void*)glad_glColorP3ui, 2, type, color);
+}
+PFNGLCOLORP3UIPROC glad_debug_glColorP3ui = glad_debug_impl_glColorP3ui;
+static void APIENTRY glad_debug_impl_glColorP3uiv(GLenum type, const GLuint *color) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorP3uiv", (void*)glad_glColorP3uiv, 2, type, color);
+	glad_glColorP3uiv(type, color);
+	if(_post_call_callback != NULL) _post_call_callback("glColorP3uiv", (void*)glad_glColorP3uiv, 2, type, color);
+}
+PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv = glad_debug_impl_glColorP3uiv;
+static void APIENTRY glad_debug_impl_glColorP4ui(GLenum type, GLuint color) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorP4ui", (void*)glad_glColorP4ui, 2, type, color);
+	glad_glColorP4ui(type, color);
+	if(_post_call_callback != NULL) _post_call_callback("glColorP4ui", (void*)glad_glColorP4ui, 2, type, color);
+}
+PFNGLCOLORP4UIPROC glad_debug_glColorP4ui = glad_debug_impl_glColorP4ui;
+static void APIENTRY glad_debug_impl_glColorP4uiv(GLenum type, const GLuint *color) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glColorP4uiv", (void*)glad_glColorP4uiv, 2, type, color);
+	glad_glColorP4uiv(type, color);
+	if(_post_call_callback != NULL) _post_call_callback("glColorP4uiv", (void*)glad_glColorP4uiv, 2, type, color);
+}
+PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv = glad_debug_impl_glColorP4uiv;
+static void APIENTRY glad_debug_impl_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColorP3ui", (void*)glad_glSecondaryColorP3ui, 2, type, color);
+	glad_glSecondaryColorP3ui(type, color);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColorP3ui", (void*)glad_glSecondaryColorP3ui, 2, type, color);
+}
+PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui = glad_debug_impl_glSecondaryColorP3ui;
+static void APIENTRY glad_debug_impl_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	if(_pre_call_callback != NULL) _pre_call_callback("glSecondaryColorP3uiv", (void*)glad_glSecondaryColorP3uiv, 2, type, color);
+	glad_glSecondaryColorP3uiv(type, color);
+	if(_post_call_callback != NULL) _post_call_callback("glSecondaryColorP3uiv", (void*)glad_glSecondaryColorP3uiv, 2, type, color);
+}
+PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv = glad_debug_impl_glSecondaryColorP3uiv;
+#endif
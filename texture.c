@@ -0,0 +1,319 @@
+#include "texture.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "glad/glad.h"
+#include "gl_state.h"
+#include "profile.h"
+
+static void
+release_source(struct TextureSlot* slot) {
+	texture_data_free(&slot->data);
+	if (slot->mapping != NULL) {
+		munmap(slot->mapping, slot->mapping_size);
+		slot->mapping = NULL;
+	}
+	memset(slot->levels, 0, sizeof(slot->levels));
+}
+
+//Texture files are used straight from the mapping, anything else is
+//decoded and mipmapped here
+static int
+decode(struct TextureSlot* slot) {
+	int fd = open(slot->path, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "Failed to open %s\n", slot->path);
+		return 0;
+	}
+
+	struct stat file_stat;
+	if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+		close(fd);
+		fprintf(stderr, "Failed to stat %s\n", slot->path);
+		return 0;
+	}
+	size_t size = (size_t) file_stat.st_size;
+
+	unsigned char* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		fprintf(stderr, "Failed to map %s\n", slot->path);
+		return 0;
+	}
+
+	if (texture_file_validate(data, size)) {
+		const struct TextureFileHeader* header = (const struct TextureFileHeader*) data;
+		const struct TextureMip* mips = (const struct TextureMip*) (header + 1);
+		slot->width = header->width;
+		slot->height = header->height;
+		slot->mip_count = header->mip_count;
+		for (uint32_t i = 0; i < header->mip_count; i++) {
+			slot->levels[i] = data + mips[i].offset;
+		}
+		slot->mapping = data;
+		slot->mapping_size = size;
+		//Pages are read ahead while the upload waits for its turn
+		madvise(data, size, MADV_WILLNEED);
+		return 1;
+	}
+
+	int ok = texture_decode_pnm(data, size, &slot->data);
+	munmap(data, size);
+	if (!ok || !texture_generate_mips(&slot->data)) {
+		fprintf(stderr, "Failed to decode %s\n", slot->path);
+		texture_data_free(&slot->data);
+		return 0;
+	}
+
+	slot->width = slot->data.width;
+	slot->height = slot->data.height;
+	slot->mip_count = slot->data.mip_count;
+	for (uint32_t i = 0; i < slot->mip_count; i++) {
+		slot->levels[i] = slot->data.mips[i];
+	}
+	return 1;
+}
+
+static void*
+loader_thread(void* argument) {
+	struct TextureLoader* loader = argument;
+	profile_set_thread_name("texture loader");
+
+	pthread_mutex_lock(&loader->mutex);
+	while (1) {
+		while (!loader->shutting_down && loader->next_queued == loader->count) {
+			pthread_cond_wait(&loader->queued, &loader->mutex);
+		}
+		if (loader->shutting_down) {
+			break;
+		}
+		struct TextureSlot* slot = &loader->slots[loader->next_queued++];
+		pthread_mutex_unlock(&loader->mutex);
+
+		profile_begin("decode texture");
+		enum TextureState state = decode(slot) ? TEXTURE_DECODED : TEXTURE_FAILED;
+		profile_end();
+		//Publishes the levels to the render thread
+		__atomic_store_n(&slot->state, state, __ATOMIC_RELEASE);
+
+		pthread_mutex_lock(&loader->mutex);
+		pthread_cond_broadcast(&loader->decoded);
+	}
+	pthread_mutex_unlock(&loader->mutex);
+
+	return NULL;
+}
+
+struct TextureLoader*
+texture_loader_create(void) {
+	struct TextureLoader* loader = calloc(1, sizeof(*loader));
+	if (loader == NULL) {
+		fprintf(stderr, "Out of memory for the texture loader\n");
+		return NULL;
+	}
+
+	pthread_mutex_init(&loader->mutex, NULL);
+	pthread_cond_init(&loader->queued, NULL);
+	pthread_cond_init(&loader->decoded, NULL);
+	if (pthread_create(&loader->thread, NULL, loader_thread, loader) != 0) {
+		fprintf(stderr, "Failed to start the texture loader\n");
+		pthread_mutex_destroy(&loader->mutex);
+		pthread_cond_destroy(&loader->queued);
+		pthread_cond_destroy(&loader->decoded);
+		free(loader);
+		return NULL;
+	}
+
+	glGenBuffers(1, &loader->pbo);
+	return loader;
+}
+
+void
+texture_loader_destroy(struct TextureLoader* loader) {
+	if (loader == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&loader->mutex);
+	loader->shutting_down = 1;
+	pthread_cond_broadcast(&loader->queued);
+	pthread_mutex_unlock(&loader->mutex);
+	pthread_join(loader->thread, NULL);
+
+	for (int i = 0; i < loader->count; i++) {
+		struct TextureSlot* slot = &loader->slots[i];
+		if (slot->id != 0) {
+			glDeleteTextures(1, &slot->id);
+		}
+		release_source(slot);
+		free(slot->path);
+	}
+	glDeleteBuffers(1, &loader->pbo);
+	//Deleted names can come back from glGen*, the cache must not trust them
+	gl_state_reset();
+
+	pthread_mutex_destroy(&loader->mutex);
+	pthread_cond_destroy(&loader->queued);
+	pthread_cond_destroy(&loader->decoded);
+	free(loader);
+}
+
+int
+texture_load(struct TextureLoader* loader, const char* path) {
+	if (loader->count == TEXTURE_LOADER_MAX) {
+		fprintf(stderr, "Too many textures, not loading %s\n", path);
+		return -1;
+	}
+
+	char* copy = strdup(path);
+	if (copy == NULL) {
+		fprintf(stderr, "Out of memory for %s\n", path);
+		return -1;
+	}
+
+	pthread_mutex_lock(&loader->mutex);
+	int handle = loader->count++;
+	loader->slots[handle] = (struct TextureSlot) {.path = copy, .state = TEXTURE_QUEUED};
+	pthread_cond_signal(&loader->queued);
+	pthread_mutex_unlock(&loader->mutex);
+	return handle;
+}
+
+//Every level is allocated up front, only the uploaded ones are sampled
+static void
+create_texture(struct TextureSlot* slot) {
+	glGenTextures(1, &slot->id);
+	gl_state_bind_texture(0, GL_TEXTURE_2D, slot->id);
+	for (uint32_t level = 0; level < slot->mip_count; level++) {
+		uint32_t width = slot->width >> level ? slot->width >> level : 1;
+		uint32_t height = slot->height >> level ? slot->height >> level : 1;
+		glTexImage2D(GL_TEXTURE_2D, (GLint) level, GL_RGBA8, (GLsizei) width, (GLsizei) height, 0,
+				GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	}
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint) slot->mip_count - 1);
+}
+
+//Copies rows [y, y + rows) of the level into the orphaned PBO,
+//glTexSubImage2D then returns without waiting for the transfer
+static void
+upload_rows(struct TextureLoader* loader, struct TextureSlot* slot, uint32_t level, uint32_t y, uint32_t rows) {
+	uint32_t width = slot->width >> level ? slot->width >> level : 1;
+	size_t row_size = (size_t) width * 4;
+	size_t size = row_size * rows;
+	const unsigned char* source = slot->levels[level] + row_size * y;
+
+	gl_state_bind_texture(0, GL_TEXTURE_2D, slot->id);
+	gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, loader->pbo);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr) size, NULL, GL_STREAM_DRAW);
+	void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr) size,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+
+	const void* pixels = (const void*) 0;
+	if (mapped != NULL) {
+		memcpy(mapped, source, size);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	} else {
+		//Synchronous, but the texture still arrives
+		gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		pixels = source;
+	}
+	glTexSubImage2D(GL_TEXTURE_2D, (GLint) level, 0, (GLint) y, (GLsizei) width, (GLsizei) rows,
+			GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+	loader->bytes_uploaded += size;
+}
+
+void
+texture_loader_update(struct TextureLoader* loader, size_t budget) {
+	size_t sent = 0;
+	int uploaded_any = 0;
+
+	for (int i = 0; i < loader->count; i++) {
+		struct TextureSlot* slot = &loader->slots[i];
+		if (__atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) != TEXTURE_DECODED) {
+			continue;
+		}
+		if (slot->id == 0) {
+			gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			create_texture(slot);
+		}
+
+		while (slot->uploaded < slot->mip_count) {
+			uint32_t level = slot->mip_count - 1 - slot->uploaded;
+			uint32_t width = slot->width >> level ? slot->width >> level : 1;
+			uint32_t height = slot->height >> level ? slot->height >> level : 1;
+			size_t row_size = (size_t) width * 4;
+
+			//As many rows as the budget has room for, one when it is spent
+			//so a single row wider than the budget still gets through
+			uint32_t rows = height - slot->uploaded_rows;
+			size_t room = sent < budget ? budget - sent : 0;
+			if (rows > room / row_size) {
+				rows = (uint32_t) (room / row_size);
+			}
+			if (rows == 0) {
+				if (uploaded_any) {
+					break;
+				}
+				rows = 1;
+			}
+
+			upload_rows(loader, slot, level, slot->uploaded_rows, rows);
+			slot->uploaded_rows += rows;
+			sent += row_size * rows;
+			uploaded_any = 1;
+
+			if (slot->uploaded_rows == height) {
+				//Sampling starts at a level only once all of it is in
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, (GLint) level);
+				slot->uploaded++;
+				slot->uploaded_rows = 0;
+			}
+		}
+
+		if (slot->uploaded == slot->mip_count) {
+			release_source(slot);
+			slot->state = TEXTURE_READY;
+		} else {
+			break;
+		}
+	}
+
+	//Client memory pointers would be taken as PBO offsets otherwise
+	if (uploaded_any) {
+		gl_state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+}
+
+void
+texture_loader_finish(struct TextureLoader* loader) {
+	pthread_mutex_lock(&loader->mutex);
+	for (int i = 0; i < loader->count; i++) {
+		//The thread takes the mutex after publishing, so no wakeup is missed
+		while (__atomic_load_n(&loader->slots[i].state, __ATOMIC_ACQUIRE) == TEXTURE_QUEUED) {
+			pthread_cond_wait(&loader->decoded, &loader->mutex);
+		}
+	}
+	pthread_mutex_unlock(&loader->mutex);
+
+	texture_loader_update(loader, SIZE_MAX);
+}
+
+unsigned int
+texture_get(const struct TextureLoader* loader, int handle) {
+	if (handle < 0 || handle >= loader->count) {
+		return 0;
+	}
+	const struct TextureSlot* slot = &loader->slots[handle];
+	return slot->uploaded > 0 ? slot->id : 0;
+}
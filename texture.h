@@ -0,0 +1,85 @@
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "texture_format.h"
+
+//Loads textures without stalling the frame. A background thread maps each
+//file and, unless it already is a texture file, decodes it and builds the
+//mips. The render thread then streams the levels into GL through a pixel
+//buffer object, coarsest first and within a per frame byte budget, so the
+//copy to the GPU happens asynchronously and a texture can be drawn at low
+//resolution while the rest arrives. Levels larger than the budget go up in
+//bands of rows over several frames.
+
+#define TEXTURE_LOADER_MAX 256
+
+enum TextureState {
+	TEXTURE_QUEUED,
+	TEXTURE_DECODED,
+	TEXTURE_READY,
+	TEXTURE_FAILED
+};
+
+struct TextureSlot {
+	char* path;
+	//Written by the loader thread once decoding is done
+	enum TextureState state;
+
+	//Levels to upload, pointing into data or into the mapped file
+	const unsigned char* levels[TEXTURE_MAX_MIPS];
+	uint32_t width;
+	uint32_t height;
+	uint32_t mip_count;
+	struct TextureData data;
+	void* mapping;
+	size_t mapping_size;
+
+	unsigned int id;
+	//Levels already in GL, counted from the coarsest
+	uint32_t uploaded;
+	//Rows of the next level already in GL
+	uint32_t uploaded_rows;
+};
+
+struct TextureLoader {
+	struct TextureSlot slots[TEXTURE_LOADER_MAX];
+	int count;
+
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t queued;
+	//Signalled after every decode
+	pthread_cond_t decoded;
+	//Slots before next_queued have been taken by the thread
+	int next_queued;
+	int shutting_down;
+
+	unsigned int pbo;
+	unsigned long bytes_uploaded;
+};
+
+//Starts the loader thread. Returns NULL on failure.
+struct TextureLoader* texture_loader_create(void);
+//Waits for the current decode, then deletes every texture
+void texture_loader_destroy(struct TextureLoader* loader);
+
+//Queues path, returns a handle or -1 when the loader is full
+int texture_load(struct TextureLoader* loader, const char* path);
+
+//Uploads decoded levels until budget bytes went out, at least one row per
+//frame so the queue always moves. Needs the GL context.
+void texture_loader_update(struct TextureLoader* loader, size_t budget);
+
+//Waits for every queued texture to decode, then uploads all of it. Makes
+//scripted runs independent of how fast the loader thread was.
+void texture_loader_finish(struct TextureLoader* loader);
+
+//GL texture name once at least its coarsest level is uploaded, 0 before
+//that and for failed loads
+unsigned int texture_get(const struct TextureLoader* loader, int handle);
+
+#endif
@@ -0,0 +1,224 @@
+#include "texture_format.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void
+texture_data_free(struct TextureData* texture) {
+	for (uint32_t i = 0; i < texture->mip_count; i++) {
+		free(texture->mips[i]);
+	}
+	*texture = (struct TextureData) {0};
+}
+
+uint32_t
+texture_mip_width(const struct TextureData* texture, uint32_t level) {
+	uint32_t width = texture->width >> level;
+	return width ? width : 1;
+}
+
+uint32_t
+texture_mip_height(const struct TextureData* texture, uint32_t level) {
+	uint32_t height = texture->height >> level;
+	return height ? height : 1;
+}
+
+//Skips whitespace and # comments, then reads a decimal number
+static int
+pnm_number(const unsigned char* data, size_t size, size_t* at, uint32_t* value) {
+	while (*at < size) {
+		if (data[*at] == '#') {
+			while (*at < size && data[*at] != '\n') {
+				(*at)++;
+			}
+		} else if (data[*at] == ' ' || data[*at] == '\t' || data[*at] == '\r' || data[*at] == '\n') {
+			(*at)++;
+		} else {
+			break;
+		}
+	}
+
+	uint32_t number = 0;
+	size_t start = *at;
+	while (*at < size && data[*at] >= '0' && data[*at] <= '9' && *at - start < 9) {
+		number = number * 10 + (uint32_t) (data[*at] - '0');
+		(*at)++;
+	}
+	*value = number;
+	return *at > start;
+}
+
+int
+texture_decode_pnm(const unsigned char* data, size_t size, struct TextureData* texture) {
+	*texture = (struct TextureData) {0};
+	if (size < 2 || data[0] != 'P' || (data[1] != '5' && data[1] != '6')) {
+		fprintf(stderr, "Not a binary PPM or PGM image\n");
+		return 0;
+	}
+	uint32_t channels = data[1] == '6' ? 3 : 1;
+
+	size_t at = 2;
+	uint32_t width, height, max_value;
+	if (!pnm_number(data, size, &at, &width) || !pnm_number(data, size, &at, &height) ||
+			!pnm_number(data, size, &at, &max_value) || at >= size) {
+		fprintf(stderr, "Bad PNM header\n");
+		return 0;
+	}
+	//Exactly one whitespace byte separates the header from the samples
+	at++;
+
+	if (width == 0 || height == 0 || width > (1u << (TEXTURE_MAX_MIPS - 1)) ||
+			height > (1u << (TEXTURE_MAX_MIPS - 1)) || max_value == 0 || max_value > 255) {
+		fprintf(stderr, "Unsupported PNM image %ux%u, max %u\n", width, height, max_value);
+		return 0;
+	}
+	size_t pixels = (size_t) width * height;
+	if (size - at < pixels * channels) {
+		fprintf(stderr, "PNM image is truncated\n");
+		return 0;
+	}
+
+	unsigned char* rgba = malloc(pixels * 4);
+	if (rgba == NULL) {
+		fprintf(stderr, "Out of memory for a %ux%u image\n", width, height);
+		return 0;
+	}
+
+	//PNM stores the top row first, GL expects the bottom row first
+	const unsigned char* samples = data + at;
+	for (uint32_t y = 0; y < height; y++) {
+		const unsigned char* source = samples + (size_t) (height - 1 - y) * width * channels;
+		unsigned char* destination = rgba + (size_t) y * width * 4;
+		for (uint32_t x = 0; x < width; x++) {
+			for (uint32_t c = 0; c < 3; c++) {
+				uint32_t value = source[x * channels + (channels == 3 ? c : 0)];
+				destination[x * 4 + c] = (unsigned char) ((value * 255 + max_value / 2) / max_value);
+			}
+			destination[x * 4 + 3] = 255;
+		}
+	}
+
+	texture->mips[0] = rgba;
+	texture->width = width;
+	texture->height = height;
+	texture->mip_count = 1;
+	return 1;
+}
+
+int
+texture_generate_mips(struct TextureData* texture) {
+	while (texture->mip_count > 1) {
+		free(texture->mips[--texture->mip_count]);
+		texture->mips[texture->mip_count] = NULL;
+	}
+
+	uint32_t level = 0;
+	while (texture_mip_width(texture, level) > 1 || texture_mip_height(texture, level) > 1) {
+		uint32_t source_width = texture_mip_width(texture, level);
+		uint32_t source_height = texture_mip_height(texture, level);
+		uint32_t width = texture_mip_width(texture, level + 1);
+		uint32_t height = texture_mip_height(texture, level + 1);
+
+		unsigned char* mip = malloc((size_t) width * height * 4);
+		if (mip == NULL) {
+			return 0;
+		}
+
+		//A 1 texel wide side averages the same texel twice
+		const unsigned char* source = texture->mips[level];
+		for (uint32_t y = 0; y < height; y++) {
+			uint32_t y0 = y * 2;
+			uint32_t y1 = y0 + 1 < source_height ? y0 + 1 : y0;
+			for (uint32_t x = 0; x < width; x++) {
+				uint32_t x0 = x * 2;
+				uint32_t x1 = x0 + 1 < source_width ? x0 + 1 : x0;
+				for (uint32_t c = 0; c < 4; c++) {
+					uint32_t sum = source[((size_t) y0 * source_width + x0) * 4 + c] +
+						source[((size_t) y0 * source_width + x1) * 4 + c] +
+						source[((size_t) y1 * source_width + x0) * 4 + c] +
+						source[((size_t) y1 * source_width + x1) * 4 + c];
+					mip[((size_t) y * width + x) * 4 + c] = (unsigned char) ((sum + 2) / 4);
+				}
+			}
+		}
+
+		texture->mips[++level] = mip;
+		texture->mip_count = level + 1;
+	}
+	return 1;
+}
+
+int
+texture_write(const char* path, const struct TextureData* texture) {
+	if (texture->mip_count == 0 || texture->mip_count > TEXTURE_MAX_MIPS) {
+		fprintf(stderr, "Nothing to write to %s\n", path);
+		return 0;
+	}
+
+	struct TextureFileHeader header = {
+		.magic = TEXTURE_FILE_MAGIC,
+		.version = TEXTURE_FILE_VERSION,
+		.format = TEXTURE_RGBA8,
+		.width = texture->width,
+		.height = texture->height,
+		.mip_count = texture->mip_count
+	};
+
+	//RGBA8 levels are whole multiples of 4 bytes and so stay aligned
+	struct TextureMip mips[TEXTURE_MAX_MIPS];
+	uint64_t offset = sizeof(header) + texture->mip_count * sizeof(struct TextureMip);
+	for (uint32_t i = 0; i < texture->mip_count; i++) {
+		uint32_t width = texture_mip_width(texture, i);
+		uint32_t height = texture_mip_height(texture, i);
+		mips[i] = (struct TextureMip) {offset, width * height * 4, width, height, 0};
+		offset += mips[i].size;
+	}
+
+	FILE* file = fopen(path, "wb");
+	if (file == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return 0;
+	}
+
+	int ok = fwrite(&header, sizeof(header), 1, file) == 1;
+	ok = ok && fwrite(mips, sizeof(struct TextureMip), texture->mip_count, file) == texture->mip_count;
+	for (uint32_t i = 0; ok && i < texture->mip_count; i++) {
+		ok = fwrite(texture->mips[i], mips[i].size, 1, file) == 1;
+	}
+
+	ok &= fclose(file) == 0;
+	if (!ok) {
+		fprintf(stderr, "Failed to write %s\n", path);
+	}
+	return ok;
+}
+
+int
+texture_file_validate(const unsigned char* data, size_t size) {
+	const struct TextureFileHeader* header = (const struct TextureFileHeader*) data;
+	if (size < sizeof(*header) || header->magic != TEXTURE_FILE_MAGIC ||
+			header->version != TEXTURE_FILE_VERSION || header->format != TEXTURE_RGBA8) {
+		return 0;
+	}
+	if (header->width == 0 || header->height == 0 || header->width > (1u << (TEXTURE_MAX_MIPS - 1)) ||
+			header->height > (1u << (TEXTURE_MAX_MIPS - 1))) {
+		return 0;
+	}
+	if (header->mip_count == 0 || header->mip_count > TEXTURE_MAX_MIPS ||
+			sizeof(*header) + header->mip_count * sizeof(struct TextureMip) > size) {
+		return 0;
+	}
+
+	const struct TextureMip* mips = (const struct TextureMip*) (header + 1);
+	for (uint32_t i = 0; i < header->mip_count; i++) {
+		uint32_t width = header->width >> i ? header->width >> i : 1;
+		uint32_t height = header->height >> i ? header->height >> i : 1;
+		if (mips[i].width != width || mips[i].height != height ||
+				(uint64_t) mips[i].size != (uint64_t) width * height * 4 ||
+				mips[i].offset % 4 != 0 || mips[i].offset > size || size - mips[i].offset < mips[i].size) {
+			return 0;
+		}
+	}
+	return 1;
+}
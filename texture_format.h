@@ -0,0 +1,70 @@
+#ifndef TEXTURE_FORMAT_H
+#define TEXTURE_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//Binary texture file, little endian, with every mip level stored ready for
+//glTexSubImage2D so loading is a map and a copy, no decoding:
+//
+//  TextureFileHeader
+//  TextureMip      mip_count entries, finest first
+//  level data      at each mip's offset, 4 byte aligned
+//
+//Only RGBA8 so far. Sources are decoded and mipmapped offline by
+//tools/img2tex, or at load time on the texture loader's thread.
+
+#define TEXTURE_FILE_MAGIC 0x58545645u /* "EVTX" */
+#define TEXTURE_FILE_VERSION 1
+//Enough for 16384 x 16384, which keeps every level under 4 GB
+#define TEXTURE_MAX_MIPS 15
+
+enum TextureFormat {
+	TEXTURE_RGBA8 = 1
+};
+
+struct TextureFileHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t format;
+	uint32_t width;
+	uint32_t height;
+	uint32_t mip_count;
+};
+
+struct TextureMip {
+	uint64_t offset;
+	uint32_t size;
+	uint32_t width;
+	uint32_t height;
+	uint32_t reserved;
+};
+
+//Decoded RGBA8 image, mips[0] is the full size level
+struct TextureData {
+	unsigned char* mips[TEXTURE_MAX_MIPS];
+	uint32_t width;
+	uint32_t height;
+	uint32_t mip_count;
+};
+
+void texture_data_free(struct TextureData* texture);
+
+uint32_t texture_mip_width(const struct TextureData* texture, uint32_t level);
+uint32_t texture_mip_height(const struct TextureData* texture, uint32_t level);
+
+//Binary PPM (P6) or PGM (P5) with 8-bit samples into mip 0. There is no
+//image library in the tree, anything else has to be converted first.
+//Returns 0 and prints the reason on failure.
+int texture_decode_pnm(const unsigned char* data, size_t size, struct TextureData* texture);
+
+//Box filters mip 0 down to 1x1, returns 0 when out of memory
+int texture_generate_mips(struct TextureData* texture);
+
+//Returns 0 and prints the reason on failure
+int texture_write(const char* path, const struct TextureData* texture);
+
+//Checks a mapped file's header and mip table against its size
+int texture_file_validate(const unsigned char* data, size_t size);
+
+#endif
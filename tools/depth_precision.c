@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <math.h>
+
+#include "every_math.h"
+
+//Prints the smallest eye-space depth difference the depth buffer can
+//resolve at a range of distances, for the classic projection into a
+//24-bit buffer and the reversed-Z infinite projection into float32.
+//Exits with 1 if reversed-Z into [0, 1] loses relative precision.
+
+enum DepthStorage {
+	DEPTH_UNORM24,
+	DEPTH_FLOAT32
+};
+
+static double
+window_depth(Matrix4 m, double distance, int zero_to_one) {
+	double z_clip = m.e[10] * -distance + m.e[11];
+	double w_clip = m.e[14] * -distance + m.e[15];
+	double ndc = z_clip / w_clip;
+	return zero_to_one ? ndc : ndc * 0.5 + 0.5;
+}
+
+static double
+depth_quantum(double depth, enum DepthStorage storage, int zero_to_one) {
+	if (storage == DEPTH_UNORM24) {
+		return 1.0 / 16777215.0;
+	}
+
+	float stored = (float) depth;
+	double quantum = fabs((double) nextafterf(stored, 0.0f) - stored);
+	if (!zero_to_one) {
+		//The [-1, 1] ndc is rounded before the 0.5 * ndc + 0.5 remap
+		float ndc = (float) (depth * 2.0 - 1.0);
+		double ndc_quantum = 0.5 * fabs((double) nextafterf(ndc, 0.0f) - ndc);
+		quantum = fmax(quantum, ndc_quantum);
+	}
+	return quantum;
+}
+
+static double
+resolvable_distance(Matrix4 m, double distance, enum DepthStorage storage, int zero_to_one) {
+	double h = distance * 1e-6;
+	double slope = (window_depth(m, distance + h, zero_to_one) -
+			window_depth(m, distance - h, zero_to_one)) / (2.0 * h);
+	double depth = window_depth(m, distance, zero_to_one);
+	return depth_quantum(depth, storage, zero_to_one) / fabs(slope);
+}
+
+int
+main() {
+	double fov = TO_RAD(45.0);
+	double aspect_ratio = 16.0 / 9.0;
+	double far_plane = 100000.0;
+	double near_plane = 0.1;
+
+	Matrix4 classic = perspective_matrix(fov, aspect_ratio, far_plane);
+	Matrix4 reversed_01 = perspective_reversed_infinite(fov, aspect_ratio, near_plane, 1);
+	Matrix4 reversed_11 = perspective_reversed_infinite(fov, aspect_ratio, near_plane, 0);
+
+	double distances[] = {1, 10, 100, 1000, 10000, 50000};
+	int count = sizeof(distances) / sizeof(distances[0]);
+
+	int failed = 0;
+	printf("%10s %18s %18s %18s\n", "distance", "classic unorm24", "reversed [0,1]", "reversed [-1,1]");
+	for (int i = 0; i < count; i++) {
+		double d = distances[i];
+		double classic_step = resolvable_distance(classic, d, DEPTH_UNORM24, 0);
+		double reversed_01_step = resolvable_distance(reversed_01, d, DEPTH_FLOAT32, 1);
+		double reversed_11_step = resolvable_distance(reversed_11, d, DEPTH_FLOAT32, 0);
+		printf("%10.0f %18.6g %18.6g %18.6g\n", d, classic_step, reversed_01_step, reversed_11_step);
+
+		if (reversed_01_step / d > 1e-6) {
+			fprintf(stderr, "reversed-Z relative precision %g at %g\n", reversed_01_step / d, d);
+			failed = 1;
+		}
+	}
+
+	return failed;
+}
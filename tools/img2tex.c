@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "texture_format.h"
+
+//Reads the whole file, the decoder wants it in one piece
+static unsigned char*
+read_file(const char* path, size_t* size) {
+	FILE* file = fopen(path, "rb");
+	if (file == NULL) {
+		fprintf(stderr, "Failed to open %s\n", path);
+		return NULL;
+	}
+
+	unsigned char* data = NULL;
+	long length = -1;
+	if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 0 && fseek(file, 0, SEEK_SET) == 0) {
+		data = malloc((size_t) length);
+	}
+	if (data == NULL || fread(data, (size_t) length, 1, file) != 1) {
+		fprintf(stderr, "Failed to read %s\n", path);
+		free(data);
+		data = NULL;
+	}
+	fclose(file);
+
+	*size = (size_t) length;
+	return data;
+}
+
+int
+main(int argc, char** argv) {
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s input.ppm output.tex\n", argv[0]);
+		return 1;
+	}
+
+	size_t size;
+	unsigned char* data = read_file(argv[1], &size);
+	if (data == NULL) {
+		return 1;
+	}
+
+	struct TextureData texture;
+	int ok = texture_decode_pnm(data, size, &texture);
+	free(data);
+	if (!ok) {
+		return 1;
+	}
+	if (!texture_generate_mips(&texture)) {
+		fprintf(stderr, "Out of memory while building mips\n");
+		texture_data_free(&texture);
+		return 1;
+	}
+
+	size_t total = 0;
+	for (uint32_t i = 0; i < texture.mip_count; i++) {
+		total += (size_t) texture_mip_width(&texture, i) * texture_mip_height(&texture, i) * 4;
+	}
+	printf("%ux%u, %u mips, %.1f KB\n", texture.width, texture.height, texture.mip_count, total / 1024.0);
+
+	ok = texture_write(argv[2], &texture);
+	texture_data_free(&texture);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "obj.h"
+#include "jobs.h"
+#include "mesh_format.h"
+#include "mesh_optimize.h"
+#include "mesh_simplify.h"
+
+#define LOD_COUNT 4
+//Each LOD aims for half the triangles of the one before
+#define LOD_REDUCTION 0.5f
+//Give up on a LOD that moves the surface further than this fraction of
+//the bounding box diagonal
+#define LOD_MAX_RELATIVE_ERROR 0.05f
+
+//Appends simplified index ranges behind the finest level until the chain
+//is full or the simplifier stops making progress
+static int
+build_lods(struct MeshData* mesh) {
+	uint32_t base_count = mesh->index_count;
+	size_t capacity = (size_t) base_count * 2;
+	uint32_t* indices = malloc(capacity * sizeof(uint32_t));
+	if (indices == NULL) {
+		return 0;
+	}
+	memcpy(indices, mesh->indices, (size_t) base_count * sizeof(uint32_t));
+
+	float min[3], max[3];
+	mesh_data_bounds(mesh, min, max);
+	float diagonal = sqrtf((max[0] - min[0]) * (max[0] - min[0]) +
+			(max[1] - min[1]) * (max[1] - min[1]) + (max[2] - min[2]) * (max[2] - min[2]));
+
+	mesh->lods[0] = (struct MeshLod) {0, base_count, 0.0f, 0};
+	mesh->lod_count = 1;
+	uint32_t total = base_count;
+
+	while (mesh->lod_count < LOD_COUNT) {
+		struct MeshLod previous = mesh->lods[mesh->lod_count - 1];
+		uint32_t target = (uint32_t) (previous.index_count * LOD_REDUCTION) / 3 * 3;
+		if (target < 3 * 16) break;
+
+		//The simplifier starts from a full copy of the previous level
+		if (total + (size_t) previous.index_count > capacity) {
+			capacity = (total + (size_t) previous.index_count) * 2;
+			uint32_t* grown = realloc(indices, capacity * sizeof(uint32_t));
+			if (grown == NULL) {
+				free(indices);
+				return 0;
+			}
+			indices = grown;
+		}
+
+		float error = 0.0f;
+		uint32_t count = mesh_simplify(indices + total, indices + previous.index_offset,
+				previous.index_count, mesh->positions, mesh->vertex_count,
+				target, diagonal * LOD_MAX_RELATIVE_ERROR, &error);
+		if (count == 0 || count > previous.index_count * 0.8f) {
+			break;
+		}
+
+		if (!mesh_optimize_vertex_cache(indices + total, count, mesh->vertex_count)) {
+			free(indices);
+			return 0;
+		}
+
+		mesh->lods[mesh->lod_count++] = (struct MeshLod) {total, count, previous.error + error, 0};
+		total += count;
+	}
+
+	free(mesh->indices);
+	mesh->indices = indices;
+	mesh->index_count = total;
+	return 1;
+}
+
+static int
+parse_format(const char* name, enum MeshVertexFormat* format) {
+	if (strcmp(name, "quantized") == 0) {
+		*format = MESH_VERTEX_QUANTIZED;
+	} else if (strcmp(name, "octahedral") == 0) {
+		*format = MESH_VERTEX_OCTAHEDRAL;
+	} else if (strcmp(name, "packed") == 0) {
+		*format = MESH_VERTEX_PACKED;
+	} else {
+		return 0;
+	}
+	return 1;
+}
+
+int
+main(int argc, char** argv) {
+	enum MeshVertexFormat format = MESH_VERTEX_OCTAHEDRAL;
+	if (argc == 5 && strcmp(argv[1], "-f") == 0 && parse_format(argv[2], &format)) {
+		argv += 2;
+		argc -= 2;
+	}
+
+	if (argc != 3) {
+		fprintf(stderr, "usage: %s [-f quantized|octahedral|packed] input.obj output.mesh\n", argv[0]);
+		return 1;
+	}
+
+	jobs_init(0);
+
+	struct MeshData mesh = {0};
+	struct ObjStats stats = {0};
+	if (!obj_load(argv[1], &mesh, &stats)) {
+		jobs_shutdown();
+		return 1;
+	}
+
+	double megabytes = stats.bytes / (1024.0 * 1024.0);
+	printf("%s: %.1f MB in %.3f s (%.1f MB/s, %d threads)\n", argv[1], megabytes,
+			stats.seconds, stats.seconds > 0 ? megabytes / stats.seconds : 0.0, jobs_concurrency());
+
+	float acmr_before = mesh_acmr(mesh.indices, mesh.index_count, mesh.vertex_count, 16);
+	int ok = mesh_optimize_vertex_cache(mesh.indices, mesh.index_count, mesh.vertex_count) &&
+		mesh_optimize_overdraw(mesh.indices, mesh.index_count, mesh.positions, mesh.vertex_count, 1.05f) &&
+		build_lods(&mesh) &&
+		mesh_optimize_vertex_fetch(&mesh);
+	if (!ok) {
+		fprintf(stderr, "Out of memory while optimizing\n");
+		mesh_data_free(&mesh);
+		jobs_shutdown();
+		return 1;
+	}
+	float acmr_after = mesh_acmr(mesh.indices, mesh.lods[0].index_count, mesh.vertex_count, 16);
+	printf("ACMR (16 entry FIFO): %.3f -> %.3f\n", acmr_before, acmr_after);
+
+	for (uint32_t i = 0; i < mesh.lod_count; i++) {
+		printf("LOD %u: %u triangles, error %g\n", i, mesh.lods[i].index_count / 3, mesh.lods[i].error);
+	}
+
+	ok = mesh_write(argv[2], &mesh, format);
+	if (ok) {
+		printf("%s: %u vertices, %u triangles, %u bytes per vertex\n", argv[2],
+				mesh.vertex_count, mesh.lods[0].index_count / 3, mesh_vertex_stride(format));
+	}
+
+	mesh_data_free(&mesh);
+	jobs_shutdown();
+	return ok ? 0 : 1;
+}
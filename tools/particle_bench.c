@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "particles.h"
+#include "jobs.h"
+
+//Simulates a million particles at a fixed 60 Hz step, refilling the dead
+//ones every frame, and writes the instance stream into plain memory as a
+//stand-in for the mapped VBO. Exits with 1 if the average frame does not
+//fit in the 60 Hz budget.
+
+#define PARTICLE_COUNT (1 << 20)
+#define FRAMES 600
+#define FRAME_BUDGET_MS (1000.0 / 60.0)
+
+static uint32_t random_state = 0x9e3779b9u;
+
+static float
+random_signed(void) {
+	random_state ^= random_state << 13;
+	random_state ^= random_state >> 17;
+	random_state ^= random_state << 5;
+	return (float) (random_state >> 8) / (float) (1 << 23) - 1.0f;
+}
+
+static double
+now_ms(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec * 1000.0 + time.tv_nsec / 1e6;
+}
+
+static void
+refill(struct Particles* particles) {
+	Vector3 origin = {{0, 0, 0}};
+	while (particles->count < particles->capacity) {
+		Vector3 velocity = {{random_signed(), 4.0f + random_signed(), random_signed()}};
+		particles_emit(particles, origin, velocity, 2.0f + random_signed());
+	}
+}
+
+int
+main(int argc, char** argv) {
+	int threads = argc > 1 ? atoi(argv[1]) : 0;
+	jobs_init(threads);
+
+	struct Particles particles = particles_create(PARTICLE_COUNT);
+	float* instances = malloc((size_t) PARTICLE_COUNT * PARTICLE_INSTANCE_FLOATS * sizeof(float));
+	if (particles.capacity == 0 || instances == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+
+	Vector3 gravity = {{0, -9.81f, 0}};
+	float dt = 1.0f / 60.0f;
+	double update_total = 0.0;
+	double update_worst = 0.0;
+	unsigned long simulated = 0;
+
+	refill(&particles);
+	for (int frame = 0; frame < FRAMES; frame++) {
+		simulated += particles.count;
+		double start = now_ms();
+		particles_update(&particles, dt, gravity, instances);
+		double elapsed = now_ms() - start;
+
+		update_total += elapsed;
+		if (elapsed > update_worst) update_worst = elapsed;
+		refill(&particles);
+	}
+
+	double average = update_total / FRAMES;
+	printf("%d threads, %d particles\n", jobs_concurrency(), PARTICLE_COUNT);
+	printf("update: %.3f ms average, %.3f ms worst, %.1f M particles/s\n",
+		average, update_worst, simulated / (update_total * 1000.0));
+
+	free(instances);
+	particles_free(&particles);
+	jobs_shutdown();
+
+	if (average > FRAME_BUDGET_MS) {
+		fprintf(stderr, "Average update exceeds the %.2f ms frame budget\n", FRAME_BUDGET_MS);
+		return 1;
+	}
+	return 0;
+}